@@ -0,0 +1,68 @@
+/**
+ * @file DistributionCounter.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_DISTRIBUTION_COUNTER_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_DISTRIBUTION_COUNTER_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * DistributionCounter stores a sample per iteration and reports the distribution of the samples as
+ * benchmark counters. Given the name of the counter `<name>`, the counters `<name>_p50`,
+ * `<name>_p99` and `<name>_max` contain the median, the 99th percentile and the maximum of the
+ * samples. The percentiles are computed with the nearest-rank method.
+ * @note Google Benchmark reports only the average time per iteration, the tails of the distribution
+ * are relevant for the components running in a control loop.
+ */
+class DistributionCounter
+{
+public:
+    /**
+     * Constructor.
+     * @param name name of the counter.
+     * @param numberOfSamples number of samples allocated in advance. Use State::max_iterations to
+     * avoid allocating memory while the benchmark is running.
+     */
+    DistributionCounter(const std::string& name, std::size_t numberOfSamples = 0);
+
+    /**
+     * Add a sample.
+     * @param sample value of the sample.
+     */
+    void add(double sample);
+
+    /**
+     * Add a duration.
+     * @param duration the duration. It is stored in seconds.
+     */
+    void add(const std::chrono::nanoseconds& duration);
+
+    /**
+     * Add the counters to the benchmark state.
+     * @param state state of the benchmark.
+     * @note The counters are not added if no sample has been stored.
+     */
+    void setCounters(benchmark::State& state) const;
+
+private:
+    std::string m_name; /**< Name of the counter. */
+    std::vector<double> m_samples; /**< Samples stored. */
+};
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_DISTRIBUTION_COUNTER_H
@@ -0,0 +1,47 @@
+/**
+ * @file LinearTaskSolverTimingsCounter.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_LINEAR_TASK_SOLVER_TIMINGS_COUNTER_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_LINEAR_TASK_SOLVER_TIMINGS_COUNTER_H
+
+#include <benchmark/benchmark.h>
+
+#include <BipedalLocomotion/System/ILinearTaskSolver.h>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * LinearTaskSolverTimingsCounter accumulates the System::LinearTaskSolverTimings returned by a
+ * System::ILinearTaskSolver after each advance and reports them as benchmark counters. The counters
+ * `tasks_update`, `problem_assembly` and `problem_solution` contain the average duration, in
+ * seconds, of each phase per iteration.
+ */
+class LinearTaskSolverTimingsCounter
+{
+public:
+    /**
+     * Add the timings of the last advance.
+     * @param timings timings returned by System::ILinearTaskSolver::getTimings.
+     */
+    void add(const System::LinearTaskSolverTimings& timings);
+
+    /**
+     * Add the counters to the benchmark state.
+     * @param state state of the benchmark.
+     */
+    void setCounters(benchmark::State& state) const;
+
+private:
+    System::LinearTaskSolverTimings m_timings; /**< Sum of the timings. */
+};
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_LINEAR_TASK_SOLVER_TIMINGS_COUNTER_H
@@ -0,0 +1,80 @@
+/**
+ * @file MemoryOperationsCounter.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_MEMORY_OPERATIONS_COUNTER_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_MEMORY_OPERATIONS_COUNTER_H
+
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * MemoryOperationsCounter counts the dynamic memory operations (malloc, calloc, realloc, memalign
+ * and free) performed in a portion of a benchmark. It relies on TestUtils::MemoryAllocationMonitor,
+ * hence the operations are counted only if the benchmark runs with the
+ * `MemoryAllocationMonitorPreload` library loaded through `LD_PRELOAD`. This is done automatically
+ * by the `run_<name>Benchmark` targets when `FRAMEWORK_RUN_MemoryAllocationMonitor_benchmarks` is
+ * enabled.
+ * @code{.cpp}
+ * MemoryOperationsCounter counter;
+ * for (auto _ : state)
+ * {
+ *     counter.start();
+ *     solver.advance();
+ *     counter.stop();
+ * }
+ * counter.setCounter(state);
+ * @endcode
+ */
+class MemoryOperationsCounter
+{
+public:
+    /**
+     * Check if the dynamic memory operations are actually counted.
+     * @return true if the memory functions of the standard library are intercepted by the monitor.
+     */
+    static bool isEnabled();
+
+    /**
+     * Start counting the memory operations.
+     */
+    void start();
+
+    /**
+     * Stop counting the memory operations. The operations counted since the last call of
+     * MemoryOperationsCounter::start are added to the total number of operations.
+     */
+    void stop();
+
+    /**
+     * Get the total number of memory operations counted so far.
+     * @return the number of memory operations.
+     */
+    std::int64_t getNumberOfOperations() const;
+
+    /**
+     * Add to the benchmark state a counter containing the average number of memory operations per
+     * iteration. If the counter is not enabled nothing is added, so that the reports do not contain
+     * misleading zeros.
+     * @param state state of the benchmark.
+     * @param name name of the counter.
+     */
+    void setCounter(benchmark::State& state, const std::string& name = "memory_operations") const;
+
+private:
+    std::int64_t m_numberOfOperations{0}; /**< Number of memory operations counted so far. */
+};
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_MEMORY_OPERATIONS_COUNTER_H
@@ -0,0 +1,44 @@
+/**
+ * @file RandomModel.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_RANDOM_MODEL_H
+#define BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_RANDOM_MODEL_H
+
+#include <cstddef>
+
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/Model.h>
+
+namespace BipedalLocomotion
+{
+namespace BenchmarkUtils
+{
+
+/**
+ * Create a random kinematic tree containing only revolute joints.
+ * @param numberOfJoints number of joints of the tree.
+ * @param numberOfAdditionalFrames number of additional frames attached to random links.
+ * @param seed seed of the random generator. The same arguments always give the same model, so that
+ * the results of different runs of a benchmark can be compared.
+ * @return the model. The link `link<i>` is the child of the joint `i`.
+ */
+iDynTree::Model getRandomKinematicTree(std::size_t numberOfJoints,
+                                       std::size_t numberOfAdditionalFrames = 10,
+                                       unsigned int seed = 42);
+
+/**
+ * Set a random joint configuration in a KinDynComputations object. The base is placed in the
+ * origin, the velocities are zero and the gravity is directed along the negative z-axis.
+ * @param kinDyn KinDynComputations object containing the model.
+ * @param seed seed of the random generator.
+ * @return true in case of success, false otherwise.
+ */
+bool setRandomRobotState(iDynTree::KinDynComputations& kinDyn, unsigned int seed = 42);
+
+} // namespace BenchmarkUtils
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARK_UTILS_RANDOM_MODEL_H
@@ -0,0 +1,49 @@
+/**
+ * @file DistributionCounter.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <BipedalLocomotion/BenchmarkUtils/DistributionCounter.h>
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+
+DistributionCounter::DistributionCounter(const std::string& name, std::size_t numberOfSamples)
+    : m_name(name)
+{
+    m_samples.reserve(numberOfSamples);
+}
+
+void DistributionCounter::add(double sample)
+{
+    m_samples.push_back(sample);
+}
+
+void DistributionCounter::add(const std::chrono::nanoseconds& duration)
+{
+    this->add(std::chrono::duration<double>(duration).count());
+}
+
+void DistributionCounter::setCounters(benchmark::State& state) const
+{
+    if (m_samples.empty())
+    {
+        return;
+    }
+
+    std::vector<double> sortedSamples = m_samples;
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+
+    // nearest-rank method
+    auto percentile = [&sortedSamples](double p) {
+        const std::size_t rank = std::ceil(p * sortedSamples.size());
+        return sortedSamples[std::max<std::size_t>(rank, 1) - 1];
+    };
+
+    state.counters[m_name + "_p50"] = percentile(0.5);
+    state.counters[m_name + "_p99"] = percentile(0.99);
+    state.counters[m_name + "_max"] = sortedSamples.back();
+}
@@ -0,0 +1,34 @@
+/**
+ * @file LinearTaskSolverTimingsCounter.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+
+#include <BipedalLocomotion/BenchmarkUtils/LinearTaskSolverTimingsCounter.h>
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+
+namespace
+{
+benchmark::Counter toCounter(const std::chrono::nanoseconds& duration)
+{
+    return benchmark::Counter(std::chrono::duration<double>(duration).count(),
+                              benchmark::Counter::kAvgIterations);
+}
+} // namespace
+
+void LinearTaskSolverTimingsCounter::add(const System::LinearTaskSolverTimings& timings)
+{
+    m_timings.tasksUpdate += timings.tasksUpdate;
+    m_timings.problemAssembly += timings.problemAssembly;
+    m_timings.problemSolution += timings.problemSolution;
+}
+
+void LinearTaskSolverTimingsCounter::setCounters(benchmark::State& state) const
+{
+    state.counters["tasks_update"] = toCounter(m_timings.tasksUpdate);
+    state.counters["problem_assembly"] = toCounter(m_timings.problemAssembly);
+    state.counters["problem_solution"] = toCounter(m_timings.problemSolution);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file MemoryOperationsCounter.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstdlib>
+
+#include <BipedalLocomotion/BenchmarkUtils/MemoryOperationsCounter.h>
+#include <BipedalLocomotion/TestUtils/MemoryAllocationMonitor.h>
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+using BipedalLocomotion::TestUtils::MemoryAllocationMonitor;
+
+bool MemoryOperationsCounter::isEnabled()
+{
+    // The monitor may be compiled but the memory functions are replaced only if the preload library
+    // is loaded. A probe allocation tells if this is the case.
+    static const bool isEnabled = [] {
+        if (!MemoryAllocationMonitor::monitorIsEnabled())
+        {
+            return false;
+        }
+
+        MemoryAllocationMonitor::startMonitor();
+        // the volatile pointer prevents the compiler from removing the allocation
+        void* volatile probe = std::malloc(1);
+        std::free(probe);
+        MemoryAllocationMonitor::endMonitor();
+
+        return MemoryAllocationMonitor::getNumberOfDynamicMemoryOperationsInLastMonitor() > 0;
+    }();
+
+    return isEnabled;
+}
+
+void MemoryOperationsCounter::start()
+{
+    MemoryAllocationMonitor::startMonitor();
+}
+
+void MemoryOperationsCounter::stop()
+{
+    MemoryAllocationMonitor::endMonitor();
+    m_numberOfOperations
+        += MemoryAllocationMonitor::getNumberOfDynamicMemoryOperationsInLastMonitor();
+}
+
+std::int64_t MemoryOperationsCounter::getNumberOfOperations() const
+{
+    return m_numberOfOperations;
+}
+
+void MemoryOperationsCounter::setCounter(benchmark::State& state, const std::string& name) const
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    state.counters[name] = benchmark::Counter(static_cast<double>(m_numberOfOperations),
+                                              benchmark::Counter::kAvgIterations);
+}
@@ -0,0 +1,72 @@
+/**
+ * @file RandomModel.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/ModelTestUtils.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/RandomModel.h>
+
+using namespace BipedalLocomotion::BenchmarkUtils;
+
+iDynTree::Model BipedalLocomotion::BenchmarkUtils::getRandomKinematicTree(
+    std::size_t numberOfJoints, std::size_t numberOfAdditionalFrames, unsigned int seed)
+{
+    // the iDynTree random utilities rely on std::rand
+    std::srand(seed);
+
+    // Prismatic joints are excluded as a workaround for
+    // https://github.com/ami-iit/bipedal-locomotion-framework/issues/799
+    constexpr bool onlyRevoluteJoints = true;
+
+    iDynTree::Model model;
+    model.addLink("baseLink", iDynTree::getRandomLink());
+
+    for (std::size_t i = 0; i < numberOfJoints; i++)
+    {
+        const std::string parentLink = iDynTree::getRandomLinkOfModel(model);
+        iDynTree::addRandomLinkToModel(model,
+                                       parentLink,
+                                       "link" + std::to_string(i),
+                                       onlyRevoluteJoints);
+    }
+
+    for (std::size_t i = 0; i < numberOfAdditionalFrames; i++)
+    {
+        const std::string parentLink = iDynTree::getRandomLinkOfModel(model);
+        iDynTree::addRandomAdditionalFrameToModel(model,
+                                                  parentLink,
+                                                  "additionalFrame" + std::to_string(i));
+    }
+
+    return model;
+}
+
+bool BipedalLocomotion::BenchmarkUtils::setRandomRobotState(iDynTree::KinDynComputations& kinDyn,
+                                                            unsigned int seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    const std::size_t numberOfDofs = kinDyn.getNrOfDegreesOfFreedom();
+    Eigen::VectorXd jointPositions(numberOfDofs);
+    for (std::size_t i = 0; i < numberOfDofs; i++)
+    {
+        jointPositions[i] = distribution(generator);
+    }
+
+    const Eigen::Matrix4d basePose = Eigen::Matrix4d::Identity();
+    const Eigen::Matrix<double, 6, 1> baseVelocity = Eigen::Matrix<double, 6, 1>::Zero();
+    const Eigen::VectorXd jointVelocities = Eigen::VectorXd::Zero(numberOfDofs);
+    constexpr double standardAccelerationOfGravitation = 9.80665;
+    const Eigen::Vector3d gravity(0, 0, -standardAccelerationOfGravitation);
+
+    return kinDyn.setRobotState(basePose, jointPositions, baseVelocity, jointVelocities, gravity);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file EstimatorsBenchmark.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARKS_ESTIMATORS_BENCHMARK_H
+#define BIPEDAL_LOCOMOTION_BENCHMARKS_ESTIMATORS_BENCHMARK_H
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <random>
+
+#include <Eigen/Dense>
+
+namespace BipedalLocomotion
+{
+namespace Benchmarks
+{
+
+/**
+ * SyntheticJointTrajectory generates a deterministic joint trajectory. Each joint oscillates around
+ * its nominal position with a sinusoid whose amplitude, frequency and phase are drawn from a random
+ * generator initialized with a fixed seed, so that two runs of a benchmark process the same stream
+ * of measurements.
+ */
+class SyntheticJointTrajectory
+{
+public:
+    /**
+     * Constructor.
+     * @param nominalPositions joint positions around which the joints oscillate.
+     * @param maximumAmplitudes maximum amplitude of the oscillation of each joint. A joint with a
+     * zero amplitude does not move.
+     * @param seed seed of the random generator.
+     */
+    SyntheticJointTrajectory(const Eigen::Ref<const Eigen::VectorXd>& nominalPositions,
+                             const Eigen::Ref<const Eigen::VectorXd>& maximumAmplitudes,
+                             unsigned int seed = 42)
+        : m_nominalPositions(nominalPositions)
+    {
+        const Eigen::Index numberOfJoints = nominalPositions.size();
+        m_amplitudes.resize(numberOfJoints);
+        m_angularFrequencies.resize(numberOfJoints);
+        m_phases.resize(numberOfJoints);
+
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<double> unitDistribution(0.0, 1.0);
+        std::uniform_real_distribution<double> frequencyDistribution(0.2, 1.0);
+        std::uniform_real_distribution<double> phaseDistribution(0.0, 2 * M_PI);
+        for (Eigen::Index i = 0; i < numberOfJoints; i++)
+        {
+            m_amplitudes[i] = maximumAmplitudes[i] * unitDistribution(generator);
+            m_angularFrequencies[i] = 2 * M_PI * frequencyDistribution(generator);
+            m_phases[i] = phaseDistribution(generator);
+        }
+
+        this->update(std::chrono::nanoseconds::zero());
+    }
+
+    /**
+     * Evaluate the trajectory at a given time.
+     */
+    void update(const std::chrono::nanoseconds& time)
+    {
+        const double t = std::chrono::duration<double>(time).count();
+        const Eigen::ArrayXd angles = m_angularFrequencies.array() * t + m_phases.array();
+
+        m_positions = m_nominalPositions.array() + m_amplitudes.array() * angles.sin();
+        m_velocities = m_amplitudes.array() * m_angularFrequencies.array() * angles.cos();
+        m_accelerations = -m_amplitudes.array() * m_angularFrequencies.array().square()
+                          * angles.sin();
+    }
+
+    const Eigen::VectorXd& positions() const
+    {
+        return m_positions;
+    }
+
+    const Eigen::VectorXd& velocities() const
+    {
+        return m_velocities;
+    }
+
+    const Eigen::VectorXd& accelerations() const
+    {
+        return m_accelerations;
+    }
+
+private:
+    Eigen::VectorXd m_nominalPositions;
+    Eigen::VectorXd m_amplitudes;
+    Eigen::VectorXd m_angularFrequencies;
+    Eigen::VectorXd m_phases;
+    Eigen::VectorXd m_positions;
+    Eigen::VectorXd m_velocities;
+    Eigen::VectorXd m_accelerations;
+};
+
+/**
+ * BipedWalkingSchedule contains the timings of the synthetic contact schedule of a biped. The feet
+ * swing alternately, the left foot (index 0) swings at the beginning of the even steps and the
+ * right foot (index 1) at the beginning of the odd steps.
+ */
+struct BipedWalkingSchedule
+{
+    std::chrono::nanoseconds swingDuration{std::chrono::milliseconds(600)};
+    std::chrono::nanoseconds doubleSupportDuration{std::chrono::milliseconds(400)};
+};
+
+/**
+ * Check if a foot is in contact at a given time.
+ * @param foot index of the foot, 0 for the left foot and 1 for the right one.
+ * @param time time since the beginning of the walking.
+ * @param schedule timings of the contact schedule.
+ */
+inline bool isFootInContact(std::size_t foot,
+                            const std::chrono::nanoseconds& time,
+                            const BipedWalkingSchedule& schedule = BipedWalkingSchedule())
+{
+    const std::chrono::nanoseconds stepDuration
+        = schedule.swingDuration + schedule.doubleSupportDuration;
+    const auto step = time / stepDuration;
+    return (static_cast<std::size_t>(step % 2) != foot % 2)
+           || (time % stepDuration >= schedule.swingDuration);
+}
+
+/**
+ * Get the time at which the contact state of a foot switched for the last time.
+ * @param foot index of the foot, 0 for the left foot and 1 for the right one.
+ * @param time time since the beginning of the walking.
+ * @param schedule timings of the contact schedule.
+ */
+inline std::chrono::nanoseconds
+getLastContactSwitchTime(std::size_t foot,
+                         const std::chrono::nanoseconds& time,
+                         const BipedWalkingSchedule& schedule = BipedWalkingSchedule())
+{
+    const std::chrono::nanoseconds stepDuration
+        = schedule.swingDuration + schedule.doubleSupportDuration;
+    const auto step = time / stepDuration;
+
+    if (static_cast<std::size_t>(step % 2) == foot % 2)
+    {
+        // the foot swings during the present step
+        const std::chrono::nanoseconds liftOffTime = step * stepDuration;
+        return isFootInContact(foot, time, schedule) ? liftOffTime + schedule.swingDuration
+                                                     : liftOffTime;
+    }
+
+    // the foot landed during the previous step, if any
+    return step == 0 ? std::chrono::nanoseconds::zero()
+                     : (step - 1) * stepDuration + schedule.swingDuration;
+}
+
+} // namespace Benchmarks
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARKS_ESTIMATORS_BENCHMARK_H
@@ -0,0 +1,541 @@
+/**
+ * @file FloatingBaseEstimatorsBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <iCubModels/iCubModels.h>
+#include <iDynTree/EigenHelpers.h>
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/Model.h>
+#include <iDynTree/ModelLoader.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/DistributionCounter.h>
+#include <BipedalLocomotion/Conversions/ManifConversions.h>
+#include <BipedalLocomotion/FloatingBaseEstimators/BaseEstimatorFromFootIMU.h>
+#include <BipedalLocomotion/FloatingBaseEstimators/InvariantEKFBaseEstimator.h>
+#include <BipedalLocomotion/FloatingBaseEstimators/LeggedOdometry.h>
+#include <BipedalLocomotion/Math/Constants.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+#include "EstimatorsBenchmark.h"
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Benchmarks;
+using namespace BipedalLocomotion::Estimators;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr std::chrono::nanoseconds samplingTime = 10ms;
+
+// number of steps used to compute the distribution of the step time
+constexpr std::size_t numberOfSteps = 5000;
+
+// joints of the iCub models used by the tests of the floating base estimators
+const std::vector<std::string> jointsList
+    = {"neck_pitch",     "neck_roll",   "neck_yaw",         "torso_pitch",
+       "torso_roll",     "torso_yaw",   "l_shoulder_pitch", "l_shoulder_roll",
+       "l_shoulder_yaw", "l_elbow",     "r_shoulder_pitch", "r_shoulder_roll",
+       "r_shoulder_yaw", "r_elbow",     "l_hip_pitch",      "l_hip_roll",
+       "l_hip_yaw",      "l_knee",      "l_ankle_pitch",    "l_ankle_roll",
+       "r_hip_pitch",    "r_hip_roll",  "r_hip_yaw",        "r_knee",
+       "r_ankle_pitch",  "r_ankle_roll"};
+
+// the legs are the last twelve joints of the list
+constexpr std::size_t numberOfUpperBodyJoints = 14;
+
+const std::vector<std::string> feetFrames = {"l_sole", "r_sole"};
+
+/**
+ * Get the names of the contact frames of a foot.
+ */
+std::vector<std::string> getContactFrames(std::size_t foot, std::size_t contactsPerFoot)
+{
+    if (contactsPerFoot == 1)
+    {
+        return {feetFrames[foot]};
+    }
+
+    std::vector<std::string> frames;
+    for (std::size_t i = 0; i < contactsPerFoot; i++)
+    {
+        frames.push_back(feetFrames[foot] + "_contact_" + std::to_string(i));
+    }
+    return frames;
+}
+
+/**
+ * Load the model of the robot. In case of more than one contact per foot, the contact frames are
+ * added to the sole links and placed on an ellipse with semi-axes of 0.1m and 0.05m.
+ */
+bool loadRobotModel(std::size_t contactsPerFoot, iDynTree::KinDynComputations& kinDyn)
+{
+    iDynTree::ModelLoader loader;
+    if (!loader.loadReducedModelFromFile(iCubModels::getModelFile("iCubGenova02"), jointsList))
+    {
+        return false;
+    }
+
+    iDynTree::Model model = loader.model().copy();
+    for (std::size_t foot = 0; foot < feetFrames.size() && contactsPerFoot > 1; foot++)
+    {
+        const iDynTree::FrameIndex soleIndex = model.getFrameIndex(feetFrames[foot]);
+        const std::string soleLink = model.getLinkName(model.getFrameLink(soleIndex));
+        const std::vector<std::string> contactFrames = getContactFrames(foot, contactsPerFoot);
+
+        for (std::size_t i = 0; i < contactFrames.size(); i++)
+        {
+            const double angle = M_PI / 4 + 2 * M_PI * i / contactsPerFoot;
+            const iDynTree::Transform sole_H_contact(iDynTree::Rotation::Identity(),
+                                                     iDynTree::Position(0.1 * std::cos(angle),
+                                                                        0.05 * std::sin(angle),
+                                                                        0));
+            if (!model.addAdditionalFrameToLink(soleLink,
+                                                contactFrames[i],
+                                                model.getFrameTransform(soleIndex)
+                                                    * sole_H_contact))
+            {
+                return false;
+            }
+        }
+    }
+
+    return kinDyn.loadRobotModel(model);
+}
+
+/**
+ * Get the nominal configuration of the robot, the same used by the InvariantEKFBaseEstimator test.
+ */
+Eigen::VectorXd getNominalJointPositions()
+{
+    Eigen::VectorXd jointPositions(jointsList.size());
+    jointPositions << -0.0001, 0.0000, 0.0000, //
+        0.1570, 0.0003, -0.0000, //
+        -0.0609, 0.4350, 0.1833, 0.5375, //
+        -0.0609, 0.4349, 0.1834, 0.5375, //
+        0.0895, 0.0090, -0.0027, -0.5694, -0.3771, -0.0211, //
+        0.0896, 0.0090, -0.0027, -0.5695, -0.3771, -0.0211;
+    return jointPositions;
+}
+
+/**
+ * Create the trajectory of the joints. The upper body moves while the legs keep the nominal
+ * configuration, hence, with the base fixed in the origin, the feet do not move and the
+ * measurements are consistent with the contact states.
+ */
+SyntheticJointTrajectory createJointTrajectory()
+{
+    Eigen::VectorXd amplitudes = Eigen::VectorXd::Zero(jointsList.size());
+    amplitudes.head(numberOfUpperBodyJoints).setConstant(0.2);
+    return SyntheticJointTrajectory(getNominalJointPositions(), amplitudes);
+}
+
+/**
+ * Set the nominal state of the robot, with the base placed in the origin.
+ */
+bool setNominalRobotState(iDynTree::KinDynComputations& kinDyn)
+{
+    const Eigen::VectorXd jointPositions = getNominalJointPositions();
+    return kinDyn.setRobotState(Eigen::Matrix4d::Identity(),
+                                jointPositions,
+                                Eigen::Matrix<double, 6, 1>::Zero(),
+                                Eigen::VectorXd::Zero(jointPositions.size()),
+                                Eigen::Vector3d(0, 0, -Math::StandardAccelerationOfGravitation));
+}
+
+std::vector<double> toQuaternionWXYZ(const iDynTree::Transform& transform)
+{
+    const Eigen::Quaterniond quaternion(iDynTree::toEigen(transform.getRotation()));
+    return {quaternion.w(), quaternion.x(), quaternion.y(), quaternion.z()};
+}
+
+std::vector<double> toPosition(const iDynTree::Transform& transform)
+{
+    const Eigen::Vector3d position = iDynTree::toEigen(transform.getPosition());
+    return {position(0), position(1), position(2)};
+}
+
+/**
+ * Create the parameters of the InvariantEKFBaseEstimator. The initial state is the nominal state of
+ * the robot.
+ */
+std::shared_ptr<StdImplementation>
+createInvariantEKFParameters(iDynTree::KinDynComputations& kinDyn, bool isBiasEstimationEnabled)
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("sampling_period_in_s",
+                          std::chrono::duration<double>(samplingTime).count());
+
+    auto modelInfoGroup = std::make_shared<StdImplementation>();
+    modelInfoGroup->setParameter("base_link", "root_link");
+    modelInfoGroup->setParameter("base_link_imu", "root_link_imu_acc");
+    modelInfoGroup->setParameter("left_foot_contact_frame", feetFrames[0]);
+    modelInfoGroup->setParameter("right_foot_contact_frame", feetFrames[1]);
+    handler->setGroup("ModelInfo", modelInfoGroup);
+
+    auto optionsGroup = std::make_shared<StdImplementation>();
+    optionsGroup->setParameter("enable_imu_bias_estimation", isBiasEstimationEnabled);
+    optionsGroup->setParameter("enable_static_imu_bias_initialization", false);
+    optionsGroup->setParameter("enable_ekf_update", true);
+    handler->setGroup("Options", optionsGroup);
+
+    auto sensorsStdDevGroup = std::make_shared<StdImplementation>();
+    sensorsStdDevGroup->setParameter("accelerometer_measurement_noise_std_dev",
+                                     std::vector<double>{0.0382, 0.01548, 0.0042});
+    sensorsStdDevGroup->setParameter("gyroscope_measurement_noise_std_dev",
+                                     std::vector<double>{0.0111, 0.0024, 0.0043});
+    sensorsStdDevGroup->setParameter("accelerometer_measurement_bias_noise_std_dev",
+                                     std::vector<double>{1e-4, 1e-4, 1e-4});
+    sensorsStdDevGroup->setParameter("gyroscope_measurement_bias_noise_std_dev",
+                                     std::vector<double>{1e-4, 1e-4, 1e-4});
+    sensorsStdDevGroup->setParameter("contact_foot_linear_velocity_noise_std_dev",
+                                     std::vector<double>{9e-3, 9.5e-3, 7e-3});
+    sensorsStdDevGroup->setParameter("contact_foot_angular_velocity_noise_std_dev",
+                                     std::vector<double>{0.007, 0.0075, 0.004});
+    sensorsStdDevGroup->setParameter("swing_foot_linear_velocity_noise_std_dev",
+                                     std::vector<double>{0.05, 0.05, 0.05});
+    sensorsStdDevGroup->setParameter("swing_foot_angular_velocity_noise_std_dev",
+                                     std::vector<double>{0.015, 0.015, 0.015});
+    sensorsStdDevGroup->setParameter("forward_kinematic_measurement_noise_std_dev",
+                                     std::vector<double>{1e-3, 1e-3, 1e-3, 1e-6, 1e-6, 1e-6});
+    sensorsStdDevGroup->setParameter("encoders_measurement_noise_std_dev",
+                                     std::vector<double>(jointsList.size(), 1e-6));
+    handler->setGroup("SensorsStdDev", sensorsStdDevGroup);
+
+    const iDynTree::Transform world_H_imu = kinDyn.getWorldTransform("root_link_imu_acc");
+    const iDynTree::Transform world_H_leftFoot = kinDyn.getWorldTransform(feetFrames[0]);
+    const iDynTree::Transform world_H_rightFoot = kinDyn.getWorldTransform(feetFrames[1]);
+
+    auto initialStatesGroup = std::make_shared<StdImplementation>();
+    initialStatesGroup->setParameter("imu_orientation_quaternion_wxyz",
+                                     toQuaternionWXYZ(world_H_imu));
+    initialStatesGroup->setParameter("imu_position_xyz", toPosition(world_H_imu));
+    initialStatesGroup->setParameter("imu_linear_velocity_xyz", std::vector<double>{0, 0, 0});
+    initialStatesGroup->setParameter("l_contact_frame_orientation_quaternion_wxyz",
+                                     toQuaternionWXYZ(world_H_leftFoot));
+    initialStatesGroup->setParameter("l_contact_frame_position_xyz",
+                                     toPosition(world_H_leftFoot));
+    initialStatesGroup->setParameter("r_contact_frame_orientation_quaternion_wxyz",
+                                     toQuaternionWXYZ(world_H_rightFoot));
+    initialStatesGroup->setParameter("r_contact_frame_position_xyz",
+                                     toPosition(world_H_rightFoot));
+    initialStatesGroup->setParameter("accelerometer_bias", std::vector<double>{0, 0, 0});
+    initialStatesGroup->setParameter("gyroscope_bias", std::vector<double>{0, 0, 0});
+    handler->setGroup("InitialStates", initialStatesGroup);
+
+    const double orientationStdDev = 10 * M_PI / 180;
+    auto priorsStdDevGroup = std::make_shared<StdImplementation>();
+    priorsStdDevGroup->setParameter("imu_orientation",
+                                    std::vector<double>{orientationStdDev,
+                                                        orientationStdDev,
+                                                        orientationStdDev / 10});
+    priorsStdDevGroup->setParameter("imu_position", std::vector<double>{1e-3, 1e-3, 1e-3});
+    priorsStdDevGroup->setParameter("imu_linear_velocity",
+                                    std::vector<double>{0.075, 0.05, 0.05});
+    priorsStdDevGroup->setParameter("l_contact_frame_orientation",
+                                    std::vector<double>(3, orientationStdDev));
+    priorsStdDevGroup->setParameter("l_contact_frame_position",
+                                    std::vector<double>{1e-3, 1e-3, 1e-3});
+    priorsStdDevGroup->setParameter("r_contact_frame_orientation",
+                                    std::vector<double>(3, orientationStdDev));
+    priorsStdDevGroup->setParameter("r_contact_frame_position",
+                                    std::vector<double>{1e-3, 1e-3, 1e-3});
+    priorsStdDevGroup->setParameter("accelerometer_bias", std::vector<double>{1e-3, 1e-3, 1e-3});
+    priorsStdDevGroup->setParameter("gyroscope_bias", std::vector<double>{1e-3, 1e-3, 1e-3});
+    handler->setGroup("PriorsStdDev", priorsStdDevGroup);
+
+    return handler;
+}
+
+/**
+ * Create the parameters of the LeggedOdometry.
+ */
+std::shared_ptr<StdImplementation> createLeggedOdometryParameters(const std::string& velocityMethod)
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("sampling_period_in_s",
+                          std::chrono::duration<double>(samplingTime).count());
+
+    // the legged odometry does not use the IMU, the base link is used as IMU frame
+    auto modelInfoGroup = std::make_shared<StdImplementation>();
+    modelInfoGroup->setParameter("base_link", "root_link");
+    modelInfoGroup->setParameter("base_link_imu", "root_link");
+    modelInfoGroup->setParameter("left_foot_contact_frame", feetFrames[0]);
+    modelInfoGroup->setParameter("right_foot_contact_frame", feetFrames[1]);
+    handler->setGroup("ModelInfo", modelInfoGroup);
+
+    auto leggedOdometryGroup = std::make_shared<StdImplementation>();
+    leggedOdometryGroup->setParameter("initial_fixed_frame", feetFrames[0]);
+    leggedOdometryGroup->setParameter("initial_ref_frame_for_world", feetFrames[0]);
+    leggedOdometryGroup->setParameter("initial_world_orientation_in_ref_frame",
+                                      std::vector<double>{1, 0, 0, 0});
+    leggedOdometryGroup->setParameter("initial_world_position_in_ref_frame",
+                                      std::vector<double>{0, 0, 0});
+    leggedOdometryGroup->setParameter("switching_pattern", "latest");
+    leggedOdometryGroup->setParameter("vel_computation_method", velocityMethod);
+    handler->setGroup("LeggedOdom", leggedOdometryGroup);
+
+    return handler;
+}
+
+/**
+ * Create the parameters of the BaseEstimatorFromFootIMU.
+ */
+std::shared_ptr<StdImplementation> createBaseEstimatorFromFootIMUParameters()
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("foot_width_in_m", 0.1);
+    handler->setParameter("foot_length_in_m", 0.236);
+
+    auto modelInfoGroup = std::make_shared<StdImplementation>();
+    modelInfoGroup->setParameter("base_frame", "root_link");
+    modelInfoGroup->setParameter("foot_frame", feetFrames[1]);
+    handler->setGroup("MODEL_INFO", modelInfoGroup);
+
+    return handler;
+}
+
+/**
+ * Set the counters of the throughput of the estimator given the time spent by all the steps.
+ */
+void setThroughputCounters(benchmark::State& state,
+                           BenchmarkUtils::DistributionCounter& stepTime,
+                           const std::chrono::nanoseconds& totalStepTime)
+{
+    stepTime.setCounters(state);
+    if (totalStepTime > std::chrono::nanoseconds::zero())
+    {
+        state.counters["steps_per_second"]
+            = state.iterations() / std::chrono::duration<double>(totalStepTime).count();
+    }
+}
+
+void setWalkingAndBiasEstimation(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"walking", "bias_estimation"})->ArgsProduct({{0, 1}, {0, 1}});
+}
+
+void setWalkingAndContacts(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"walking", "contacts_per_foot"})->ArgsProduct({{0, 1}, {1, 2, 4}});
+}
+
+/**
+ * Measure the time required by a step of the InvariantEKFBaseEstimator, i.e. setting the IMU,
+ * contact and kinematic measurements and advancing the estimator. The robot either stands on both
+ * feet or walks, swinging the feet alternately.
+ */
+void advanceInvariantEKFBaseEstimator(benchmark::State& state)
+{
+    const bool isWalking = state.range(0) != 0;
+    const bool isBiasEstimationEnabled = state.range(1) != 0;
+
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    if (!loadRobotModel(1, *kinDyn) || !setNominalRobotState(*kinDyn))
+    {
+        state.SkipWithError("Unable to load the model.");
+        return;
+    }
+
+    // the base is fixed, the accelerometer measures the gravity and the gyroscope measures zero
+    const Eigen::Vector3d accelerometer
+        = iDynTree::toEigen(kinDyn->getWorldTransform("root_link_imu_acc").getRotation())
+              .transpose()
+          * Eigen::Vector3d(0, 0, Math::StandardAccelerationOfGravitation);
+    const Eigen::Vector3d gyroscope = Eigen::Vector3d::Zero();
+
+    InvariantEKFBaseEstimator estimator;
+    if (!estimator.initialize(createInvariantEKFParameters(*kinDyn, isBiasEstimationEnabled),
+                              kinDyn))
+    {
+        state.SkipWithError("Unable to initialize the estimator.");
+        return;
+    }
+
+    SyntheticJointTrajectory trajectory = createJointTrajectory();
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+    std::chrono::nanoseconds totalStepTime = std::chrono::nanoseconds::zero();
+    BenchmarkUtils::DistributionCounter stepTime("step_time", state.max_iterations);
+    for (auto _ : state)
+    {
+        trajectory.update(time);
+        const bool isLeftFootInContact = !isWalking || isFootInContact(0, time);
+        const bool isRightFootInContact = !isWalking || isFootInContact(1, time);
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool isAdvanced
+            = estimator.setIMUMeasurement(accelerometer, gyroscope)
+              && estimator.setContacts(isLeftFootInContact, isRightFootInContact)
+              && estimator.setKinematics(trajectory.positions(), trajectory.velocities())
+              && estimator.advance();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+
+        if (!isAdvanced)
+        {
+            state.SkipWithError("Unable to advance the estimator.");
+            break;
+        }
+
+        stepTime.add(elapsed);
+        totalStepTime += elapsed;
+        time += samplingTime;
+    }
+
+    setThroughputCounters(state, stepTime, totalStepTime);
+}
+
+/**
+ * Measure the time required by a step of the LeggedOdometry, i.e. setting the kinematic
+ * measurements and the state of each contact and advancing the estimator. Each foot has one or more
+ * contact frames, the robot either stands on both feet or walks, swinging the feet alternately.
+ */
+void advanceLeggedOdometry(benchmark::State& state, std::string velocityMethod)
+{
+    const bool isWalking = state.range(0) != 0;
+    const std::size_t contactsPerFoot = state.range(1);
+
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    LeggedOdometry estimator;
+    if (!loadRobotModel(contactsPerFoot, *kinDyn) || !setNominalRobotState(*kinDyn)
+        || !estimator.initialize(createLeggedOdometryParameters(velocityMethod), kinDyn))
+    {
+        state.SkipWithError("Unable to initialize the estimator.");
+        return;
+    }
+
+    const std::vector<std::vector<std::string>> contactFrames
+        = {getContactFrames(0, contactsPerFoot), getContactFrames(1, contactsPerFoot)};
+
+    SyntheticJointTrajectory trajectory = createJointTrajectory();
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+    std::chrono::nanoseconds totalStepTime = std::chrono::nanoseconds::zero();
+    BenchmarkUtils::DistributionCounter stepTime("step_time", state.max_iterations);
+    for (auto _ : state)
+    {
+        trajectory.update(time);
+
+        const auto start = std::chrono::steady_clock::now();
+        bool isAdvanced = estimator.setKinematics(trajectory.positions(), trajectory.velocities());
+        for (std::size_t foot = 0; foot < contactFrames.size(); foot++)
+        {
+            const bool isInContact = !isWalking || isFootInContact(foot, time);
+            const std::chrono::nanoseconds switchTime
+                = isWalking ? getLastContactSwitchTime(foot, time) : 0s;
+            for (const auto& frame : contactFrames[foot])
+            {
+                isAdvanced = isAdvanced
+                             && estimator.setContactStatus(frame, isInContact, switchTime, time);
+            }
+        }
+        isAdvanced = isAdvanced && estimator.advance();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+
+        if (!isAdvanced)
+        {
+            state.SkipWithError("Unable to advance the estimator.");
+            break;
+        }
+
+        stepTime.add(elapsed);
+        totalStepTime += elapsed;
+        time += samplingTime;
+    }
+
+    setThroughputCounters(state, stepTime, totalStepTime);
+}
+
+/**
+ * Measure the time required by a step of the BaseEstimatorFromFootIMU, i.e. setting the input and
+ * advancing the estimator. The foot keeps the nominal pose while the upper body moves.
+ */
+void advanceBaseEstimatorFromFootIMU(benchmark::State& state)
+{
+    iDynTree::KinDynComputations kinDyn;
+    BaseEstimatorFromFootIMU estimator;
+    if (!loadRobotModel(1, kinDyn) || !setNominalRobotState(kinDyn)
+        || !estimator.setModel(kinDyn.model())
+        || !estimator.initialize(createBaseEstimatorFromFootIMUParameters()))
+    {
+        state.SkipWithError("Unable to initialize the estimator.");
+        return;
+    }
+
+    SyntheticJointTrajectory trajectory = createJointTrajectory();
+    BaseEstimatorFromFootIMUInput input;
+    input.desiredFootPose = Conversions::toManifPose(kinDyn.getWorldTransform(feetFrames[1]));
+    input.measuredRotation = input.desiredFootPose.asSO3();
+
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+    std::chrono::nanoseconds totalStepTime = std::chrono::nanoseconds::zero();
+    BenchmarkUtils::DistributionCounter stepTime("step_time", state.max_iterations);
+    for (auto _ : state)
+    {
+        trajectory.update(time);
+        input.jointPositions = trajectory.positions();
+        input.jointVelocities = trajectory.velocities();
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool isAdvanced = estimator.setInput(input) && estimator.advance();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+
+        if (!isAdvanced)
+        {
+            state.SkipWithError("Unable to advance the estimator.");
+            break;
+        }
+
+        stepTime.add(elapsed);
+        totalStepTime += elapsed;
+        time += samplingTime;
+    }
+
+    setThroughputCounters(state, stepTime, totalStepTime);
+}
+} // namespace
+
+BENCHMARK(advanceInvariantEKFBaseEstimator)
+    ->Apply(setWalkingAndBiasEstimation)
+    ->Iterations(numberOfSteps)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(advanceLeggedOdometry, single, std::string("single"))
+    ->Apply(setWalkingAndContacts)
+    ->Iterations(numberOfSteps)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(advanceLeggedOdometry, multiAvg, std::string("multiAvg"))
+    ->Apply(setWalkingAndContacts)
+    ->Iterations(numberOfSteps)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(advanceLeggedOdometry, multiLS, std::string("multiLS"))
+    ->Apply(setWalkingAndContacts)
+    ->Iterations(numberOfSteps)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(advanceBaseEstimatorFromFootIMU)
+    ->Iterations(numberOfSteps)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,578 @@
+/**
+ * @file RobotDynamicsEstimatorBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/EigenHelpers.h>
+#include <iDynTree/FixedJoint.h>
+#include <iDynTree/KinDynComputations.h>
+#include <iDynTree/Model.h>
+#include <iDynTree/ModelTestUtils.h>
+#include <iDynTree/RevoluteJoint.h>
+#include <iDynTree/Sensors.h>
+#include <iDynTree/SixAxisForceTorqueSensor.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/DistributionCounter.h>
+#include <BipedalLocomotion/Math/Constants.h>
+#include <BipedalLocomotion/ParametersHandler/TomlImplementation.h>
+#include <BipedalLocomotion/RobotDynamicsEstimator/KinDynWrapper.h>
+#include <BipedalLocomotion/RobotDynamicsEstimator/RobotDynamicsEstimator.h>
+#include <BipedalLocomotion/RobotDynamicsEstimator/SubModel.h>
+
+#include "EstimatorsBenchmark.h"
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Benchmarks;
+using namespace BipedalLocomotion::Estimators::RobotDynamicsEstimator;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr std::chrono::nanoseconds samplingTime = 10ms;
+
+// number of steps used to compute the distribution of the step time
+constexpr std::size_t numberOfSteps = 500;
+
+// number of revolute joints of each sub-model
+constexpr std::size_t jointsPerSubModel = 2;
+
+// parameters of the motors, the same for all the joints
+constexpr double gearRatio = 100.0;
+constexpr double torqueConstant = 0.047;
+
+/**
+ * SyntheticRobot is a serial chain split in sub-models by force/torque sensors. Each sub-model
+ * contains the same number of revolute joints and an IMU attached to its first link, while the
+ * external contacts are attached to the last link of the sub-models in a round-robin fashion.
+ */
+struct SyntheticRobot
+{
+    iDynTree::Model model;
+    iDynTree::SensorsList sensors;
+    std::vector<std::string> ftFrames; /**< Frames of the sensors and associated fixed joints. */
+    std::vector<iDynTree::LinkIndex> ftChildLinks; /**< First link after each sensor. */
+    std::vector<std::string> imuFrames;
+    std::vector<std::string> contactFrames;
+};
+
+/**
+ * Create the synthetic robot given the number of force/torque sensors and of external contacts.
+ * The inertial parameters and the transforms are random, the seed of the random generator is fixed
+ * so that the same arguments always give the same robot.
+ */
+SyntheticRobot createSyntheticRobot(std::size_t numberOfFTSensors, std::size_t numberOfContacts)
+{
+    // the iDynTree random utilities rely on std::rand
+    std::srand(42);
+
+    SyntheticRobot robot;
+    iDynTree::Model& model = robot.model;
+
+    // the additional frames are added once all the links are in the model
+    std::vector<std::string> imuLinks;
+    std::vector<std::string> lastLinks;
+
+    std::string parentLink = "base_link";
+    model.addLink(parentLink, iDynTree::getRandomLink());
+    for (std::size_t subModel = 0; subModel <= numberOfFTSensors; subModel++)
+    {
+        if (subModel > 0)
+        {
+            const std::string ftFrame = "ft_" + std::to_string(subModel);
+            const std::string childLink = ftFrame + "_link";
+            const iDynTree::LinkIndex parentIndex = model.getLinkIndex(parentLink);
+            const iDynTree::LinkIndex childIndex = model.addLink(childLink,
+                                                                 iDynTree::getRandomLink());
+            const iDynTree::Transform parent_H_child = iDynTree::getRandomTransform();
+
+            iDynTree::FixedJoint ftJoint(parentIndex, childIndex, parent_H_child);
+            const iDynTree::JointIndex ftJointIndex = model.addJoint(ftFrame, &ftJoint);
+
+            // the sensor frame coincides with the frame of the child link
+            iDynTree::SixAxisForceTorqueSensor sensor;
+            sensor.setName(ftFrame);
+            sensor.setParentJoint(ftFrame);
+            sensor.setParentJointIndex(ftJointIndex);
+            sensor.setFirstLinkName(parentLink);
+            sensor.setSecondLinkName(childLink);
+            sensor.setFirstLinkSensorTransform(parentIndex, parent_H_child);
+            sensor.setSecondLinkSensorTransform(childIndex, iDynTree::Transform::Identity());
+            sensor.setAppliedWrenchLink(childIndex);
+            robot.sensors.addSensor(sensor);
+
+            robot.ftFrames.push_back(ftFrame);
+            robot.ftChildLinks.push_back(childIndex);
+            parentLink = childLink;
+        }
+
+        imuLinks.push_back(parentLink);
+        for (std::size_t i = 0; i < jointsPerSubModel; i++)
+        {
+            const std::string index = std::to_string(model.getNrOfDOFs());
+            const std::string childLink = "link_" + index;
+            const iDynTree::LinkIndex childIndex = model.addLink(childLink,
+                                                                 iDynTree::getRandomLink());
+
+            iDynTree::RevoluteJoint joint;
+            joint.setAttachedLinks(model.getLinkIndex(parentLink), childIndex);
+            joint.setRestTransform(iDynTree::getRandomTransform());
+            joint.setAxis(iDynTree::getRandomAxis(), childIndex);
+            model.addJoint("joint_" + index, &joint);
+
+            parentLink = childLink;
+        }
+        lastLinks.push_back(parentLink);
+    }
+
+    for (std::size_t i = 0; i < robot.ftFrames.size(); i++)
+    {
+        model.addAdditionalFrameToLink(model.getLinkName(robot.ftChildLinks[i]),
+                                       robot.ftFrames[i],
+                                       iDynTree::Transform::Identity());
+    }
+
+    for (std::size_t i = 0; i < imuLinks.size(); i++)
+    {
+        robot.imuFrames.push_back("imu_" + std::to_string(i));
+        model.addAdditionalFrameToLink(imuLinks[i],
+                                       robot.imuFrames.back(),
+                                       iDynTree::getRandomTransform());
+    }
+
+    for (std::size_t i = 0; i < numberOfContacts; i++)
+    {
+        robot.contactFrames.push_back("contact_" + std::to_string(i));
+        model.addAdditionalFrameToLink(lastLinks[i % lastLinks.size()],
+                                       robot.contactFrames.back(),
+                                       iDynTree::getRandomTransform());
+    }
+
+    return robot;
+}
+
+std::string toUpper(std::string name)
+{
+    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+    return name;
+}
+
+/**
+ * Create a group of the sensors or of the contacts in the MODEL group.
+ */
+std::shared_ptr<TomlImplementation> createSensorsGroup(const std::vector<std::string>& frames,
+                                                       const std::string& suffix)
+{
+    std::vector<std::string> names;
+    for (const auto& frame : frames)
+    {
+        names.push_back(frame + suffix);
+    }
+
+    auto group = std::make_shared<TomlImplementation>();
+    group->setParameter("names", names);
+    group->setParameter("frames", frames);
+    return group;
+}
+
+/**
+ * Create a group of the UKF_STATE group.
+ */
+std::shared_ptr<TomlImplementation> createStateGroup(const std::string& inputName,
+                                                     const std::string& dynamicModel,
+                                                     std::size_t size,
+                                                     double covariance)
+{
+    auto group = std::make_shared<TomlImplementation>();
+    group->setParameter("input_name", inputName);
+    group->setParameter("covariance", std::vector<double>(size, covariance));
+    group->setParameter("initial_covariance", std::vector<double>(size, 1e-2));
+    group->setParameter("dynamic_model", dynamicModel);
+    return group;
+}
+
+/**
+ * Create a group of the UKF_MEASUREMENT group.
+ */
+std::shared_ptr<TomlImplementation> createMeasurementGroup(const std::string& inputName,
+                                                           const std::string& associatedState,
+                                                           const std::string& dynamicModel,
+                                                           std::size_t size,
+                                                           double covariance)
+{
+    auto group = std::make_shared<TomlImplementation>();
+    group->setParameter("input_name", inputName);
+    group->setParameter("associated_state", associatedState);
+    group->setParameter("covariance", std::vector<double>(size, covariance));
+    group->setParameter("use_bias", false);
+    group->setParameter("dynamic_model", dynamicModel);
+    return group;
+}
+
+/**
+ * Create the parameters of the estimator. The configuration mirrors the one used by the
+ * RobotDynamicsEstimator test: every IMU is both an accelerometer and a gyroscope, and the
+ * accelerometers and gyroscopes that are not attached to the base are also measured through the
+ * model of the robot.
+ * @note TomlImplementation is used since the estimator forwards the sampling time to the dynamics
+ * as a double, which are then retrieved as std::chrono::nanoseconds.
+ */
+std::shared_ptr<TomlImplementation> createParametersHandler(const SyntheticRobot& robot)
+{
+    const std::size_t numberOfJoints = robot.model.getNrOfDOFs();
+
+    auto generalGroup = std::make_shared<TomlImplementation>();
+    generalGroup->setParameter("sampling_time",
+                               std::chrono::duration<double>(samplingTime).count());
+
+    std::vector<std::string> jointsList;
+    for (std::size_t i = 0; i < robot.model.getNrOfJoints(); i++)
+    {
+        if (robot.model.getJoint(i)->getNrOfDOFs() > 0)
+        {
+            jointsList.push_back(robot.model.getJointName(i));
+        }
+    }
+
+    auto modelGroup = std::make_shared<TomlImplementation>();
+    modelGroup->setParameter("joint_list", jointsList);
+    modelGroup->setParameter("base_link", std::string("base_link"));
+    auto ftGroup = createSensorsGroup(robot.ftFrames, "_ft");
+    ftGroup->setParameter("associated_joints", robot.ftFrames);
+    modelGroup->setGroup("FT", ftGroup);
+    modelGroup->setGroup("ACCELEROMETER", createSensorsGroup(robot.imuFrames, "_acc"));
+    modelGroup->setGroup("GYROSCOPE", createSensorsGroup(robot.imuFrames, "_gyro"));
+    modelGroup->setGroup("EXTERNAL_CONTACT", createSensorsGroup(robot.contactFrames, ""));
+
+    auto stateGroup = std::make_shared<TomlImplementation>();
+    auto measurementGroup = std::make_shared<TomlImplementation>();
+    std::vector<std::string> stateDynamics;
+    std::vector<std::string> measurementDynamics;
+    auto addState = [&](const std::string& name, std::shared_ptr<TomlImplementation> group) {
+        stateDynamics.push_back(name);
+        stateGroup->setGroup(name, group);
+    };
+    auto addMeasurement = [&](const std::string& name, std::shared_ptr<TomlImplementation> group) {
+        measurementDynamics.push_back(name);
+        measurementGroup->setGroup(name, group);
+    };
+
+    addState("JOINT_VELOCITIES",
+             createStateGroup("ds", "JointVelocityStateDynamics", numberOfJoints, 1e-4));
+    addState("MOTOR_TORQUES",
+             createStateGroup("tau_m", "ZeroVelocityStateDynamics", numberOfJoints, 1e-2));
+    addState("FRICTION_TORQUES",
+             createStateGroup("tau_F", "ZeroVelocityStateDynamics", numberOfJoints, 1e-3));
+
+    addMeasurement("JOINT_VELOCITIES",
+                   createMeasurementGroup("ds",
+                                          "JOINT_VELOCITIES",
+                                          "ConstantMeasurementModel",
+                                          numberOfJoints,
+                                          1e-8));
+    auto motorCurrentsGroup = std::make_shared<TomlImplementation>();
+    motorCurrentsGroup->setParameter("input_name", std::string("i_m"));
+    motorCurrentsGroup->setParameter("covariance", std::vector<double>(numberOfJoints, 1e-8));
+    motorCurrentsGroup->setParameter("gear_ratio", std::vector<double>(numberOfJoints, gearRatio));
+    motorCurrentsGroup->setParameter("torque_constant",
+                                     std::vector<double>(numberOfJoints, torqueConstant));
+    motorCurrentsGroup->setParameter("dynamic_model",
+                                     std::string("MotorCurrentMeasurementDynamics"));
+    addMeasurement("MOTOR_CURRENTS", motorCurrentsGroup);
+    addMeasurement("FRICTION_TORQUES",
+                   createMeasurementGroup("tau_F",
+                                          "FRICTION_TORQUES",
+                                          "ConstantMeasurementModel",
+                                          numberOfJoints,
+                                          1e-6));
+
+    for (const auto& ft : robot.ftFrames)
+    {
+        const std::string name = toUpper(ft);
+        addState(name, createStateGroup(ft + "_ft", "ZeroVelocityStateDynamics", 6, 1e-2));
+        addMeasurement(name,
+                       createMeasurementGroup(ft + "_ft",
+                                              name,
+                                              "ConstantMeasurementModel",
+                                              6,
+                                              1e-8));
+    }
+
+    for (std::size_t i = 0; i < robot.imuFrames.size(); i++)
+    {
+        for (const auto& [suffix, model] :
+             {std::pair<std::string, std::string>{"_acc", "AccelerometerMeasurementDynamics"},
+              std::pair<std::string, std::string>{"_gyro", "GyroscopeMeasurementDynamics"}})
+        {
+            const std::string inputName = robot.imuFrames[i] + suffix;
+            const std::string name = toUpper(inputName);
+            addState(name, createStateGroup(inputName, "ZeroVelocityStateDynamics", 3, 1e-3));
+            addMeasurement(name,
+                           createMeasurementGroup(inputName,
+                                                  name,
+                                                  "ConstantMeasurementModel",
+                                                  3,
+                                                  1e-3));
+
+            // the IMU attached to the base is not measured through the model of the robot
+            if (i > 0)
+            {
+                addMeasurement(name + "_MODEL",
+                               createMeasurementGroup(inputName, name, model, 3, 1e-3));
+            }
+        }
+    }
+
+    for (const auto& contact : robot.contactFrames)
+    {
+        auto contactGroup
+            = createStateGroup(contact, "ExternalContactStateDynamics", 6, 1e-2);
+        contactGroup->setParameter("k", std::vector<double>(6, 1e2));
+        addState(toUpper(contact), contactGroup);
+    }
+
+    stateGroup->setParameter("dynamics_list", stateDynamics);
+    measurementGroup->setParameter("dynamics_list", measurementDynamics);
+
+    auto ukfGroup = std::make_shared<TomlImplementation>();
+    ukfGroup->setParameter("alpha", 1.0);
+    ukfGroup->setParameter("beta", 2.0);
+    ukfGroup->setParameter("kappa", 0.0);
+    ukfGroup->setGroup("UKF_STATE", stateGroup);
+    ukfGroup->setGroup("UKF_MEASUREMENT", measurementGroup);
+
+    auto handler = std::make_shared<TomlImplementation>();
+    handler->setGroup("GENERAL", generalGroup);
+    handler->setGroup("MODEL", modelGroup);
+    handler->setGroup("UKF", ukfGroup);
+    return handler;
+}
+
+/**
+ * SyntheticMeasurements generates the measurements of the synthetic robot while the joints follow
+ * a SyntheticJointTrajectory and the base is fixed. The measurements are computed assuming that the
+ * motion is quasi-static: the motor currents balance the gravity torques, the force/torque sensors
+ * measure the weight of the links that follow them, the accelerometers measure the gravity and the
+ * contact wrenches are zero.
+ */
+class SyntheticMeasurements
+{
+public:
+    SyntheticMeasurements(const SyntheticRobot& robot,
+                          std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
+        : m_robot(robot)
+        , m_kinDyn(kinDyn)
+        , m_trajectory(Eigen::VectorXd::Zero(robot.model.getNrOfDOFs()),
+                       Eigen::VectorXd::Constant(robot.model.getNrOfDOFs(), 0.5))
+        , m_gravityTorques(robot.model)
+    {
+        m_input.basePose.setIdentity();
+        m_input.baseVelocity.setZero();
+        m_input.baseAcceleration.setZero();
+        m_input.frictionTorques = Eigen::VectorXd::Zero(robot.model.getNrOfDOFs());
+    }
+
+    bool update(const std::chrono::nanoseconds& time)
+    {
+        m_trajectory.update(time);
+        m_input.jointPositions = m_trajectory.positions();
+        m_input.jointVelocities = m_trajectory.velocities();
+
+        const Eigen::Vector3d gravity(0, 0, -Math::StandardAccelerationOfGravitation);
+        if (!m_kinDyn->setRobotState(Eigen::Matrix4d::Identity(),
+                                     m_input.jointPositions,
+                                     Eigen::Matrix<double, 6, 1>::Zero(),
+                                     m_input.jointVelocities,
+                                     gravity)
+            || !m_kinDyn->generalizedGravityForces(m_gravityTorques))
+        {
+            return false;
+        }
+
+        m_input.motorCurrents = iDynTree::toEigen(m_gravityTorques.jointTorques())
+                                / (gearRatio * torqueConstant);
+
+        for (std::size_t i = 0; i < m_robot.ftFrames.size(); i++)
+        {
+            const iDynTree::Transform world_H_sensor
+                = m_kinDyn->getWorldTransform(m_robot.ftFrames[i]);
+            const Eigen::Vector3d sensorPosition
+                = iDynTree::toEigen(world_H_sensor.getPosition());
+
+            // the sensor balances the weight of the links that follow it in the chain
+            Eigen::Vector3d force = Eigen::Vector3d::Zero();
+            Eigen::Vector3d torque = Eigen::Vector3d::Zero();
+            for (std::size_t link = m_robot.ftChildLinks[i]; link < m_robot.model.getNrOfLinks();
+                 link++)
+            {
+                const iDynTree::SpatialInertia& inertia
+                    = m_robot.model.getLink(link)->getInertia();
+                const Eigen::Vector3d centerOfMass = iDynTree::toEigen(
+                    m_kinDyn->getWorldTransform(link) * inertia.getCenterOfMass());
+                const Eigen::Vector3d weight = -inertia.getMass() * gravity;
+                force += weight;
+                torque += (centerOfMass - sensorPosition).cross(weight);
+            }
+
+            const Eigen::Matrix3d sensor_R_world
+                = iDynTree::toEigen(world_H_sensor.getRotation()).transpose();
+            m_input.ftWrenches[m_robot.ftFrames[i] + "_ft"].resize(6);
+            m_input.ftWrenches[m_robot.ftFrames[i] + "_ft"] << sensor_R_world * force,
+                sensor_R_world * torque;
+        }
+
+        for (const auto& imu : m_robot.imuFrames)
+        {
+            const iDynTree::Transform world_H_imu = m_kinDyn->getWorldTransform(imu);
+            m_input.linearAccelerations[imu + "_acc"]
+                = -iDynTree::toEigen(world_H_imu.getRotation()).transpose() * gravity;
+
+            // the frame velocity representation is body fixed
+            m_input.angularVelocities[imu + "_gyro"]
+                = iDynTree::toEigen(m_kinDyn->getFrameVel(imu).getAngularVec3());
+        }
+
+        return true;
+    }
+
+    const RobotDynamicsEstimatorInput& input() const
+    {
+        return m_input;
+    }
+
+    /**
+     * Get the state of the estimator consistent with the present measurements.
+     */
+    RobotDynamicsEstimatorOutput getState() const
+    {
+        RobotDynamicsEstimatorOutput state;
+        state.ds = m_input.jointVelocities;
+        state.tau_m = iDynTree::toEigen(m_gravityTorques.jointTorques());
+        state.tau_F = m_input.frictionTorques;
+        state.ftWrenches = m_input.ftWrenches;
+        state.linearAccelerations = m_input.linearAccelerations;
+        state.angularVelocities = m_input.angularVelocities;
+        for (const auto& contact : m_robot.contactFrames)
+        {
+            state.contactWrenches[contact] = Eigen::VectorXd::Zero(6);
+        }
+        return state;
+    }
+
+private:
+    const SyntheticRobot& m_robot;
+    std::shared_ptr<iDynTree::KinDynComputations> m_kinDyn;
+    SyntheticJointTrajectory m_trajectory;
+    iDynTree::FreeFloatingGeneralizedTorques m_gravityTorques;
+    RobotDynamicsEstimatorInput m_input;
+};
+
+void setProblemSize(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"ft", "contacts"})->ArgsProduct({{1, 2, 4}, {1, 2, 4}});
+}
+
+/**
+ * Measure the time required by a step of the RobotDynamicsEstimator, i.e. setting the input and
+ * advancing the estimator, given the number of force/torque sensors, hence of sub-models, and the
+ * number of external contacts.
+ */
+void advanceRobotDynamicsEstimator(benchmark::State& state)
+{
+    const SyntheticRobot robot = createSyntheticRobot(state.range(0), state.range(1));
+    auto handler = createParametersHandler(robot);
+
+    auto kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    if (!kinDyn->loadRobotModel(robot.model)
+        || !kinDyn->setFrameVelocityRepresentation(iDynTree::BODY_FIXED_REPRESENTATION))
+    {
+        state.SkipWithError("Unable to load the model.");
+        return;
+    }
+
+    SubModelCreator subModelCreator;
+    subModelCreator.setModelAndSensors(robot.model, robot.sensors);
+    if (!subModelCreator.setKinDyn(kinDyn)
+        || !subModelCreator.createSubModels(handler->getGroup("MODEL")))
+    {
+        state.SkipWithError("Unable to create the sub-models.");
+        return;
+    }
+
+    const std::vector<SubModel>& subModelList = subModelCreator.getSubModelList();
+    std::vector<std::shared_ptr<KinDynWrapper>> kinDynWrapperList;
+    for (const auto& subModel : subModelList)
+    {
+        kinDynWrapperList.push_back(std::make_shared<KinDynWrapper>());
+        if (!kinDynWrapperList.back()->setModel(subModel))
+        {
+            state.SkipWithError("Unable to load the sub-models.");
+            return;
+        }
+    }
+
+    SyntheticMeasurements measurements(robot, kinDyn);
+    std::unique_ptr<RobotDynamicsEstimator> estimator
+        = RobotDynamicsEstimator::build(handler, kinDyn, subModelList, kinDynWrapperList);
+    if (estimator == nullptr || !measurements.update(std::chrono::nanoseconds::zero())
+        || !estimator->setInitialState(measurements.getState()))
+    {
+        state.SkipWithError("Unable to initialize the estimator.");
+        return;
+    }
+
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+    std::chrono::nanoseconds totalStepTime = std::chrono::nanoseconds::zero();
+    BenchmarkUtils::DistributionCounter stepTime("step_time", state.max_iterations);
+    for (auto _ : state)
+    {
+        if (!measurements.update(time))
+        {
+            state.SkipWithError("Unable to compute the measurements.");
+            break;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool isAdvanced = estimator->setInput(measurements.input()) && estimator->advance();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start);
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+
+        if (!isAdvanced)
+        {
+            state.SkipWithError("Unable to advance the estimator.");
+            break;
+        }
+
+        stepTime.add(elapsed);
+        totalStepTime += elapsed;
+        time += samplingTime;
+    }
+
+    stepTime.setCounters(state);
+    state.counters["sub_models"] = subModelList.size();
+    if (totalStepTime > std::chrono::nanoseconds::zero())
+    {
+        state.counters["steps_per_second"]
+            = state.iterations() / std::chrono::duration<double>(totalStepTime).count();
+    }
+}
+} // namespace
+
+BENCHMARK(advanceRobotDynamicsEstimator)
+    ->Apply(setProblemSize)
+    ->Iterations(numberOfSteps)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
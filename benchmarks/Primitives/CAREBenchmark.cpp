@@ -0,0 +1,186 @@
+/**
+ * @file CAREBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/Math/CARE.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Math;
+
+namespace
+{
+// size of the state of the problems solved in a batch
+constexpr std::size_t stateSizeBatch = 8;
+
+/**
+ * Create the matrices of a set of unstable decoupled second order systems, e.g. the linearized
+ * dynamics of a set of inverted pendulums, whose state is \f$[x_i, \dot{x}_i]\f$ and whose input is
+ * \f$\ddot{x}_i\f$. The stiffness of each system is scaled by a given factor, so that close
+ * problems can be created.
+ * @param stateSize size of the state. It must be even.
+ * @param scaling scaling of the stiffness of the systems.
+ */
+CARE::Matrices createProblem(std::size_t stateSize, double scaling = 1.0)
+{
+    const std::size_t numberOfSystems = stateSize / 2;
+
+    CARE::Matrices problem;
+    problem.A = Eigen::MatrixXd::Zero(stateSize, stateSize);
+    problem.B = Eigen::MatrixXd::Zero(stateSize, numberOfSystems);
+    for (std::size_t i = 0; i < numberOfSystems; i++)
+    {
+        problem.A(2 * i, 2 * i + 1) = 1;
+        problem.A(2 * i + 1, 2 * i) = scaling * (1.0 + i);
+        problem.B(2 * i + 1, i) = 1;
+    }
+    problem.Q = Eigen::MatrixXd::Identity(stateSize, stateSize);
+    problem.R = Eigen::MatrixXd::Identity(numberOfSystems, numberOfSystems);
+    return problem;
+}
+
+void setStateSize(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("state_size")->RangeMultiplier(2)->Range(2, 64);
+}
+
+/**
+ * Measure the time required to solve a Riccati equation with the matrix sign function.
+ */
+void solveCARE(benchmark::State& state)
+{
+    const CARE::Matrices problem = createProblem(state.range(0));
+
+    CARE care;
+    if (!care.setMatrices(problem.A, problem.B, problem.Q, problem.R))
+    {
+        state.SkipWithError("Unable to set the matrices.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        if (!care.solve())
+        {
+            state.SkipWithError("Unable to solve the Riccati equation.");
+            break;
+        }
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to solve a Riccati equation whose matrices change slightly at each
+ * iteration, e.g. when the gains of a LQR controller are recomputed online. The previous solution
+ * is refined with the Newton-Kleinman iterations.
+ */
+void solveCAREWarmStart(benchmark::State& state)
+{
+    const std::vector<CARE::Matrices> problems = {createProblem(state.range(0), 0.99),
+                                                  createProblem(state.range(0), 1.01)};
+
+    auto handler = std::make_shared<ParametersHandler::StdImplementation>();
+    handler->setParameter("warm_start", true);
+
+    CARE care;
+    if (!care.initialize(handler))
+    {
+        state.SkipWithError("Unable to initialize the solver.");
+        return;
+    }
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        const CARE::Matrices& problem = problems[index];
+        index = (index + 1) % problems.size();
+
+        // the matrices are set before the timer is started since only the solution is measured
+        if (!care.setMatrices(problem.A, problem.B, problem.Q, problem.R))
+        {
+            state.SkipWithError("Unable to set the matrices.");
+            break;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool isSolved = care.solve();
+        state.SetIterationTime(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!isSolved)
+        {
+            state.SkipWithError("Unable to solve the Riccati equation.");
+            break;
+        }
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to solve a batch of close Riccati equations, e.g. to compute the gains
+ * of a controller on a grid of operating points.
+ */
+void solveCAREBatch(benchmark::State& state, std::size_t numberOfThreads)
+{
+    const std::size_t numberOfProblems = state.range(0);
+    std::vector<CARE::Matrices> problems;
+    for (std::size_t i = 0; i < numberOfProblems; i++)
+    {
+        problems.push_back(createProblem(stateSizeBatch, 1.0 + 0.01 * i));
+    }
+
+    CARE care;
+    std::vector<Eigen::MatrixXd> solutions;
+    for (auto _ : state)
+    {
+        if (!care.solveBatch(problems, solutions, numberOfThreads))
+        {
+            state.SkipWithError("Unable to solve the Riccati equations.");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * numberOfProblems);
+    state.SetComplexityN(state.range(0));
+}
+} // namespace
+
+BENCHMARK(solveCARE)
+    ->Apply(setStateSize)
+    ->Complexity(benchmark::oNCubed)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(solveCAREWarmStart)
+    ->Apply(setStateSize)
+    ->UseManualTime()
+    ->Complexity(benchmark::oNCubed)
+    ->Unit(benchmark::kMicrosecond);
+
+// the threads are created by each call of CARE::solveBatch, hence their cost is included
+BENCHMARK_CAPTURE(solveCAREBatch, single_thread, 1)
+    ->ArgName("problems")
+    ->RangeMultiplier(4)
+    ->Range(8, 512)
+    ->Complexity(benchmark::oN)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(solveCAREBatch, hardware_threads, 0)
+    ->ArgName("problems")
+    ->RangeMultiplier(4)
+    ->Range(8, 512)
+    ->UseRealTime()
+    ->Complexity(benchmark::oN)
+    ->Unit(benchmark::kMillisecond);
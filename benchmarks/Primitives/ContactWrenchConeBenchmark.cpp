@@ -0,0 +1,103 @@
+/**
+ * @file ContactWrenchConeBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/Math/ContactWrenchCone.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Math;
+
+namespace
+{
+std::shared_ptr<ParametersHandler::StdImplementation> createParametersHandler(int numberOfSlices)
+{
+    auto handler = std::make_shared<ParametersHandler::StdImplementation>();
+    handler->setParameter("number_of_slices", numberOfSlices);
+    handler->setParameter("static_friction_coefficient", 0.33);
+    handler->setParameter("foot_limits_x", std::vector<double>{-0.08, 0.12});
+    handler->setParameter("foot_limits_y", std::vector<double>{-0.03, 0.03});
+    return handler;
+}
+
+void setNumberOfSlices(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("slices")->RangeMultiplier(2)->Range(1, 64);
+}
+
+/**
+ * Measure the time required to initialize a cone. If isShared is true, a cone having the same
+ * parameters already exists, hence the constraints are not computed again.
+ */
+void initializeContactWrenchCone(benchmark::State& state, bool isShared)
+{
+    auto handler = createParametersHandler(state.range(0));
+
+    ContactWrenchCone sharedCone;
+    if (isShared && !sharedCone.initialize(handler))
+    {
+        state.SkipWithError("Unable to initialize the cone.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        ContactWrenchCone cone;
+        if (!cone.initialize(handler))
+        {
+            state.SkipWithError("Unable to initialize the cone.");
+            break;
+        }
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to express the constraints of a cone in mixed representation.
+ */
+void computeContactWrenchConeRotatedA(benchmark::State& state)
+{
+    ContactWrenchCone cone;
+    if (!cone.initialize(createParametersHandler(state.range(0))))
+    {
+        state.SkipWithError("Unable to initialize the cone.");
+        return;
+    }
+
+    const Eigen::Matrix3d rotation
+        = Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized()).toRotationMatrix();
+    Eigen::MatrixXd A(cone.getA().rows(), cone.getA().cols());
+    for (auto _ : state)
+    {
+        if (!cone.computeRotatedA(rotation, A))
+        {
+            state.SkipWithError("Unable to compute the rotated constraints.");
+            break;
+        }
+        benchmark::DoNotOptimize(A.data());
+    }
+
+    state.counters["constraints"] = A.rows();
+    state.SetComplexityN(state.range(0));
+}
+} // namespace
+
+BENCHMARK_CAPTURE(initializeContactWrenchCone, computed, false)
+    ->Apply(setNumberOfSlices)
+    ->Complexity(benchmark::oN);
+
+BENCHMARK_CAPTURE(initializeContactWrenchCone, shared, true)
+    ->Apply(setNumberOfSlices)
+    ->Complexity(benchmark::o1);
+
+BENCHMARK(computeContactWrenchConeRotatedA)->Apply(setNumberOfSlices)->Complexity(benchmark::oN);
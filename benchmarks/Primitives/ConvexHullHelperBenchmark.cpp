@@ -0,0 +1,101 @@
+/**
+ * @file ConvexHullHelperBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstddef>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/Planners/ConvexHullHelper.h>
+
+using namespace BipedalLocomotion::Planners;
+
+namespace
+{
+/**
+ * Get a set of points uniformly distributed on the unit sphere. All the points are vertices of the
+ * convex hull, hence the number of facets grows linearly with the number of points.
+ * @return a matrix containing a point in each column.
+ */
+Eigen::MatrixXd createPointsOnSphere(std::size_t numberOfPoints)
+{
+    std::mt19937 generator(42);
+    std::normal_distribution<double> distribution;
+
+    Eigen::MatrixXd points(3, numberOfPoints);
+    for (std::size_t i = 0; i < numberOfPoints; i++)
+    {
+        points.col(i) = Eigen::Vector3d::NullaryExpr([&]() { return distribution(generator); })
+                            .normalized();
+    }
+    return points;
+}
+
+void setNumberOfPoints(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("points")->RangeMultiplier(4)->Range(8, 2048);
+}
+
+/**
+ * Measure the time required to build the convex hull of a set of points.
+ */
+void buildConvexHull(benchmark::State& state)
+{
+    const Eigen::MatrixXd points = createPointsOnSphere(state.range(0));
+
+    ConvexHullHelper helper;
+    for (auto _ : state)
+    {
+        if (!helper.buildConvexHull(points))
+        {
+            state.SkipWithError("Unable to build the convex hull.");
+            break;
+        }
+    }
+
+    state.counters["facets"] = helper.getA().rows();
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to check if a point belongs to the convex hull.
+ */
+void checkPointBelongsToConvexHull(benchmark::State& state)
+{
+    ConvexHullHelper helper;
+    if (!helper.buildConvexHull(createPointsOnSphere(state.range(0))))
+    {
+        state.SkipWithError("Unable to build the convex hull.");
+        return;
+    }
+
+    // the even points are inside the hull, the odd ones are outside
+    Eigen::MatrixXd points = createPointsOnSphere(64);
+    for (Eigen::Index i = 0; i < points.cols(); i++)
+    {
+        points.col(i) *= (i % 2 == 0) ? 0.5 : 1.5;
+    }
+
+    Eigen::Index index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(helper.doesPointBelongToConvexHull(points.col(index)));
+        index = (index + 1) % points.cols();
+    }
+
+    state.counters["facets"] = helper.getA().rows();
+    state.SetComplexityN(state.range(0));
+}
+} // namespace
+
+BENCHMARK(buildConvexHull)
+    ->Apply(setNumberOfPoints)
+    ->Complexity(benchmark::oNLogN)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(checkPointBelongsToConvexHull)->Apply(setNumberOfPoints)->Complexity(benchmark::oN);
@@ -0,0 +1,169 @@
+/**
+ * @file SO3PlannerBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <Eigen/Geometry> // Required because of https://github.com/artivis/manif/issues/162
+#include <chrono>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <manif/SO3.h>
+
+#include <BipedalLocomotion/Planners/SO3Planner.h>
+
+using namespace BipedalLocomotion::Planners;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr std::chrono::nanoseconds trajectoryDuration = 1s;
+constexpr std::chrono::nanoseconds advanceTimeStep = 1ms;
+
+/**
+ * Get a deterministic set of rotations.
+ */
+std::vector<manif::SO3d> createRotations(std::size_t size)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-M_PI, M_PI);
+
+    std::vector<manif::SO3d> rotations(size);
+    for (auto& rotation : rotations)
+    {
+        rotation = manif::SO3d(distribution(generator),
+                               distribution(generator) / 2,
+                               distribution(generator));
+    }
+    return rotations;
+}
+
+/**
+ * Set zero initial and final velocity and acceleration.
+ */
+template <class PlannerType> bool setBoundaryConditions(PlannerType& planner)
+{
+    const manif::SO3d::Tangent zero = manif::SO3d::Tangent::Zero();
+    return planner.setInitialConditions(zero, zero) && planner.setFinalConditions(zero, zero);
+}
+
+/**
+ * Measure the time required to plan a trajectory between two rotations. The coefficients of the
+ * trajectory are computed lazily by the first evaluation of the trajectory.
+ */
+template <class PlannerType> void computeSO3PlannerCoefficients(benchmark::State& state)
+{
+    const std::vector<manif::SO3d> rotations = createRotations(64);
+
+    PlannerType planner;
+    if (!setBoundaryConditions(planner))
+    {
+        state.SkipWithError("Unable to set the boundary conditions.");
+        return;
+    }
+
+    SO3PlannerState output;
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        const std::size_t next = (index + 1) % rotations.size();
+        if (!planner.setRotations(rotations[index], rotations[next], trajectoryDuration)
+            || !planner.evaluatePoint(std::chrono::nanoseconds::zero(), output))
+        {
+            state.SkipWithError("Unable to compute the trajectory.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.rotation.coeffs().data());
+        index = next;
+    }
+}
+
+/**
+ * Measure the time required to evaluate the trajectory at a given time instant.
+ */
+template <class PlannerType> void evaluateSO3PlannerPoint(benchmark::State& state)
+{
+    const std::vector<manif::SO3d> rotations = createRotations(2);
+
+    PlannerType planner;
+    if (!setBoundaryConditions(planner)
+        || !planner.setRotations(rotations[0], rotations[1], trajectoryDuration))
+    {
+        state.SkipWithError("Unable to set the trajectory.");
+        return;
+    }
+
+    SO3PlannerState output;
+    std::chrono::nanoseconds time = std::chrono::nanoseconds::zero();
+    for (auto _ : state)
+    {
+        if (!planner.evaluatePoint(time, output))
+        {
+            state.SkipWithError("Unable to evaluate the trajectory.");
+            break;
+        }
+        benchmark::DoNotOptimize(output.rotation.coeffs().data());
+        time = (time + advanceTimeStep) % trajectoryDuration;
+    }
+}
+
+/**
+ * Measure the time required to sample the whole trajectory with the advance interface.
+ */
+template <class PlannerType> void advanceSO3Planner(benchmark::State& state)
+{
+    const std::vector<manif::SO3d> rotations = createRotations(2);
+    const std::size_t numberOfSamples = trajectoryDuration / advanceTimeStep;
+
+    PlannerType planner;
+    if (!setBoundaryConditions(planner) || !planner.setAdvanceTimeStep(advanceTimeStep))
+    {
+        state.SkipWithError("Unable to initialize the planner.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        // setting the rotations resets the time of the advance interface. The coefficients are
+        // computed by the first advance
+        if (!planner.setRotations(rotations[0], rotations[1], trajectoryDuration))
+        {
+            state.SkipWithError("Unable to set the rotations.");
+            break;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        bool ok = true;
+        for (std::size_t i = 0; i < numberOfSamples; i++)
+        {
+            ok = ok && planner.advance();
+        }
+        state.SetIterationTime(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!ok)
+        {
+            state.SkipWithError("Unable to advance the planner.");
+            break;
+        }
+        benchmark::DoNotOptimize(planner.getOutput().rotation.coeffs().data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * numberOfSamples);
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(computeSO3PlannerCoefficients, SO3PlannerInertial);
+BENCHMARK_TEMPLATE(computeSO3PlannerCoefficients, SO3PlannerBody);
+BENCHMARK_TEMPLATE(evaluateSO3PlannerPoint, SO3PlannerInertial);
+BENCHMARK_TEMPLATE(evaluateSO3PlannerPoint, SO3PlannerBody);
+BENCHMARK_TEMPLATE(advanceSO3Planner, SO3PlannerInertial)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(advanceSO3Planner, SO3PlannerBody)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,293 @@
+/**
+ * @file SplinesBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/Math/CubicSpline.h>
+#include <BipedalLocomotion/Math/LinearSpline.h>
+#include <BipedalLocomotion/Math/QuadraticBezierCurve.h>
+#include <BipedalLocomotion/Math/QuinticSpline.h>
+#include <BipedalLocomotion/Math/ZeroOrderSpline.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Math;
+using namespace std::chrono_literals;
+
+namespace
+{
+using Vector = Eigen::Vector3d;
+
+// time between two consecutive knots
+constexpr std::chrono::nanoseconds knotsDistance = 100ms;
+
+// time step of the advance interface, i.e. ten samples between two consecutive knots
+constexpr std::chrono::nanoseconds advanceTimeStep = 10ms;
+
+// number of knots of the splines evaluated in a batch
+constexpr std::size_t numberOfKnotsBatch = 64;
+
+/**
+ * Knots of a spline passing through random points.
+ */
+struct Knots
+{
+    std::vector<Vector> positions;
+    std::vector<std::chrono::nanoseconds> times;
+};
+
+Knots createKnots(std::size_t numberOfKnots)
+{
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+    Knots knots;
+    knots.positions.resize(numberOfKnots);
+    knots.times.resize(numberOfKnots);
+    for (std::size_t i = 0; i < numberOfKnots; i++)
+    {
+        knots.positions[i] = Vector::NullaryExpr([&]() { return distribution(generator); });
+        knots.times[i] = i * knotsDistance;
+    }
+    return knots;
+}
+
+/**
+ * Get a set of time instants drawn uniformly from the time span of the spline.
+ */
+std::vector<std::chrono::nanoseconds> createRandomTimes(const Knots& knots, std::size_t size)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<std::chrono::nanoseconds::rep>
+        distribution(knots.times.front().count(), knots.times.back().count());
+
+    std::vector<std::chrono::nanoseconds> times(size);
+    for (auto& time : times)
+    {
+        time = std::chrono::nanoseconds(distribution(generator));
+    }
+    return times;
+}
+
+/**
+ * Set the knots and the boundary conditions of a spline.
+ */
+template <class SplineType> bool setSplineKnots(const Knots& knots, SplineType& spline)
+{
+    return spline.setKnots(knots.positions, knots.times)
+           && spline.setInitialConditions(Vector::Zero(), Vector::Zero())
+           && spline.setFinalConditions(Vector::Zero(), Vector::Zero());
+}
+
+void setNumberOfKnots(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("knots")->RangeMultiplier(4)->Range(4, 1024);
+}
+
+void setNumberOfPoints(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("points")->RangeMultiplier(4)->Range(64, 16384);
+}
+
+/**
+ * Measure the time required to set the knots of a spline and to compute its coefficients. The
+ * coefficients are computed lazily by the first evaluation of the spline.
+ */
+template <class SplineType> void computeSplineCoefficients(benchmark::State& state)
+{
+    const Knots knots = createKnots(state.range(0));
+
+    SplineType spline;
+    Vector position;
+    for (auto _ : state)
+    {
+        if (!setSplineKnots(knots, spline) || !spline.evaluatePoint(knots.times.front(), position))
+        {
+            state.SkipWithError("Unable to compute the coefficients of the spline.");
+            break;
+        }
+        benchmark::DoNotOptimize(position.data());
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to evaluate a spline at a random time instant.
+ */
+template <class SplineType> void evaluateSplinePoint(benchmark::State& state)
+{
+    const Knots knots = createKnots(state.range(0));
+    const std::vector<std::chrono::nanoseconds> times = createRandomTimes(knots, 1024);
+
+    SplineType spline;
+    Vector position, velocity, acceleration;
+    if (!setSplineKnots(knots, spline) || !spline.evaluatePoint(knots.times.front(), position))
+    {
+        state.SkipWithError("Unable to compute the coefficients of the spline.");
+        return;
+    }
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        if (!spline.evaluatePoint(times[index], position, velocity, acceleration))
+        {
+            state.SkipWithError("Unable to evaluate the spline.");
+            break;
+        }
+        benchmark::DoNotOptimize(acceleration.data());
+        index = (index + 1) % times.size();
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to evaluate a spline at a set of ordered time instants.
+ */
+template <class SplineType> void evaluateSplineOrderedPoints(benchmark::State& state)
+{
+    const Knots knots = createKnots(numberOfKnotsBatch);
+    std::vector<std::chrono::nanoseconds> times = createRandomTimes(knots, state.range(0));
+    std::sort(times.begin(), times.end());
+
+    SplineType spline;
+    std::vector<Vector> positions, velocities, accelerations;
+    if (!setSplineKnots(knots, spline))
+    {
+        state.SkipWithError("Unable to set the knots of the spline.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        if (!spline.evaluateOrderedPoints(times, positions, velocities, accelerations))
+        {
+            state.SkipWithError("Unable to evaluate the spline.");
+            break;
+        }
+        benchmark::DoNotOptimize(accelerations.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * times.size());
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to sample a whole spline with the advance interface. The number of
+ * samples is proportional to the number of knots.
+ */
+template <class SplineType> void advanceSpline(benchmark::State& state)
+{
+    const Knots knots = createKnots(state.range(0));
+    const std::size_t numberOfSamples = knots.times.back() / advanceTimeStep;
+
+    SplineType spline;
+    Vector position;
+    if (!spline.setAdvanceTimeStep(advanceTimeStep))
+    {
+        state.SkipWithError("Unable to set the advance time step.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        // setting the knots resets the time of the advance interface
+        if (!setSplineKnots(knots, spline) || !spline.evaluatePoint(knots.times.front(), position))
+        {
+            state.SkipWithError("Unable to compute the coefficients of the spline.");
+            break;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        bool ok = true;
+        for (std::size_t i = 0; i < numberOfSamples; i++)
+        {
+            ok = ok && spline.advance();
+        }
+        state.SetIterationTime(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!ok)
+        {
+            state.SkipWithError("Unable to advance the spline.");
+            break;
+        }
+        benchmark::DoNotOptimize(spline.getOutput().position.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * numberOfSamples);
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to evaluate a quadratic Bézier curve given the number of knots.
+ */
+void evaluateQuadraticBezierCurve(benchmark::State& state)
+{
+    auto handler = std::make_shared<ParametersHandler::StdImplementation>();
+    handler->setParameter("number_of_knots", static_cast<int>(state.range(0)));
+
+    QuadraticBezierCurve curve;
+    if (!curve.initialize(handler))
+    {
+        state.SkipWithError("Unable to initialize the curve.");
+        return;
+    }
+
+    const Eigen::Vector2d initialPoint(0, 0);
+    const Eigen::Vector2d controlPoint(0.5, 1);
+    const Eigen::Vector2d finalPoint(1, 0);
+    for (auto _ : state)
+    {
+        const auto points = curve.evaluateCurve(initialPoint, controlPoint, finalPoint);
+        benchmark::DoNotOptimize(points.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetComplexityN(state.range(0));
+}
+} // namespace
+
+#define BIPEDAL_LOCOMOTION_SPLINE_BENCHMARKS(SplineType)                                           \
+    BENCHMARK_TEMPLATE(computeSplineCoefficients, SplineType)                                      \
+        ->Apply(setNumberOfKnots)                                                                  \
+        ->Complexity()                                                                             \
+        ->Unit(benchmark::kMicrosecond);                                                           \
+    BENCHMARK_TEMPLATE(evaluateSplinePoint, SplineType)                                            \
+        ->Apply(setNumberOfKnots)                                                                  \
+        ->Complexity();                                                                            \
+    BENCHMARK_TEMPLATE(evaluateSplineOrderedPoints, SplineType)                                    \
+        ->Apply(setNumberOfPoints)                                                                 \
+        ->Complexity(benchmark::oN)                                                                \
+        ->Unit(benchmark::kMicrosecond);                                                           \
+    BENCHMARK_TEMPLATE(advanceSpline, SplineType)                                                  \
+        ->Apply(setNumberOfKnots)                                                                  \
+        ->UseManualTime()                                                                          \
+        ->Complexity()                                                                             \
+        ->Unit(benchmark::kMicrosecond)
+
+BIPEDAL_LOCOMOTION_SPLINE_BENCHMARKS(ZeroOrderSpline<Vector>);
+BIPEDAL_LOCOMOTION_SPLINE_BENCHMARKS(LinearSpline<Vector>);
+BIPEDAL_LOCOMOTION_SPLINE_BENCHMARKS(CubicSpline<Vector>);
+BIPEDAL_LOCOMOTION_SPLINE_BENCHMARKS(QuinticSpline<Vector>);
+
+BENCHMARK(evaluateQuadraticBezierCurve)
+    ->ArgName("knots")
+    ->RangeMultiplier(4)
+    ->Range(16, 4096)
+    ->Complexity(benchmark::oN);
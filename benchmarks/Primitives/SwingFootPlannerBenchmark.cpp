@@ -0,0 +1,152 @@
+/**
+ * @file SwingFootPlannerBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Geometry>
+#include <manif/SE3.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/DistributionCounter.h>
+#include <BipedalLocomotion/Contacts/ContactList.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/Planners/SwingFootPlanner.h>
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Planners;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr std::chrono::nanoseconds samplingTime = 10ms;
+constexpr std::chrono::nanoseconds stanceDuration = 400ms;
+constexpr std::chrono::nanoseconds swingDuration = 600ms;
+
+// number of steps of the trajectory sampled by the advanceSwingFootPlanner benchmark
+constexpr std::size_t numberOfStepsAdvance = 10;
+
+// the last contact lasts one step, hence the trajectory contains (steps + 1) * 100 samples
+constexpr std::size_t numberOfSamplesAdvance
+    = (numberOfStepsAdvance + 1) * (stanceDuration + swingDuration) / samplingTime;
+
+std::shared_ptr<ParametersHandler::StdImplementation>
+createParametersHandler(const std::string& interpolationMethod)
+{
+    auto handler = std::make_shared<ParametersHandler::StdImplementation>();
+    handler->setParameter("sampling_time", samplingTime);
+    handler->setParameter("step_height", 0.1);
+    handler->setParameter("foot_apex_time", 0.5);
+    handler->setParameter("interpolation_method", interpolationMethod);
+    return handler;
+}
+
+/**
+ * Create the contact list of a foot walking along a curve. At each step the foot moves forward
+ * and turns.
+ */
+bool createContactList(std::size_t numberOfSteps, Contacts::ContactList& contactList)
+{
+    const std::chrono::nanoseconds stepDuration = stanceDuration + swingDuration;
+    for (std::size_t i = 0; i <= numberOfSteps; i++)
+    {
+        const manif::SE3d pose({0.2 * i, 0.02 * i * i, 0},
+                               Eigen::AngleAxisd(0.1 * i, Eigen::Vector3d::UnitZ()));
+        const std::chrono::nanoseconds activationTime = i * stepDuration;
+
+        // the last contact lasts a whole step
+        const std::chrono::nanoseconds deactivationTime
+            = activationTime + (i == numberOfSteps ? stepDuration : stanceDuration);
+        if (!contactList.addContact(pose, activationTime, deactivationTime))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Measure the time required to set the contact list of the planner given the number of steps.
+ */
+void setSwingFootPlannerContactList(benchmark::State& state)
+{
+    SwingFootPlanner planner;
+    Contacts::ContactList contactList;
+    if (!planner.initialize(createParametersHandler("min_acceleration"))
+        || !createContactList(state.range(0), contactList))
+    {
+        state.SkipWithError("Unable to initialize the benchmark.");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        // the planner has not been advanced yet, hence the contact list is replaced
+        if (!planner.setContactList(contactList))
+        {
+            state.SkipWithError("Unable to set the contact list.");
+            break;
+        }
+    }
+
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Measure the time required to advance the planner along a walking trajectory. The distribution
+ * of the time is reported since the trajectory of the foot is planned at the take off.
+ */
+void advanceSwingFootPlanner(benchmark::State& state, std::string interpolationMethod)
+{
+    SwingFootPlanner planner;
+    Contacts::ContactList contactList;
+    if (!planner.initialize(createParametersHandler(interpolationMethod))
+        || !createContactList(numberOfStepsAdvance, contactList)
+        || !planner.setContactList(contactList))
+    {
+        state.SkipWithError("Unable to initialize the benchmark.");
+        return;
+    }
+
+    BenchmarkUtils::DistributionCounter advanceTime("advance_time", state.max_iterations);
+    for (auto _ : state)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const bool isAdvanced = planner.advance();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        state.SetIterationTime(std::chrono::duration<double>(elapsed).count());
+
+        if (!isAdvanced)
+        {
+            state.SkipWithError("Unable to advance the planner.");
+            break;
+        }
+
+        advanceTime.add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+
+    advanceTime.setCounters(state);
+}
+} // namespace
+
+BENCHMARK(setSwingFootPlannerContactList)
+    ->ArgName("steps")
+    ->RangeMultiplier(4)
+    ->Range(4, 1024)
+    ->Complexity(benchmark::oN);
+
+BENCHMARK_CAPTURE(advanceSwingFootPlanner, min_acceleration, std::string("min_acceleration"))
+    ->Iterations(numberOfSamplesAdvance)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(advanceSwingFootPlanner, min_jerk, std::string("min_jerk"))
+    ->Iterations(numberOfSamplesAdvance)
+    ->UseManualTime()
+    ->Unit(benchmark::kMicrosecond);
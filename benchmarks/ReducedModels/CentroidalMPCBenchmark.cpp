@@ -0,0 +1,295 @@
+/**
+ * @file CentroidalMPCBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/BenchmarkUtils/DistributionCounter.h>
+#include <BipedalLocomotion/Contacts/ContactPhaseList.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/ReducedModelControllers/CentroidalMPC.h>
+
+#include "ReducedModelsBenchmark.h"
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Benchmarks;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::ReducedModelControllers;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr std::chrono::nanoseconds samplingTime = 100ms;
+constexpr double comHeight = 0.53;
+
+// number of control cycles used to compute the distribution of the solve time
+constexpr std::size_t numberOfControlCycles = 200;
+
+// the first control cycles are not measured, the solver starts far from the solution
+constexpr std::size_t warmUpControlCycles = 5;
+
+/**
+ * Create the parameters of the controller given the arguments of the benchmark, i.e. the number of
+ * knots of the horizon, the number of contacts, the number of corners per contact and if the warm
+ * start is enabled.
+ */
+std::shared_ptr<StdImplementation> createParametersHandler(const benchmark::State& state,
+                                                           const IpoptSettings& settings)
+{
+    const std::size_t horizon = state.range(0);
+    const std::size_t numberOfContacts = state.range(1);
+    const std::size_t numberOfCorners = state.range(2);
+    const bool isWarmStartEnabled = state.range(3) != 0;
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("sampling_time", samplingTime);
+    handler->setParameter("time_horizon",
+                          std::chrono::nanoseconds(samplingTime * static_cast<int>(horizon)));
+    handler->setParameter("number_of_maximum_contacts", static_cast<int>(numberOfContacts));
+    handler->setParameter("number_of_slices", 1);
+    handler->setParameter("static_friction_coefficient", 0.33);
+    handler->setParameter("solver_verbosity", 0);
+    handler->setParameter("solver_name", "ipopt");
+    handler->setParameter("linear_solver", std::string(settings.linearSolver));
+    handler->setParameter("ipopt_tolerance", settings.tolerance);
+    handler->setParameter("is_warm_start_enabled", isWarmStartEnabled);
+
+    handler->setParameter("com_weight", std::vector<double>{1, 1, 1000});
+    handler->setParameter("contact_position_weight", 1e3);
+    handler->setParameter("force_rate_of_change_weight", std::vector<double>{10, 10, 10});
+    handler->setParameter("angular_momentum_weight", 1e5);
+    handler->setParameter("contact_force_symmetry_weight", 10.0);
+
+    const std::vector<Eigen::Vector3d> corners = getContactCorners(numberOfCorners);
+    for (std::size_t i = 0; i < numberOfContacts; i++)
+    {
+        auto contactHandler = std::make_shared<StdImplementation>();
+        contactHandler->setParameter("contact_name", getContactName(i));
+        contactHandler->setParameter("number_of_corners", static_cast<int>(numberOfCorners));
+        for (std::size_t j = 0; j < numberOfCorners; j++)
+        {
+            contactHandler->setParameter("corner_" + std::to_string(j),
+                                         std::vector<double>(corners[j].data(),
+                                                             corners[j].data() + 3));
+        }
+        contactHandler->setParameter("bounding_box_lower_limit",
+                                     std::vector<double>{-0.05, -0.05, 0});
+        contactHandler->setParameter("bounding_box_upper_limit",
+                                     std::vector<double>{0.05, 0.05, 0});
+        handler->setGroup("CONTACT_" + std::to_string(i), contactHandler);
+    }
+
+    return handler;
+}
+
+/**
+ * WalkingSimulation closes the loop of the controller assuming that the centroidal state evolves
+ * as predicted by the controller.
+ */
+class WalkingSimulation
+{
+public:
+    bool initialize(const benchmark::State& state, std::size_t numberOfCycles)
+    {
+        m_horizon = state.range(0);
+
+        // the contact phase list must cover the horizon of the last control cycle
+        if (!createWalkingContactPhaseList(state.range(1),
+                                           samplingTime * (numberOfCycles + m_horizon + 1),
+                                           m_phaseList))
+        {
+            return false;
+        }
+
+        m_phaseIt = m_phaseList.getPresentPhase(m_currentTime);
+        m_com = getCoMReference(m_phaseList, m_currentTime, comHeight);
+        m_dcom.setZero();
+        m_angularMomentum.setZero();
+        m_comReference.resize(m_horizon + 1);
+        m_angularMomentumReference.resize(m_horizon + 1, Eigen::Vector3d::Zero());
+
+        return true;
+    }
+
+    /**
+     * Set the inputs of the controller.
+     */
+    bool setInputs(CentroidalMPC& mpc)
+    {
+        for (std::size_t i = 0; i < m_comReference.size(); i++)
+        {
+            m_comReference[i] = getCoMReference(m_phaseList, m_currentTime + samplingTime * i, //
+                                                comHeight);
+        }
+
+        return mpc.setState(m_com, m_dcom, m_angularMomentum)
+               && mpc.setReferenceTrajectory(m_comReference, m_angularMomentumReference)
+               && mpc.setContactPhaseList(m_phaseList);
+    }
+
+    /**
+     * Update the state with the output of the controller and move to the next control cycle.
+     */
+    void update(const CentroidalMPC& mpc)
+    {
+        const auto& output = mpc.getOutput();
+        m_com = output.comTrajectory[1];
+        m_dcom = output.comVelocityTrajectory[1];
+        m_angularMomentum = output.angularMomentumTrajectory[1];
+        m_currentTime += samplingTime;
+
+        // the contact locations adjusted by the controller are considered once the contact is
+        // established
+        auto newPhaseIt = m_phaseList.getPresentPhase(m_currentTime);
+        if (newPhaseIt != m_phaseIt)
+        {
+            if (newPhaseIt->activeContacts.size() > m_phaseIt->activeContacts.size())
+            {
+                m_phaseList = output.contactPhaseList;
+                newPhaseIt = m_phaseList.getPresentPhase(m_currentTime);
+            }
+            m_phaseIt = newPhaseIt;
+        }
+    }
+
+private:
+    std::size_t m_horizon{0};
+    std::chrono::nanoseconds m_currentTime{0};
+    Contacts::ContactPhaseList m_phaseList;
+    Contacts::ContactPhaseList::const_iterator m_phaseIt;
+    Eigen::Vector3d m_com;
+    Eigen::Vector3d m_dcom;
+    Eigen::Vector3d m_angularMomentum;
+    std::vector<Eigen::Vector3d> m_comReference;
+    std::vector<Eigen::Vector3d> m_angularMomentumReference;
+};
+
+void setProblemSize(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"horizon", "contacts", "corners", "warm_start"})
+        ->ArgsProduct({{5, 10, 15, 20}, {2, 4}, {4, 8}, {0, 1}});
+}
+
+void setHorizon(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"horizon", "contacts", "corners", "warm_start"})
+        ->ArgsProduct({{5, 10, 15, 20}, {2}, {4}, {0, 1}});
+}
+
+/**
+ * Measure the time required to build the optimization problem.
+ */
+void initializeCentroidalMPC(benchmark::State& state, IpoptSettings settings)
+{
+    auto handler = createParametersHandler(state, settings);
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto mpc = std::make_unique<CentroidalMPC>();
+        state.ResumeTiming();
+
+        const bool isInitialized = mpc->initialize(handler);
+
+        state.PauseTiming();
+        mpc.reset();
+        state.ResumeTiming();
+
+        if (!isInitialized)
+        {
+            state.SkipWithError("Unable to initialize the controller.");
+            break;
+        }
+    }
+}
+
+/**
+ * Measure the time required by the advance of the controller while walking. The distributions of
+ * the time spent by the solver and of the number of iterations are reported as counters.
+ */
+void advanceCentroidalMPC(benchmark::State& state, IpoptSettings settings)
+{
+    CentroidalMPC mpc;
+    WalkingSimulation simulation;
+    if (!mpc.initialize(createParametersHandler(state, settings))
+        || !simulation.initialize(state, warmUpControlCycles + state.max_iterations))
+    {
+        state.SkipWithError("Unable to initialize the benchmark.");
+        return;
+    }
+
+    for (std::size_t i = 0; i < warmUpControlCycles; i++)
+    {
+        if (!simulation.setInputs(mpc) || !mpc.advance())
+        {
+            state.SkipWithError("Unable to advance the controller.");
+            return;
+        }
+        simulation.update(mpc);
+    }
+
+    BenchmarkUtils::DistributionCounter solveTime("solve_time", state.max_iterations);
+    BenchmarkUtils::DistributionCounter iterations("iterations", state.max_iterations);
+    for (auto _ : state)
+    {
+        if (!simulation.setInputs(mpc))
+        {
+            state.SkipWithError("Unable to set the inputs of the controller.");
+            break;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool isAdvanced = mpc.advance();
+        state.SetIterationTime(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!isAdvanced)
+        {
+            state.SkipWithError("Unable to advance the controller.");
+            break;
+        }
+
+        solveTime.add(mpc.getStatistics().solverDuration);
+        iterations.add(mpc.getStatistics().numberOfIterations);
+        simulation.update(mpc);
+    }
+
+    solveTime.setCounters(state);
+    iterations.setCounters(state);
+}
+} // namespace
+
+BENCHMARK_CAPTURE(initializeCentroidalMPC, mumps, IpoptSettings{"mumps", 1e-8})
+    ->Apply(setProblemSize)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(advanceCentroidalMPC, mumps, IpoptSettings{"mumps", 1e-8})
+    ->Apply(setProblemSize)
+    ->Iterations(numberOfControlCycles)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(advanceCentroidalMPC,
+                  mumps_low_tolerance,
+                  IpoptSettings{"mumps", 1e-4})
+    ->Apply(setHorizon)
+    ->Iterations(numberOfControlCycles)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+// ma27 is available only if ipopt has been compiled with the HSL libraries, otherwise the benchmark
+// is skipped
+BENCHMARK_CAPTURE(advanceCentroidalMPC, ma27, IpoptSettings{"ma27", 1e-8})
+    ->Apply(setHorizon)
+    ->Iterations(numberOfControlCycles)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,173 @@
+/**
+ * @file ReducedModelsBenchmark.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARKS_REDUCED_MODELS_BENCHMARK_H
+#define BIPEDAL_LOCOMOTION_BENCHMARKS_REDUCED_MODELS_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <manif/manif.h>
+
+#include <BipedalLocomotion/Contacts/ContactList.h>
+#include <BipedalLocomotion/Contacts/ContactPhaseList.h>
+
+namespace BipedalLocomotion
+{
+namespace Benchmarks
+{
+
+/**
+ * IpoptSettings contains the options of ipopt compared by the benchmarks.
+ */
+struct IpoptSettings
+{
+    const char* linearSolver; /**< Linear solver used by ipopt. */
+    double tolerance; /**< Convergence tolerance of ipopt. */
+};
+
+/**
+ * WalkingGait contains the timings and the step length of the walking contact phase lists.
+ * @note The durations are multiple of 100ms, so that the contact lists can be used by controllers
+ * running at 10Hz.
+ */
+struct WalkingGait
+{
+    /** Duration of the first and the last phase, where all the contacts are active. */
+    std::chrono::nanoseconds initialStanceDuration{std::chrono::seconds(1)};
+
+    /** Duration of the swing phase. */
+    std::chrono::nanoseconds swingDuration{std::chrono::milliseconds(600)};
+
+    /** Duration of the phase between two steps, where all the contacts are active. */
+    std::chrono::nanoseconds doubleSupportDuration{std::chrono::milliseconds(400)};
+
+    double stepLength{0.1}; /**< Forward displacement of a contact at each step. */
+};
+
+/**
+ * Get the name of the i-th contact of the walking contact phase lists.
+ */
+inline std::string getContactName(std::size_t index)
+{
+    return "contact_" + std::to_string(index);
+}
+
+/**
+ * Get the position of the corners of a contact. The corners are placed on an ellipse with semi-axes
+ * of 0.1m and 0.05m.
+ */
+inline std::vector<Eigen::Vector3d> getContactCorners(std::size_t numberOfCorners)
+{
+    std::vector<Eigen::Vector3d> corners(numberOfCorners);
+    for (std::size_t i = 0; i < numberOfCorners; i++)
+    {
+        // the first corner is placed on the front left of the contact
+        const double angle = M_PI / 4 + 2 * M_PI * i / numberOfCorners;
+        corners[i] << 0.1 * std::cos(angle), 0.05 * std::sin(angle), 0;
+    }
+    return corners;
+}
+
+/**
+ * Create a walking contact phase list. In case of two contacts, the contacts are the feet of a
+ * biped, in case of four contacts they are the feet of a quadruped moving with a trot, i.e. the
+ * diagonal pairs swing together.
+ * @param numberOfContacts number of contacts. It must be 2 or 4.
+ * @param minimumDuration minimum duration of the contact phase list. The number of steps is chosen
+ * accordingly.
+ * @param phaseList the contact phase list.
+ * @param gait timings and step length of the contact phase list.
+ * @return true in case of success, false otherwise.
+ */
+inline bool createWalkingContactPhaseList(std::size_t numberOfContacts,
+                                          const std::chrono::nanoseconds& minimumDuration,
+                                          Contacts::ContactPhaseList& phaseList,
+                                          const WalkingGait& gait = WalkingGait())
+{
+    std::vector<Eigen::Vector3d> nominalPositions;
+    if (numberOfContacts == 2)
+    {
+        nominalPositions = {{0, 0.08, 0}, {0, -0.08, 0}};
+    } else if (numberOfContacts == 4)
+    {
+        // front left, front right, rear right and rear left. Even and odd contacts are diagonal
+        nominalPositions = {{0.2, 0.1, 0}, {0.2, -0.1, 0}, {-0.2, -0.1, 0}, {-0.2, 0.1, 0}};
+    } else
+    {
+        return false;
+    }
+
+    // the even contacts swing during the even steps, the odd ones during the odd steps
+    const std::chrono::nanoseconds stepDuration = gait.swingDuration + gait.doubleSupportDuration;
+    const double minimumNumberOfSteps = std::chrono::duration<double>(minimumDuration).count()
+                                        / std::chrono::duration<double>(stepDuration).count();
+    const std::size_t numberOfSteps = std::max<std::size_t>(2, std::ceil(minimumNumberOfSteps));
+    const std::chrono::nanoseconds endTime = 2 * gait.initialStanceDuration
+                                             + numberOfSteps * stepDuration
+                                             - gait.doubleSupportDuration;
+
+    Contacts::ContactListMap contactListMap;
+    for (std::size_t i = 0; i < numberOfContacts; i++)
+    {
+        Contacts::ContactList& contactList = contactListMap[getContactName(i)];
+        Eigen::Vector3d position = nominalPositions[i];
+        std::chrono::nanoseconds activationTime = std::chrono::nanoseconds::zero();
+
+        for (std::size_t step = i % 2; step < numberOfSteps; step += 2)
+        {
+            const std::chrono::nanoseconds liftOffTime
+                = gait.initialStanceDuration + step * stepDuration;
+            if (!contactList.addContact(manif::SE3d(position, manif::SO3d::Identity()),
+                                        activationTime,
+                                        liftOffTime))
+            {
+                return false;
+            }
+
+            position(0) += gait.stepLength;
+            activationTime = liftOffTime + gait.swingDuration;
+        }
+
+        if (!contactList.addContact(manif::SE3d(position, manif::SO3d::Identity()),
+                                    activationTime,
+                                    endTime))
+        {
+            return false;
+        }
+    }
+
+    phaseList.setLists(contactListMap);
+    return true;
+}
+
+/**
+ * Get the reference position of the CoM at a given time. The CoM is placed at a given height above
+ * the mean position of the last contacts established.
+ */
+inline Eigen::Vector3d getCoMReference(const Contacts::ContactPhaseList& phaseList,
+                                       const std::chrono::nanoseconds& time,
+                                       double height)
+{
+    Eigen::Vector3d com = Eigen::Vector3d::Zero();
+    for (const auto& [key, contactList] : phaseList.lists())
+    {
+        com += contactList.getPresentContact(time)->pose.translation();
+    }
+    com /= phaseList.lists().size();
+    com(2) += height;
+    return com;
+}
+
+} // namespace Benchmarks
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARKS_REDUCED_MODELS_BENCHMARK_H
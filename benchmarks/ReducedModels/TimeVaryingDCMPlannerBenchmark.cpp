@@ -0,0 +1,191 @@
+/**
+ * @file TimeVaryingDCMPlannerBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/BenchmarkUtils/DistributionCounter.h>
+#include <BipedalLocomotion/Contacts/ContactPhaseList.h>
+#include <BipedalLocomotion/Math/Constants.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/Planners/TimeVaryingDCMPlanner.h>
+
+#include "ReducedModelsBenchmark.h"
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Benchmarks;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::Planners;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr double dcmHeight = 0.53;
+
+// number of trajectories used to compute the distribution of the solve time
+constexpr std::size_t numberOfTrajectories = 50;
+
+/**
+ * Create the parameters of the planner given the number of corners of the feet.
+ */
+std::shared_ptr<StdImplementation> createParametersHandler(std::size_t numberOfCorners,
+                                                           const IpoptSettings& settings)
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("planner_sampling_time", 50ms);
+    handler->setParameter("linear_solver", std::string(settings.linearSolver));
+    handler->setParameter("ipopt_tolerance", settings.tolerance);
+
+    const std::vector<Eigen::Vector3d> corners = getContactCorners(numberOfCorners);
+    handler->setParameter("number_of_foot_corners", static_cast<int>(numberOfCorners));
+    for (std::size_t i = 0; i < numberOfCorners; i++)
+    {
+        handler->setParameter("foot_corner_" + std::to_string(i),
+                              std::vector<double>(corners[i].data(), corners[i].data() + 3));
+    }
+
+    handler->setParameter("omega_dot_weight", 1.0);
+    handler->setParameter("dcm_tracking_weight", 1.0);
+    handler->setParameter("omega_dot_rate_of_change_weight", 10.0);
+    handler->setParameter("vrp_rate_of_change_weight", 100.0);
+    handler->setParameter("dcm_rate_of_change_weight", 1.0);
+
+    return handler;
+}
+
+void setNumberOfCorners(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("corners")->Arg(4)->Arg(8);
+}
+
+void setProblemSize(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"steps", "corners"})->ArgsProduct({{2, 4, 8, 16}, {4, 8}});
+}
+
+void setNumberOfSteps(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgNames({"steps", "corners"})->ArgsProduct({{2, 4, 8, 16}, {4}});
+}
+
+/**
+ * Measure the time required to initialize the planner.
+ * @note The optimization problem depends on the contact phase list, it is built by
+ * TimeVaryingDCMPlanner::computeTrajectory and its duration is reported by the
+ * computeTimeVaryingDCMPlannerTrajectory benchmark.
+ */
+void initializeTimeVaryingDCMPlanner(benchmark::State& state, IpoptSettings settings)
+{
+    auto handler = createParametersHandler(state.range(0), settings);
+
+    for (auto _ : state)
+    {
+        TimeVaryingDCMPlanner planner;
+        if (!planner.initialize(handler))
+        {
+            state.SkipWithError("Unable to initialize the planner.");
+            break;
+        }
+    }
+}
+
+/**
+ * Measure the time required to compute the DCM trajectory of a walking contact phase list. The
+ * distributions of the time spent to build the optimization problem, of the time spent by the
+ * solver and of the number of iterations are reported as counters.
+ */
+void computeTimeVaryingDCMPlannerTrajectory(benchmark::State& state, IpoptSettings settings)
+{
+    // the walking contact phase list starts and ends with a stance phase lasting one second
+    const WalkingGait gait;
+    const std::chrono::nanoseconds stepDuration = gait.swingDuration + gait.doubleSupportDuration;
+
+    TimeVaryingDCMPlanner planner;
+    Contacts::ContactPhaseList phaseList;
+    if (!planner.initialize(createParametersHandler(state.range(1), settings))
+        || !createWalkingContactPhaseList(2, stepDuration * state.range(0), phaseList, gait))
+    {
+        state.SkipWithError("Unable to initialize the benchmark.");
+        return;
+    }
+
+    DCMPlannerState initialState;
+    initialState.dcmPosition = getCoMReference(phaseList, 0s, dcmHeight);
+    initialState.dcmVelocity.setZero();
+    initialState.vrpPosition = initialState.dcmPosition;
+    initialState.omega = std::sqrt(Math::StandardAccelerationOfGravitation / dcmHeight);
+
+    BenchmarkUtils::DistributionCounter setupTime("setup_time", state.max_iterations);
+    BenchmarkUtils::DistributionCounter solveTime("solve_time", state.max_iterations);
+    BenchmarkUtils::DistributionCounter iterations("iterations", state.max_iterations);
+    for (auto _ : state)
+    {
+        // setting the contact phase list invalidates the trajectory previously computed
+        if (!planner.setContactPhaseList(phaseList))
+        {
+            state.SkipWithError("Unable to set the contact phase list.");
+            break;
+        }
+        planner.setInitialState(initialState);
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool isComputed = planner.computeTrajectory();
+        state.SetIterationTime(
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+        if (!isComputed)
+        {
+            state.SkipWithError("Unable to compute the trajectory.");
+            break;
+        }
+
+        setupTime.add(planner.getStatistics().problemSetupDuration);
+        solveTime.add(planner.getStatistics().solverDuration);
+        iterations.add(planner.getStatistics().numberOfIterations);
+    }
+
+    setupTime.setCounters(state);
+    solveTime.setCounters(state);
+    iterations.setCounters(state);
+}
+} // namespace
+
+BENCHMARK_CAPTURE(initializeTimeVaryingDCMPlanner, mumps, IpoptSettings{"mumps", 1e-8})
+    ->Apply(setNumberOfCorners)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(computeTimeVaryingDCMPlannerTrajectory,
+                  mumps,
+                  IpoptSettings{"mumps", 1e-8})
+    ->Apply(setProblemSize)
+    ->Iterations(numberOfTrajectories)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(computeTimeVaryingDCMPlannerTrajectory,
+                  mumps_low_tolerance,
+                  IpoptSettings{"mumps", 1e-4})
+    ->Apply(setNumberOfSteps)
+    ->Iterations(numberOfTrajectories)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+// ma27 is available only if ipopt has been compiled with the HSL libraries, otherwise the benchmark
+// is skipped
+BENCHMARK_CAPTURE(computeTimeVaryingDCMPlannerTrajectory,
+                  ma27,
+                  IpoptSettings{"ma27", 1e-8})
+    ->Apply(setNumberOfSteps)
+    ->Iterations(numberOfTrajectories)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
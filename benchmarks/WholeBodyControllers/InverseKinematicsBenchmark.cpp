@@ -0,0 +1,175 @@
+/**
+ * @file InverseKinematicsBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/EigenHelpers.h>
+#include <iDynTree/KinDynComputations.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/RandomModel.h>
+#include <BipedalLocomotion/Conversions/ManifConversions.h>
+#include <BipedalLocomotion/IK/CoMTask.h>
+#include <BipedalLocomotion/IK/JointLimitsTask.h>
+#include <BipedalLocomotion/IK/JointTrackingTask.h>
+#include <BipedalLocomotion/IK/QPFixedBaseInverseKinematics.h>
+#include <BipedalLocomotion/IK/QPInverseKinematics.h>
+#include <BipedalLocomotion/IK/SE3Task.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+#include "LinearTaskSolverBenchmark.h"
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Benchmarks;
+using namespace BipedalLocomotion::IK;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr auto robotVelocity = "robot_velocity";
+constexpr std::size_t highPriority = 0;
+constexpr std::size_t lowPriority = 1;
+
+std::shared_ptr<StdImplementation> createTaskHandler(const std::string& type)
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("robot_velocity_variable_name", robotVelocity);
+    handler->setParameter("type", type);
+    return handler;
+}
+
+/**
+ * Build an inverse kinematics problem controlling the pose of an end-effector (and the position of
+ * the center of mass in case of floating base robot) as hard constraints, subject to the joint
+ * limits, and regularizing the joint positions.
+ */
+template <class InverseKinematics>
+bool createProblem(std::size_t numberOfJoints,
+                   LinearTaskSolverProblem<InverseKinematics>& problem)
+{
+    constexpr bool isFloatingBase = !std::is_same_v<InverseKinematics, QPFixedBaseInverseKinematics>;
+
+    problem.kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    if (!problem.kinDyn->setFrameVelocityRepresentation(
+            iDynTree::FrameVelocityRepresentation::MIXED_REPRESENTATION)
+        || !problem.kinDyn->loadRobotModel(BenchmarkUtils::getRandomKinematicTree(numberOfJoints))
+        || !BenchmarkUtils::setRandomRobotState(*problem.kinDyn))
+    {
+        return false;
+    }
+
+    const std::size_t dofs = problem.kinDyn->getNrOfDegreesOfFreedom();
+    Eigen::VectorXd jointPositions(dofs);
+    problem.kinDyn->getJointPos(jointPositions);
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("robot_velocity_variable_name", robotVelocity);
+    handler->setParameter("verbosity", false);
+
+    problem.solver = std::make_shared<InverseKinematics>();
+    if constexpr (!isFloatingBase)
+    {
+        if (!problem.solver->setKinDyn(problem.kinDyn))
+        {
+            return false;
+        }
+    }
+    if (!problem.solver->initialize(handler))
+    {
+        return false;
+    }
+
+    // end-effector pose
+    const std::string endEffectorFrame = "link" + std::to_string(numberOfJoints - 1);
+    auto se3Handler = createTaskHandler("SE3Task");
+    se3Handler->setParameter("kp_linear", 5.0);
+    se3Handler->setParameter("kp_angular", 5.0);
+    se3Handler->setParameter("frame_name", endEffectorFrame);
+    auto se3Task = std::make_shared<SE3Task>();
+    if (!se3Task->setKinDyn(problem.kinDyn) || !se3Task->initialize(se3Handler)
+        || !se3Task->setSetPoint(
+            Conversions::toManifPose(problem.kinDyn->getWorldTransform(endEffectorFrame)))
+        || !problem.solver->addTask(se3Task, "se3_task", highPriority))
+    {
+        return false;
+    }
+
+    // center of mass position
+    if constexpr (isFloatingBase)
+    {
+        auto comHandler = createTaskHandler("CoMTask");
+        comHandler->setParameter("kp_linear", 5.0);
+        auto comTask = std::make_shared<CoMTask>();
+        if (!comTask->setKinDyn(problem.kinDyn) || !comTask->initialize(comHandler)
+            || !comTask->setSetPoint(iDynTree::toEigen(
+                                         problem.kinDyn->getCenterOfMassPosition()),
+                                     Eigen::Vector3d::Zero())
+            || !problem.solver->addTask(comTask, "com_task", highPriority))
+        {
+            return false;
+        }
+    }
+
+    // joint limits
+    constexpr double jointLimitDelta = 0.5;
+    auto jointLimitsHandler = createTaskHandler("JointLimitsTask");
+    jointLimitsHandler->setParameter("sampling_time", std::chrono::nanoseconds(10ms));
+    jointLimitsHandler->setParameter("use_model_limits", false);
+    jointLimitsHandler->setParameter("klim", Eigen::VectorXd::Constant(dofs, 0.5).eval());
+    jointLimitsHandler->setParameter("upper_limits",
+                                     (jointPositions.array() + jointLimitDelta).matrix().eval());
+    jointLimitsHandler->setParameter("lower_limits",
+                                     (jointPositions.array() - jointLimitDelta).matrix().eval());
+    auto jointLimitsTask = std::make_shared<JointLimitsTask>();
+    if (!jointLimitsTask->setKinDyn(problem.kinDyn)
+        || !jointLimitsTask->initialize(jointLimitsHandler)
+        || !problem.solver->addTask(jointLimitsTask, "joint_limits_task", highPriority))
+    {
+        return false;
+    }
+
+    // joint regularization
+    const Eigen::VectorXd regularizationWeight = Eigen::VectorXd::Ones(dofs);
+    auto regularizationHandler = createTaskHandler("JointTrackingTask");
+    regularizationHandler->setParameter("kp", Eigen::VectorXd::Ones(dofs).eval());
+    auto regularizationTask = std::make_shared<JointTrackingTask>();
+    if (!regularizationTask->setKinDyn(problem.kinDyn)
+        || !regularizationTask->initialize(regularizationHandler)
+        || !regularizationTask->setSetPoint(jointPositions)
+        || !problem.solver->addTask(regularizationTask,
+                                    "regularization_task",
+                                    lowPriority,
+                                    regularizationWeight))
+    {
+        return false;
+    }
+
+    constexpr std::size_t spatialVelocitySize = 6;
+    return problem.variablesHandler.addVariable(robotVelocity, dofs + spatialVelocitySize)
+           && problem.solver->finalize(problem.variablesHandler);
+}
+} // namespace
+
+BENCHMARK_CAPTURE(finalize, QPInverseKinematics, createProblem<QPInverseKinematics>)
+    ->Apply(setNumberOfJoints);
+BENCHMARK_CAPTURE(advance, QPInverseKinematics, createProblem<QPInverseKinematics>)
+    ->Apply(setNumberOfJoints);
+
+BENCHMARK_CAPTURE(finalize,
+                  QPFixedBaseInverseKinematics,
+                  createProblem<QPFixedBaseInverseKinematics>)
+    ->Apply(setNumberOfJoints);
+BENCHMARK_CAPTURE(advance,
+                  QPFixedBaseInverseKinematics,
+                  createProblem<QPFixedBaseInverseKinematics>)
+    ->Apply(setNumberOfJoints);
@@ -0,0 +1,134 @@
+/**
+ * @file LinearTaskSolverBenchmark.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BENCHMARKS_LINEAR_TASK_SOLVER_BENCHMARK_H
+#define BIPEDAL_LOCOMOTION_BENCHMARKS_LINEAR_TASK_SOLVER_BENCHMARK_H
+
+#include <cstddef>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <iDynTree/KinDynComputations.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/LinearTaskSolverTimingsCounter.h>
+#include <BipedalLocomotion/BenchmarkUtils/MemoryOperationsCounter.h>
+#include <BipedalLocomotion/System/VariablesHandler.h>
+
+namespace BipedalLocomotion
+{
+namespace Benchmarks
+{
+
+/**
+ * LinearTaskSolverProblem contains a solver and the objects it depends on.
+ */
+template <class Solver> struct LinearTaskSolverProblem
+{
+    std::shared_ptr<iDynTree::KinDynComputations> kinDyn; /**< Kinematics and dynamics of the
+                                                             robot shared by the tasks. */
+    std::shared_ptr<Solver> solver; /**< Finalized solver. */
+    System::VariablesHandler variablesHandler; /**< Variables of the problem. */
+};
+
+/**
+ * Function building a problem given the number of joints of the robot.
+ */
+template <class Solver>
+using LinearTaskSolverProblemBuilder = bool (*)(std::size_t numberOfJoints,
+                                                LinearTaskSolverProblem<Solver>& problem);
+
+/**
+ * Set the number of joints of the random models used by the benchmarks.
+ */
+inline void setNumberOfJoints(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("dofs")->DenseRange(12, 60, 12)->Unit(benchmark::kMicrosecond);
+}
+
+/**
+ * Measure the time required to finalize the solver, i.e. to allocate the problem once the tasks are
+ * added.
+ */
+template <class Solver>
+void finalize(benchmark::State& state, LinearTaskSolverProblemBuilder<Solver> build)
+{
+    LinearTaskSolverProblem<Solver> problem;
+    if (!build(state.range(0), problem))
+    {
+        state.SkipWithError("Unable to build the problem.");
+        return;
+    }
+
+    BenchmarkUtils::MemoryOperationsCounter memoryOperations;
+    for (auto _ : state)
+    {
+        memoryOperations.start();
+        const bool isFinalized = problem.solver->finalize(problem.variablesHandler);
+        memoryOperations.stop();
+
+        if (!isFinalized)
+        {
+            state.SkipWithError("Unable to finalize the solver.");
+            break;
+        }
+    }
+
+    memoryOperations.setCounter(state);
+    state.counters["variables"] = problem.variablesHandler.getNumberOfVariables();
+}
+
+/**
+ * Measure the steady-state time required by the advance of the solver. The duration of the update
+ * of the tasks, of the assembly of the problem and of its solution are reported as counters.
+ */
+template <class Solver>
+void advance(benchmark::State& state, LinearTaskSolverProblemBuilder<Solver> build)
+{
+    LinearTaskSolverProblem<Solver> problem;
+    if (!build(state.range(0), problem))
+    {
+        state.SkipWithError("Unable to build the problem.");
+        return;
+    }
+
+    // the first advance initializes the QP solver, the following ones are warm started
+    constexpr std::size_t warmUpIterations = 10;
+    for (std::size_t i = 0; i < warmUpIterations; i++)
+    {
+        if (!problem.solver->advance())
+        {
+            state.SkipWithError("Unable to advance the solver.");
+            return;
+        }
+    }
+
+    BenchmarkUtils::MemoryOperationsCounter memoryOperations;
+    BenchmarkUtils::LinearTaskSolverTimingsCounter timings;
+    for (auto _ : state)
+    {
+        memoryOperations.start();
+        const bool isAdvanced = problem.solver->advance();
+        memoryOperations.stop();
+
+        if (!isAdvanced)
+        {
+            state.SkipWithError("Unable to advance the solver.");
+            break;
+        }
+
+        timings.add(problem.solver->getTimings());
+    }
+
+    memoryOperations.setCounter(state);
+    timings.setCounters(state);
+    state.counters["variables"] = problem.variablesHandler.getNumberOfVariables();
+}
+
+} // namespace Benchmarks
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BENCHMARKS_LINEAR_TASK_SOLVER_BENCHMARK_H
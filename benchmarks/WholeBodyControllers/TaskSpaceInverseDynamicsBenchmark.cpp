@@ -0,0 +1,283 @@
+/**
+ * @file TaskSpaceInverseDynamicsBenchmark.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/EigenHelpers.h>
+#include <iDynTree/KinDynComputations.h>
+
+#include <BipedalLocomotion/BenchmarkUtils/RandomModel.h>
+#include <BipedalLocomotion/Conversions/ManifConversions.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/TSID/BaseDynamicsTask.h>
+#include <BipedalLocomotion/TSID/CoMTask.h>
+#include <BipedalLocomotion/TSID/FeasibleContactWrenchTask.h>
+#include <BipedalLocomotion/TSID/JointDynamicsTask.h>
+#include <BipedalLocomotion/TSID/JointTrackingTask.h>
+#include <BipedalLocomotion/TSID/QPFixedBaseTSID.h>
+#include <BipedalLocomotion/TSID/QPTSID.h>
+#include <BipedalLocomotion/TSID/SE3Task.h>
+#include <BipedalLocomotion/TSID/SO3Task.h>
+#include <BipedalLocomotion/TSID/TaskSpaceInverseDynamics.h>
+
+#include "LinearTaskSolverBenchmark.h"
+
+using namespace BipedalLocomotion;
+using namespace BipedalLocomotion::Benchmarks;
+using namespace BipedalLocomotion::TSID;
+using namespace BipedalLocomotion::ParametersHandler;
+
+namespace
+{
+constexpr auto robotAcceleration = "robot_acceleration";
+constexpr auto jointTorques = "joint_torques";
+constexpr std::size_t highPriority = 0;
+constexpr std::size_t lowPriority = 1;
+constexpr std::size_t spatialAccelerationSize = 6;
+constexpr std::size_t wrenchSize = 6;
+constexpr double kp = 100.0;
+const double kd = 2 * std::sqrt(kp);
+
+std::shared_ptr<StdImplementation> createSolverHandler()
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("robot_acceleration_variable_name", robotAcceleration);
+    handler->setParameter("joint_torques_variable_name", jointTorques);
+    handler->setParameter("verbosity", false);
+    return handler;
+}
+
+bool loadRandomRobot(std::size_t numberOfJoints,
+                     std::shared_ptr<iDynTree::KinDynComputations>& kinDyn)
+{
+    kinDyn = std::make_shared<iDynTree::KinDynComputations>();
+    return kinDyn->setFrameVelocityRepresentation(
+               iDynTree::FrameVelocityRepresentation::MIXED_REPRESENTATION)
+           && kinDyn->loadRobotModel(BenchmarkUtils::getRandomKinematicTree(numberOfJoints))
+           && BenchmarkUtils::setRandomRobotState(*kinDyn);
+}
+
+bool addSE3Task(const std::string& frameName,
+                std::size_t priority,
+                std::shared_ptr<iDynTree::KinDynComputations> kinDyn,
+                TaskSpaceInverseDynamics& solver)
+{
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("robot_acceleration_variable_name", robotAcceleration);
+    handler->setParameter("frame_name", frameName);
+    handler->setParameter("kp_linear", kp);
+    handler->setParameter("kd_linear", kd);
+    handler->setParameter("kp_angular", kp);
+    handler->setParameter("kd_angular", kd);
+
+    auto task = std::make_shared<SE3Task>();
+    if (!task->setKinDyn(kinDyn) || !task->initialize(handler)
+        || !task->setSetPoint(Conversions::toManifPose(kinDyn->getWorldTransform(frameName)),
+                              manif::SE3d::Tangent::Zero(),
+                              manif::SE3d::Tangent::Zero()))
+    {
+        return false;
+    }
+
+    if (priority == highPriority)
+    {
+        return solver.addTask(task, frameName + "_se3_task", priority);
+    }
+
+    constexpr double weight = 10.0;
+    return solver.addTask(task,
+                          frameName + "_se3_task",
+                          priority,
+                          Eigen::VectorXd::Constant(task->size(), weight));
+}
+
+bool addJointRegularizationTask(std::shared_ptr<iDynTree::KinDynComputations> kinDyn,
+                                TaskSpaceInverseDynamics& solver)
+{
+    const std::size_t dofs = kinDyn->getNrOfDegreesOfFreedom();
+    Eigen::VectorXd jointPositions(dofs);
+    kinDyn->getJointPos(jointPositions);
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("robot_acceleration_variable_name", robotAcceleration);
+    handler->setParameter("kp", Eigen::VectorXd::Constant(dofs, 1.0).eval());
+
+    auto task = std::make_shared<JointTrackingTask>();
+    return task->setKinDyn(kinDyn) && task->initialize(handler)
+           && task->setSetPoint(jointPositions)
+           && solver.addTask(task, "regularization_task", lowPriority, Eigen::VectorXd::Ones(dofs));
+}
+
+/**
+ * Build a fixed base TSID controlling the pose of an end-effector and regularizing the joint
+ * positions. The joint dynamics is added by QPFixedBaseTSID.
+ */
+bool createQPFixedBaseTSID(std::size_t numberOfJoints,
+                           LinearTaskSolverProblem<QPFixedBaseTSID>& problem)
+{
+    if (!loadRandomRobot(numberOfJoints, problem.kinDyn))
+    {
+        return false;
+    }
+
+    problem.solver = std::make_shared<QPFixedBaseTSID>();
+    if (!problem.solver->setKinDyn(problem.kinDyn)
+        || !problem.solver->initialize(createSolverHandler()))
+    {
+        return false;
+    }
+
+    const std::string endEffectorFrame = "link" + std::to_string(numberOfJoints - 1);
+    if (!addSE3Task(endEffectorFrame, highPriority, problem.kinDyn, *problem.solver)
+        || !addJointRegularizationTask(problem.kinDyn, *problem.solver))
+    {
+        return false;
+    }
+
+    const std::size_t dofs = problem.kinDyn->getNrOfDegreesOfFreedom();
+    return problem.variablesHandler.addVariable(robotAcceleration, dofs + spatialAccelerationSize)
+           && problem.variablesHandler.addVariable(jointTorques, dofs)
+           && problem.solver->finalize(problem.variablesHandler);
+}
+
+/**
+ * Build a floating base TSID for a robot standing on two feet. The floating base and joint
+ * dynamics and the feasibility of the contact wrenches are hard constraints, while the feet poses,
+ * the center of mass position, the base orientation and the joint positions are tracked with a
+ * weight.
+ */
+bool createQPTSID(std::size_t numberOfJoints, LinearTaskSolverProblem<QPTSID>& problem)
+{
+    if (!loadRandomRobot(numberOfJoints, problem.kinDyn))
+    {
+        return false;
+    }
+
+    const std::vector<std::string> feet{"link" + std::to_string(numberOfJoints - 1),
+                                        "link" + std::to_string(numberOfJoints - 2)};
+    const std::vector<std::string> wrenches{"left_foot_wrench", "right_foot_wrench"};
+
+    auto solverHandler = createSolverHandler();
+    solverHandler->setParameter("contact_wrench_variables_name", wrenches);
+
+    problem.solver = std::make_shared<QPTSID>();
+    if (!problem.solver->initialize(solverHandler))
+    {
+        return false;
+    }
+
+    // floating base and joint dynamics
+    auto dynamicsHandler = createSolverHandler();
+    dynamicsHandler->setParameter("max_number_of_contacts", static_cast<int>(feet.size()));
+    for (std::size_t i = 0; i < feet.size(); i++)
+    {
+        auto contactHandler = std::make_shared<StdImplementation>();
+        contactHandler->setParameter("variable_name", wrenches[i]);
+        contactHandler->setParameter("frame_name", feet[i]);
+        dynamicsHandler->setGroup("CONTACT_" + std::to_string(i), contactHandler);
+    }
+
+    auto baseDynamicsTask = std::make_shared<BaseDynamicsTask>();
+    auto jointDynamicsTask = std::make_shared<JointDynamicsTask>();
+    if (!baseDynamicsTask->setKinDyn(problem.kinDyn)
+        || !baseDynamicsTask->initialize(dynamicsHandler)
+        || !problem.solver->addTask(baseDynamicsTask, "base_dynamics_task", highPriority)
+        || !jointDynamicsTask->setKinDyn(problem.kinDyn)
+        || !jointDynamicsTask->initialize(dynamicsHandler)
+        || !problem.solver->addTask(jointDynamicsTask, "joint_dynamics_task", highPriority))
+    {
+        return false;
+    }
+
+    // feasibility of the contact wrenches and pose of the feet
+    std::vector<std::shared_ptr<FeasibleContactWrenchTask>> contactWrenchTasks;
+    for (std::size_t i = 0; i < feet.size(); i++)
+    {
+        auto handler = std::make_shared<StdImplementation>();
+        handler->setParameter("variable_name", wrenches[i]);
+        handler->setParameter("frame_name", feet[i]);
+        handler->setParameter("number_of_slices", 2);
+        handler->setParameter("static_friction_coefficient", 0.3);
+        handler->setParameter("foot_limits_x", std::vector<double>{-0.1, 0.1});
+        handler->setParameter("foot_limits_y", std::vector<double>{-0.05, 0.05});
+
+        auto task = std::make_shared<FeasibleContactWrenchTask>();
+        if (!task->setKinDyn(problem.kinDyn) || !task->initialize(handler)
+            || !problem.solver->addTask(task, feet[i] + "_wrench_task", highPriority)
+            || !addSE3Task(feet[i], lowPriority, problem.kinDyn, *problem.solver))
+        {
+            return false;
+        }
+        contactWrenchTasks.push_back(task);
+    }
+
+    // center of mass position
+    auto comHandler = std::make_shared<StdImplementation>();
+    comHandler->setParameter("robot_acceleration_variable_name", robotAcceleration);
+    comHandler->setParameter("kp_linear", kp);
+    comHandler->setParameter("kd_linear", kd);
+    auto comTask = std::make_shared<CoMTask>();
+    if (!comTask->setKinDyn(problem.kinDyn) || !comTask->initialize(comHandler)
+        || !comTask->setSetPoint(iDynTree::toEigen(problem.kinDyn->getCenterOfMassPosition()))
+        || !problem.solver->addTask(comTask, "com_task", lowPriority, Eigen::Vector3d::Ones()))
+    {
+        return false;
+    }
+
+    // base orientation
+    const std::string baseFrame = problem.kinDyn->getFloatingBase();
+    auto baseHandler = std::make_shared<StdImplementation>();
+    baseHandler->setParameter("robot_acceleration_variable_name", robotAcceleration);
+    baseHandler->setParameter("frame_name", baseFrame);
+    baseHandler->setParameter("kp_angular", kp);
+    baseHandler->setParameter("kd_angular", kd);
+    auto baseTask = std::make_shared<SO3Task>();
+    if (!baseTask->setKinDyn(problem.kinDyn) || !baseTask->initialize(baseHandler)
+        || !baseTask->setSetPoint(Conversions::toManifRot(
+                                      problem.kinDyn->getWorldTransform(baseFrame).getRotation()),
+                                  manif::SO3d::Tangent::Zero(),
+                                  manif::SO3d::Tangent::Zero())
+        || !problem.solver->addTask(baseTask, "base_task", lowPriority, Eigen::Vector3d::Ones()))
+    {
+        return false;
+    }
+
+    if (!addJointRegularizationTask(problem.kinDyn, *problem.solver))
+    {
+        return false;
+    }
+
+    const std::size_t dofs = problem.kinDyn->getNrOfDegreesOfFreedom();
+    if (!problem.variablesHandler.addVariable(robotAcceleration, dofs + spatialAccelerationSize)
+        || !problem.variablesHandler.addVariable(jointTorques, dofs)
+        || !problem.variablesHandler.addVariable(wrenches[0], wrenchSize)
+        || !problem.variablesHandler.addVariable(wrenches[1], wrenchSize)
+        || !problem.solver->finalize(problem.variablesHandler))
+    {
+        return false;
+    }
+
+    for (const auto& task : contactWrenchTasks)
+    {
+        task->setContactActive(true);
+    }
+
+    return true;
+}
+} // namespace
+
+BENCHMARK_CAPTURE(finalize, QPTSID, createQPTSID)->Apply(setNumberOfJoints);
+BENCHMARK_CAPTURE(advance, QPTSID, createQPTSID)->Apply(setNumberOfJoints);
+
+BENCHMARK_CAPTURE(finalize, QPFixedBaseTSID, createQPFixedBaseTSID)->Apply(setNumberOfJoints);
+BENCHMARK_CAPTURE(advance, QPFixedBaseTSID, createQPFixedBaseTSID)->Apply(setNumberOfJoints);
@@ -10,6 +10,11 @@
 #include <pybind11/stl.h>
 #include <pybind11/chrono.h>
 
+#include <Eigen/Dense>
+
+#include <chrono>
+#include <string>
+
 #include <BipedalLocomotion/ContactDetectors/ContactDetector.h>
 #include <BipedalLocomotion/ContactDetectors/FixedFootDetector.h>
 #include <BipedalLocomotion/ContactDetectors/SchmittTriggerDetector.h>
@@ -73,7 +78,47 @@ void CreateSchmittTriggerDetector(pybind11::module& module)
              py::arg("contact_name"),
              py::arg("state"),
              py::arg("params"))
-        .def("remove_contact", &SchmittTriggerDetector::removeContact, py::arg("contact_name"));
+        .def("remove_contact", &SchmittTriggerDetector::removeContact, py::arg("contact_name"))
+        .def(
+            "advance_window",
+            [](SchmittTriggerDetector& impl,
+               const std::string& contactName,
+               Eigen::Ref<const Eigen::VectorXd> times,
+               Eigen::Ref<const Eigen::VectorXd> rawValues) {
+                if (times.size() != rawValues.size())
+                {
+                    throw py::value_error("The number of time instants and raw values must be "
+                                          "the same.");
+                }
+
+                Eigen::Matrix<bool, Eigen::Dynamic, 1> isActive(times.size());
+                bool ok = true;
+                {
+                    py::gil_scoped_release release;
+                    SchmittTriggerInput input;
+                    EstimatedContact contact;
+                    for (Eigen::Index i = 0; ok && i < times.size(); i++)
+                    {
+                        input.time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::duration<double>(times[i]));
+                        input.rawValue = rawValues[i];
+                        ok = impl.setTimedTriggerInput(contactName, input) && impl.advance()
+                             && impl.get(contactName, contact);
+                        isActive[i] = contact.isActive;
+                    }
+                }
+                if (!ok)
+                {
+                    throw py::value_error("Unable to run the detector on the window of samples "
+                                          "of the contact named "
+                                          + contactName + ".");
+                }
+
+                return isActive;
+            },
+            py::arg("contact_name"),
+            py::arg("times"),
+            py::arg("raw_values"));
 }
 
 void CreateFixedFootDetector(pybind11::module& module)
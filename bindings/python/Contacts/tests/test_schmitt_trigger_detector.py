@@ -3,6 +3,7 @@ pytestmark = pytest.mark.contact_detectors
 
 import bipedal_locomotion_framework.bindings as blf
 from datetime import timedelta
+import numpy as np
 
 
 def test_schmitt_trigger_detector():
@@ -87,3 +88,28 @@ def test_schmitt_trigger_detector():
     assert(detector.reset_contact("right", True, params))
     right_contact = detector.get("right")
     assert(right_contact.is_active == True)
+
+
+def test_schmitt_trigger_detector_window():
+
+    parameters_handler = blf.parameters_handler.StdParametersHandler()
+    parameters_handler.set_parameter_vector_string("contacts", ["right"])
+    parameters_handler.set_parameter_vector_float("contact_make_thresholds", [100.0])
+    parameters_handler.set_parameter_vector_float("contact_break_thresholds", [10.0])
+    parameters_handler.set_parameter_vector_datetime("contact_make_switch_times", [timedelta(seconds=0.2)])
+    parameters_handler.set_parameter_vector_datetime("contact_break_switch_times", [timedelta(seconds=0.2)])
+
+    detector = blf.contacts.SchmittTriggerDetector()
+    assert(detector.initialize(parameters_handler))
+    assert(detector.reset_contacts())
+
+    # same rise and fall signals of test_schmitt_trigger_detector
+    times = np.array([0.1, 0.2, 0.3, 0.4, 0.5, 0.6])
+    raw_values = np.array([120.0, 120.0, 120.0, 7.0, 7.0, 7.0])
+    is_active = detector.advance_window("right", times, raw_values)
+
+    assert(is_active.shape == (6,))
+    assert(list(is_active) == [False, False, True, True, True, False])
+
+    with pytest.raises(ValueError):
+        detector.advance_window("left", times, raw_values)
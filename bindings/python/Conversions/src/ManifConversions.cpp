@@ -51,6 +51,55 @@ manif::SO3d toManifRot(::pybind11::object& obj)
     return BipedalLocomotion::Conversions::toManifRot(*cls);
 }
 
+using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+RowMajorMatrix toManifPoses(Eigen::Ref<const RowMajorMatrix> rotations,
+                            Eigen::Ref<const RowMajorMatrix> translations)
+{
+    if (rotations.cols() != 9 || translations.cols() != 3
+        || rotations.rows() != translations.rows())
+    {
+        throw ::pybind11::value_error("Invalid input for the function. Please provide an (N, 9) "
+                                      "matrix containing the row-major rotation matrices and an "
+                                      "(N, 3) matrix containing the translations.");
+    }
+
+    RowMajorMatrix poses(rotations.rows(), manif::SE3d::RepSize);
+    ::pybind11::gil_scoped_release release;
+    for (Eigen::Index i = 0; i < rotations.rows(); i++)
+    {
+        const Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> rotation(
+            rotations.row(i).data());
+        poses.row(i) = BipedalLocomotion::Conversions::toManifPose(
+                           Eigen::Matrix3d(rotation),
+                           Eigen::Vector3d(translations.row(i).transpose()))
+                           .coeffs()
+                           .transpose();
+    }
+    return poses;
+}
+
+RowMajorMatrix toManifRots(Eigen::Ref<const RowMajorMatrix> rotations)
+{
+    if (rotations.cols() != 9)
+    {
+        throw ::pybind11::value_error("Invalid input for the function. Please provide an (N, 9) "
+                                      "matrix containing the row-major rotation matrices.");
+    }
+
+    RowMajorMatrix quaternions(rotations.rows(), manif::SO3d::RepSize);
+    ::pybind11::gil_scoped_release release;
+    for (Eigen::Index i = 0; i < rotations.rows(); i++)
+    {
+        const Eigen::Map<const Eigen::Matrix<double, 3, 3, Eigen::RowMajor>> rotation(
+            rotations.row(i).data());
+        quaternions.row(i) = BipedalLocomotion::Conversions::toManifRot(Eigen::Matrix3d(rotation))
+                                 .coeffs()
+                                 .transpose();
+    }
+    return quaternions;
+}
+
 void CreateManifConversions(pybind11::module& module)
 {
     namespace py = ::pybind11;
@@ -73,7 +122,14 @@ void CreateManifConversions(pybind11::module& module)
         .def("to_manif_rot",
              py::overload_cast<::pybind11::object&>(
                  &::BipedalLocomotion::bindings::Conversions::toManifRot),
-             py::arg("rotation"));
+             py::arg("rotation"))
+        .def("to_manif_poses",
+             &::BipedalLocomotion::bindings::Conversions::toManifPoses,
+             py::arg("rotations"),
+             py::arg("translations"))
+        .def("to_manif_rots",
+             &::BipedalLocomotion::bindings::Conversions::toManifRots,
+             py::arg("rotations"));
 }
 
 } // namespace Conversions
@@ -29,3 +29,18 @@ def test_manif_conversions_from_idyntree():
     manif_se3 = blf.conversions.to_manif_pose(idyntree_se3)
     assert idyntree_se3.getRotation().toNumPy() == pytest.approx(manif_se3.rotation())
     assert idyntree_se3.getPosition().toNumPy() == pytest.approx(manif_se3.translation())
+
+
+def test_manif_conversions_batch():
+    rotations = np.array([idyn.Rotation.RPY(0.1 * i, 0.2, -1.32).toNumPy() for i in range(5)])
+    translations = np.array([[9.1, -1.2, 0.1 * i] for i in range(5)])
+
+    poses = blf.conversions.to_manif_poses(rotations.reshape(5, 9), translations)
+    quaternions = blf.conversions.to_manif_rots(rotations.reshape(5, 9))
+    assert poses.shape == (5, 7)
+    assert quaternions.shape == (5, 4)
+
+    for i in range(5):
+        manif_se3 = blf.conversions.to_manif_pose(rotations[i], translations[i])
+        assert manif_se3.coeffs() == pytest.approx(poses[i])
+        assert manif_se3.quat() == pytest.approx(quaternions[i])
@@ -14,6 +14,7 @@
 #include <BipedalLocomotion/FloatingBaseEstimators/LeggedOdometry.h>
 
 #include <BipedalLocomotion/bindings/FloatingBaseEstimators/LeggedOdometry.h>
+#include <BipedalLocomotion/bindings/System/OutputView.h>
 #include <BipedalLocomotion/bindings/type_caster/swig.h>
 
 #include <iDynTree/KinDynComputations.h>
@@ -70,7 +71,7 @@ void CreateLeggedOdometry(pybind11::module& module)
              &LeggedOdometry::setKinematics,
              py::arg("encoders"),
              py::arg("encoder_speeds"))
-        .def("advance", &LeggedOdometry::advance)
+        .def("advance", &LeggedOdometry::advance, py::call_guard<py::gil_scoped_release>())
         .def("reset_estimator",
              py::overload_cast<const InternalState&>(&FloatingBaseEstimator::resetEstimator),
              py::arg("new_state"))
@@ -98,6 +99,12 @@ void CreateLeggedOdometry(pybind11::module& module)
              py::arg("frame_position_in_world"))
         .def("get_fixed_frame_index", &LeggedOdometry::getFixedFrameIdx)
         .def("get_output", &LeggedOdometry::getOutput)
+        .def("get_output_view",
+             [](py::object self) -> py::object {
+                 const auto& impl = self.cast<const LeggedOdometry&>();
+                 return ::BipedalLocomotion::bindings::System::GetOutputView(impl.getOutput(),
+                                                                             self);
+             })
         .def("is_output_valid", &LeggedOdometry::isOutputValid);
 }
 
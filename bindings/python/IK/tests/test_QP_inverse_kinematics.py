@@ -425,3 +425,13 @@ def test_qp_inverse_kinematics():
     # Check that with different desiderata the ik solution is different
     assert state.joint_velocity != pytest.approx(updated_state.joint_velocity)
     assert state.base_velocity.coeffs() != pytest.approx(updated_state.base_velocity.coeffs())
+
+    # The view of the output is not copied. It is read-only and it is updated by the solver
+    state_view = qp_ik.get_output_view()
+    assert state_view.joint_velocity == pytest.approx(updated_state.joint_velocity)
+    assert not state_view.joint_velocity.flags.writeable
+    with pytest.raises(AttributeError):
+        state_view.joint_velocity = updated_state.joint_velocity
+
+    assert qp_ik.advance()
+    assert state_view.joint_velocity == pytest.approx(qp_ik.get_output().joint_velocity)
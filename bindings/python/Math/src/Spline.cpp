@@ -7,7 +7,10 @@
 
 #include <Eigen/Dense>
 
+#include <algorithm>
 #include <chrono>
+#include <tuple>
+#include <vector>
 #include <pybind11/chrono.h>
 #include <pybind11/eigen.h>
 #include <pybind11/pybind11.h>
@@ -78,7 +81,50 @@ template <typename T> void CreateSplineTmp(pybind11::module& module, const std::
              py::arg("time"),
              py::arg("position"),
              py::arg("velocity"),
-             py::arg("acceleration"));
+             py::arg("acceleration"))
+        .def(
+            "evaluate_points",
+            [](Spline<T>& impl, Eigen::Ref<const Eigen::VectorXd> times) {
+                using Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+                std::vector<std::chrono::nanoseconds> time(times.size());
+                for (Eigen::Index i = 0; i < times.size(); i++)
+                {
+                    time[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::duration<double>(times[i]));
+                }
+
+                if (!std::is_sorted(time.begin(), time.end()))
+                {
+                    throw py::value_error("The time instants must be sorted in ascending order.");
+                }
+
+                std::vector<T> position, velocity, acceleration;
+                bool ok = false;
+                {
+                    py::gil_scoped_release release;
+                    ok = impl.evaluateOrderedPoints(time, position, velocity, acceleration);
+                }
+                if (!ok)
+                {
+                    throw py::value_error("Unable to evaluate the spline.");
+                }
+
+                // each row contains a point of the trajectory
+                const Eigen::Index size = position.empty() ? 0 : position.front().size();
+                Matrix positions(time.size(), size);
+                Matrix velocities(time.size(), size);
+                Matrix accelerations(time.size(), size);
+                for (std::size_t i = 0; i < time.size(); i++)
+                {
+                    positions.row(i) = position[i].transpose();
+                    velocities.row(i) = velocity[i].transpose();
+                    accelerations.row(i) = acceleration[i].transpose();
+                }
+
+                return std::make_tuple(positions, velocities, accelerations);
+            },
+            py::arg("times"));
 }
 
 template <typename T>
@@ -98,3 +98,19 @@ def test_quintic_spline():
             + 5 * 4 * coefficients[5] * (t ** 3)
 
         assert np.allclose(expected.transpose()[0], acceleration, atol=1e-5)
+
+    # evaluate all the points at once
+    times = np.linspace(init_time, final_time, int(points_to_check_number))
+    positions, velocities, accelerations = spline.evaluate_points(times)
+    assert positions.shape == (times.size, 4)
+    assert velocities.shape == (times.size, 4)
+    assert accelerations.shape == (times.size, 4)
+
+    for i, t in enumerate(times):
+        assert spline.evaluate_point(t, position, velocity, acceleration)
+        assert np.allclose(positions[i], position)
+        assert np.allclose(velocities[i], velocity)
+        assert np.allclose(accelerations[i], acceleration)
+
+    with pytest.raises(ValueError):
+        spline.evaluate_points(times[::-1])
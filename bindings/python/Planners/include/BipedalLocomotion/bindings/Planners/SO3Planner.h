@@ -0,0 +1,25 @@
+/**
+ * @file SO3Planner.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BINDINGS_PLANNERS_SO3_PLANNER_H
+#define BIPEDAL_LOCOMOTION_BINDINGS_PLANNERS_SO3_PLANNER_H
+
+#include <pybind11/pybind11.h>
+
+namespace BipedalLocomotion
+{
+namespace bindings
+{
+namespace Planners
+{
+
+void CreateSO3Planner(pybind11::module& module);
+
+} // namespace Planners
+} // namespace bindings
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BINDINGS_PLANNERS_SO3_PLANNER_H
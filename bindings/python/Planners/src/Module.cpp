@@ -9,6 +9,7 @@
 
 #include <BipedalLocomotion/bindings/Planners/DCMPlanner.h>
 #include <BipedalLocomotion/bindings/Planners/Module.h>
+#include <BipedalLocomotion/bindings/Planners/SO3Planner.h>
 #include <BipedalLocomotion/bindings/Planners/Spline.h>
 #include <BipedalLocomotion/bindings/Planners/SwingFootPlanner.h>
 #include <BipedalLocomotion/bindings/Planners/TimeVaryingDCMPlanner.h>
@@ -25,6 +26,7 @@ void CreateModule(pybind11::module& module)
 
     CreateDCMPlanner(module);
     CreateTimeVaryingDCMPlanner(module);
+    CreateSO3Planner(module);
     CreateSwingFootPlanner(module);
     CreateSpline(module);
     CreateCubicSpline(module);
@@ -0,0 +1,130 @@
+/**
+ * @file SO3Planner.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <string>
+#include <tuple>
+
+#include <pybind11/chrono.h>
+#include <pybind11/eigen.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <BipedalLocomotion/Planners/SO3Planner.h>
+
+#include <BipedalLocomotion/bindings/Planners/SO3Planner.h>
+#include <BipedalLocomotion/bindings/System/Advanceable.h>
+
+namespace BipedalLocomotion
+{
+namespace bindings
+{
+namespace Planners
+{
+
+template <BipedalLocomotion::Planners::LieGroupTrivialization trivialization>
+void CreateSO3PlannerTmp(pybind11::module& module, const std::string& name)
+{
+    namespace py = ::pybind11;
+    using namespace BipedalLocomotion::Planners;
+    using Planner = SO3Planner<trivialization>;
+    using Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+    py::class_<Planner, System::Source<SO3PlannerState>>(module, name.c_str())
+        .def(py::init())
+        .def("set_rotations",
+             &Planner::setRotations,
+             py::arg("initial_rotation"),
+             py::arg("final_rotation"),
+             py::arg("duration"))
+        .def("set_initial_conditions",
+             &Planner::setInitialConditions,
+             py::arg("velocity"),
+             py::arg("acceleration"))
+        .def("set_final_conditions",
+             &Planner::setFinalConditions,
+             py::arg("velocity"),
+             py::arg("acceleration"))
+        .def("set_advance_time_step", &Planner::setAdvanceTimeStep, py::arg("dt"))
+        .def(
+            "evaluate_point",
+            [](Planner& impl, const std::chrono::nanoseconds& time) -> SO3PlannerState {
+                SO3PlannerState state;
+                if (!impl.evaluatePoint(time, state))
+                {
+                    throw py::value_error("Unable to evaluate the trajectory.");
+                }
+                return state;
+            },
+            py::arg("time"))
+        .def(
+            "evaluate_points",
+            [](Planner& impl, Eigen::Ref<const Eigen::VectorXd> times) {
+                // the rotations are stored as quaternions with the same ordering of the manif
+                // coefficients, i.e., (x, y, z, w)
+                Matrix rotations(times.size(), 4);
+                Matrix velocities(times.size(), 3);
+                Matrix accelerations(times.size(), 3);
+
+                bool ok = true;
+                {
+                    py::gil_scoped_release release;
+                    SO3PlannerState state;
+                    for (Eigen::Index i = 0; ok && i < times.size(); i++)
+                    {
+                        const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::duration<double>(times[i]));
+                        ok = impl.evaluatePoint(time, state);
+                        rotations.row(i) = state.rotation.coeffs().transpose();
+                        velocities.row(i) = state.velocity.coeffs().transpose();
+                        accelerations.row(i) = state.acceleration.coeffs().transpose();
+                    }
+                }
+
+                if (!ok)
+                {
+                    throw py::value_error("Unable to evaluate the trajectory.");
+                }
+
+                return std::make_tuple(rotations, velocities, accelerations);
+            },
+            py::arg("times"));
+}
+
+void CreateSO3Planner(pybind11::module& module)
+{
+    namespace py = ::pybind11;
+    using namespace BipedalLocomotion::Planners;
+
+    py::class_<SO3PlannerState>(module, "SO3PlannerState")
+        .def(py::init())
+        .def_readwrite("rotation", &SO3PlannerState::rotation)
+        .def_property(
+            "velocity",
+            [](const SO3PlannerState& s) //
+            -> decltype(SO3PlannerState::velocity)::DataType { return s.velocity.coeffs(); },
+            [](SO3PlannerState& s, decltype(SO3PlannerState::velocity)::DataType& coeffs) {
+                s.velocity.coeffs() = coeffs;
+            })
+        .def_property(
+            "acceleration",
+            [](const SO3PlannerState& s) //
+            -> decltype(SO3PlannerState::acceleration)::DataType {
+                return s.acceleration.coeffs();
+            },
+            [](SO3PlannerState& s, decltype(SO3PlannerState::acceleration)::DataType& coeffs) {
+                s.acceleration.coeffs() = coeffs;
+            });
+
+    BipedalLocomotion::bindings::System::CreateSource<SO3PlannerState>(module, "SO3Planner");
+
+    CreateSO3PlannerTmp<LieGroupTrivialization::Right>(module, "SO3PlannerInertial");
+    CreateSO3PlannerTmp<LieGroupTrivialization::Left>(module, "SO3PlannerBody");
+}
+
+} // namespace Planners
+} // namespace bindings
+} // namespace BipedalLocomotion
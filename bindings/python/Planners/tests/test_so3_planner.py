@@ -0,0 +1,38 @@
+import pytest
+pytestmark = pytest.mark.planners
+
+import bipedal_locomotion_framework.bindings as blf
+import manifpy as manif
+import numpy as np
+from datetime import timedelta
+
+
+def test_so3_planner():
+
+    from scipy.spatial.transform import Rotation as R
+
+    initial_rotation = manif.SO3(quaternion=np.array([0, 0, 0, 1]))
+    final_rotation = manif.SO3(quaternion=R.from_euler(seq="z", angles=np.pi / 2).as_quat())
+
+    planner = blf.planners.SO3PlannerInertial()
+    assert planner.set_rotations(initial_rotation=initial_rotation,
+                                 final_rotation=final_rotation,
+                                 duration=timedelta(seconds=1.0))
+
+    times = np.linspace(0.0, 1.0, 11)
+    rotations, velocities, accelerations = planner.evaluate_points(times=times)
+    assert rotations.shape == (11, 4)
+    assert velocities.shape == (11, 3)
+    assert accelerations.shape == (11, 3)
+
+    # the boundary conditions are satisfied
+    assert rotations[0] == pytest.approx(initial_rotation.coeffs())
+    assert rotations[-1] == pytest.approx(final_rotation.coeffs())
+    assert velocities[0] == pytest.approx([0, 0, 0])
+    assert velocities[-1] == pytest.approx([0, 0, 0])
+
+    # the batch evaluation is equivalent to the evaluation of a single point
+    state = planner.evaluate_point(time=timedelta(seconds=times[5]))
+    assert rotations[5] == pytest.approx(state.rotation.coeffs())
+    assert velocities[5] == pytest.approx(state.velocity)
+    assert accelerations[5] == pytest.approx(state.acceleration)
@@ -106,7 +106,8 @@ void CreateRobotDynamicsEstimator(pybind11::module& module)
                  &BipedalLocomotion::Estimators::RobotDynamicsEstimator::RobotDynamicsEstimator::finalize,
                  py::arg("state_variable_handler"),
                  py::arg("measurement_variable_handler"),
-                 py::arg("kindyn_full_model"))
+                 py::arg("kindyn_full_model"),
+                 py::call_guard<py::gil_scoped_release>())
             .def_static("build",
                         [](std::shared_ptr<const IParametersHandler> handler,
                         py::object& obj,
@@ -98,7 +98,7 @@ void CreateYarpSensorBridge(pybind11::module& module)
                 return impl.setDriversList(list);
             },
             py::arg("polydrivers"))
-        .def("advance", &YarpSensorBridge::advance)
+        .def("advance", &YarpSensorBridge::advance, py::call_guard<py::gil_scoped_release>())
         .def("is_output_valid", &YarpSensorBridge::isOutputValid)
         .def("get_failed_sensor_reads", &YarpSensorBridge::getFailedSensorReads)
         .def("get_joints_list",
@@ -19,6 +19,7 @@
 #include <BipedalLocomotion/System/OutputPort.h>
 #include <BipedalLocomotion/System/Sink.h>
 #include <BipedalLocomotion/System/Source.h>
+#include <BipedalLocomotion/bindings/System/OutputView.h>
 
 namespace BipedalLocomotion
 {
@@ -49,6 +50,14 @@ void CreateOutputPort(pybind11::module& module, const std::string& pythonClassNa
     py::class_<::BipedalLocomotion::System::OutputPort<Output>> //
         (module, outputPortName.c_str())
             .def("get_output", &::BipedalLocomotion::System::OutputPort<Output>::getOutput)
+            .def("get_output_view",
+                 [](py::object self) -> py::object {
+                     // the output is not copied. The view keeps the owner alive and it is
+                     // updated by the next call of advance
+                     const auto& impl
+                         = self.cast<const ::BipedalLocomotion::System::OutputPort<Output>&>();
+                     return GetOutputView(impl.getOutput(), self);
+                 })
             .def("is_output_valid",
                  &::BipedalLocomotion::System::OutputPort<Output>::isOutputValid);
 }
@@ -68,8 +77,13 @@ void CreateAdvanceableImpl(pybind11::module& module, const std::string& pythonCl
                 [](::BipedalLocomotion::System::Advanceable<Input, Output>& impl,
                    std::shared_ptr<const ::BipedalLocomotion::ParametersHandler::IParametersHandler>
                        handler) -> bool { return impl.initialize(handler); },
-                py::arg("handler"))
-            .def("advance", &::BipedalLocomotion::System::Advanceable<Input, Output>::advance)
+                py::arg("handler"),
+                py::call_guard<py::gil_scoped_release>())
+            // the GIL is released so that other Python threads can run while the advanceable is
+            // computing its output. The methods implemented in Python acquire it again.
+            .def("advance",
+                 &::BipedalLocomotion::System::Advanceable<Input, Output>::advance,
+                 py::call_guard<py::gil_scoped_release>())
             .def("close", &::BipedalLocomotion::System::Advanceable<Input, Output>::close);
 }
 
@@ -16,6 +16,7 @@
 
 #include <BipedalLocomotion/System/ILinearTaskSolver.h>
 #include <BipedalLocomotion/System/WeightProvider.h>
+#include <BipedalLocomotion/bindings/System/OutputView.h>
 
 namespace BipedalLocomotion
 {
@@ -100,10 +101,19 @@ void CreateILinearTaskSolver(pybind11::module& module, const std::string& python
             py::arg("name"))
         .def("finalize",
              &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::finalize,
-             py::arg("handler"))
-        .def("advance", &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::advance)
+             py::arg("handler"),
+             py::call_guard<py::gil_scoped_release>())
+        .def("advance",
+             &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::advance,
+             py::call_guard<py::gil_scoped_release>())
         .def("get_output",
              &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::getOutput)
+        .def("get_output_view",
+             [](py::object self) -> py::object {
+                 const auto& impl = self.cast<
+                     const ::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>&>();
+                 return GetOutputView(impl.getOutput(), self);
+             })
         .def("is_output_valid",
              &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::isOutputValid)
         .def(
@@ -111,7 +121,8 @@ void CreateILinearTaskSolver(pybind11::module& module, const std::string& python
             [](::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>& impl,
                std::shared_ptr<const ::BipedalLocomotion::ParametersHandler::IParametersHandler>
                    handler) -> bool { return impl.initialize(handler); },
-            py::arg("handler"))
+            py::arg("handler"),
+            py::call_guard<py::gil_scoped_release>())
         .def("__str__", &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::toString)
         .def("get_raw_solution",
              &::BipedalLocomotion::System::ILinearTaskSolver<_Task, _State>::getRawSolution);
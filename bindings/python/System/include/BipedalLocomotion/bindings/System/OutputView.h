@@ -0,0 +1,81 @@
+/**
+ * @file OutputView.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_BINDINGS_SYSTEM_OUTPUT_VIEW_H
+#define BIPEDAL_LOCOMOTION_BINDINGS_SYSTEM_OUTPUT_VIEW_H
+
+#include <string>
+
+#include <pybind11/pybind11.h>
+
+namespace BipedalLocomotion
+{
+namespace bindings
+{
+namespace System
+{
+
+/**
+ * OutputView is a read-only proxy of an object owned by C++. The attributes are read without
+ * copying them: the NumPy arrays are returned as read-only views and the objects bound with
+ * pybind11 are wrapped in another OutputView. The attributes cannot be set and the methods cannot
+ * be called, since they may modify the object.
+ */
+class OutputView
+{
+public:
+    /**
+     * Constructor.
+     * @param object the object that is wrapped.
+     */
+    explicit OutputView(pybind11::object object);
+
+    /**
+     * Wrap a value so that it cannot be modified.
+     * @param value the value.
+     * @return a read-only view of the value if it is a NumPy array, an OutputView if it is an
+     * object bound with pybind11, the value itself otherwise.
+     */
+    static pybind11::object wrap(pybind11::object value);
+
+    /**
+     * Get an attribute of the wrapped object.
+     * @param name name of the attribute.
+     * @return the wrapped attribute.
+     */
+    pybind11::object getAttribute(const std::string& name) const;
+
+    /**
+     * Get the names of the attributes of the wrapped object.
+     * @return a list containing the names.
+     */
+    pybind11::object getAttributeNames() const;
+
+private:
+    pybind11::object m_object;
+};
+
+/**
+ * Get a read-only view of the output of a block. The view refers to the memory of the output,
+ * hence it is updated when the block is advanced.
+ * @param output the output.
+ * @param owner the Python object owning the output. It is kept alive by the view.
+ * @return the view.
+ */
+template <class Output>
+pybind11::object GetOutputView(const Output& output, pybind11::handle owner)
+{
+    return OutputView::wrap(
+        pybind11::cast(output, pybind11::return_value_policy::reference_internal, owner));
+}
+
+void CreateOutputView(pybind11::module& module);
+
+} // namespace System
+} // namespace bindings
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_BINDINGS_SYSTEM_OUTPUT_VIEW_H
@@ -13,6 +13,7 @@
 #include <BipedalLocomotion/bindings/System/ITaskControllerManager.h>
 #include <BipedalLocomotion/bindings/System/LinearTask.h>
 #include <BipedalLocomotion/bindings/System/Module.h>
+#include <BipedalLocomotion/bindings/System/OutputView.h>
 #include <BipedalLocomotion/bindings/System/VariablesHandler.h>
 #include <BipedalLocomotion/bindings/System/WeightProvider.h>
 
@@ -27,6 +28,7 @@ void CreateModule(pybind11::module& module)
     module.doc() = "System module";
 
     CreateCommonDataStructure(module);
+    CreateOutputView(module);
 
     CreateVariablesHandler(module);
     CreateLinearTask(module);
@@ -0,0 +1,92 @@
+/**
+ * @file OutputView.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <string>
+#include <utility>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <BipedalLocomotion/bindings/System/OutputView.h>
+
+namespace BipedalLocomotion
+{
+namespace bindings
+{
+namespace System
+{
+
+namespace
+{
+[[noreturn]] void throwAttributeError(const std::string& message)
+{
+    // pybind11::attribute_error is not available in all the supported versions of pybind11
+    PyErr_SetString(PyExc_AttributeError, message.c_str());
+    throw pybind11::error_already_set();
+}
+} // namespace
+
+OutputView::OutputView(pybind11::object object)
+    : m_object(std::move(object))
+{
+}
+
+pybind11::object OutputView::wrap(pybind11::object value)
+{
+    namespace py = ::pybind11;
+
+    // the arrays may share the memory with the output
+    if (py::isinstance<py::array>(value))
+    {
+        py::object view = value.attr("view")();
+        view.attr("setflags")(py::arg("write") = false);
+        return view;
+    }
+
+    // the objects bound with pybind11 may refer to the output
+    if (py::detail::get_type_info(Py_TYPE(value.ptr())) != nullptr)
+    {
+        return py::cast(OutputView(std::move(value)));
+    }
+
+    // the methods of the objects bound with pybind11 may modify the output
+    if (py::isinstance<py::function>(value))
+    {
+        throwAttributeError("The methods cannot be called on a read-only view. Please use "
+                            "get_output() to get a copy of the output.");
+    }
+
+    // the other values (e.g., numbers, lists and dictionaries) are already copies
+    return value;
+}
+
+pybind11::object OutputView::getAttribute(const std::string& name) const
+{
+    return OutputView::wrap(m_object.attr(name.c_str()));
+}
+
+pybind11::object OutputView::getAttributeNames() const
+{
+    return pybind11::module::import("builtins").attr("dir")(m_object);
+}
+
+void CreateOutputView(pybind11::module& module)
+{
+    namespace py = ::pybind11;
+
+    py::class_<OutputView>(module, "OutputView")
+        .def("__getattr__", &OutputView::getAttribute, py::arg("name"))
+        .def("__setattr__",
+             [](OutputView&, const std::string& name, py::object) {
+                 throwAttributeError("Unable to set the attribute '" + name
+                                     + "'. The view is read-only.");
+             })
+        .def("__dir__", &OutputView::getAttributeNames);
+}
+
+} // namespace System
+} // namespace bindings
+} // namespace BipedalLocomotion
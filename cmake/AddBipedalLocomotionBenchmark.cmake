@@ -0,0 +1,68 @@
+# Copyright (C) 2024 Istituto Italiano di Tecnologia (IIT). All rights reserved.
+# This software may be modified and distributed under the terms of the
+# BSD-3-Clause license.
+
+# The target `benchmarks` builds all the benchmarks, while `run_benchmarks` runs them and stores the
+# results in json files in the folder FRAMEWORK_BENCHMARKS_OUTPUT_DIRECTORY
+if(FRAMEWORK_COMPILE_Benchmarks)
+  set(FRAMEWORK_BENCHMARKS_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/benchmark_results" CACHE PATH
+    "Folder where the run_benchmarks target stores the json files containing the results")
+  mark_as_advanced(FRAMEWORK_BENCHMARKS_OUTPUT_DIRECTORY)
+
+  add_custom_target(benchmarks)
+  add_custom_target(run_benchmarks)
+endif()
+
+function(add_bipedal_benchmark)
+
+    if(FRAMEWORK_COMPILE_Benchmarks)
+
+      set(options )
+      set(oneValueArgs NAME)
+      set(multiValueArgs SOURCES LINKS)
+
+      set(prefix "bipedal")
+
+      cmake_parse_arguments(${prefix}
+          "${options}"
+          "${oneValueArgs}"
+          "${multiValueArgs}"
+          ${ARGN})
+
+      set(name ${${prefix}_NAME})
+      set(benchmark_files ${${prefix}_SOURCES})
+
+      set(targetname ${name}Benchmark)
+      add_executable(${targetname}
+          "${benchmark_files}")
+
+      target_link_libraries(${targetname} PRIVATE benchmark::benchmark_main BipedalLocomotion::BenchmarkUtils ${${prefix}_LINKS})
+      target_compile_features(${targetname} PUBLIC cxx_std_17)
+      target_compile_definitions(${targetname} PRIVATE -D_USE_MATH_DEFINES)
+
+      add_dependencies(benchmarks ${targetname})
+
+      # The memory operations are counted only if the functions of the standard library are
+      # replaced by the ones of the MemoryAllocationMonitorPreload library
+      set(environment)
+      if(FRAMEWORK_RUN_MemoryAllocationMonitor_benchmarks)
+        set(environment "LD_PRELOAD=$<TARGET_FILE:BipedalLocomotion::MemoryAllocationMonitorPreload>")
+      endif()
+
+      add_custom_target(run_${targetname}
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${FRAMEWORK_BENCHMARKS_OUTPUT_DIRECTORY}"
+        COMMAND ${CMAKE_COMMAND} -E env ${environment} $<TARGET_FILE:${targetname}>
+                --benchmark_out=${FRAMEWORK_BENCHMARKS_OUTPUT_DIRECTORY}/${targetname}.json
+                --benchmark_out_format=json
+        DEPENDS ${targetname}
+        COMMENT "Running ${targetname}"
+        USES_TERMINAL
+        VERBATIM)
+
+      add_dependencies(run_benchmarks run_${targetname})
+
+      message(STATUS "Created benchmark ${targetname}.")
+
+    endif()
+
+endfunction()
@@ -108,6 +108,10 @@ checkandset_dependency(icub-models)
 find_package(VALGRIND QUIET)
 checkandset_dependency(VALGRIND)
 
+# required only for the benchmarks
+find_package(benchmark QUIET)
+checkandset_dependency(benchmark)
+
 find_package(UnicyclePlanner QUIET)
 checkandset_dependency(UnicyclePlanner)
 
@@ -116,9 +120,13 @@ checkandset_dependency(onnxruntime)
 
 ##########################      Test-related options       ##############################
 
+framework_dependent_option(FRAMEWORK_COMPILE_Benchmarks
+  "Compile the benchmarks?" OFF
+  "FRAMEWORK_USE_benchmark" OFF)
+
 # MemoryAllocationMonitor require glibc >= 2.35
 set(FRAMEWORK_GLIBC_GEQ_2_35 OFF)
-if(BUILD_TESTING AND UNIX AND NOT APPLE)
+if((BUILD_TESTING OR FRAMEWORK_COMPILE_Benchmarks) AND UNIX AND NOT APPLE)
   execute_process(COMMAND ldd --version
                   OUTPUT_VARIABLE FRAMEWORK_LDD_VERSION_OUTPUT)
   string(REGEX MATCH "GLIBC ([0-9]+.[0-9]+)" FRAMEWORK_LDD_REGEX_OUTPUT ${FRAMEWORK_LDD_VERSION_OUTPUT})
@@ -131,6 +139,10 @@ framework_dependent_option(FRAMEWORK_RUN_MemoryAllocationMonitor_tests
   "Run MemoryAllocationMonitor tests?" ON
   "BUILD_TESTING;UNIX;NOT APPLE;FRAMEWORK_GLIBC_GEQ_2_35" OFF)
 
+framework_dependent_option(FRAMEWORK_RUN_MemoryAllocationMonitor_benchmarks
+  "Count the dynamic memory operations in the benchmarks?" ON
+  "FRAMEWORK_COMPILE_Benchmarks;UNIX;NOT APPLE;FRAMEWORK_GLIBC_GEQ_2_35" OFF)
+
 framework_dependent_option(FRAMEWORK_RUN_Valgrind_tests
   "Run Valgrind tests?" OFF
   "BUILD_TESTING;VALGRIND_FOUND" OFF)
@@ -15,7 +15,10 @@
 #include <BipedalLocomotion/YarpUtilities/VectorsCollection.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollectionServer.h>
 #include <BipedalLocomotion/ContinuousDynamicalSystem/ButterworthLowPassFilter.h>
+#include <BipedalLocomotion/System/SPSCRingBuffer.h>
+#include <BipedalLocomotion/System/TripleBuffer.h>
 
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -56,6 +59,18 @@ struct CouplingMatrices
     }
 };
 
+/**
+ * Friction models compensated by the device
+ *
+ */
+enum class FrictionModel
+{
+    None, /**< the friction is not compensated */
+    CoulombViscous, /**< FRICTION_COULOMB_VISCOUS model */
+    CoulombViscousStribeck, /**< FRICTION_COULOMB_VISCOUS_STRIBECK model */
+    PINN, /**< FRICTION_PINN model */
+};
+
 /**
  * Parameters for the control of torque through current and for mechanical friction compensation
  *
@@ -67,6 +82,7 @@ struct MotorTorqueCurrentParameters
     double kp; /**< proportional gain */
     double maxCurr; /**< maximum current */
     std::string frictionModel; ///< friction model
+    FrictionModel frictionModelType; ///< friction model used by the control loop
     double maxOutputFriction; /**< maximum output of the friction model */
 
     /**
@@ -76,7 +92,30 @@ struct MotorTorqueCurrentParameters
     {
         kt = kfc = kp = maxCurr = 0.0;
         maxOutputFriction = 0.0;
-        frictionModel = "";
+        setFrictionModel("");
+    }
+
+    /**
+     * Set the friction model. The control loop uses frictionModelType, so it never compares
+     * strings.
+     * @param model name of the model. An unknown name disables the friction compensation.
+     */
+    void setFrictionModel(const std::string& model)
+    {
+        frictionModel = model;
+        if (model == "FRICTION_COULOMB_VISCOUS")
+        {
+            frictionModelType = FrictionModel::CoulombViscous;
+        } else if (model == "FRICTION_COULOMB_VISCOUS_STRIBECK")
+        {
+            frictionModelType = FrictionModel::CoulombViscousStribeck;
+        } else if (model == "FRICTION_PINN")
+        {
+            frictionModelType = FrictionModel::PINN;
+        } else
+        {
+            frictionModelType = FrictionModel::None;
+        }
     }
 };
 
@@ -152,6 +191,10 @@ struct LowPassFilterParameters
  * @brief This class implements a device that allows to control the joints of a robot in torque mode.
  * The device is able to estimate the friction torque acting on the joints and to compensate it.
  * The friction torque is estimated using a physics informed neural network model or a coulomb + viscous model.
+ * The control loop never waits for the other threads of the device. The torque control parameters
+ * changed through the RPC port are published as a new copy that the control loop picks up at the
+ * beginning of the next cycle (read-copy-update), while the status of the controller is sent to
+ * the publishing thread through a lock-free queue.
  */
 class BipedalLocomotion::JointTorqueControlDevice
     : public BipedalLocomotion::PassThroughControlBoard,
@@ -167,7 +210,10 @@ private:
     std::vector<CoulombViscousStribeckParameters> coulombViscousStribeckParameters;
     std::vector<std::unique_ptr<PINNFrictionEstimator>> frictionEstimators;
     BipedalLocomotion::ContinuousDynamicalSystem::ButterworthLowPassFilter lowPassFilter;
-    std::mutex mutexTorqueControlParam_; /**< The mutex for protecting the parameters of the torque control. */
+    std::mutex mutexTorqueControlParam_; /**< The mutex serializing the threads that modify the parameters of the torque control. */
+    BipedalLocomotion::System::TripleBuffer<std::vector<MotorTorqueCurrentParameters>>
+        m_torqueControlParametersSnapshot; /**< Latest copy of the torque control parameters read by the control loop. */
+    std::vector<FrictionModel> m_frictionModelsInUse; /**< Friction models used by the control loop. */
     yarp::sig::Vector desiredJointTorques;
     yarp::sig::Vector desiredMotorCurrents;
     yarp::sig::Vector measuredJointVelocities;
@@ -194,16 +240,17 @@ private:
 
     CouplingMatrices couplingMatrices;
 
-    bool m_torqueControlIsRunning{false}; /**< True if the estimator is running. */
+    std::atomic<bool> m_torqueControlIsRunning{false}; /**< True if the estimator is running. */
 
     std::thread m_publishEstimationThread; /**< Thread to publish the estimation. */
     struct Status
     {
-        std::mutex mutex;
         std::vector<double> m_motorPositionError;
         std::vector<double> m_frictionLogging;
         std::vector<double> m_currentLogging;
-    } m_status;
+    };
+    Status m_status; /**< Status computed by the control loop. */
+    BipedalLocomotion::System::SPSCRingBuffer<Status> m_statusBuffer; /**< Status sent to the publishing thread. */
 
     bool openCalledCorrectly{false};
 
@@ -218,7 +265,19 @@ private:
     void startHijackingTorqueControlIfNecessary(int j);
     void stopHijackingTorqueControlIfNecessary(int j);
     bool isHijackingTorqueControl(int j);
-    double computeFrictionTorque(int joint);
+    double computeFrictionTorque(int joint, const MotorTorqueCurrentParameters& parameters);
+
+    /**
+     * Get the latest copy of the torque control parameters.
+     * The function must be called with globalMutex locked, i.e., by the control loop.
+     */
+    const std::vector<MotorTorqueCurrentParameters>& updateTorqueControlParameters();
+
+    /**
+     * Publish the torque control parameters to the control loop.
+     * The function must be called with mutexTorqueControlParam_ locked.
+     */
+    void publishTorqueControlParameters();
 
     void computeDesiredCurrents();
     void readStatus();
@@ -283,6 +342,13 @@ public:
 
     // CONTROL THREAD
     virtual bool threadInit();
+
+    /**
+     * Run the control loop.
+     * @note The control loop never waits for the other threads. If a proxied call (e.g.,
+     * setControlMode or setRefTorques) holds globalMutex when the cycle starts, the cycle is
+     * skipped and the references sent by the previous cycle are kept.
+     */
     virtual void run();
     virtual void threadRelease();
 
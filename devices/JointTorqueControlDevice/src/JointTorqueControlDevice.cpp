@@ -107,6 +107,7 @@ bool JointTorqueControlDevice::setKpJtcvc(const std::string& jointName, const do
         {
             std::lock_guard<std::mutex> lock(mutexTorqueControlParam_);
             motorTorqueCurrentParameters[index].kp = kp;
+            this->publishTorqueControlParameters();
 
             log()->info("Request for kp des = {}", kp);
             log()->info("Setting value kp = {}", motorTorqueCurrentParameters[index].kp);
@@ -159,6 +160,7 @@ bool JointTorqueControlDevice::setKfcJtcvc(const std::string& jointName, const d
 
         // Update the kfc value
         motorTorqueCurrentParameters[index].kfc = kfc;
+        this->publishTorqueControlParameters();
 
         return true;
     }
@@ -205,6 +207,7 @@ bool JointTorqueControlDevice::setMaxFrictionTorque(const std::string& jointName
 
         // Update the maxOutputFriction value
         motorTorqueCurrentParameters[index].maxOutputFriction = maxFriction;
+        this->publishTorqueControlParameters();
 
         return true;
     }
@@ -245,12 +248,10 @@ bool JointTorqueControlDevice::setFrictionModel(const std::string& jointName,
         if (m_axisNames[index] == jointName)
         {
             std::lock_guard<std::mutex> lock(mutexTorqueControlParam_);
-            motorTorqueCurrentParameters[index].frictionModel = model;
+            motorTorqueCurrentParameters[index].setFrictionModel(model);
 
-            if (model == "FRICTION_PINN")
-            {
-                frictionEstimators[index]->resetEstimator();
-            }
+            // the friction estimator is reset by the control loop when it receives the new model
+            this->publishTorqueControlParameters();
 
             return true;
         }
@@ -282,6 +283,37 @@ std::string JointTorqueControlDevice::getFrictionModel(const std::string& jointN
     return model;
 }
 
+void JointTorqueControlDevice::publishTorqueControlParameters()
+{
+    // the control loop keeps using its copy until it calls updateTorqueControlParameters
+    m_torqueControlParametersSnapshot.getWriteBuffer() = motorTorqueCurrentParameters;
+    m_torqueControlParametersSnapshot.publish();
+}
+
+const std::vector<MotorTorqueCurrentParameters>&
+JointTorqueControlDevice::updateTorqueControlParameters()
+{
+    if (m_torqueControlParametersSnapshot.update())
+    {
+        const auto& parameters = m_torqueControlParametersSnapshot.getReadBuffer();
+        for (int j = 0; j < parameters.size(); j++)
+        {
+            if (parameters[j].frictionModelType == m_frictionModelsInUse[j])
+            {
+                continue;
+            }
+
+            m_frictionModelsInUse[j] = parameters[j].frictionModelType;
+            if (m_frictionModelsInUse[j] == FrictionModel::PINN && frictionEstimators[j] != nullptr)
+            {
+                frictionEstimators[j]->resetEstimator();
+            }
+        }
+    }
+
+    return m_torqueControlParametersSnapshot.getReadBuffer();
+}
+
 // HIJACKING CONTROL
 void JointTorqueControlDevice::startHijackingTorqueControlIfNecessary(int j)
 {
@@ -291,7 +323,7 @@ void JointTorqueControlDevice::startHijackingTorqueControlIfNecessary(int j)
                                                           // initialize the desired joint torque
                                                           // considering the measured current
 
-        if (motorTorqueCurrentParameters[j].frictionModel == "FRICTION_PINN")
+        if (this->updateTorqueControlParameters()[j].frictionModelType == FrictionModel::PINN)
         {
             frictionEstimators[j]->resetEstimator();
 
@@ -313,7 +345,7 @@ void JointTorqueControlDevice::stopHijackingTorqueControlIfNecessary(int j)
 {
     if (this->hijackingTorqueControl[j])
     {
-        if (motorTorqueCurrentParameters[j].frictionModel == "FRICTION_PINN")
+        if (this->updateTorqueControlParameters()[j].frictionModelType == FrictionModel::PINN)
         {
             frictionEstimators[j]->resetEstimator();
         }
@@ -328,19 +360,19 @@ bool JointTorqueControlDevice::isHijackingTorqueControl(int j)
     return this->hijackingTorqueControl[j];
 }
 
-double JointTorqueControlDevice::computeFrictionTorque(int joint)
+double JointTorqueControlDevice::computeFrictionTorque(int joint,
+                                                       const MotorTorqueCurrentParameters& parameters)
 {
     double frictionTorque = 0.0;
 
-    if (motorTorqueCurrentParameters[joint].frictionModel == "FRICTION_COULOMB_VISCOUS")
+    if (parameters.frictionModelType == FrictionModel::CoulombViscous)
     {
         double velocityRadians = measuredJointVelocities[joint] * M_PI / 180.0;
 
         frictionTorque = coulombViscousParameters[joint].kc
                              * std::tanh(coulombViscousParameters[joint].ka * velocityRadians)
                          + coulombViscousParameters[joint].kv * velocityRadians;
-    } else if (motorTorqueCurrentParameters[joint].frictionModel
-               == "FRICTION_COULOMB_VISCOUS_STRIBECK")
+    } else if (parameters.frictionModelType == FrictionModel::CoulombViscousStribeck)
     {
         double velocityRadians = measuredJointVelocities[joint] * M_PI / 180.0;
 
@@ -357,7 +389,7 @@ double JointTorqueControlDevice::computeFrictionTorque(int joint)
               * std::tanh(coulombViscousStribeckParameters[joint].ka * velocityRadians);
 
         frictionTorque = tauCoulomb + tauViscous + tauStribeck;
-    } else if (motorTorqueCurrentParameters[joint].frictionModel == "FRICTION_PINN")
+    } else if (parameters.frictionModelType == FrictionModel::PINN)
     {
         m_tempJointPosRad = measuredJointPositions[joint] * M_PI / 180.0;
         m_tempJointPosMotorSideRad = m_gearRatios[joint] * m_tempJointPosRad;
@@ -377,8 +409,8 @@ double JointTorqueControlDevice::computeFrictionTorque(int joint)
     }
 
     frictionTorque = saturation(frictionTorque,
-                                motorTorqueCurrentParameters[joint].maxOutputFriction,
-                                -motorTorqueCurrentParameters[joint].maxOutputFriction);
+                                parameters.maxOutputFriction,
+                                -parameters.maxOutputFriction);
 
     return frictionTorque;
 }
@@ -390,15 +422,16 @@ void JointTorqueControlDevice::computeDesiredCurrents()
 
     estimatedFrictionTorques.zero();
 
-    std::lock_guard<std::mutex> lock(mutexTorqueControlParam_);
+    // the parameters are never modified while the control loop is using them
+    const auto& parameters = this->updateTorqueControlParameters();
 
     for (int j = 0; j < this->axes; j++)
     {
         if (this->hijackingTorqueControl[j])
         {
-            if (motorTorqueCurrentParameters[j].kfc > 0.0)
+            if (parameters[j].kfc > 0.0)
             {
-                estimatedFrictionTorques[j] = computeFrictionTorque(j);
+                estimatedFrictionTorques[j] = computeFrictionTorque(j, parameters[j]);
             }
         }
     }
@@ -428,23 +461,20 @@ void JointTorqueControlDevice::computeDesiredCurrents()
 
             desiredMotorCurrents[j]
                 = (desiredJointTorques[j]
-                   + motorTorqueCurrentParameters[j].kp
+                   + parameters[j].kp
                          * (desiredJointTorques[j] - measuredJointTorques[j])
-                   + motorTorqueCurrentParameters[j].kfc * estimatedFrictionTorques[j])
-                  / motorTorqueCurrentParameters[j].kt;
+                   + parameters[j].kfc * estimatedFrictionTorques[j])
+                  / parameters[j].kt;
 
             desiredMotorCurrents[j] = desiredMotorCurrents[j] / m_gearRatios[j];
 
             desiredMotorCurrents[j] = saturation(desiredMotorCurrents[j],
-                                                 motorTorqueCurrentParameters[j].maxCurr,
-                                                 -motorTorqueCurrentParameters[j].maxCurr);
+                                                 parameters[j].maxCurr,
+                                                 -parameters[j].maxCurr);
 
-            {
-                std::lock_guard<std::mutex> lockOutput(m_status.mutex);
-                m_status.m_frictionLogging[j] = estimatedFrictionTorques[j];
-                m_status.m_motorPositionError[j] = m_motorPositionError[j];
-                m_status.m_currentLogging[j] = desiredMotorCurrents[j];
-            }
+            m_status.m_frictionLogging[j] = estimatedFrictionTorques[j];
+            m_status.m_motorPositionError[j] = m_motorPositionError[j];
+            m_status.m_currentLogging[j] = desiredMotorCurrents[j];
         }
     }
 
@@ -464,6 +494,10 @@ void JointTorqueControlDevice::computeDesiredCurrents()
     {
         log()->warn("Inf or NaN found in control output");
     }
+
+    // the status is copied in a preallocated slot. If the publishing thread is late the status
+    // is discarded
+    m_statusBuffer.push(m_status);
 }
 
 void JointTorqueControlDevice::readStatus()
@@ -840,9 +874,15 @@ bool JointTorqueControlDevice::open(yarp::os::Searchable& config)
         motorTorqueCurrentParameters[i].kfc = kfc[i];
         motorTorqueCurrentParameters[i].kp = kp[i];
         motorTorqueCurrentParameters[i].maxCurr = maxCurr[i];
-        motorTorqueCurrentParameters[i].frictionModel = frictionModels[i];
+        motorTorqueCurrentParameters[i].setFrictionModel(frictionModels[i]);
         motorTorqueCurrentParameters[i].maxOutputFriction = maxOutputFriction[i];
     }
+    m_torqueControlParametersSnapshot.initialize(motorTorqueCurrentParameters);
+    m_frictionModelsInUse.resize(kt.size());
+    for (int i = 0; i < kt.size(); i++)
+    {
+        m_frictionModelsInUse[i] = motorTorqueCurrentParameters[i].frictionModelType;
+    }
 
     auto filterParams = std::make_shared<ParametersHandler::YarpImplementation>();
     filterParams->setParameter("cutoff_frequency", m_lowPassFilterParameters.cutoffFrequency);
@@ -866,7 +906,7 @@ bool JointTorqueControlDevice::open(yarp::os::Searchable& config)
 
     for (int i = 0; i < kt.size(); i++)
     {
-        if (motorTorqueCurrentParameters[i].frictionModel == "FRICTION_PINN")
+        if (motorTorqueCurrentParameters[i].frictionModelType == FrictionModel::PINN)
         {
             frictionEstimators[i] = std::make_unique<PINNFrictionEstimator>();
 
@@ -912,10 +952,6 @@ bool JointTorqueControlDevice::open(yarp::os::Searchable& config)
     m_vectorsCollectionServer.populateMetadata("friction_torques::estimated", joint_list);
     m_vectorsCollectionServer.finalizeMetadata();
 
-    // run the thread
-    m_torqueControlIsRunning = false;
-    m_publishEstimationThread = std::thread([this] { this->publishStatus(); });
-
     return ret;
 }
 
@@ -928,13 +964,10 @@ void JointTorqueControlDevice::publishStatus()
     auto wakeUpTime = time;
     const auto publishOutputPeriod = std::chrono::duration<double>(0.01);
 
-    m_torqueControlIsRunning = true;
+    Status status;
 
     while (m_torqueControlIsRunning)
     {
-        m_vectorsCollectionServer.prepareData(); // required to prepare the data to be sent
-        m_vectorsCollectionServer.clearData(); // optional see the documentation
-
         // detect if a clock has been reset
         oldTime = time;
         time = BipedalLocomotion::clock().now();
@@ -946,14 +979,23 @@ void JointTorqueControlDevice::publishStatus()
         wakeUpTime = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeUpTime
                                                                           + publishOutputPeriod);
 
+        // only the latest status computed by the control loop is published
+        bool isStatusUpdated = false;
+        while (m_statusBuffer.pop(status))
         {
-            std::lock_guard<std::mutex> lockOutput(m_status.mutex);
+            isStatusUpdated = true;
+        }
+
+        if (isStatusUpdated)
+        {
+            m_vectorsCollectionServer.prepareData(); // required to prepare the data to be sent
+            m_vectorsCollectionServer.clearData(); // optional see the documentation
             m_vectorsCollectionServer.populateData("motor_currents::desired",
-                                                   m_status.m_currentLogging);
+                                                   status.m_currentLogging);
             m_vectorsCollectionServer.populateData("position_error::input_network",
-                                                   m_status.m_motorPositionError);
+                                                   status.m_motorPositionError);
             m_vectorsCollectionServer.populateData("friction_torques::estimated",
-                                                   m_status.m_frictionLogging);
+                                                   status.m_frictionLogging);
             m_vectorsCollectionServer.sendData();
         }
 
@@ -1023,6 +1065,22 @@ bool JointTorqueControlDevice::attachAll(const PolyDriverList& p)
                    .asInt32();
     this->setPeriod(rate * 0.001);
 
+    // the queue contains the status computed by the control loop in two periods of the publishing
+    // thread
+    if (ret)
+    {
+        constexpr double publishStatusPeriodInMs = 10;
+        const auto capacity
+            = static_cast<std::size_t>(2 * std::ceil(publishStatusPeriodInMs / std::max(rate, 1)));
+        ret = m_statusBuffer.initialize(capacity, m_status);
+    }
+
+    if (ret)
+    {
+        m_torqueControlIsRunning = true;
+        m_publishEstimationThread = std::thread([this] { this->publishStatus(); });
+    }
+
     if (ret)
     {
         if (!this->start())
@@ -1212,7 +1270,7 @@ bool JointTorqueControlDevice::setControlModes(const int n_joint, const int* joi
 bool JointTorqueControlDevice::setRefTorques(const double* trqs)
 {
     {
-        std::lock_guard<std::mutex>(this->globalMutex);
+        std::lock_guard<std::mutex> lock(this->globalMutex);
         memcpy(desiredJointTorques.data(), trqs, this->axes * sizeof(double));
 
         this->controlLoop();
@@ -1226,7 +1284,7 @@ bool JointTorqueControlDevice::setRefTorques(const int n_joints,
                                              const double* trqs)
 {
     {
-        std::lock_guard<std::mutex>(this->globalMutex);
+        std::lock_guard<std::mutex> lock(this->globalMutex);
         for (int i = 0; i < n_joints; i++)
         {
             desiredJointTorques[joints[i]] = trqs[i];
@@ -1240,7 +1298,7 @@ bool JointTorqueControlDevice::setRefTorques(const int n_joints,
 
 bool JointTorqueControlDevice::setRefTorque(int j, double trq)
 {
-    std::lock_guard<std::mutex>(this->globalMutex);
+    std::lock_guard<std::mutex> lock(this->globalMutex);
     desiredJointTorques[j] = trq;
 
     // If the single joint version is used, we do not call the updateLoop, because probably this
@@ -1252,14 +1310,14 @@ bool JointTorqueControlDevice::setRefTorque(int j, double trq)
 
 bool JointTorqueControlDevice::getRefTorques(double* trqs)
 {
-    std::lock_guard<std::mutex>(this->globalMutex);
+    std::lock_guard<std::mutex> lock(this->globalMutex);
     memcpy(trqs, desiredJointTorques.data(), this->axes * sizeof(double));
     return true;
 }
 
 bool JointTorqueControlDevice::getRefTorque(int j, double* trq)
 {
-    std::lock_guard<std::mutex>(this->globalMutex);
+    std::lock_guard<std::mutex> lock(this->globalMutex);
     *trq = desiredJointTorques[j];
     return true;
 }
@@ -1279,7 +1337,15 @@ void JointTorqueControlDevice::run()
 {
     std::chrono::nanoseconds now = BipedalLocomotion::clock().now();
 
-    std::lock_guard<std::mutex> lock(globalMutex);
+    // if another thread is using the control board (e.g., to change the control mode or to run
+    // the control loop after setting the reference torques) the cycle is skipped instead of
+    // waiting
+    std::unique_lock<std::mutex> lock(globalMutex, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+        return;
+    }
+
     if (now.count() - timeOfLastControlLoop.count() >= this->getPeriod())
     {
         this->controlLoop();
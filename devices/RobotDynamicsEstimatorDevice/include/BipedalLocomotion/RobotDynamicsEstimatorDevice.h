@@ -14,6 +14,7 @@
 #include <BipedalLocomotion/RobotDynamicsEstimator/RobotDynamicsEstimator.h>
 #include <BipedalLocomotion/RobotDynamicsEstimator/SubModel.h>
 #include <BipedalLocomotion/RobotInterface/YarpSensorBridge.h>
+#include <BipedalLocomotion/System/TripleBuffer.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollection.h>
 
 #include <iDynTree/Estimation/ContactStateMachine.h>
@@ -27,6 +28,8 @@
 #include <yarp/os/PeriodicThread.h>
 #include <yarp/os/ResourceFinder.h>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -41,6 +44,10 @@ class RobotDynamicsEstimatorDevice;
  * RobotDynamicsEstimatorDevice is a concrete class and implements yarp device.
  * The device uses the RobotDynamicsEstimator library to estimate joint torques and
  * external contact wrenches.
+ * The device runs three stages at independent rates. The periodic thread of the device acquires
+ * the measurements, a second thread runs the estimator and a third one publishes the results.
+ * The acquisition and the estimation stages share only the latest measurements through a
+ * lock-free System::TripleBuffer, hence a slow estimation step never delays the acquisition.
  */
 class BipedalLocomotion::RobotDynamicsEstimatorDevice : public yarp::dev::DeviceDriver,
                                                         public yarp::dev::IMultipleWrapper,
@@ -91,7 +98,9 @@ public:
 
     /**
      * Loop function. This is the thread itself.
-     * The thread calls the run() function every <period> ms.
+     * The thread calls the run() function every <period> ms. It implements the acquisition
+     * stage, i.e., it reads the sensors and makes the measurements available to the estimation
+     * thread.
      */
     virtual void run() final;
 
@@ -128,19 +137,57 @@ private:
                            object.
                          */
     std::thread m_publishEstimationThread; /**< Thread to publish the estimation. */
+    std::thread m_estimationThread; /**< Thread running the estimator. */
+    std::chrono::nanoseconds m_estimationPeriod; /**< Period of the estimation thread. */
+    std::chrono::nanoseconds m_publishPeriod; /**< Period of the publishing thread. */
+
+    /**
+     * Measurements acquired by the periodic thread.
+     */
+    struct Measurements
+    {
+        BipedalLocomotion::Estimators::RobotDynamicsEstimator::RobotDynamicsEstimatorInput input;
+        Eigen::VectorXd measuredTauj; /**< Measured joint torques. */
+        std::size_t sequence{0}; /**< Number of the acquisition. */
+        std::chrono::nanoseconds timestamp{0}; /**< Time at the end of the acquisition. */
+        std::chrono::nanoseconds acquisitionDuration{0}; /**< Duration of the acquisition. */
+    };
+    System::TripleBuffer<Measurements> m_measurements; /**< Latest measurements shared between
+                                                          the acquisition and the estimation
+                                                          threads. */
+    std::size_t m_acquisitionSequence{0}; /**< Number of acquisitions. */
+
     struct EstimatorInput
     {
         std::mutex mutex;
-        BipedalLocomotion::Estimators::RobotDynamicsEstimator::RobotDynamicsEstimatorInput input;
+        Measurements measurements; /**< Measurements used by the last estimation step. */
     } m_estimatorInput; /**< Estimator input. */
+
+    /**
+     * Timing of the acquisition and the estimation stages.
+     */
+    struct Telemetry
+    {
+        std::chrono::nanoseconds estimationDuration{0}; /**< Duration of the last estimation
+                                                           step. */
+        std::chrono::nanoseconds measurementAge{0}; /**< Time elapsed between the acquisition of
+                                                       the measurements and the beginning of the
+                                                       last estimation step. */
+        std::size_t droppedMeasurements{0}; /**< Number of measurements overwritten before being
+                                               used by the estimator. */
+        std::size_t skippedSteps{0}; /**< Number of estimation steps skipped since no new
+                                        measurements were available. */
+    };
+
     struct EstimatorOutput
     {
         std::mutex mutex;
         BipedalLocomotion::Estimators::RobotDynamicsEstimator::RobotDynamicsEstimatorOutput output;
+        Telemetry telemetry;
     } m_estimatorOutput; /**< Estimator output. */
-    bool m_estimatorIsRunning; /**< Flag to check if the estimator is running. */
+    std::atomic<bool> m_estimatorIsRunning{false}; /**< Flag to check if the estimator is
+                                                      running. */
     Eigen::VectorXd m_estimatedTauj; /**< Estimated joint torques. */
-    Eigen::VectorXd m_measuredTauj; /**< Measured joint torques. */
     yarp::dev::PolyDriver m_remappedVirtualAnalogSensors; /**< Remapped virtual analog sensor
                                                            containg the axes for which the joint
                                                            torques estimates are published */
@@ -200,10 +247,11 @@ private:
     bool openCommunications();
 
     /**
-     * Update the measurements used by the estimator.
+     * Read the measurements used by the estimator.
+     * @param measurements measurements to be filled.
      * @return true/false on success/failure.
      */
-    bool updateMeasurements();
+    bool updateMeasurements(Measurements& measurements);
 
     /**
      * Resize the estimator initial state based on configuration.
@@ -233,6 +281,12 @@ private:
      */
     void publishEstimatorOutput();
 
+    /**
+     * Run the estimator on the latest measurements.
+     * This is a separate thread.
+     */
+    void runEstimator();
+
     /**
      * Open the remapper virtual sensors.
      * @return true/false on success/failure.
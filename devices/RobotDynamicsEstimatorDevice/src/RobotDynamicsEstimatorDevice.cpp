@@ -175,7 +175,6 @@ bool RobotDynamicsEstimatorDevice::resizeEstimatorInitialState(
     m_estimatorOutput.output.tau_m.resize(m_kinDyn->model().getNrOfDOFs());
     m_estimatorOutput.output.tau_F.resize(m_kinDyn->model().getNrOfDOFs());
     m_estimatedTauj.resize(m_kinDyn->model().getNrOfDOFs());
-    m_measuredTauj.resize(m_kinDyn->model().getNrOfDOFs());
     m_estimatedJointTorquesYARP.resize(m_kinDyn->model().getNrOfDOFs());
 
     std::vector<std::string> ftList;
@@ -342,9 +341,11 @@ bool RobotDynamicsEstimatorDevice::setEstimatorInitialState()
 bool RobotDynamicsEstimatorDevice::resizeEstimatorMeasurement(
     IParametersHandler::weak_ptr modelHandler)
 {
-    m_estimatorInput.input.jointPositions.resize(m_kinDyn->model().getNrOfDOFs());
-    m_estimatorInput.input.jointVelocities.resize(m_kinDyn->model().getNrOfDOFs());
-    m_estimatorInput.input.motorCurrents.resize(m_kinDyn->model().getNrOfDOFs());
+    Measurements measurements;
+    measurements.input.jointPositions.resize(m_kinDyn->model().getNrOfDOFs());
+    measurements.input.jointVelocities.resize(m_kinDyn->model().getNrOfDOFs());
+    measurements.input.motorCurrents.resize(m_kinDyn->model().getNrOfDOFs());
+    measurements.measuredTauj.resize(m_kinDyn->model().getNrOfDOFs());
 
     std::vector<std::string> ftList;
     auto ftGroup = modelHandler.lock()->getGroup("FT").lock();
@@ -355,7 +356,7 @@ bool RobotDynamicsEstimatorDevice::resizeEstimatorMeasurement(
 
     for (const auto& ft : ftList)
     {
-        m_estimatorInput.input.ftWrenches[ft] = Eigen::VectorXd::Zero(6);
+        measurements.input.ftWrenches[ft] = Eigen::VectorXd::Zero(6);
     }
 
     std::vector<std::string> accList;
@@ -366,7 +367,7 @@ bool RobotDynamicsEstimatorDevice::resizeEstimatorMeasurement(
     }
     for (auto acc : accList)
     {
-        m_estimatorInput.input.linearAccelerations[acc] = Eigen::VectorXd::Zero(3); // ACC BIAS
+        measurements.input.linearAccelerations[acc] = Eigen::VectorXd::Zero(3); // ACC BIAS
     }
 
     std::vector<std::string> gyroList;
@@ -377,9 +378,13 @@ bool RobotDynamicsEstimatorDevice::resizeEstimatorMeasurement(
     }
     for (auto gyro : gyroList)
     {
-        m_estimatorInput.input.angularVelocities[gyro] = Eigen::VectorXd(3).setZero(); // GYRO BIAS
+        measurements.input.angularVelocities[gyro] = Eigen::VectorXd(3).setZero(); // GYRO BIAS
     }
 
+    // all the copies of the measurements are allocated here, so the threads never allocate memory
+    m_measurements.initialize(measurements);
+    m_estimatorInput.measurements = measurements;
+
     return true;
 }
 
@@ -453,10 +458,7 @@ bool RobotDynamicsEstimatorDevice::open(yarp::os::Searchable& config)
         return false;
     }
     double devicePeriod{0.01};
-    if (generalGroupHandler->getParameter("sampling_time", devicePeriod))
-    {
-        this->setPeriod(devicePeriod);
-    } else
+    if (!generalGroupHandler->getParameter("sampling_time", devicePeriod))
     {
         generalGroupHandler->setParameter("sampling_time", devicePeriod);
         if (!params->setGroup("GENERAL", generalGroupHandler))
@@ -466,6 +468,32 @@ bool RobotDynamicsEstimatorDevice::open(yarp::os::Searchable& config)
         }
     }
 
+    // the estimator runs at the sampling time used to discretize its model. The sensors can be
+    // read at a different rate.
+    m_estimationPeriod = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(devicePeriod));
+
+    double acquisitionPeriod{devicePeriod};
+    if (!generalGroupHandler->getParameter("acquisition_period", acquisitionPeriod))
+    {
+        log()->info("{} The parameter 'acquisition_period' is not provided. The sampling time "
+                    "will be used {}.",
+                    logPrefix,
+                    acquisitionPeriod);
+    }
+    this->setPeriod(acquisitionPeriod);
+
+    double publishPeriod{0.01};
+    if (!generalGroupHandler->getParameter("publish_period", publishPeriod))
+    {
+        log()->info("{} The parameter 'publish_period' is not provided. The default one "
+                    "will be used {}.",
+                    logPrefix,
+                    publishPeriod);
+    }
+    m_publishPeriod = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(publishPeriod));
+
     if (!generalGroupHandler->getParameter("robot", m_robot))
     {
         log()->info("{} The parameter 'robot' is not provided. The default one "
@@ -588,7 +616,9 @@ bool RobotDynamicsEstimatorDevice::attachAll(const yarp::dev::PolyDriverList& po
         return false;
     }
 
-    // run the thread
+    // run the threads
+    m_estimatorIsRunning = true;
+    m_estimationThread = std::thread([this] { this->runEstimator(); });
     m_publishEstimationThread = std::thread([this] { this->publishEstimatorOutput(); });
 
     start();
@@ -596,57 +626,57 @@ bool RobotDynamicsEstimatorDevice::attachAll(const yarp::dev::PolyDriverList& po
     return true;
 }
 
-bool RobotDynamicsEstimatorDevice::updateMeasurements()
+bool RobotDynamicsEstimatorDevice::updateMeasurements(Measurements& measurements)
 {
-    m_estimatorInput.input.basePose.setIdentity();
-    m_estimatorInput.input.baseVelocity.setZero();
-    m_estimatorInput.input.baseAcceleration.setZero();
+    measurements.input.basePose.setIdentity();
+    measurements.input.baseVelocity.setZero();
+    measurements.input.baseAcceleration.setZero();
 
-    if (!m_robotSensorBridge->getJointPositions(m_estimatorInput.input.jointPositions))
+    if (!m_robotSensorBridge->getJointPositions(measurements.input.jointPositions))
     {
         return false;
     }
 
-    if (!m_robotSensorBridge->getJointVelocities(m_estimatorInput.input.jointVelocities))
+    if (!m_robotSensorBridge->getJointVelocities(measurements.input.jointVelocities))
     {
         return false;
     }
 
-    if (!m_robotSensorBridge->getMotorCurrents(m_estimatorInput.input.motorCurrents))
+    if (!m_robotSensorBridge->getMotorCurrents(measurements.input.motorCurrents))
     {
         return false;
     }
 
-    for (auto& [key, value] : m_estimatorInput.input.ftWrenches)
+    for (auto& [key, value] : measurements.input.ftWrenches)
     {
         if (!m_robotSensorBridge
-                 ->getSixAxisForceTorqueMeasurement(key, m_estimatorInput.input.ftWrenches[key]))
+                 ->getSixAxisForceTorqueMeasurement(key, measurements.input.ftWrenches[key]))
         {
             return false;
         }
-        m_estimatorInput.input.ftWrenches[key] -= m_ftOffset[key];
+        measurements.input.ftWrenches[key] -= m_ftOffset[key];
     }
 
-    for (auto& [key, value] : m_estimatorInput.input.linearAccelerations)
+    for (auto& [key, value] : measurements.input.linearAccelerations)
     {
         if (!m_robotSensorBridge->getLinearAccelerometerMeasurement(key,
-                                                                    m_estimatorInput.input
+                                                                    measurements.input
                                                                         .linearAccelerations[key]))
         {
             return false;
         }
     }
 
-    for (auto& [key, value] : m_estimatorInput.input.angularVelocities)
+    for (auto& [key, value] : measurements.input.angularVelocities)
     {
         if (!m_robotSensorBridge->getGyroscopeMeasure(key,
-                                                      m_estimatorInput.input.angularVelocities[key]))
+                                                      measurements.input.angularVelocities[key]))
         {
             return false;
         }
     }
 
-    m_robotSensorBridge->getJointTorques(m_measuredTauj);
+    m_robotSensorBridge->getJointTorques(measurements.measuredTauj);
 
     return true;
 }
@@ -658,10 +688,6 @@ void RobotDynamicsEstimatorDevice::publishEstimatorOutput()
     auto time = BipedalLocomotion::clock().now();
     auto oldTime = time;
     auto wakeUpTime = time;
-    const auto publishOutputPeriod = std::chrono::duration<double>(0.01);
-
-    m_estimatorIsRunning = true;
-
     while (m_estimatorIsRunning)
     {
         auto& data = m_loggerPort.prepare();
@@ -675,8 +701,7 @@ void RobotDynamicsEstimatorDevice::publishEstimatorOutput()
         {
             wakeUpTime = time;
         }
-        wakeUpTime = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeUpTime
-                                                                          + publishOutputPeriod);
+        wakeUpTime += m_publishPeriod;
 
         {
 
@@ -696,8 +721,6 @@ void RobotDynamicsEstimatorDevice::publishEstimatorOutput()
             data.vectors["tau_j::estimated"].assign(m_estimatedTauj.data(),
                                                     m_estimatedTauj.data()
                                                         + m_estimatedTauj.size());
-            data.vectors["tau_j::measured"].assign(m_measuredTauj.data(),
-                                                   m_measuredTauj.data() + m_measuredTauj.size());
 
             for (auto& [key, value] : m_estimatorOutput.output.ftWrenches)
             {
@@ -721,34 +744,50 @@ void RobotDynamicsEstimatorDevice::publishEstimatorOutput()
                 data.vectors["accelerometer_biases::" + key + "::estimated"]
                     .assign(value.data(), value.data() + value.size());
             }
+
+            const auto& telemetry = m_estimatorOutput.telemetry;
+            data.vectors["timing::estimation_duration"]
+                = {std::chrono::duration<double>(telemetry.estimationDuration).count()};
+            data.vectors["timing::measurement_age"]
+                = {std::chrono::duration<double>(telemetry.measurementAge).count()};
+            data.vectors["timing::dropped_measurements"]
+                = {static_cast<double>(telemetry.droppedMeasurements)};
+            data.vectors["timing::skipped_estimation_steps"]
+                = {static_cast<double>(telemetry.skippedSteps)};
         }
 
         {
             std::lock_guard<std::mutex> lockInput(m_estimatorInput.mutex);
-
-            data.vectors["im::measured"].assign(m_estimatorInput.input.motorCurrents.data(),
-                                                m_estimatorInput.input.motorCurrents.data()
-                                                    + m_estimatorInput.input.motorCurrents.size());
-            data.vectors["ds::measured"].assign(m_estimatorInput.input.jointVelocities.data(),
-                                                m_estimatorInput.input.jointVelocities.data()
-                                                    + m_estimatorInput.input.jointVelocities.size());
-            for (auto& [key, value] : m_estimatorInput.input.ftWrenches)
+            const auto& measurements = m_estimatorInput.measurements;
+
+            data.vectors["tau_j::measured"].assign(measurements.measuredTauj.data(),
+                                                   measurements.measuredTauj.data()
+                                                       + measurements.measuredTauj.size());
+            data.vectors["im::measured"].assign(measurements.input.motorCurrents.data(),
+                                                measurements.input.motorCurrents.data()
+                                                    + measurements.input.motorCurrents.size());
+            data.vectors["ds::measured"].assign(measurements.input.jointVelocities.data(),
+                                                measurements.input.jointVelocities.data()
+                                                    + measurements.input.jointVelocities.size());
+            for (auto& [key, value] : measurements.input.ftWrenches)
             {
                 data.vectors["fts::" + key + "::measured"].assign(value.data(),
                                                                   value.data() + value.size());
             }
-            for (auto& [key, value] : m_estimatorInput.input.linearAccelerations)
+            for (auto& [key, value] : measurements.input.linearAccelerations)
             {
                 data.vectors["accelerometers::" + key + "::measured"].assign(value.data(),
                                                                              value.data()
                                                                                  + value.size());
             }
-            for (auto& [key, value] : m_estimatorInput.input.angularVelocities)
+            for (auto& [key, value] : measurements.input.angularVelocities)
             {
                 data.vectors["gyroscopes::" + key + "::measured"].assign(value.data(),
                                                                          value.data()
                                                                              + value.size());
             }
+            data.vectors["timing::acquisition_duration"]
+                = {std::chrono::duration<double>(measurements.acquisitionDuration).count()};
         }
         m_loggerPort.write();
 
@@ -765,10 +804,89 @@ void RobotDynamicsEstimatorDevice::publishEstimatorOutput()
     }
 }
 
+void RobotDynamicsEstimatorDevice::runEstimator()
+{
+    constexpr auto logPrefix = "[RobotDynamicsEstimatorDevice::runEstimator]";
+
+    auto time = BipedalLocomotion::clock().now();
+    auto oldTime = time;
+    auto wakeUpTime = time;
+
+    // the first measurements are published by the acquisition thread after setting the initial
+    // state of the estimator
+    bool isEstimatorInitialized{false};
+    std::size_t lastSequence{0};
+
+    while (m_estimatorIsRunning)
+    {
+        // detect if a clock has been reset
+        oldTime = time;
+        time = BipedalLocomotion::clock().now();
+        // if the current time is lower than old time, the timer has been reset.
+        if ((time - oldTime).count() < 1e-12)
+        {
+            wakeUpTime = time;
+        }
+        wakeUpTime += m_estimationPeriod;
+
+        if (!m_measurements.update())
+        {
+            if (isEstimatorInitialized)
+            {
+                std::lock_guard<std::mutex> lockOutput(m_estimatorOutput.mutex);
+                m_estimatorOutput.telemetry.skippedSteps++;
+            }
+
+            BipedalLocomotion::clock().sleepUntil(wakeUpTime);
+            continue;
+        }
+
+        const auto& measurements = m_measurements.getReadBuffer();
+        const std::size_t droppedMeasurements
+            = isEstimatorInitialized ? measurements.sequence - lastSequence - 1 : 0;
+        lastSequence = measurements.sequence;
+        isEstimatorInitialized = true;
+
+        const auto estimationStart = BipedalLocomotion::clock().now();
+
+        if (!m_estimator->setInput(measurements.input))
+        {
+            log()->error("{} Could not set estimator input.", logPrefix);
+        } else if (!m_estimator->advance())
+        {
+            log()->warn("{} Advance RobotDynamicsEstimator failed.", logPrefix);
+        } else
+        {
+            const auto estimationEnd = BipedalLocomotion::clock().now();
+
+            std::lock_guard<std::mutex> lockOutput(m_estimatorOutput.mutex);
+            m_estimatorOutput.output = m_estimator->getOutput();
+
+            auto& telemetry = m_estimatorOutput.telemetry;
+            telemetry.estimationDuration = estimationEnd - estimationStart;
+            telemetry.measurementAge = estimationStart - measurements.timestamp;
+            telemetry.droppedMeasurements += droppedMeasurements;
+        }
+
+        {
+            std::lock_guard<std::mutex> lockInput(m_estimatorInput.mutex);
+            m_estimatorInput.measurements = measurements;
+        }
+
+        // release the CPU
+        BipedalLocomotion::clock().yield();
+
+        // sleep
+        BipedalLocomotion::clock().sleepUntil(wakeUpTime);
+    }
+}
+
 void RobotDynamicsEstimatorDevice::run()
 {
     constexpr auto logPrefix = "[RobotDynamicsEstimatorDevice::run]";
 
+    const auto acquisitionStart = BipedalLocomotion::clock().now();
+
     // advance sensor bridge
     if (!m_robotSensorBridge->advance())
     {
@@ -778,8 +896,12 @@ void RobotDynamicsEstimatorDevice::run()
 
     if (m_isFirstRun)
     {
+        // the estimation thread does not use the estimator until the first measurements are
+        // published
+        std::unique_lock<std::mutex> lockOutput(m_estimatorOutput.mutex);
         if (!setEstimatorInitialState())
         {
+            lockOutput.unlock();
             log()->error("{} Could not set estimator initial state", logPrefix);
             detachAll();
             close();
@@ -789,32 +911,19 @@ void RobotDynamicsEstimatorDevice::run()
         m_isFirstRun = false;
     }
 
-    // update estimator measurements
-    {
-        std::lock_guard<std::mutex> lockInput(m_estimatorInput.mutex);
-        if (!updateMeasurements())
-        {
-            log()->error("{} Measurement updates failed.", logPrefix);
-            return;
-        }
-
-        if (!m_estimator->setInput(m_estimatorInput.input))
-        {
-            log()->error("{} Could not set estimator input.", logPrefix);
-            return;
-        }
-    }
-
-    if (!m_estimator->advance())
+    // update estimator measurements. The measurements are written in the copy owned by this
+    // thread, hence the estimation thread is never blocked.
+    auto& measurements = m_measurements.getWriteBuffer();
+    if (!updateMeasurements(measurements))
     {
-        log()->warn("{} Advance RobotDynamicsEstimator failed.", logPrefix);
+        log()->error("{} Measurement updates failed.", logPrefix);
         return;
     }
 
-    {
-        std::lock_guard<std::mutex> lockOutput(m_estimatorOutput.mutex);
-        m_estimatorOutput.output = m_estimator->getOutput();
-    }
+    measurements.sequence = ++m_acquisitionSequence;
+    measurements.timestamp = BipedalLocomotion::clock().now();
+    measurements.acquisitionDuration = measurements.timestamp - acquisitionStart;
+    m_measurements.publish();
 
     return;
 }
@@ -834,6 +943,10 @@ bool RobotDynamicsEstimatorDevice::detachAll()
 bool RobotDynamicsEstimatorDevice::close()
 {
     m_estimatorIsRunning = false;
+    if (m_estimationThread.joinable())
+    {
+        m_estimationThread.join();
+    }
     if (m_publishEstimationThread.joinable())
     {
         m_publishEstimationThread.join();
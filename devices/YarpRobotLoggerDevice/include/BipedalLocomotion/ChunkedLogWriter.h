@@ -0,0 +1,191 @@
+/**
+ * @file ChunkedLogWriter.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_FRAMEWORK_CHUNKED_LOG_WRITER_H
+#define BIPEDAL_LOCOMOTION_FRAMEWORK_CHUNKED_LOG_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <iDynTree/Span.h>
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+
+namespace BipedalLocomotion
+{
+
+/**
+ * ChunkedLogWriter streams numeric signals on disk while they are collected. The samples of each
+ * channel are accumulated in chunks preallocated when the channel is added and, once a chunk is
+ * full, it is written by a background thread. The chunks of a channel are shared with the
+ * background thread without locks, hence the memory required by the writer does not depend on
+ * the length of the experiment and adding a sample never blocks. If the disk is not able to keep
+ * up with the producer the new samples are dropped and counted.
+ *
+ * The chunks are compressed without losing information. The bit representation of each value is
+ * replaced by its difference with respect to the previous sample, the bytes of the result are
+ * shuffled so that the bytes with the same significance are contiguous, and the runs of zero
+ * bytes are encoded with their length. Since the most significant bytes of slowly varying signals
+ * do not change, they are stored in a few bytes.
+ *
+ * The file is a sequence of records written in the native byte order (little endian on all the
+ * supported platforms). The file starts with the 8 bytes magic string `BLFLOG01`, then each record
+ * is composed by
+ * - `uint32` type of the record (ChunkedLogWriter::channelRecord, ChunkedLogWriter::chunkRecord or
+ *   ChunkedLogWriter::compressedChunkRecord);
+ * - `uint64` size of the payload in bytes;
+ * - the payload;
+ * - `uint32` 32 bit FNV-1a hash of the payload.
+ *
+ * The payload of a channel record contains the `uint32` channel id, the `uint32` number of
+ * elements, the name and the name of each element (each string is stored as a `uint32` length
+ * followed by the characters). The payload of a chunk record contains the `uint32` channel id,
+ * the `uint32` number of samples `n`, `n` timestamps and then, for each element of the channel,
+ * `n` consecutive values (i.e., the data is stored by column). The payload of a compressed chunk
+ * record contains the `uint32` channel id, the `uint32` number of samples, the `uint32` size in
+ * bytes of each compressed column (the timestamps and then each element) and the compressed
+ * columns.
+ * Every record is flushed once written, so if the process crashes the file contains all the
+ * chunks written so far and at most a truncated record, that is discarded by ChunkedLogReader.
+ *
+ * The following parameters are used to initialize the class
+ *
+ * |    Parameter Name   |  Type  |               Description               | Mandatory | Default |
+ * |:-------------------:|:------:|:---------------------------------------:|:---------:|:-------:|
+ * |     `chunk_size`    | `int`  |   Number of samples stored in a chunk.  |     No    |   1000  |
+ * | `max_queued_chunks` | `int`  | Full chunks of a channel to be written. |     No    |    4    |
+ * |    `compression`    | `bool` |    If true the chunks are compressed.   |     No    |   true  |
+ */
+class ChunkedLogWriter
+{
+public:
+    static constexpr std::uint32_t channelRecord = 1; /**< Record describing a channel. */
+    static constexpr std::uint32_t chunkRecord = 2; /**< Record containing a chunk of samples. */
+    static constexpr std::uint32_t compressedChunkRecord = 3; /**< Record containing a
+                                                                 compressed chunk of samples. */
+
+    /**
+     * Constructor.
+     */
+    ChunkedLogWriter();
+
+    /**
+     * Destructor. The file is closed if it is still open.
+     */
+    ~ChunkedLogWriter();
+
+    /**
+     * Initialize the writer.
+     * @param handler pointer to the parameter handler.
+     * @return true in case of success, false otherwise.
+     * @note This function must be called before adding the channels.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
+
+    /**
+     * Open a file and start the writing thread. The description of all the channels already
+     * added is written at the beginning of the file.
+     * @param fileName name of the file.
+     * @return true in case of success, false otherwise.
+     */
+    bool open(const std::string& fileName);
+
+    /**
+     * Write all the collected samples, stop the writing thread and close the file. The channels
+     * are kept, so the writer can be opened again on a different file.
+     * @return true in case of success, false otherwise.
+     */
+    bool close();
+
+    /**
+     * Check if a file is open.
+     * @return true if the file is open, false otherwise.
+     */
+    bool isOpen() const;
+
+    /**
+     * Add a channel.
+     * @param name name of the channel.
+     * @param elementNames name of the elements of the channel. Its size defines the size of the
+     * channel.
+     * @return true in case of success, false otherwise.
+     * @note The chunks of the channel are allocated by this function. It must not be called
+     * concurrently with push().
+     */
+    bool addChannel(const std::string& name, const std::vector<std::string>& elementNames);
+
+    /**
+     * Add a sample to a channel. Unless the size of the sample changes, the function does not
+     * allocate memory, it does not lock any mutex and it does not access the disk.
+     * @param name name of the channel.
+     * @param time timestamp of the sample.
+     * @param data the sample.
+     * @return true in case of success, false if the channel does not exist.
+     * @note If the size of the sample is different from the size of the channel, the sample is
+     * stored in the channel named `<name>_size_<size>`, that is added the first time the size
+     * changes. The elements of the new channel are named `element_<i>`.
+     * @note If all the chunks of the channel are waiting to be written, the sample is dropped and
+     * counted. This also happens if too many samples are pushed while the file is closed, since
+     * the samples are written once the file is opened again.
+     * @warning The function must be always called by the same thread.
+     */
+    bool push(const std::string& name, double time, iDynTree::Span<const double> data);
+
+    /**
+     * Get the number of samples dropped because all the chunks of their channel were full.
+     * @return the number of dropped samples.
+     */
+    std::size_t getDroppedSamples() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+/**
+ * ChunkedLogReader loads in memory a file written by ChunkedLogWriter.
+ */
+class ChunkedLogReader
+{
+public:
+    /**
+     * Signal stored in the file.
+     */
+    struct Channel
+    {
+        std::vector<std::string> elementNames; /**< Name of each element. */
+        std::vector<double> time; /**< Timestamps of the samples. */
+        Eigen::MatrixXd data; /**< Samples of the channel. Each column is a sample. */
+    };
+
+    /**
+     * Read a file.
+     * @param fileName name of the file.
+     * @return true in case of success, false otherwise.
+     * @note A truncated or corrupted record at the end of the file is discarded and it is not
+     * considered an error, since it is the expected outcome of a crash of the writer.
+     */
+    bool open(const std::string& fileName);
+
+    /**
+     * Get all the channels stored in the file.
+     * @return a map containing the channels.
+     */
+    const std::unordered_map<std::string, Channel>& getChannels() const;
+
+private:
+    std::unordered_map<std::string, Channel> m_channels;
+};
+
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_FRAMEWORK_CHUNKED_LOG_WRITER_H
@@ -7,9 +7,13 @@
 #define BIPEDAL_LOCOMOTION_FRAMEWORK_YARP_ROBOT_LOGGER_DEVICE_H
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -26,8 +30,10 @@
 
 #include <robometry/BufferManager.h>
 
+#include <BipedalLocomotion/ChunkedLogWriter.h>
 #include <BipedalLocomotion/RobotInterface/YarpCameraBridge.h>
 #include <BipedalLocomotion/RobotInterface/YarpSensorBridge.h>
+#include <BipedalLocomotion/System/SPSCRingBuffer.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollection.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollectionClient.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollectionServer.h>
@@ -97,15 +103,34 @@ private:
 
     struct VectorsCollectionSignal
     {
+        /**
+         * Vector of a packed collection. The handle is resolved once when the metadata is
+         * received.
+         */
+        struct Channel
+        {
+            std::string key;
+            std::string name;
+            BipedalLocomotion::YarpUtilities::VectorsCollectionLayout::Handle handle{0};
+            Eigen::VectorXd buffer; /**< Buffer used to store the vector. */
+        };
+
         std::mutex mutex;
         BipedalLocomotion::YarpUtilities::VectorsCollectionClient client;
         BipedalLocomotion::YarpUtilities::VectorsCollectionMetadata metadata;
         std::string signalName;
+        std::vector<Channel> channels; /**< Empty if the data is not packed. */
         bool dataArrived{false};
         std::atomic<bool> connected{false};
 
         bool connect();
         void disconnect();
+
+        /**
+         * Resolve the channels from the layout of the client.
+         * @param treeDelim delimiter used to build the name of the channels.
+         */
+        void resolveChannels(const std::string& treeDelim);
     };
 
     std::unordered_map<std::string, VectorsCollectionSignal> m_vectorsCollectionSignals;
@@ -125,18 +150,38 @@ private:
             Frame
         };
 
+        /**
+         * Frame waiting to be encoded.
+         */
+        struct Frame
+        {
+            cv::Mat image;
+            std::chrono::nanoseconds captureTime{0};
+            unsigned int index{0};
+        };
+
         struct ImageSaver
         {
             std::mutex mutex;
             std::shared_ptr<cv::VideoWriter> writer;
-            cv::Mat frame;
+            cv::Mat frame; /**< Frame read by the capture thread. */
             SaveMode saveMode{SaveMode::Video};
             std::filesystem::path framesPath;
+            std::string channelName; /**< Name of the channel in the buffer manager. */
+            bool isDepth{false}; /**< True if the saver stores depth images. */
+            double scale{1.0}; /**< Scale applied to the depth images. */
+
+            // the following members are protected by the video encoding mutex
+            std::vector<Frame> freeFrames; /**< Pool of frames. */
+            std::deque<Frame> pendingFrames; /**< Frames waiting to be encoded. */
+            bool isScheduled{false}; /**< True if the saver is in the encoding queue. */
+            std::size_t droppedFrames{0}; /**< Frames dropped since the pool was empty. */
+
+            cv::Mat encodedImage; /**< Buffer used by the encoding thread. */
         };
 
         std::shared_ptr<ImageSaver> rgb;
         std::shared_ptr<ImageSaver> depth;
-        int depthScale{1};
 
         std::thread videoThread;
         std::atomic<bool> recordVideoIsRunning{false};
@@ -146,6 +191,14 @@ private:
     std::string m_videoCodecCode{"mp4v"};
     std::unordered_map<std::string, VideoWriter> m_videoWriters;
 
+    int m_videoEncodingThreadsNumber{2};
+    int m_videoFramesPoolSize{10};
+    std::mutex m_videoEncodingMutex;
+    std::condition_variable m_videoEncodingCondition;
+    std::deque<std::shared_ptr<VideoWriter::ImageSaver>> m_videoEncodingQueue;
+    bool m_videoEncodingIsRunning{false};
+    std::vector<std::thread> m_videoEncodingThreads;
+
     const std::string m_textLoggingPortName = "/YarpRobotLoggerDevice/TextLogging:i";
     std::unordered_set<std::string> m_textLoggingPortNames;
     yarp::os::BufferedPort<yarp::os::Bottle> m_textLoggingPort;
@@ -153,14 +206,84 @@ private:
     std::unordered_set<std::string> m_textLogsStoredInManager;
     std::thread m_lookForNewLogsThread;
 
-    Eigen::VectorXd m_jointSensorBuffer;
-    ft_t m_ftBuffer;
-    gyro_t m_gyroBuffer;
-    accelerometer_t m_acceloremeterBuffer;
-    orientation_t m_orientationBuffer;
-    magnemetometer_t m_magnemetometerBuffer;
     analog_sensor_t m_analogSensorBuffer;
-    double m_ftTemperatureBuffer;
+
+    /**
+     * Record containing all the signals read from the sensor bridge in a single run of the
+     * device. The layout of the record is computed in attachAll and it never changes.
+     */
+    struct SensorRecord
+    {
+        double time{0};
+        Eigen::VectorXd data; /**< Signals stored contiguously. */
+        std::vector<unsigned char> isValid; /**< One element for each sensor channel. */
+    };
+
+    /**
+     * Policy deciding which samples of a sensor channel are stored. The samples sent on the
+     * real-time port are not affected by the policy.
+     */
+    struct SamplingPolicy
+    {
+        enum class Type
+        {
+            Always, /**< All the samples are stored. */
+            Decimation, /**< One sample every `decimation` samples is stored. */
+            OnChange, /**< A sample is stored only if it differs from the last stored one. */
+            Deadband, /**< A sample is stored only if at least one element differs more than
+                         `deadband` from the last stored one. */
+        };
+
+        Type type{Type::Always};
+        unsigned int decimation{1};
+        double deadband{0};
+        unsigned int counter{0};
+        Eigen::VectorXd lastStoredSample;
+        bool hasStoredSample{false};
+
+        /**
+         * Check if a sample has to be stored. If so, the state of the policy is updated.
+         * @param sample the sample of the channel.
+         * @return true if the sample has to be stored, false otherwise.
+         */
+        bool shouldStore(Eigen::Ref<const Eigen::VectorXd> sample);
+    };
+
+    /**
+     * Channel of the buffer manager filled with a segment of the SensorRecord.
+     */
+    struct SensorChannel
+    {
+        std::string name;
+        std::string rtName;
+        std::size_t offset{0};
+        std::size_t size{0};
+        Eigen::VectorXd buffer; /**< Buffer used by the telemetry thread. */
+        SamplingPolicy samplingPolicy;
+    };
+
+    /**
+     * Function reading one or more consecutive sensor channels from the sensor bridge.
+     */
+    struct SensorReader
+    {
+        std::size_t firstChannel{0};
+        std::size_t numberOfChannels{0};
+        std::size_t offset{0};
+        std::size_t size{0};
+        std::function<bool(Eigen::Ref<Eigen::VectorXd>)> read;
+    };
+
+    /** Sampling policies associated to the prefix of the channels names. */
+    std::vector<std::pair<std::string, SamplingPolicy>> m_samplingPolicies;
+    std::vector<SensorChannel> m_sensorChannels;
+    std::vector<SensorReader> m_sensorReaders;
+    std::size_t m_sensorRecordSize{0};
+    std::size_t m_sensorRecordsQueueSize{1000};
+    BipedalLocomotion::System::SPSCRingBuffer<SensorRecord> m_sensorRecords;
+    std::atomic<std::size_t> m_droppedSensorRecords{0};
+    std::atomic<bool> m_telemetryThreadIsRunning{false};
+    std::thread m_telemetryThread;
 
     bool m_streamMotorStates{false};
     bool m_streamJointStates{false};
@@ -177,8 +300,18 @@ private:
     std::mutex m_bufferManagerMutex;
     robometry::BufferManager m_bufferManager;
 
+    bool m_streamTelemetry{false}; /**< If true the numeric signals are streamed on disk. */
+    ChunkedLogWriter m_streamingWriter;
+    const std::string m_streamingFileName = "output_telemetry.blflog";
+
     void lookForNewLogs();
     void lookForExogenousSignals();
+    void processTelemetry();
+    void logSensorRecord(const SensorRecord& record);
+
+    bool addSensorChannels(
+        const std::vector<std::pair<std::string, std::vector<std::string>>>& channels,
+        std::function<bool(Eigen::Ref<Eigen::VectorXd>)> reader);
 
     bool addChannel(const std::string& nameKey,
                     std::size_t vectorSize,
@@ -186,6 +319,13 @@ private:
 
     bool hasSubstring(const std::string& str, const std::vector<std::string>& substrings) const;
     void recordVideo(const std::string& cameraName, VideoWriter& writer);
+    void enqueueFrame(const std::shared_ptr<VideoWriter::ImageSaver>& imageSaver,
+                      std::chrono::nanoseconds captureTime,
+                      unsigned int index);
+    void encodeFrames();
+    void encodeFrame(VideoWriter::ImageSaver& imageSaver,
+                     const VideoWriter::Frame& frame,
+                     std::size_t droppedFrames);
     void unpackIMU(Eigen::Ref<const analog_sensor_t> signal,
                    Eigen::Ref<accelerometer_t> accelerometer,
                    Eigen::Ref<gyro_t> gyro,
@@ -195,6 +335,7 @@ private:
     bool setupTelemetry(std::weak_ptr<const ParametersHandler::IParametersHandler> params,
                         const double& devicePeriod);
     bool setupExogenousInputs(std::weak_ptr<const ParametersHandler::IParametersHandler> params);
+    bool setupSamplingPolicies(std::weak_ptr<const ParametersHandler::IParametersHandler> params);
     bool saveCallback(const std::string& fileName, const robometry::SaveCallbackSaveMethod& method);
     bool openVideoWriter(
         std::shared_ptr<VideoWriter::ImageSaver> imageSaver,
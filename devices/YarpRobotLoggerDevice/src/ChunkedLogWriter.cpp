@@ -0,0 +1,888 @@
+/**
+ * @file ChunkedLogWriter.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include <BipedalLocomotion/ChunkedLogWriter.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion;
+
+namespace
+{
+
+constexpr char fileMagic[] = "BLFLOG01";
+constexpr std::size_t fileMagicSize = 8;
+
+// period used by the writer thread to check if new chunks are available
+constexpr std::chrono::milliseconds writerPeriod{10};
+
+// 32 bit FNV-1a hash. It is used to detect corrupted or truncated records
+constexpr std::uint32_t fnvOffsetBasis = 2166136261u;
+constexpr std::uint32_t fnvPrime = 16777619u;
+
+void hashCombine(const void* data, std::size_t size, std::uint32_t& hash)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= fnvPrime;
+    }
+}
+
+// The columns of a compressed chunk are encoded as follows. The bit representation of each value
+// is subtracted from the previous one (the bit representations of slowly varying signals share
+// the sign, the exponent and the most significant bits of the mantissa) and the difference is
+// zigzag encoded. Then the bytes are shuffled, i.e., the first bytes of all the values are stored,
+// then the second bytes and so on. In this way the zero bytes generated by the difference are
+// contiguous and they are run length encoded. Each token starts with a control byte. If the most
+// significant bit is set the token represents (c & 0x7F) + 1 zero bytes, otherwise it is followed
+// by c + 1 literal bytes.
+constexpr std::size_t maxRunLength = 128;
+
+void compressColumn(const double* data,
+                    std::size_t n,
+                    std::vector<std::uint8_t>& shuffled,
+                    std::vector<std::uint8_t>& output)
+{
+    constexpr std::size_t bytes = sizeof(std::uint64_t);
+    shuffled.resize(n * bytes);
+
+    std::uint64_t previous = 0;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        std::uint64_t value;
+        std::memcpy(&value, data + i, bytes);
+
+        // zigzag encoding of the difference, small negative differences have small magnitude
+        const std::uint64_t difference = value - previous;
+        const std::uint64_t delta = (difference << 1) ^ (0 - (difference >> 63));
+        previous = value;
+        for (std::size_t b = 0; b < bytes; b++)
+        {
+            shuffled[b * n + i] = static_cast<std::uint8_t>(delta >> (8 * b));
+        }
+    }
+
+    std::size_t i = 0;
+    while (i < shuffled.size())
+    {
+        std::size_t run = 0;
+        if (shuffled[i] == 0)
+        {
+            while (i + run < shuffled.size() && run < maxRunLength && shuffled[i + run] == 0)
+            {
+                run++;
+            }
+            output.push_back(static_cast<std::uint8_t>(0x80 | (run - 1)));
+        } else
+        {
+            while (i + run < shuffled.size() && run < maxRunLength && shuffled[i + run] != 0)
+            {
+                run++;
+            }
+            output.push_back(static_cast<std::uint8_t>(run - 1));
+            output.insert(output.end(), shuffled.begin() + i, shuffled.begin() + i + run);
+        }
+        i += run;
+    }
+}
+
+bool decompressColumn(const std::uint8_t* input,
+                      std::size_t size,
+                      std::size_t n,
+                      std::vector<std::uint8_t>& shuffled,
+                      double* data)
+{
+    constexpr std::size_t bytes = sizeof(std::uint64_t);
+    shuffled.resize(n * bytes);
+
+    std::size_t index = 0;
+    std::size_t i = 0;
+    while (index < size)
+    {
+        const std::uint8_t control = input[index++];
+        const std::size_t run = (control & 0x7F) + 1;
+        if (i + run > shuffled.size())
+        {
+            return false;
+        }
+
+        if (control & 0x80)
+        {
+            std::fill_n(shuffled.begin() + i, run, 0);
+        } else
+        {
+            if (index + run > size)
+            {
+                return false;
+            }
+            std::copy_n(input + index, run, shuffled.begin() + i);
+            index += run;
+        }
+        i += run;
+    }
+
+    if (i != shuffled.size())
+    {
+        return false;
+    }
+
+    std::uint64_t previous = 0;
+    for (std::size_t k = 0; k < n; k++)
+    {
+        std::uint64_t delta = 0;
+        for (std::size_t b = 0; b < bytes; b++)
+        {
+            delta |= static_cast<std::uint64_t>(shuffled[b * n + k]) << (8 * b);
+        }
+        previous += (delta >> 1) ^ (0 - (delta & 1));
+        std::memcpy(data + k, &previous, bytes);
+    }
+
+    return true;
+}
+
+/**
+ * Helper class that writes the payload of a record and computes its hash.
+ */
+class RecordWriter
+{
+public:
+    RecordWriter(std::ofstream& stream, std::uint32_t type, std::uint64_t payloadSize)
+        : m_stream(stream)
+    {
+        m_stream.write(reinterpret_cast<const char*>(&type), sizeof(type));
+        m_stream.write(reinterpret_cast<const char*>(&payloadSize), sizeof(payloadSize));
+    }
+
+    void write(const void* data, std::size_t size)
+    {
+        m_stream.write(static_cast<const char*>(data), size);
+        hashCombine(data, size, m_hash);
+    }
+
+    void write(std::uint32_t value)
+    {
+        this->write(&value, sizeof(value));
+    }
+
+    void write(const std::string& value)
+    {
+        this->write(static_cast<std::uint32_t>(value.size()));
+        this->write(value.data(), value.size());
+    }
+
+    bool finalize()
+    {
+        m_stream.write(reinterpret_cast<const char*>(&m_hash), sizeof(m_hash));
+        m_stream.flush();
+        return m_stream.good();
+    }
+
+private:
+    std::ofstream& m_stream;
+    std::uint32_t m_hash{fnvOffsetBasis};
+};
+
+/**
+ * Helper class that reads the payload of a record.
+ */
+class PayloadReader
+{
+public:
+    explicit PayloadReader(const std::vector<char>& payload)
+        : m_payload(payload)
+    {
+    }
+
+    bool read(void* data, std::size_t size)
+    {
+        if (m_index + size > m_payload.size())
+        {
+            return false;
+        }
+        std::memcpy(data, m_payload.data() + m_index, size);
+        m_index += size;
+        return true;
+    }
+
+    bool read(std::uint32_t& value)
+    {
+        return this->read(&value, sizeof(value));
+    }
+
+    bool read(std::string& value)
+    {
+        std::uint32_t size;
+        if (!this->read(size) || m_index + size > m_payload.size())
+        {
+            return false;
+        }
+        value.assign(m_payload.data() + m_index, size);
+        m_index += size;
+        return true;
+    }
+
+private:
+    const std::vector<char>& m_payload;
+    std::size_t m_index{0};
+};
+
+} // namespace
+
+struct ChunkedLogWriter::Impl
+{
+    struct Chunk
+    {
+        std::vector<double> time;
+        Eigen::MatrixXd data; /**< Each column contains the samples of an element. */
+    };
+
+    /**
+     * The chunks of a channel are used as a circular buffer shared by the producer and the writer
+     * thread. The producer stores a sample and then increments pushedSamples, while the writer
+     * thread writes the samples on disk and then increments writtenSamples. A chunk is filled
+     * again only once all its samples have been written, hence no lock is required.
+     */
+    struct Channel
+    {
+        std::uint32_t id{0};
+        std::string name;
+        std::vector<std::string> elementNames;
+        std::vector<Chunk> chunks;
+        std::atomic<std::uint64_t> pushedSamples{0};
+        std::atomic<std::uint64_t> writtenSamples{0};
+        Channel* resized{nullptr}; /**< Channel storing the samples with a different size. */
+        bool isDescriptionWritten{false}; /**< Accessed only by the writer thread. */
+    };
+
+    std::size_t chunkSize{1000};
+    std::size_t maxQueuedChunks{4};
+    bool compression{true};
+
+    // the map is accessed only by the producer, i.e., by addChannel() and push()
+    std::unordered_map<std::string, std::unique_ptr<Channel>> channels;
+    std::atomic<std::size_t> droppedSamples{0};
+
+    // the mutex protects the list of the channels and the state of the writer thread. It is
+    // never locked by push(), unless a channel is added since the size of a sample changed
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<Channel*> channelList;
+    bool isWriterRunning{false};
+
+    std::ofstream stream;
+    std::thread writerThread;
+    bool writeError{false};
+
+    // buffers used by the writer thread
+    std::vector<Channel*> writerChannels;
+    std::vector<std::uint8_t> shuffledBuffer;
+    std::vector<std::uint8_t> compressedBuffer;
+    std::vector<std::size_t> compressedColumnsSize;
+
+    /**
+     * Add a channel and preallocate its chunks.
+     * @return a pointer to the channel or nullptr if a channel with the same name already exists.
+     */
+    Channel* addChannel(const std::string& name, const std::vector<std::string>& elementNames)
+    {
+        if (channels.find(name) != channels.end())
+        {
+            return nullptr;
+        }
+
+        auto channel = std::make_unique<Channel>();
+        channel->id = static_cast<std::uint32_t>(channels.size());
+        channel->name = name;
+        channel->elementNames = elementNames;
+
+        // the current chunk is filled by the producer while the full ones are written
+        channel->chunks.resize(maxQueuedChunks + 1);
+        for (auto& chunk : channel->chunks)
+        {
+            chunk.time.resize(chunkSize);
+            chunk.data.resize(chunkSize, elementNames.size());
+        }
+
+        Channel* ptr = channels.emplace(name, std::move(channel)).first->second.get();
+
+        std::lock_guard lock(mutex);
+        channelList.push_back(ptr);
+        return ptr;
+    }
+
+    bool writeChannel(const Channel& channel)
+    {
+        std::uint64_t payloadSize = 3 * sizeof(std::uint32_t) + channel.name.size();
+        for (const auto& elementName : channel.elementNames)
+        {
+            payloadSize += sizeof(std::uint32_t) + elementName.size();
+        }
+
+        RecordWriter writer(stream, ChunkedLogWriter::channelRecord, payloadSize);
+        writer.write(channel.id);
+        writer.write(static_cast<std::uint32_t>(channel.elementNames.size()));
+        writer.write(channel.name);
+        for (const auto& elementName : channel.elementNames)
+        {
+            writer.write(elementName);
+        }
+        return writer.finalize();
+    }
+
+    bool writeCompressedChunk(const Channel& channel,
+                              const Chunk& chunk,
+                              std::size_t begin,
+                              std::size_t end)
+    {
+        const std::size_t n = end - begin;
+        const std::size_t size = chunk.data.cols();
+
+        // the timestamps are compressed as an additional column
+        compressedBuffer.clear();
+        compressedColumnsSize.clear();
+        compressColumn(chunk.time.data() + begin, n, shuffledBuffer, compressedBuffer);
+        compressedColumnsSize.push_back(compressedBuffer.size());
+        for (std::size_t i = 0; i < size; i++)
+        {
+            const std::size_t offset = compressedBuffer.size();
+            compressColumn(chunk.data.col(i).data() + begin, n, shuffledBuffer, compressedBuffer);
+            compressedColumnsSize.push_back(compressedBuffer.size() - offset);
+        }
+
+        const std::uint64_t payloadSize = (2 + compressedColumnsSize.size()) * sizeof(std::uint32_t)
+                                          + compressedBuffer.size();
+
+        RecordWriter writer(stream, ChunkedLogWriter::compressedChunkRecord, payloadSize);
+        writer.write(channel.id);
+        writer.write(static_cast<std::uint32_t>(n));
+        for (const auto& columnSize : compressedColumnsSize)
+        {
+            writer.write(static_cast<std::uint32_t>(columnSize));
+        }
+        writer.write(compressedBuffer.data(), compressedBuffer.size());
+        return writer.finalize();
+    }
+
+    /**
+     * Write the samples of a chunk in the range [begin, end).
+     */
+    bool writeChunk(const Channel& channel, const Chunk& chunk, std::size_t begin, std::size_t end)
+    {
+        if (compression)
+        {
+            return writeCompressedChunk(channel, chunk, begin, end);
+        }
+
+        const std::size_t n = end - begin;
+        const std::size_t size = chunk.data.cols();
+        const std::uint64_t payloadSize
+            = 2 * sizeof(std::uint32_t) + (n + n * size) * sizeof(double);
+
+        RecordWriter writer(stream, ChunkedLogWriter::chunkRecord, payloadSize);
+        writer.write(channel.id);
+        writer.write(static_cast<std::uint32_t>(n));
+        writer.write(chunk.time.data() + begin, n * sizeof(double));
+        for (std::size_t i = 0; i < size; i++)
+        {
+            writer.write(chunk.data.col(i).data() + begin, n * sizeof(double));
+        }
+        return writer.finalize();
+    }
+
+    void checkWrite(bool ok)
+    {
+        if (!ok && !writeError)
+        {
+            log()->error("[ChunkedLogWriter::runWriter] Unable to write on the file. The "
+                         "following records will be lost.");
+            writeError = true;
+        }
+    }
+
+    /**
+     * Write the full chunks of a channel. If writePartialChunk is true also the samples of the
+     * chunk filled by the producer are written.
+     */
+    void writeSamples(Channel& channel, bool writePartialChunk)
+    {
+        if (!channel.isDescriptionWritten)
+        {
+            checkWrite(writeChannel(channel));
+            channel.isDescriptionWritten = true;
+        }
+
+        const std::uint64_t pushed = channel.pushedSamples.load(std::memory_order_acquire);
+        const std::uint64_t end = writePartialChunk ? pushed : pushed - pushed % chunkSize;
+        std::uint64_t written = channel.writtenSamples.load(std::memory_order_relaxed);
+        while (written < end)
+        {
+            const std::uint64_t chunkIndex = written / chunkSize;
+            const std::size_t begin = written % chunkSize;
+            const std::size_t last = std::min<std::uint64_t>(end - chunkIndex * chunkSize, //
+                                                             chunkSize);
+            checkWrite(writeChunk(channel,
+                                  channel.chunks[chunkIndex % channel.chunks.size()],
+                                  begin,
+                                  last));
+
+            // the chunk can be filled again by the producer once all its samples are written
+            written += last - begin;
+            channel.writtenSamples.store(written, std::memory_order_release);
+        }
+    }
+
+    void runWriter()
+    {
+        bool isRunning = true;
+        while (isRunning)
+        {
+            {
+                std::unique_lock lock(mutex);
+                condition.wait_for(lock, writerPeriod, [this] { return !isWriterRunning; });
+                isRunning = isWriterRunning;
+                writerChannels = channelList;
+            }
+
+            // the disk is accessed without holding the lock. When the writer is stopped also the
+            // chunks that are not full are written
+            for (Channel* channel : writerChannels)
+            {
+                writeSamples(*channel, !isRunning);
+            }
+        }
+    }
+};
+
+ChunkedLogWriter::ChunkedLogWriter()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+ChunkedLogWriter::~ChunkedLogWriter()
+{
+    if (this->isOpen())
+    {
+        this->close();
+    }
+}
+
+bool ChunkedLogWriter::initialize(
+    std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[ChunkedLogWriter::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameters handler is not valid.", logPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->channels.empty())
+    {
+        log()->error("{} The writer must be initialized before adding the channels.", logPrefix);
+        return false;
+    }
+
+    int chunkSize = static_cast<int>(m_pimpl->chunkSize);
+    if (!ptr->getParameter("chunk_size", chunkSize))
+    {
+        log()->info("{} Unable to find the parameter 'chunk_size'. The default value {} will be "
+                    "used.",
+                    logPrefix,
+                    chunkSize);
+    }
+
+    int maxQueuedChunks = static_cast<int>(m_pimpl->maxQueuedChunks);
+    if (!ptr->getParameter("max_queued_chunks", maxQueuedChunks))
+    {
+        log()->info("{} Unable to find the parameter 'max_queued_chunks'. The default value {} "
+                    "will be used.",
+                    logPrefix,
+                    maxQueuedChunks);
+    }
+
+    if (!ptr->getParameter("compression", m_pimpl->compression))
+    {
+        log()->info("{} Unable to find the parameter 'compression'. The default value {} will be "
+                    "used.",
+                    logPrefix,
+                    m_pimpl->compression);
+    }
+
+    if (chunkSize <= 0 || maxQueuedChunks <= 0)
+    {
+        log()->error("{} The parameters 'chunk_size' and 'max_queued_chunks' must be strictly "
+                     "positive.",
+                     logPrefix);
+        return false;
+    }
+
+    m_pimpl->chunkSize = chunkSize;
+    m_pimpl->maxQueuedChunks = maxQueuedChunks;
+    return true;
+}
+
+bool ChunkedLogWriter::open(const std::string& fileName)
+{
+    constexpr auto logPrefix = "[ChunkedLogWriter::open]";
+
+    if (this->isOpen())
+    {
+        log()->error("{} A file is already open. Please call close() first.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->stream.open(fileName, std::ios::binary | std::ios::trunc);
+    if (!m_pimpl->stream.is_open())
+    {
+        log()->error("{} Unable to open the file named {}.", logPrefix, fileName);
+        return false;
+    }
+    m_pimpl->stream.write(fileMagic, fileMagicSize);
+    m_pimpl->stream.flush();
+
+    std::lock_guard lock(m_pimpl->mutex);
+
+    // the description of each channel is written before its samples, including the ones collected
+    // while the file was closed
+    for (auto* channel : m_pimpl->channelList)
+    {
+        channel->isDescriptionWritten = false;
+    }
+
+    m_pimpl->writeError = false;
+    m_pimpl->isWriterRunning = true;
+    m_pimpl->writerThread = std::thread([this] { m_pimpl->runWriter(); });
+
+    return true;
+}
+
+bool ChunkedLogWriter::close()
+{
+    constexpr auto logPrefix = "[ChunkedLogWriter::close]";
+
+    if (!this->isOpen())
+    {
+        log()->error("{} The file is not open.", logPrefix);
+        return false;
+    }
+
+    {
+        std::lock_guard lock(m_pimpl->mutex);
+        m_pimpl->isWriterRunning = false;
+    }
+    m_pimpl->condition.notify_one();
+
+    if (m_pimpl->writerThread.joinable())
+    {
+        m_pimpl->writerThread.join();
+        m_pimpl->writerThread = std::thread();
+    }
+
+    m_pimpl->stream.close();
+
+    return !m_pimpl->writeError;
+}
+
+bool ChunkedLogWriter::isOpen() const
+{
+    return m_pimpl->stream.is_open();
+}
+
+bool ChunkedLogWriter::addChannel(const std::string& name,
+                                  const std::vector<std::string>& elementNames)
+{
+    constexpr auto logPrefix = "[ChunkedLogWriter::addChannel]";
+
+    if (elementNames.empty())
+    {
+        log()->error("{} The channel named {} must contain at least one element.",
+                     logPrefix,
+                     name);
+        return false;
+    }
+
+    if (m_pimpl->addChannel(name, elementNames) == nullptr)
+    {
+        log()->error("{} The channel named {} already exists.", logPrefix, name);
+        return false;
+    }
+
+    return true;
+}
+
+bool ChunkedLogWriter::push(const std::string& name, double time, iDynTree::Span<const double> data)
+{
+    constexpr auto logPrefix = "[ChunkedLogWriter::push]";
+
+    auto it = m_pimpl->channels.find(name);
+    if (it == m_pimpl->channels.end() || data.size() == 0)
+    {
+        log()->error("{} The channel named {} does not exist or the sample is empty.",
+                     logPrefix,
+                     name);
+        return false;
+    }
+
+    // the samples having a different size are stored in a new channel
+    Impl::Channel* channel = it->second.get();
+    const std::size_t size = data.size();
+    while (channel->elementNames.size() != size)
+    {
+        if (channel->resized == nullptr)
+        {
+            const std::string resizedName = name + "_size_" + std::to_string(size);
+            std::vector<std::string> elementNames;
+            for (std::size_t i = 0; i < size; i++)
+            {
+                elementNames.push_back("element_" + std::to_string(i));
+            }
+
+            channel->resized = m_pimpl->addChannel(resizedName, elementNames);
+            if (channel->resized == nullptr)
+            {
+                log()->error("{} The size of the channel named {} changed to {}, but the channel "
+                             "named {} already exists.",
+                             logPrefix,
+                             name,
+                             size,
+                             resizedName);
+                return false;
+            }
+
+            log()->warn("{} The size of the channel named {} changed to {}. The samples will be "
+                        "stored in the channel named {}.",
+                        logPrefix,
+                        name,
+                        size,
+                        resizedName);
+        }
+        channel = channel->resized;
+    }
+
+    // the sample is dropped if all the chunks are waiting to be written
+    const std::size_t chunkSize = m_pimpl->chunkSize;
+    const std::uint64_t pushed = channel->pushedSamples.load(std::memory_order_relaxed);
+    const std::uint64_t written = channel->writtenSamples.load(std::memory_order_acquire);
+    const std::uint64_t chunkIndex = pushed / chunkSize;
+    if (chunkIndex - written / chunkSize >= channel->chunks.size())
+    {
+        m_pimpl->droppedSamples.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    auto& chunk = channel->chunks[chunkIndex % channel->chunks.size()];
+    const std::size_t index = pushed % chunkSize;
+    chunk.time[index] = time;
+    chunk.data.row(index) = Eigen::Map<const Eigen::RowVectorXd>(data.data(), size);
+    channel->pushedSamples.store(pushed + 1, std::memory_order_release);
+
+    return true;
+}
+
+std::size_t ChunkedLogWriter::getDroppedSamples() const
+{
+    return m_pimpl->droppedSamples.load();
+}
+
+bool ChunkedLogReader::open(const std::string& fileName)
+{
+    constexpr auto logPrefix = "[ChunkedLogReader::open]";
+
+    m_channels.clear();
+
+    std::ifstream stream(fileName, std::ios::binary);
+    if (!stream.is_open())
+    {
+        log()->error("{} Unable to open the file named {}.", logPrefix, fileName);
+        return false;
+    }
+
+    char magic[fileMagicSize];
+    if (!stream.read(magic, fileMagicSize) || std::memcmp(magic, fileMagic, fileMagicSize) != 0)
+    {
+        log()->error("{} The file named {} has not been written by ChunkedLogWriter.",
+                     logPrefix,
+                     fileName);
+        return false;
+    }
+
+    // the samples are collected by element and copied in the channels at the end
+    struct ChannelData
+    {
+        std::string name;
+        std::vector<std::vector<double>> elements;
+    };
+    std::unordered_map<std::uint32_t, ChannelData> channelsData;
+
+    std::vector<char> payload;
+    std::vector<double> buffer;
+    std::vector<std::uint8_t> compressed;
+    std::vector<std::uint8_t> shuffled;
+    while (true)
+    {
+        std::uint32_t type;
+        std::uint64_t payloadSize;
+        std::uint32_t hash;
+        if (!stream.read(reinterpret_cast<char*>(&type), sizeof(type))
+            || !stream.read(reinterpret_cast<char*>(&payloadSize), sizeof(payloadSize)))
+        {
+            break;
+        }
+
+        payload.resize(payloadSize);
+        if (!stream.read(payload.data(), payloadSize)
+            || !stream.read(reinterpret_cast<char*>(&hash), sizeof(hash)))
+        {
+            log()->warn("{} The last record of the file named {} is truncated and it will be "
+                        "discarded.",
+                        logPrefix,
+                        fileName);
+            break;
+        }
+
+        std::uint32_t expectedHash = fnvOffsetBasis;
+        hashCombine(payload.data(), payload.size(), expectedHash);
+        if (hash != expectedHash)
+        {
+            log()->warn("{} A corrupted record has been found in the file named {}. The rest of "
+                        "the file will be discarded.",
+                        logPrefix,
+                        fileName);
+            break;
+        }
+
+        PayloadReader reader(payload);
+        std::uint32_t id;
+        std::uint32_t size;
+        if (!reader.read(id) || !reader.read(size))
+        {
+            log()->error("{} Unable to parse a record of the file named {}.", logPrefix, fileName);
+            return false;
+        }
+
+        if (type == ChunkedLogWriter::channelRecord)
+        {
+            std::string name;
+            std::vector<std::string> elementNames(size);
+            bool ok = reader.read(name);
+            for (auto& elementName : elementNames)
+            {
+                ok = ok && reader.read(elementName);
+            }
+            if (!ok)
+            {
+                log()->error("{} Unable to parse the description of a channel in the file named "
+                             "{}.",
+                             logPrefix,
+                             fileName);
+                return false;
+            }
+
+            channelsData[id].name = name;
+            channelsData[id].elements.resize(elementNames.size());
+            m_channels[name].elementNames = std::move(elementNames);
+        } else if (type == ChunkedLogWriter::chunkRecord
+                   || type == ChunkedLogWriter::compressedChunkRecord)
+        {
+            auto it = channelsData.find(id);
+            if (it == channelsData.end())
+            {
+                log()->error("{} A chunk refers to an unknown channel in the file named {}.",
+                             logPrefix,
+                             fileName);
+                return false;
+            }
+
+            // in a chunk record the second integer is the number of samples
+            const std::size_t numberOfSamples = size;
+            const bool isCompressed = type == ChunkedLogWriter::compressedChunkRecord;
+            auto& elements = it->second.elements;
+            auto& channel = m_channels[it->second.name];
+
+            // the size in bytes of the timestamps and of each element
+            std::vector<std::uint32_t> columnsSize(elements.size() + 1,
+                                                   numberOfSamples * sizeof(double));
+            bool ok = true;
+            if (isCompressed)
+            {
+                for (auto& columnSize : columnsSize)
+                {
+                    ok = ok && reader.read(columnSize);
+                }
+            }
+
+            auto readColumn = [&](std::uint32_t columnSize, std::vector<double>& column) -> bool {
+                buffer.resize(numberOfSamples);
+                if (isCompressed)
+                {
+                    compressed.resize(columnSize);
+                    if (!reader.read(compressed.data(), columnSize)
+                        || !decompressColumn(compressed.data(),
+                                             columnSize,
+                                             numberOfSamples,
+                                             shuffled,
+                                             buffer.data()))
+                    {
+                        return false;
+                    }
+                } else if (!reader.read(buffer.data(), columnSize))
+                {
+                    return false;
+                }
+                column.insert(column.end(), buffer.begin(), buffer.end());
+                return true;
+            };
+
+            ok = ok && readColumn(columnsSize[0], channel.time);
+            for (std::size_t i = 0; i < elements.size(); i++)
+            {
+                ok = ok && readColumn(columnsSize[i + 1], elements[i]);
+            }
+
+            if (!ok)
+            {
+                log()->error("{} Unable to parse a chunk in the file named {}.",
+                             logPrefix,
+                             fileName);
+                return false;
+            }
+        }
+        // unknown records are skipped to be forward compatible
+    }
+
+    for (const auto& [id, data] : channelsData)
+    {
+        auto& channel = m_channels[data.name];
+        channel.data.resize(data.elements.size(), channel.time.size());
+        for (std::size_t i = 0; i < data.elements.size(); i++)
+        {
+            channel.data.row(i)
+                = Eigen::Map<const Eigen::RowVectorXd>(data.elements[i].data(),
+                                                       data.elements[i].size());
+        }
+    }
+
+    return true;
+}
+
+const std::unordered_map<std::string, ChunkedLogReader::Channel>&
+ChunkedLogReader::getChannels() const
+{
+    return m_channels;
+}
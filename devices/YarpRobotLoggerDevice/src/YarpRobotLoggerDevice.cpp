@@ -3,6 +3,7 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdio>
@@ -14,6 +15,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <system_error>
 #include <tuple>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
@@ -93,6 +95,28 @@ void YarpRobotLoggerDevice::VectorsCollectionSignal::disconnect()
     }
 }
 
+void YarpRobotLoggerDevice::VectorsCollectionSignal::resolveChannels(const std::string& treeDelim)
+{
+    channels.clear();
+
+    // the layout is available only if the data is packed or written in shared memory
+    if (!client.isPacked() && !client.isSharedMemory())
+    {
+        return;
+    }
+
+    const auto& entries = client.getLayout().getEntries();
+    for (std::size_t handle = 0; handle < entries.size(); handle++)
+    {
+        Channel channel;
+        channel.key = entries[handle].key;
+        channel.name = signalName + treeDelim + entries[handle].key;
+        channel.handle = handle;
+        channel.buffer.resize(entries[handle].size);
+        channels.push_back(std::move(channel));
+    }
+}
+
 YarpRobotLoggerDevice::YarpRobotLoggerDevice(double period,
                                              yarp::os::ShouldUseSystemClock useSystemClock)
     : yarp::os::PeriodicThread(period, useSystemClock)
@@ -319,7 +343,7 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
                     {
                         log()->warn("{} The depth stream of the rgbd camera {} will be saved as a "
                                     "grayscale 8bit video. We suggest to save it as a set of "
-                                    "frames.",
+                                    "frames, that are stored as lossless 16bit png images.",
                                     logPrefix,
                                     i);
                     }
@@ -327,7 +351,19 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
                     ok = ok && m_videoWriters[cameraNames[i]].rgb != nullptr;
                     m_videoWriters[cameraNames[i]].depth = createImageSaver(depthSaveMode[i]);
                     ok = ok && m_videoWriters[cameraNames[i]].depth != nullptr;
-                    m_videoWriters[cameraNames[i]].depthScale = depthScale[i];
+                    if (ok)
+                    {
+                        m_videoWriters[cameraNames[i]].depth->channelName
+                            = "camera::" + cameraNames[i] + "::depth";
+                        m_videoWriters[cameraNames[i]].depth->isDepth = true;
+                        m_videoWriters[cameraNames[i]].depth->scale = depthScale[i];
+                    }
+                }
+
+                if (ok)
+                {
+                    m_videoWriters[cameraNames[i]].rgb->channelName
+                        = "camera::" + cameraNames[i] + "::rgb";
                 }
             }
 
@@ -378,6 +414,30 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
                              fourccCodecUrl);
                 return false;
             }
+
+            if (!params->getParameter("video_encoding_threads", m_videoEncodingThreadsNumber))
+            {
+                log()->info("{} The parameter 'video_encoding_threads' is not provided. The "
+                            "default one will be used {}.",
+                            logPrefix,
+                            m_videoEncodingThreadsNumber);
+            }
+
+            if (!params->getParameter("video_frames_pool_size", m_videoFramesPoolSize))
+            {
+                log()->info("{} The parameter 'video_frames_pool_size' is not provided. The "
+                            "default one will be used {}.",
+                            logPrefix,
+                            m_videoFramesPoolSize);
+            }
+
+            if (m_videoEncodingThreadsNumber <= 0 || m_videoFramesPoolSize <= 0)
+            {
+                log()->error("{} The parameters 'video_encoding_threads' and "
+                             "'video_frames_pool_size' must be strictly positive.",
+                             logPrefix);
+                return false;
+            }
         }
     } else
     {
@@ -394,9 +454,133 @@ bool YarpRobotLoggerDevice::open(yarp::os::Searchable& config)
         return false;
     }
 
+    if (!this->setupSamplingPolicies(params->getGroup("SamplingPolicies")))
+    {
+        return false;
+    }
+
     return true;
 }
 
+bool YarpRobotLoggerDevice::setupSamplingPolicies(
+    std::weak_ptr<const ParametersHandler::IParametersHandler> params)
+{
+    constexpr auto logPrefix = "[YarpRobotLoggerDevice::setupSamplingPolicies]";
+
+    auto ptr = params.lock();
+    if (ptr == nullptr)
+    {
+        log()->info("{} All the samples of the sensors will be stored.", logPrefix);
+        return true;
+    }
+
+    std::vector<std::string> policies;
+    if (!ptr->getParameter("policies", policies))
+    {
+        log()->error("{} Unable to get the list of the sampling policies.", logPrefix);
+        return false;
+    }
+
+    for (const auto& policyName : policies)
+    {
+        auto group = ptr->getGroup(policyName).lock();
+        if (group == nullptr)
+        {
+            log()->error("{} Unable to get the group named {}.", logPrefix, policyName);
+            return false;
+        }
+
+        std::vector<std::string> channels;
+        if (!group->getParameter("channels", channels))
+        {
+            log()->error("{} Unable to get the channels parameter for the group named {}.",
+                         logPrefix,
+                         policyName);
+            return false;
+        }
+
+        std::string type;
+        if (!group->getParameter("type", type))
+        {
+            log()->error("{} Unable to get the type parameter for the group named {}.",
+                         logPrefix,
+                         policyName);
+            return false;
+        }
+
+        SamplingPolicy policy;
+        if (type == "decimation")
+        {
+            int decimation{0};
+            if (!group->getParameter("decimation", decimation) || decimation <= 0)
+            {
+                log()->error("{} The parameter 'decimation' of the group named {} is required "
+                             "and it must be strictly positive.",
+                             logPrefix,
+                             policyName);
+                return false;
+            }
+            policy.type = SamplingPolicy::Type::Decimation;
+            policy.decimation = static_cast<unsigned int>(decimation);
+        } else if (type == "on_change")
+        {
+            policy.type = SamplingPolicy::Type::OnChange;
+        } else if (type == "deadband")
+        {
+            if (!group->getParameter("deadband", policy.deadband) || policy.deadband < 0)
+            {
+                log()->error("{} The parameter 'deadband' of the group named {} is required and "
+                             "it must be non negative.",
+                             logPrefix,
+                             policyName);
+                return false;
+            }
+            policy.type = SamplingPolicy::Type::Deadband;
+        } else
+        {
+            log()->error("{} The type '{}' of the group named {} is not valid. The supported "
+                         "types are 'decimation', 'on_change' and 'deadband'.",
+                         logPrefix,
+                         type,
+                         policyName);
+            return false;
+        }
+
+        for (const auto& channel : channels)
+        {
+            m_samplingPolicies.emplace_back(channel, policy);
+        }
+    }
+
+    return true;
+}
+
+bool YarpRobotLoggerDevice::SamplingPolicy::shouldStore(Eigen::Ref<const Eigen::VectorXd> sample)
+{
+    if (type == Type::Always)
+    {
+        return true;
+    }
+
+    if (type == Type::Decimation)
+    {
+        const bool store = counter == 0;
+        counter = (counter + 1) % decimation;
+        return store;
+    }
+
+    // the first sample is always stored. Since a comparison with NaN is always false, a sample
+    // containing NaN is always considered different from the last stored one
+    const bool isChanged = !hasStoredSample || sample.hasNaN()
+                           || ((sample - lastStoredSample).array().abs() > deadband).any();
+    if (isChanged)
+    {
+        lastStoredSample = sample;
+        hasStoredSample = true;
+    }
+    return isChanged;
+}
+
 bool YarpRobotLoggerDevice::setupExogenousInputs(
     std::weak_ptr<const ParametersHandler::IParametersHandler> params)
 {
@@ -529,6 +713,45 @@ bool YarpRobotLoggerDevice::setupTelemetry(
     config.n_samples = static_cast<int>(std::ceil((1 + percentage) //
                                                   * (config.save_period / devicePeriod)));
 
+    int queueSize = static_cast<int>(m_sensorRecordsQueueSize);
+    if (!ptr->getParameter("queue_size", queueSize))
+    {
+        log()->info("{} Unable to get the 'queue_size' parameter for the telemetry. The default "
+                    "value {} will be used.",
+                    logPrefix,
+                    queueSize);
+    }
+    if (queueSize <= 0)
+    {
+        log()->error("{} The 'queue_size' parameter must be strictly positive.", logPrefix);
+        return false;
+    }
+    m_sensorRecordsQueueSize = queueSize;
+
+    if (!ptr->getParameter("streaming", m_streamTelemetry))
+    {
+        log()->info("{} Unable to get the 'streaming' parameter for the telemetry. The signals "
+                    "will be stored in memory and saved periodically.",
+                    logPrefix);
+    }
+
+    if (m_streamTelemetry)
+    {
+        // the numeric signals are written in chunks while they are collected, only the text
+        // logs and the timestamps of the cameras are kept in the buffer manager
+        if (!m_streamingWriter.initialize(ptr))
+        {
+            log()->error("{} Unable to initialize the streaming writer.", logPrefix);
+            return false;
+        }
+
+        if (!m_streamingWriter.open(m_streamingFileName))
+        {
+            log()->error("{} Unable to open the file {}.", logPrefix, m_streamingFileName);
+            return false;
+        }
+    }
+
     return m_bufferManager.configure(config);
 }
 
@@ -650,7 +873,26 @@ bool YarpRobotLoggerDevice::addChannel(const std::string& nameKey,
                                        std::size_t vectorSize,
                                        const std::vector<std::string>& metadataNames)
 {
-    if (metadataNames.empty() || vectorSize != metadataNames.size())
+    if (m_streamTelemetry)
+    {
+        std::vector<std::string> elementNames = metadataNames;
+        if (metadataNames.empty() || vectorSize != metadataNames.size())
+        {
+            log()->warn("The metadata names are empty or the size of the metadata names is "
+                        "different from the vector size. The default metadata will be used.");
+            elementNames.clear();
+            for (std::size_t i = 0; i < vectorSize; i++)
+            {
+                elementNames.push_back("element_" + std::to_string(i));
+            }
+        }
+
+        if (!m_streamingWriter.addChannel(nameKey, elementNames))
+        {
+            log()->error("Failed to add the channel in the streaming writer named: {}", nameKey);
+            return false;
+        }
+    } else if (metadataNames.empty() || vectorSize != metadataNames.size())
     {
         log()->warn("The metadata names are empty or the size of the metadata names is different "
                     "from the vector size. The default metadata will be used.");
@@ -700,6 +942,50 @@ bool YarpRobotLoggerDevice::addChannel(const std::string& nameKey,
     return true;
 }
 
+bool YarpRobotLoggerDevice::addSensorChannels(
+    const std::vector<std::pair<std::string, std::vector<std::string>>>& channels,
+    std::function<bool(Eigen::Ref<Eigen::VectorXd>)> reader)
+{
+    SensorReader sensorReader;
+    sensorReader.firstChannel = m_sensorChannels.size();
+    sensorReader.numberOfChannels = channels.size();
+    sensorReader.offset = m_sensorRecordSize;
+    sensorReader.read = std::move(reader);
+
+    for (const auto& [name, metadata] : channels)
+    {
+        if (!addChannel(name, metadata.size(), metadata))
+        {
+            return false;
+        }
+
+        SensorChannel channel;
+        channel.name = name;
+        channel.rtName = robotRtRootName + treeDelim + name;
+        channel.offset = m_sensorRecordSize;
+        channel.size = metadata.size();
+        channel.buffer.setZero(channel.size);
+
+        // the policy associated to the longest prefix of the channel name is used
+        std::size_t prefixLength = 0;
+        for (const auto& [prefix, policy] : m_samplingPolicies)
+        {
+            if (name.compare(0, prefix.size(), prefix) == 0 && prefix.size() >= prefixLength)
+            {
+                prefixLength = prefix.size();
+                channel.samplingPolicy = policy;
+                channel.samplingPolicy.lastStoredSample.setZero(channel.size);
+            }
+        }
+        m_sensorRecordSize += channel.size;
+        m_sensorChannels.push_back(std::move(channel));
+    }
+
+    sensorReader.size = m_sensorRecordSize - sensorReader.offset;
+    m_sensorReaders.push_back(std::move(sensorReader));
+    return true;
+}
+
 bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
 {
     constexpr auto logPrefix = "[YarpRobotLoggerDevice::attachAll]";
@@ -741,7 +1027,6 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
         return false;
     }
 
-    const unsigned dofs = joints.size();
     m_bufferManager.setDescriptionList(joints);
     if (m_sendDataRT)
     {
@@ -756,41 +1041,97 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
         m_vectorCollectionRTDataServer.populateMetadata(rtMetadataName, joints);
     }
 
-    // prepare the telemetry
+    // prepare the telemetry. Each reader fills a segment of the record produced by the run
+    // method, the record is then logged by the telemetry thread
+    auto jointChannel = [&joints](const std::string& name) {
+        return std::vector<std::pair<std::string, std::vector<std::string>>>{{name, joints}};
+    };
+    auto sensorChannel = [this](const std::string& prefix,
+                                const std::string& sensorName,
+                                const std::vector<std::string>& elementNames) {
+        return std::vector<std::pair<std::string, std::vector<std::string>>>{
+            {prefix + treeDelim + sensorName, elementNames}};
+    };
+
     if (m_streamJointStates)
     {
-        ok = ok && addChannel(jointStatePositionsName, joints.size(), joints);
-        ok = ok && addChannel(jointStateVelocitiesName, joints.size(), joints);
+        ok = ok
+             && addSensorChannels(jointChannel(jointStatePositionsName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getJointPositions(data);
+                                  });
+        ok = ok
+             && addSensorChannels(jointChannel(jointStateVelocitiesName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getJointVelocities(data);
+                                  });
         if (m_streamJointAccelerations)
         {
-            ok = ok && addChannel(jointStateAccelerationsName, joints.size(), joints);
+            ok = ok
+                 && addSensorChannels(jointChannel(jointStateAccelerationsName),
+                                      [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge->getJointAccelerations(data);
+                                      });
         }
-        ok = ok && addChannel(jointStateTorquesName, joints.size(), joints);
+        ok = ok
+             && addSensorChannels(jointChannel(jointStateTorquesName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getJointTorques(data);
+                                  });
     }
     if (m_streamMotorStates)
     {
-        ok = ok && addChannel(motorStatePositionsName, joints.size(), joints);
-        ok = ok && addChannel(motorStateVelocitiesName, joints.size(), joints);
-        ok = ok && addChannel(motorStateAccelerationsName, joints.size(), joints);
-        ok = ok && addChannel(motorStateCurrentsName, joints.size(), joints);
+        ok = ok
+             && addSensorChannels(jointChannel(motorStatePositionsName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getMotorPositions(data);
+                                  });
+        ok = ok
+             && addSensorChannels(jointChannel(motorStateVelocitiesName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getMotorVelocities(data);
+                                  });
+        ok = ok
+             && addSensorChannels(jointChannel(motorStateAccelerationsName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getMotorAccelerations(data);
+                                  });
+        ok = ok
+             && addSensorChannels(jointChannel(motorStateCurrentsName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getMotorCurrents(data);
+                                  });
     }
 
     if (m_streamMotorPWM)
     {
-        ok = ok && addChannel(motorStatePwmName, joints.size(), joints);
+        ok = ok
+             && addSensorChannels(jointChannel(motorStatePwmName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getMotorPWMs(data);
+                                  });
     }
 
     if (m_streamPIDs)
     {
-        ok = ok && addChannel(motorStatePidsName, joints.size(), joints);
+        ok = ok
+             && addSensorChannels(jointChannel(motorStatePidsName),
+                                  [this](Eigen::Ref<Eigen::VectorXd> data) {
+                                      return m_robotSensorBridge->getPidPositions(data);
+                                  });
     }
 
     if (m_streamFTSensors)
     {
         for (const auto& sensorName : m_robotSensorBridge->getSixAxisForceTorqueSensorsList())
         {
-            std::string fullFTSensorName = ftsName + treeDelim + sensorName;
-            ok = ok && addChannel(fullFTSensorName, ftElementNames.size(), ftElementNames);
+            ok = ok
+                 && addSensorChannels(sensorChannel(ftsName, sensorName, ftElementNames),
+                                      [this, sensorName](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge
+                                              ->getSixAxisForceTorqueMeasurement(sensorName,
+                                                                                 data.head<6>());
+                                      });
         }
     }
 
@@ -798,52 +1139,77 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
     {
         for (const auto& sensorName : m_robotSensorBridge->getGyroscopesList())
         {
-            std::string fullGyroSensorName = gyrosName + treeDelim + sensorName;
-            ok = ok && addChannel(fullGyroSensorName, gyroElementNames.size(), gyroElementNames);
+            ok = ok
+                 && addSensorChannels(sensorChannel(gyrosName, sensorName, gyroElementNames),
+                                      [this, sensorName](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge
+                                              ->getGyroscopeMeasure(sensorName, data.head<3>());
+                                      });
         }
 
         for (const auto& sensorName : m_robotSensorBridge->getLinearAccelerometersList())
         {
-            std::string fullAccelerometerSensorName = accelerometersName + treeDelim + sensorName;
             ok = ok
-                 && addChannel(fullAccelerometerSensorName,
-                               accelerometerElementNames.size(), //
-                               accelerometerElementNames);
+                 && addSensorChannels(sensorChannel(accelerometersName,
+                                                    sensorName,
+                                                    accelerometerElementNames),
+                                      [this, sensorName](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge
+                                              ->getLinearAccelerometerMeasurement(sensorName,
+                                                                                  data.head<3>());
+                                      });
         }
 
         for (const auto& sensorName : m_robotSensorBridge->getOrientationSensorsList())
         {
-            std::string fullOrientationsSensorName = orientationsName + treeDelim + sensorName;
             ok = ok
-                 && addChannel(fullOrientationsSensorName,
-                               orientationElementNames.size(), //
-                               orientationElementNames);
+                 && addSensorChannels(sensorChannel(orientationsName,
+                                                    sensorName,
+                                                    orientationElementNames),
+                                      [this, sensorName](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge
+                                              ->getOrientationSensorMeasurement(sensorName,
+                                                                                data.head<3>());
+                                      });
         }
 
         for (const auto& sensorName : m_robotSensorBridge->getMagnetometersList())
         {
-            std::string fullMagnetometersSensorName = magnetometersName + treeDelim + sensorName;
             ok = ok
-                 && addChannel(fullMagnetometersSensorName,
-                               magnetometerElementNames.size(), //
-                               magnetometerElementNames);
-        }
-
-        // an IMU contains a gyro accelerometer and an orientation sensor
+                 && addSensorChannels(sensorChannel(magnetometersName,
+                                                    sensorName,
+                                                    magnetometerElementNames),
+                                      [this, sensorName](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge
+                                              ->getMagnetometerMeasurement(sensorName,
+                                                                           data.head<3>());
+                                      });
+        }
+
+        // an IMU contains a gyro accelerometer and an orientation sensor. The three channels
+        // are filled by a single reader
         for (const auto& sensorName : m_robotSensorBridge->getIMUsList())
         {
-            std::string fullAccelerometerSensorName = accelerometersName + treeDelim + sensorName;
-            std::string fullGyroSensorName = gyrosName + treeDelim + sensorName;
-            std::string fullOrientationsSensorName = orientationsName + treeDelim + sensorName;
-            ok = ok
-                 && addChannel(fullAccelerometerSensorName,
-                               accelerometerElementNames.size(), //
-                               accelerometerElementNames);
-            ok = ok && addChannel(fullGyroSensorName, gyroElementNames.size(), gyroElementNames);
             ok = ok
-                 && addChannel(fullOrientationsSensorName,
-                               orientationElementNames.size(), //
-                               orientationElementNames);
+                 && addSensorChannels(
+                     {{accelerometersName + treeDelim + sensorName, accelerometerElementNames},
+                      {gyrosName + treeDelim + sensorName, gyroElementNames},
+                      {orientationsName + treeDelim + sensorName, orientationElementNames}},
+                     [this, sensorName](Eigen::Ref<Eigen::VectorXd> data) {
+                         if (!m_robotSensorBridge->getIMUMeasurement(sensorName,
+                                                                     m_analogSensorBuffer))
+                         {
+                             return false;
+                         }
+
+                         // it will return a tuple containing the Accelerometer, the gyro and
+                         // the orientation
+                         this->unpackIMU(m_analogSensorBuffer,
+                                         data.segment<3>(0),
+                                         data.segment<3>(3),
+                                         data.segment<3>(6));
+                         return true;
+                     });
         }
     }
 
@@ -851,12 +1217,16 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
     {
         for (const auto& cartesianWrenchName : m_robotSensorBridge->getCartesianWrenchesList())
         {
-            std::string fullCartesianWrenchName
-                = cartesianWrenchesName + treeDelim + cartesianWrenchName;
             ok = ok
-                 && addChannel(fullCartesianWrenchName,
-                               cartesianWrenchNames.size(), //
-                               cartesianWrenchNames);
+                 && addSensorChannels(sensorChannel(cartesianWrenchesName,
+                                                    cartesianWrenchName,
+                                                    cartesianWrenchNames),
+                                      [this,
+                                       cartesianWrenchName](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge
+                                              ->getCartesianWrench(cartesianWrenchName,
+                                                                   data.head<6>());
+                                      });
         }
     }
 
@@ -864,11 +1234,12 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
     {
         for (const auto& sensorName : m_robotSensorBridge->getTemperatureSensorsList())
         {
-            std::string fullTemperatureSensorName = temperatureName + treeDelim + sensorName;
             ok = ok
-                 && addChannel(fullTemperatureSensorName,
-                               temperatureNames.size(), //
-                               temperatureNames);
+                 && addSensorChannels(sensorChannel(temperatureName, sensorName, temperatureNames),
+                                      [this, sensorName](Eigen::Ref<Eigen::VectorXd> data) {
+                                          return m_robotSensorBridge->getTemperature(sensorName,
+                                                                                     data(0));
+                                      });
         }
     }
 
@@ -929,8 +1300,15 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
         m_vectorCollectionRTDataServer.finalizeMetadata();
     }
 
-    // resize the temporary vectors
-    m_jointSensorBuffer.resize(dofs);
+    // allocate the records exchanged between the run method and the telemetry thread
+    SensorRecord recordPrototype;
+    recordPrototype.data.setZero(m_sensorRecordSize);
+    recordPrototype.isValid.assign(m_sensorChannels.size(), 0);
+    if (!m_sensorRecords.initialize(m_sensorRecordsQueueSize, recordPrototype))
+    {
+        log()->error("{} Unable to allocate the queue of the sensor records.", logPrefix);
+        return false;
+    }
 
     // The user can avoid to record the camera
     if (m_cameraBridge != nullptr)
@@ -1031,8 +1409,39 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
                                                 {"timestamp"}});
         }
 
+        // the latency between the capture and the encoding of the frames and the number of
+        // frames dropped since the encoding threads were not able to keep up with the cameras
+        for (auto& [camera, writer] : m_videoWriters)
+        {
+            for (const auto& imageSaver : {writer.rgb, writer.depth})
+            {
+                if (imageSaver == nullptr)
+                {
+                    continue;
+                }
+
+                ok = ok
+                     && m_bufferManager.addChannel({imageSaver->channelName + "_encoding_latency",
+                                                    {1, 1}, //
+                                                    {"latency"}});
+                ok = ok
+                     && m_bufferManager.addChannel({imageSaver->channelName + "_dropped_frames",
+                                                    {1, 1}, //
+                                                    {"dropped_frames"}});
+
+                imageSaver->freeFrames.resize(m_videoFramesPoolSize);
+            }
+        }
+
         if (ok)
         {
+            // start the pool of threads encoding the frames
+            m_videoEncodingIsRunning = true;
+            for (int i = 0; i < m_videoEncodingThreadsNumber; i++)
+            {
+                m_videoEncodingThreads.emplace_back([this] { this->encodeFrames(); });
+            }
+
             // using C++17 it is not possible to use a structured binding in the for loop, i.e. for
             // (auto& [key, val] : m_videoWriters) since Lambda implicit capture fails with variable
             // declared from structured binding.
@@ -1061,6 +1470,10 @@ bool YarpRobotLoggerDevice::attachAll(const yarp::dev::PolyDriverList& poly)
 
     if (ok)
     {
+        // run the thread that moves the records from the queue to the telemetry
+        m_telemetryThreadIsRunning = true;
+        m_telemetryThread = std::thread([this] { this->processTelemetry(); });
+
         return start();
     }
 
@@ -1127,8 +1540,8 @@ bool YarpRobotLoggerDevice::createFramesFolder(std::shared_ptr<VideoWriter::Imag
         return false;
     }
 
-    imageSaver->framesPath = "output_" + camera + "_" + imageType;
     std::lock_guard guard(imageSaver->mutex);
+    imageSaver->framesPath = "output_" + camera + "_" + imageType;
     std::filesystem::create_directory(imageSaver->framesPath);
     return true;
 }
@@ -1199,6 +1612,9 @@ void YarpRobotLoggerDevice::lookForExogenousSignals()
                                     "the metadata for the signal named: {}. The exogenous signal will "
                                     "not contain the metadata.",
                                     name);
+                    } else
+                    {
+                        signal.resolveChannels(treeDelim);
                     }
                 }
             }
@@ -1327,7 +1743,8 @@ void YarpRobotLoggerDevice::recordVideo(const std::string& cameraName, VideoWrit
         }
         wakeUpTime += recordVideoPeriod;
 
-        // get the frame from the camera
+        // get the frame from the camera. The frames are copied in the pool of the image savers
+        // and encoded by the encoding threads
         if (writer.rgb != nullptr)
         {
             if (!m_cameraBridge->getColorImage(cameraName, writer.rgb->frame))
@@ -1339,28 +1756,7 @@ void YarpRobotLoggerDevice::recordVideo(const std::string& cameraName, VideoWrit
                             cameraName);
             }
 
-            // save the frame in the video writer
-            if (writer.rgb->saveMode == VideoWriter::SaveMode::Video)
-            {
-                std::lock_guard<std::mutex> lock(writer.rgb->mutex);
-                writer.rgb->writer->write(writer.rgb->frame);
-            } else
-            {
-                assert(writer.rgb->saveMode == VideoWriter::SaveMode::Frame);
-
-                const std::filesystem::path imgPath
-                    = writer.rgb->framesPath / ("img_" + std::to_string(imageIndex) + ".png");
-
-                cv::imwrite(imgPath.string(), writer.rgb->frame);
-
-                // lock the the buffered manager mutex
-                std::lock_guard lock(m_bufferManagerMutex);
-
-                // TODO here we may save the frame itself
-                m_bufferManager.push_back(std::chrono::duration<double>(time).count(),
-                                          std::chrono::duration<double>(time).count(),
-                                          "camera::" + cameraName + "::rgb");
-            }
+            this->enqueueFrame(writer.rgb, time, imageIndex);
         }
 
         if (writer.depth != nullptr)
@@ -1372,42 +1768,10 @@ void YarpRobotLoggerDevice::recordVideo(const std::string& cameraName, VideoWrit
                             "will be used.",
                             logPrefix,
                             cameraName);
-
-            } else
-            {
-                // If a new frame arrived the we should scale it
-                writer.depth->frame = writer.depth->frame * writer.depthScale;
             }
 
-            if (writer.depth->saveMode == VideoWriter::SaveMode::Video)
-            {
-                // we need to convert the image to 8bit this is required by the video writer
-                cv::Mat image8Bit;
-                writer.depth->frame.convertTo(image8Bit, CV_8UC1);
-
-                // save the frame in the video writer
-                std::lock_guard<std::mutex> lock(writer.depth->mutex);
-                writer.depth->writer->write(image8Bit);
-            } else
-            {
-                assert(writer.depth->saveMode == VideoWriter::SaveMode::Frame);
-
-                const std::filesystem::path imgPath
-                    = writer.depth->framesPath / ("img_" + std::to_string(imageIndex) + ".png");
-
-                // convert the image into 16bit grayscale image
-                cv::Mat image16Bit;
-                writer.depth->frame.convertTo(image16Bit, CV_16UC1);
-                cv::imwrite(imgPath.string(), image16Bit);
-
-                // lock the the buffered manager mutex
-                std::lock_guard lock(m_bufferManagerMutex);
-
-                // TODO here we may save the frame itself
-                m_bufferManager.push_back(std::chrono::duration<double>(time).count(),
-                                          std::chrono::duration<double>(time).count(),
-                                          "camera::" + cameraName + "::depth");
-            }
+            // the depth is scaled by the encoding threads
+            this->enqueueFrame(writer.depth, time, imageIndex);
         }
 
         // increase the index
@@ -1429,215 +1793,286 @@ void YarpRobotLoggerDevice::recordVideo(const std::string& cameraName, VideoWrit
     }
 }
 
-void YarpRobotLoggerDevice::run()
+void YarpRobotLoggerDevice::enqueueFrame(
+    const std::shared_ptr<VideoWriter::ImageSaver>& imageSaver,
+    std::chrono::nanoseconds captureTime,
+    unsigned int index)
 {
-    auto logData = [this](const std::string& name, const auto& data, const double time) {
-        m_bufferManager.push_back(data, time, name);
-        std::string rtName = robotRtRootName + treeDelim + name;
-        if (m_sendDataRT)
-        {
-            m_vectorCollectionRTDataServer.populateData(rtName, data);
-        }
-    };
-
-    constexpr auto logPrefix = "[YarpRobotLoggerDevice::run]";
-    const std::chrono::nanoseconds t = BipedalLocomotion::clock().now();
+    // no frame has been received yet
+    if (imageSaver->frame.empty())
+    {
+        return;
+    }
 
-    if (!m_firstRun)
+    VideoWriter::Frame frame;
     {
-        if (t - m_previousTimestamp > m_acceptableStep)
+        std::lock_guard lock(m_videoEncodingMutex);
+        if (imageSaver->freeFrames.empty())
         {
-            log()->warn("{} The time step is too big. The previous timestamp is {} and the current "
-                        "timestamp is {}. The time step is {}.",
-                        logPrefix,
-                        std::chrono::duration<double>(m_previousTimestamp),
-                        std::chrono::duration<double>(t),
-                        std::chrono::duration<double>(t - m_previousTimestamp));
+            // the encoding threads are not able to keep up with the camera
+            imageSaver->droppedFrames++;
             return;
         }
+        frame = std::move(imageSaver->freeFrames.back());
+        imageSaver->freeFrames.pop_back();
     }
 
-    const double time = std::chrono::duration<double>(t).count();
-    std::string signalFullName = "";
-    std::string rtSignalFullName = "";
+    // the memory of the pooled frame is reused if the size of the image does not change
+    imageSaver->frame.copyTo(frame.image);
+    frame.captureTime = captureTime;
+    frame.index = index;
 
-    std::lock_guard lock(m_bufferManagerMutex);
-    if (m_sendDataRT)
-    {
-        m_vectorCollectionRTDataServer.prepareData();
-        m_vectorCollectionRTDataServer.clearData();
-        Eigen::Matrix<double, 1, 1> timeData;
-        timeData << time;
-        rtSignalFullName = robotRtRootName + treeDelim + timestampsName;
-        m_vectorCollectionRTDataServer.populateData(rtSignalFullName, timeData);
-    }
+    std::lock_guard lock(m_videoEncodingMutex);
+    imageSaver->pendingFrames.push_back(std::move(frame));
 
-    // get the data
-    if (!m_robotSensorBridge->advance())
+    // the frames of an image saver are encoded by a single thread at a time to keep their order
+    if (!imageSaver->isScheduled)
     {
-        log()->error("{} Could not advance sensor bridge.", logPrefix);
+        imageSaver->isScheduled = true;
+        m_videoEncodingQueue.push_back(imageSaver);
+        m_videoEncodingCondition.notify_one();
     }
+}
 
-    if (m_streamJointStates)
+void YarpRobotLoggerDevice::encodeFrames()
+{
+    std::unique_lock lock(m_videoEncodingMutex);
+    while (true)
     {
-        if (m_robotSensorBridge->getJointPositions(m_jointSensorBuffer))
-        {
-            logData(jointStatePositionsName, m_jointSensorBuffer, time);
-        }
-        if (m_robotSensorBridge->getJointVelocities(m_jointSensorBuffer))
+        m_videoEncodingCondition.wait(lock, [this] {
+            return !m_videoEncodingQueue.empty() || !m_videoEncodingIsRunning;
+        });
+
+        // the pending frames are encoded before closing the thread
+        if (m_videoEncodingQueue.empty())
         {
-            logData(jointStateVelocitiesName, m_jointSensorBuffer, time);
+            break;
         }
-        if (m_streamJointAccelerations)
+
+        std::shared_ptr<VideoWriter::ImageSaver> imageSaver
+            = std::move(m_videoEncodingQueue.front());
+        m_videoEncodingQueue.pop_front();
+        VideoWriter::Frame frame = std::move(imageSaver->pendingFrames.front());
+        imageSaver->pendingFrames.pop_front();
+        const std::size_t droppedFrames = imageSaver->droppedFrames;
+
+        lock.unlock();
+        this->encodeFrame(*imageSaver, frame, droppedFrames);
+        lock.lock();
+
+        imageSaver->freeFrames.push_back(std::move(frame));
+        if (imageSaver->pendingFrames.empty())
         {
-            if (m_robotSensorBridge->getJointAccelerations(m_jointSensorBuffer))
-            {
-                logData(jointStateAccelerationsName, m_jointSensorBuffer, time);
-            }
-        }
-        if (m_robotSensorBridge->getJointTorques(m_jointSensorBuffer))
+            imageSaver->isScheduled = false;
+        } else
         {
-            logData(jointStateTorquesName, m_jointSensorBuffer, time);
+            m_videoEncodingQueue.push_back(std::move(imageSaver));
         }
     }
+}
 
-    if (m_streamMotorStates)
+void YarpRobotLoggerDevice::encodeFrame(VideoWriter::ImageSaver& imageSaver,
+                                        const VideoWriter::Frame& frame,
+                                        std::size_t droppedFrames)
+{
+    const cv::Mat* image = &frame.image;
+
+    if (imageSaver.saveMode == VideoWriter::SaveMode::Video)
     {
-        if (m_robotSensorBridge->getMotorPositions(m_jointSensorBuffer))
+        if (imageSaver.isDepth)
         {
-            logData(motorStatePositionsName, m_jointSensorBuffer, time);
+            // we need to convert the image to 8bit this is required by the video writer
+            frame.image.convertTo(imageSaver.encodedImage, CV_8UC1, imageSaver.scale);
+            image = &imageSaver.encodedImage;
         }
-        if (m_robotSensorBridge->getMotorVelocities(m_jointSensorBuffer))
-        {
-            logData(motorStateVelocitiesName, m_jointSensorBuffer, time);
-        }
-        if (m_robotSensorBridge->getMotorAccelerations(m_jointSensorBuffer))
+
+        // save the frame in the video writer
+        std::lock_guard<std::mutex> lock(imageSaver.mutex);
+        imageSaver.writer->write(*image);
+    } else
+    {
+        assert(imageSaver.saveMode == VideoWriter::SaveMode::Frame);
+
+        if (imageSaver.isDepth)
         {
-            logData(motorStateAccelerationsName, m_jointSensorBuffer, time);
+            // the depth is saved as a 16bit grayscale image. Since png is a lossless format no
+            // information is lost after the scaling
+            frame.image.convertTo(imageSaver.encodedImage, CV_16UC1, imageSaver.scale);
+            image = &imageSaver.encodedImage;
         }
-        if (m_robotSensorBridge->getMotorCurrents(m_jointSensorBuffer))
+
+        std::filesystem::path imgPath;
         {
-            logData(motorStateCurrentsName, m_jointSensorBuffer, time);
+            std::lock_guard<std::mutex> lock(imageSaver.mutex);
+            imgPath = imageSaver.framesPath / ("img_" + std::to_string(frame.index) + ".png");
         }
+        cv::imwrite(imgPath.string(), *image);
     }
 
-    if (m_streamMotorPWM)
+    const double captureTime = std::chrono::duration<double>(frame.captureTime).count();
+    const double latency
+        = std::chrono::duration<double>(BipedalLocomotion::clock().now() - frame.captureTime)
+              .count();
+
+    // lock the the buffered manager mutex
+    std::lock_guard lock(m_bufferManagerMutex);
+    if (imageSaver.saveMode == VideoWriter::SaveMode::Frame)
     {
-        if (m_robotSensorBridge->getMotorPWMs(m_jointSensorBuffer))
-        {
-            logData(motorStatePwmName, m_jointSensorBuffer, time);
-        }
+        // TODO here we may save the frame itself
+        m_bufferManager.push_back(captureTime, captureTime, imageSaver.channelName);
     }
+    m_bufferManager.push_back(latency, captureTime, imageSaver.channelName + "_encoding_latency");
+    m_bufferManager.push_back(static_cast<double>(droppedFrames),
+                              captureTime,
+                              imageSaver.channelName + "_dropped_frames");
+}
 
-    if (m_streamPIDs)
+void YarpRobotLoggerDevice::run()
+{
+    constexpr auto logPrefix = "[YarpRobotLoggerDevice::run]";
+    const std::chrono::nanoseconds t = BipedalLocomotion::clock().now();
+
+    if (!m_firstRun)
     {
-        if (m_robotSensorBridge->getPidPositions(m_jointSensorBuffer))
+        if (t - m_previousTimestamp > m_acceptableStep)
         {
-            logData(motorStatePidsName, m_jointSensorBuffer, time);
+            log()->warn("{} The time step is too big. The previous timestamp is {} and the current "
+                        "timestamp is {}. The time step is {}.",
+                        logPrefix,
+                        std::chrono::duration<double>(m_previousTimestamp),
+                        std::chrono::duration<double>(t),
+                        std::chrono::duration<double>(t - m_previousTimestamp));
+            return;
         }
     }
 
-    if (m_streamFTSensors)
+    // get the data
+    if (!m_robotSensorBridge->advance())
     {
-        for (const auto& sensorName : m_robotSensorBridge->getSixAxisForceTorqueSensorsList())
-        {
-            if (m_robotSensorBridge->getSixAxisForceTorqueMeasurement(sensorName, m_ftBuffer))
-            {
-                signalFullName = ftsName + treeDelim + sensorName;
-                logData(signalFullName, m_ftBuffer, time);
-            }
-        }
+        log()->error("{} Could not advance sensor bridge.", logPrefix);
     }
 
-    if (m_streamTemperatureSensors)
+    // the record is written directly in the queue. The telemetry thread will take care of
+    // storing it in the buffer manager and of sending it to the realtime clients.
+    SensorRecord* record = m_sensorRecords.beginWrite();
+    if (record == nullptr)
     {
-        for (const auto& sensorName : m_robotSensorBridge->getTemperatureSensorsList())
+        // the telemetry thread is not able to keep up with the device. The error is reported by
+        // the telemetry thread to avoid logging in this thread.
+        m_droppedSensorRecords++;
+    } else
+    {
+        record->time = std::chrono::duration<double>(t).count();
+        for (const auto& reader : m_sensorReaders)
         {
-            if (m_robotSensorBridge->getTemperature(sensorName, m_ftTemperatureBuffer))
-            {
-                signalFullName = temperatureName + treeDelim + sensorName;
-
-                Eigen::Matrix<double, 1, 1> temperatureData;
-                temperatureData << m_ftTemperatureBuffer;
-                logData(signalFullName, temperatureData, time);
-            }
+            const bool isValid = reader.read(record->data.segment(reader.offset, reader.size));
+            std::fill_n(record->isValid.begin() + reader.firstChannel,
+                        reader.numberOfChannels,
+                        isValid);
         }
+        m_sensorRecords.endWrite();
     }
 
-    if (m_streamInertials)
+    m_previousTimestamp = t;
+    m_firstRun = false;
+}
+
+void YarpRobotLoggerDevice::processTelemetry()
+{
+    constexpr auto logPrefix = "[YarpRobotLoggerDevice::processTelemetry]";
+
+    // the queue is drained every time the thread wakes up, hence waiting for a period of the
+    // device is enough to keep the queue almost empty
+    const auto telemetryPeriod = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(this->getPeriod()));
+    std::size_t reportedDroppedRecords = 0;
+
+    while (m_telemetryThreadIsRunning)
     {
-        for (const auto& sensorName : m_robotSensorBridge->getGyroscopesList())
+        while (const SensorRecord* record = m_sensorRecords.beginRead())
         {
-            if (m_robotSensorBridge->getGyroscopeMeasure(sensorName, m_gyroBuffer))
-            {
-                signalFullName = gyrosName + treeDelim + sensorName;
-                logData(signalFullName, m_gyroBuffer, time);
-            }
+            this->logSensorRecord(*record);
+            m_sensorRecords.endRead();
         }
 
-        // pack the data for the accelerometer
-        for (const auto& sensorName : m_robotSensorBridge->getLinearAccelerometersList())
+        const std::size_t droppedRecords = m_droppedSensorRecords;
+        if (droppedRecords != reportedDroppedRecords)
         {
-            if (m_robotSensorBridge->getLinearAccelerometerMeasurement(sensorName,
-                                                                       m_acceloremeterBuffer))
-            {
-                signalFullName = accelerometersName + treeDelim + sensorName;
-                logData(signalFullName, m_acceloremeterBuffer, time);
-            }
+            log()->warn("{} The queue of the sensor records is full. {} records have been "
+                        "dropped since the device started. Please consider increasing the "
+                        "'queue_size' parameter.",
+                        logPrefix,
+                        droppedRecords);
+            reportedDroppedRecords = droppedRecords;
         }
 
-        // pack the data for the orientations
-        for (const auto& sensorName : m_robotSensorBridge->getOrientationSensorsList())
-        {
-            if (m_robotSensorBridge->getOrientationSensorMeasurement(sensorName,
-                                                                     m_orientationBuffer))
-            {
-                signalFullName = orientationsName + treeDelim + sensorName;
-                logData(signalFullName, m_orientationBuffer, time);
-            }
-        }
+        BipedalLocomotion::clock().sleepFor(telemetryPeriod);
+    }
 
-        for (const auto& sensorName : m_robotSensorBridge->getMagnetometersList())
+    // store the records produced before the device has been stopped
+    while (const SensorRecord* record = m_sensorRecords.beginRead())
+    {
+        this->logSensorRecord(*record);
+        m_sensorRecords.endRead();
+    }
+}
+
+void YarpRobotLoggerDevice::logSensorRecord(const SensorRecord& record)
+{
+    auto storeData = [this](const std::string& name, const auto& data, const double time) {
+        if (m_streamTelemetry)
         {
-            if (m_robotSensorBridge->getMagnetometerMeasurement(sensorName, m_magnemetometerBuffer))
-            {
-                signalFullName = magnetometersName + treeDelim + sensorName;
-                logData(signalFullName, m_magnemetometerBuffer, time);
-            }
+            m_streamingWriter.push(name, time, iDynTree::make_span(data));
+        } else
+        {
+            m_bufferManager.push_back(data, time, name);
         }
-    }
+    };
 
-    // an IMU contains a gyro accelerometer and an orientation sensor
-    for (const auto& sensorName : m_robotSensorBridge->getIMUsList())
-    {
-        if (m_robotSensorBridge->getIMUMeasurement(sensorName, m_analogSensorBuffer))
+    auto logData = [this, &storeData](const std::string& name,
+                                      const auto& data,
+                                      const double time) {
+        storeData(name, data, time);
+        std::string rtName = robotRtRootName + treeDelim + name;
+        if (m_sendDataRT)
         {
-            // it will return a tuple containing the Accelerometer, the gyro and the orientation
-            this->unpackIMU(m_analogSensorBuffer,
-                            m_acceloremeterBuffer,
-                            m_gyroBuffer,
-                            m_orientationBuffer);
+            m_vectorCollectionRTDataServer.populateData(rtName, data);
+        }
+    };
 
-            signalFullName = accelerometersName + treeDelim + sensorName;
-            logData(signalFullName, m_acceloremeterBuffer, time);
+    constexpr auto logPrefix = "[YarpRobotLoggerDevice::logSensorRecord]";
 
-            signalFullName = gyrosName + treeDelim + sensorName;
-            logData(signalFullName, m_gyroBuffer, time);
+    const double time = record.time;
+    std::string signalFullName = "";
+    std::string rtSignalFullName = "";
 
-            signalFullName = orientationsName + treeDelim + sensorName;
-            logData(signalFullName, m_orientationBuffer, time);
-        }
+    std::lock_guard lock(m_bufferManagerMutex);
+    if (m_sendDataRT)
+    {
+        m_vectorCollectionRTDataServer.prepareData();
+        m_vectorCollectionRTDataServer.clearData();
+        Eigen::Matrix<double, 1, 1> timeData;
+        timeData << time;
+        rtSignalFullName = robotRtRootName + treeDelim + timestampsName;
+        m_vectorCollectionRTDataServer.populateData(rtSignalFullName, timeData);
     }
 
-    if (m_streamCartesianWrenches)
+    for (std::size_t i = 0; i < m_sensorChannels.size(); i++)
     {
-        for (const auto& cartesianWrenchName : m_robotSensorBridge->getCartesianWrenchesList())
+        if (!record.isValid[i])
         {
-            if (m_robotSensorBridge->getCartesianWrench(cartesianWrenchName, m_ftBuffer))
-            {
-                signalFullName = cartesianWrenchesName + treeDelim + cartesianWrenchName;
-                logData(signalFullName, m_ftBuffer, time);
-            }
+            continue;
+        }
+
+        auto& channel = m_sensorChannels[i];
+        channel.buffer = record.data.segment(channel.offset, channel.size);
+        if (channel.samplingPolicy.shouldStore(channel.buffer))
+        {
+            storeData(channel.name, channel.buffer, time);
+        }
+        if (m_sendDataRT)
+        {
+            m_vectorCollectionRTDataServer.populateData(channel.rtName, channel.buffer);
         }
     }
 
@@ -1649,6 +2084,45 @@ void YarpRobotLoggerDevice::run()
         }
 
         std::lock_guard<std::mutex> lock(signal.mutex);
+
+        // the packed data is stored without unpacking it
+        if (!signal.channels.empty())
+        {
+            const BipedalLocomotion::YarpUtilities::PackedVectorsCollection* packed
+                = signal.client.readPackedData(false);
+            if (packed == nullptr)
+            {
+                continue;
+            }
+
+            if (!signal.dataArrived)
+            {
+                bool channelsAdded = true;
+                for (const auto& channel : signal.channels)
+                {
+                    const auto& metadata = signal.metadata.vectors.find(channel.key);
+                    channelsAdded = addChannel(channel.name,
+                                               channel.buffer.size(),
+                                               metadata == signal.metadata.vectors.cend()
+                                                   ? std::vector<std::string>{}
+                                                   : metadata->second)
+                                    && channelsAdded;
+                }
+                signal.dataArrived = channelsAdded;
+                continue;
+            }
+
+            const auto& layout = signal.client.getLayout();
+            for (auto& channel : signal.channels)
+            {
+                const iDynTree::Span<const double> vector
+                    = layout.getVector(*packed, channel.handle);
+                channel.buffer = Eigen::Map<const Eigen::VectorXd>(vector.data(), vector.size());
+                logData(channel.name, channel.buffer, time);
+            }
+            continue;
+        }
+
         const BipedalLocomotion::YarpUtilities::VectorsCollection* collection
             = signal.client.readData(false);
 
@@ -1750,9 +2224,6 @@ void YarpRobotLoggerDevice::run()
     {
         m_vectorCollectionRTDataServer.sendData();
     }
-
-    m_previousTimestamp = t;
-    m_firstRun = false;
 }
 
 bool YarpRobotLoggerDevice::saveCallback(const std::string& fileName,
@@ -1922,6 +2393,39 @@ bool YarpRobotLoggerDevice::saveCallback(const std::string& fileName,
         }
     }
 
+    // close the file containing the streamed signals and start a new one
+    if (m_streamTelemetry)
+    {
+        // the samples pushed while the file is closed are stored in the writer queue
+        if (!m_streamingWriter.close())
+        {
+            // the incomplete file is kept with its name and it is not overwritten by a new one
+            log()->error("{} Unable to write all the streamed signals. The file {} is kept and "
+                         "the streaming is stopped.",
+                         logPrefix,
+                         m_streamingFileName);
+        } else
+        {
+            std::error_code error;
+            std::filesystem::rename(m_streamingFileName, fileName + ".blflog", error);
+            if (error)
+            {
+                // opening the writer again would truncate the file
+                log()->error("{} Unable to rename the file {} to {}: {}. The streaming is "
+                             "stopped.",
+                             logPrefix,
+                             m_streamingFileName,
+                             fileName + ".blflog",
+                             error.message());
+            } else if (method == robometry::SaveCallbackSaveMethod::periodic
+                       && !m_streamingWriter.open(m_streamingFileName))
+            {
+                log()->error("{} Unable to open the file {}.", logPrefix, m_streamingFileName);
+                return false;
+            }
+        }
+    }
+
     // save the status of the code
     std::ofstream file(fileName + ".md");
     file << "# " << fileName << std::endl;
@@ -1965,6 +2469,14 @@ bool YarpRobotLoggerDevice::detachAll()
 
 bool YarpRobotLoggerDevice::close()
 {
+    // close the thread that moves the sensor records to the telemetry
+    m_telemetryThreadIsRunning = false;
+    if (m_telemetryThread.joinable())
+    {
+        m_telemetryThread.join();
+        m_telemetryThread = std::thread();
+    }
+
     // stop all the video thread
     for (auto& [cameraName, writer] : m_videoWriters)
     {
@@ -1981,6 +2493,35 @@ bool YarpRobotLoggerDevice::close()
         }
     }
 
+    // close the threads encoding the frames once all the captured frames are saved
+    {
+        std::lock_guard lock(m_videoEncodingMutex);
+        m_videoEncodingIsRunning = false;
+    }
+    m_videoEncodingCondition.notify_all();
+    for (auto& thread : m_videoEncodingThreads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    m_videoEncodingThreads.clear();
+
+    for (const auto& [cameraName, writer] : m_videoWriters)
+    {
+        for (const auto& imageSaver : {writer.rgb, writer.depth})
+        {
+            if (imageSaver != nullptr && imageSaver->droppedFrames > 0)
+            {
+                log()->warn("[YarpRobotLoggerDevice::close] {} frames of {} have been dropped "
+                            "since the encoding threads were not able to keep up with the camera.",
+                            imageSaver->droppedFrames,
+                            imageSaver->channelName);
+            }
+        }
+    }
+
     // close the thread associated to the text logging polling
     m_lookForNewLogsIsRunning = false;
     if (m_lookForNewLogsThread.joinable())
@@ -0,0 +1,219 @@
+/**
+ * @file ChunkedLogWriterTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <filesystem>
+#include <memory>
+#include <random>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+// BLF
+#include <BipedalLocomotion/ChunkedLogWriter.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion;
+
+TEST_CASE("Chunked log writer")
+{
+    auto handler = std::make_shared<ParametersHandler::StdImplementation>();
+    handler->setParameter("chunk_size", 10);
+    handler->setParameter("max_queued_chunks", 100);
+
+    const std::filesystem::path fileName
+        = std::filesystem::temp_directory_path() / "chunked_log_writer_test.blflog";
+
+    ChunkedLogWriter writer;
+    REQUIRE(writer.initialize(handler));
+    REQUIRE(writer.addChannel("joints", {"j0", "j1", "j2"}));
+    REQUIRE(writer.addChannel("time", {"t"}));
+    REQUIRE_FALSE(writer.addChannel("joints", {"j0"}));
+    REQUIRE(writer.open(fileName.string()));
+
+    // the number of samples is not a multiple of the chunk size, so the last chunk is written by
+    // close()
+    constexpr std::size_t numberOfSamples = 95;
+    Eigen::Vector3d joints;
+    for (std::size_t i = 0; i < numberOfSamples; i++)
+    {
+        const double time = 0.001 * i;
+        joints << i, 2.0 * i, 3.0 * i;
+        REQUIRE(writer.push("joints", time, joints));
+        REQUIRE(writer.push("time", time, iDynTree::Span<const double>(&time, 1)));
+    }
+    REQUIRE_FALSE(writer.push("unknown", 0, joints));
+    REQUIRE(writer.close());
+    REQUIRE(writer.getDroppedSamples() == 0);
+
+    SECTION("Read")
+    {
+        ChunkedLogReader reader;
+        REQUIRE(reader.open(fileName.string()));
+
+        const auto& channels = reader.getChannels();
+        REQUIRE(channels.size() == 2);
+
+        const auto& jointsChannel = channels.at("joints");
+        REQUIRE(jointsChannel.elementNames == std::vector<std::string>{"j0", "j1", "j2"});
+        REQUIRE(jointsChannel.time.size() == numberOfSamples);
+        REQUIRE(jointsChannel.data.rows() == 3);
+        REQUIRE(jointsChannel.data.cols() == numberOfSamples);
+        for (std::size_t i = 0; i < numberOfSamples; i++)
+        {
+            REQUIRE(jointsChannel.time[i] == 0.001 * i);
+            REQUIRE(jointsChannel.data(0, i) == i);
+            REQUIRE(jointsChannel.data(1, i) == 2.0 * i);
+            REQUIRE(jointsChannel.data(2, i) == 3.0 * i);
+        }
+
+        const auto& timeChannel = channels.at("time");
+        REQUIRE(timeChannel.data.cols() == numberOfSamples);
+        REQUIRE(timeChannel.data(0, numberOfSamples - 1) == 0.001 * (numberOfSamples - 1));
+    }
+
+    SECTION("Truncated file")
+    {
+        // remove a part of the last record, as it happens if the process crashes while writing
+        const auto size = std::filesystem::file_size(fileName);
+        std::filesystem::resize_file(fileName, size - 20);
+
+        ChunkedLogReader reader;
+        REQUIRE(reader.open(fileName.string()));
+
+        // the last record contains the samples of one of the two channels. All the other chunks
+        // must be available
+        std::size_t samples = 0;
+        for (const auto& [name, channel] : reader.getChannels())
+        {
+            REQUIRE(static_cast<std::size_t>(channel.data.cols()) == channel.time.size());
+            samples += channel.time.size();
+        }
+        REQUIRE(samples == 2 * numberOfSamples - 5);
+    }
+
+    SECTION("Reopen")
+    {
+        // the channels are kept when the writer is opened on a new file
+        REQUIRE(writer.push("joints", 1.0, joints));
+        REQUIRE(writer.open(fileName.string()));
+        REQUIRE(writer.close());
+
+        ChunkedLogReader reader;
+        REQUIRE(reader.open(fileName.string()));
+        REQUIRE(reader.getChannels().size() == 2);
+        REQUIRE(reader.getChannels().at("joints").time == std::vector<double>{1.0});
+        REQUIRE(reader.getChannels().at("time").time.empty());
+    }
+
+    SECTION("Size change")
+    {
+        // the samples with a different size are stored in a new channel
+        REQUIRE(writer.open(fileName.string()));
+        REQUIRE(writer.push("joints", 1.0, iDynTree::Span<const double>(joints.data(), 2)));
+        REQUIRE(writer.push("joints", 2.0, joints));
+        REQUIRE(writer.push("joints", 3.0, iDynTree::Span<const double>(joints.data(), 2)));
+        REQUIRE(writer.close());
+
+        ChunkedLogReader reader;
+        REQUIRE(reader.open(fileName.string()));
+        const auto& channels = reader.getChannels();
+        REQUIRE(channels.size() == 3);
+        REQUIRE(channels.at("joints").time == std::vector<double>{2.0});
+
+        const auto& resizedChannel = channels.at("joints_size_2");
+        REQUIRE(resizedChannel.elementNames == std::vector<std::string>{"element_0", "element_1"});
+        REQUIRE(resizedChannel.time == std::vector<double>{1.0, 3.0});
+        REQUIRE(resizedChannel.data.col(1) == joints.head<2>());
+    }
+
+    SECTION("Dropped samples")
+    {
+        // the samples pushed while the file is closed are kept until all the chunks are full. The
+        // first chunk already contains the last samples written by close()
+        constexpr std::size_t storedSamples = (100 + 1) * 10 - numberOfSamples % 10;
+        for (std::size_t i = 0; i < storedSamples + 5; i++)
+        {
+            REQUIRE(writer.push("joints", 0.001 * i, joints));
+        }
+        REQUIRE(writer.getDroppedSamples() == 5);
+
+        REQUIRE(writer.open(fileName.string()));
+        REQUIRE(writer.close());
+
+        ChunkedLogReader reader;
+        REQUIRE(reader.open(fileName.string()));
+        REQUIRE(reader.getChannels().at("joints").time.size() == storedSamples);
+    }
+
+    std::filesystem::remove(fileName);
+}
+
+TEST_CASE("Chunked log writer compression")
+{
+    const std::filesystem::path compressedFileName
+        = std::filesystem::temp_directory_path() / "chunked_log_writer_compressed.blflog";
+    const std::filesystem::path rawFileName
+        = std::filesystem::temp_directory_path() / "chunked_log_writer_raw.blflog";
+
+    // a constant signal (as a temperature), a signal converted from single precision (as most of
+    // the measurements provided by the robot) and a random signal
+    constexpr std::size_t numberOfSamples = 2000;
+    Eigen::MatrixXd signals(3, numberOfSamples);
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (std::size_t i = 0; i < numberOfSamples; i++)
+    {
+        signals(0, i) = 36.5;
+        signals(1, i) = static_cast<float>(std::sin(0.001 * i));
+        signals(2, i) = distribution(generator);
+    }
+
+    auto write = [&signals](const std::filesystem::path& fileName, bool compression) {
+        auto handler = std::make_shared<ParametersHandler::StdImplementation>();
+        handler->setParameter("chunk_size", 500);
+        handler->setParameter("compression", compression);
+
+        ChunkedLogWriter writer;
+        REQUIRE(writer.initialize(handler));
+        REQUIRE(writer.addChannel("constant", {"x"}));
+        REQUIRE(writer.addChannel("quantized", {"x"}));
+        REQUIRE(writer.addChannel("random", {"x"}));
+        REQUIRE(writer.open(fileName.string()));
+        for (Eigen::Index i = 0; i < signals.cols(); i++)
+        {
+            const double time = 0.001 * i;
+            using Span = iDynTree::Span<const double>;
+            REQUIRE(writer.push("constant", time, Span(&signals(0, i), 1)));
+            REQUIRE(writer.push("quantized", time, Span(&signals(1, i), 1)));
+            REQUIRE(writer.push("random", time, Span(&signals(2, i), 1)));
+        }
+        REQUIRE(writer.close());
+    };
+
+    write(compressedFileName, true);
+    write(rawFileName, false);
+
+    // the compression is lossless
+    for (const auto& fileName : {compressedFileName, rawFileName})
+    {
+        ChunkedLogReader reader;
+        REQUIRE(reader.open(fileName.string()));
+        const auto& channels = reader.getChannels();
+        REQUIRE(channels.at("constant").data == signals.row(0));
+        REQUIRE(channels.at("quantized").data == signals.row(1));
+        REQUIRE(channels.at("random").data == signals.row(2));
+        REQUIRE(channels.at("random").time.size() == numberOfSamples);
+        REQUIRE(channels.at("random").time.back() == 0.001 * (numberOfSamples - 1));
+    }
+
+    // the random signal cannot be compressed, while the other signals and the timestamps are
+    // stored in a fraction of the raw size
+    REQUIRE(std::filesystem::file_size(compressedFileName)
+            < std::filesystem::file_size(rawFileName) * 3 / 4);
+
+    std::filesystem::remove(compressedFileName);
+    std::filesystem::remove(rawFileName);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file TapedFunction.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_AUTODIFF_TAPED_FUNCTION_H
+#define BIPEDAL_LOCOMOTION_AUTODIFF_TAPED_FUNCTION_H
+
+#include <functional>
+#include <memory>
+
+#include <Eigen/Dense>
+#include <Eigen/SparseCore>
+
+#include <BipedalLocomotion/AutoDiff/CppAD.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+
+namespace BipedalLocomotion
+{
+namespace AutoDiff
+{
+namespace CppAD
+{
+
+/**
+ * TapedFunction computes the value and the sparse Jacobian of a function \f$y = f(x)\f$, with
+ * \f$x \in \mathbb{R}^n\f$ and \f$y \in \mathbb{R}^m\f$. The function is recorded on a CppAD tape
+ * only once, in TapedFunction::setFunction. The tape is optimized and the sparsity pattern of the
+ * Jacobian is computed. Then, the Jacobian is evaluated by computing only its structurally
+ * non-zero entries, and by reusing the graph coloring computed at the first evaluation.
+ *
+ * If the code generation is enabled, the function and the non-zero entries of the Jacobian are
+ * recorded in a second tape that is translated to C code. The code is compiled in a shared
+ * library that is loaded at runtime. In this case, evaluate calls native code instead of the
+ * CppAD operation sequence interpreter.
+ * @code{.cpp}
+ * // measurement model of an estimator
+ * TapedFunction model;
+ * model.initialize(handler);
+ * model.setFunction(
+ *     [](const VectorXAD& x) -> VectorXAD {
+ *         VectorXAD y(2);
+ *         y << x(0) * x(1), CppAD::sin(x(2));
+ *         return y;
+ *     },
+ *     3);
+ *
+ * model.evaluate(state);
+ * const Eigen::SparseMatrix<double>& H = model.getJacobian();
+ * @endcode
+ * @note The function is recorded for a single value of the input. Hence, it must not contain
+ * branches depending on the value of the input (use CppAD::CondExpGt and similar instead).
+ * @note The code generation requires CppAD to be compiled with the support to just in time
+ * compilation (CppAD 2022 or newer) and a C compiler available at runtime. If it is not available
+ * the initialization fails when the code generation is required.
+ */
+class TapedFunction
+{
+public:
+    /**
+     * Function to be differentiated.
+     */
+    using Function = std::function<VectorXAD(const VectorXAD&)>;
+
+    /**
+     * Constructor.
+     */
+    TapedFunction();
+
+    /**
+     * Destructor.
+     */
+    ~TapedFunction();
+
+    /**
+     * Initialize the object.
+     * @param handler pointer to the parameter handler.
+     * @note The following parameters are optional
+     * |      Parameter Name     |   Type   |                                 Description                                | Mandatory |
+     * |:-----------------------:|:--------:|:--------------------------------------------------------------------------:|:---------:|
+     * |        `optimize`       |  `bool`  |                 Optimize the tape. Default value `true`.                  |    No     |
+     * |     `generate_code`     |  `bool`  |       Compile the function and its Jacobian. Default value `false`.       |    No     |
+     * |     `function_name`     | `string` |  Name of the generated C function. Default value `blf_taped_function`.   |    No     |
+     * |    `output_directory`   | `string` | Directory containing the generated code. Default value: temp directory.  |    No     |
+     * |    `compile_command`    | `string` |     Command used to compile the code. Default value chosen by CppAD.     |    No     |
+     * @return true in case of success, false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
+
+    /**
+     * Record the function.
+     * @param function the function to be recorded.
+     * @param inputSize size of the input of the function.
+     * @param input value of the input used to record the function. If not provided a vector of
+     * zeros is used.
+     * @return true in case of success, false otherwise.
+     * @note This function allocates memory and, if the code generation is enabled, it compiles the
+     * generated code. It should be called once, before starting the control loop.
+     */
+    bool setFunction(const Function& function,
+                     Eigen::Index inputSize,
+                     Eigen::Ref<const Eigen::VectorXd> input = Eigen::VectorXd());
+
+    /**
+     * Evaluate the function and its Jacobian.
+     * @param input value of the input.
+     * @return true in case of success, false otherwise.
+     * @note The buffers used by the evaluation are allocated by setFunction. The vectors
+     * returned by the CppAD interpreter are allocated through CppAD::thread_alloc, that is set to
+     * hold the released memory so that it is reused by the next evaluation.
+     */
+    bool evaluate(Eigen::Ref<const Eigen::VectorXd> input);
+
+    /**
+     * Get the value of the function computed by the last call of evaluate.
+     * @return the value of the function.
+     */
+    Eigen::Ref<const Eigen::VectorXd> getOutput() const;
+
+    /**
+     * Get the Jacobian computed by the last call of evaluate.
+     * @return the Jacobian. Its sparsity pattern does not change between calls.
+     */
+    const Eigen::SparseMatrix<double>& getJacobian() const;
+
+    /**
+     * Get the size of the input of the function.
+     * @return the size of the input.
+     */
+    Eigen::Index getInputSize() const;
+
+    /**
+     * Get the size of the output of the function.
+     * @return the size of the output.
+     */
+    Eigen::Index getOutputSize() const;
+
+    /**
+     * Check if the function and its Jacobian are evaluated with generated code.
+     * @return true if the code has been generated and loaded, false otherwise.
+     */
+    bool isCodeGenerated() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+} // namespace CppAD
+} // namespace AutoDiff
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_AUTODIFF_TAPED_FUNCTION_H
@@ -0,0 +1,489 @@
+/**
+ * @file TapedFunction.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <BipedalLocomotion/AutoDiff/TapedFunction.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+// The just in time compilation has been introduced in CppAD 2022. CPPAD_C_COMPILER_CMD is
+// defined only by the versions supporting it.
+#ifdef CPPAD_C_COMPILER_CMD
+#define BIPEDAL_LOCOMOTION_CPPAD_HAS_JIT
+#include <cppad/utility/create_dll_lib.hpp>
+#include <cppad/utility/link_dll_lib.hpp>
+#endif
+
+using namespace BipedalLocomotion::AutoDiff::CppAD;
+
+struct TapedFunction::Impl
+{
+    using SizeVector = ::CppAD::vector<std::size_t>;
+    using ValueVector = ::CppAD::vector<double>;
+
+    /** Signature of the functions generated by CppAD::ADFun::to_csrc. */
+    using GeneratedFunction = int (*)(std::size_t nx,
+                                      const double* x,
+                                      std::size_t ny,
+                                      double* y,
+                                      std::size_t* compareChange);
+
+    struct
+    {
+        bool optimize{true};
+        bool generateCode{false};
+        std::string functionName{"blf_taped_function"};
+        std::filesystem::path outputDirectory;
+        std::string compileCommand;
+    } parameters;
+
+    bool isInitialized{false};
+    bool isFunctionSet{false};
+
+    ::CppAD::ADFun<double> tape; /**< Tape of the function. */
+    ::CppAD::sparse_rc<SizeVector> pattern; /**< Sparsity pattern of the Jacobian. */
+    ::CppAD::sparse_rcv<SizeVector, ValueVector> jacobianEntries; /**< Non-zero entries. */
+    ::CppAD::sparse_jac_work work; /**< Coloring of the Jacobian computed at the first call. */
+    bool useForwardMode{true}; /**< True if the Jacobian is computed in forward mode. */
+
+    ValueVector input;
+    ValueVector forwardOutput; /**< Value of the function computed by the interpreter. */
+    Eigen::VectorXd output;
+    Eigen::SparseMatrix<double> jacobian;
+
+    /** Position in Eigen::SparseMatrix::valuePtr of each entry of the sparsity pattern. */
+    std::vector<Eigen::Index> valueIndices;
+
+#ifdef BIPEDAL_LOCOMOTION_CPPAD_HAS_JIT
+    std::unique_ptr<::CppAD::link_dll_lib> library; /**< Library containing the generated code. */
+#endif
+    GeneratedFunction generatedFunction{nullptr};
+    Eigen::VectorXd generatedOutput; /**< Value of the function followed by the Jacobian entries. */
+
+    bool generateCode(const VectorXAD& recordingPoint);
+    void copyJacobianEntries(const double* entries);
+};
+
+bool TapedFunction::Impl::generateCode(const VectorXAD& recordingPoint)
+{
+    constexpr auto logPrefix = "[TapedFunction::Impl::generateCode]";
+
+#ifdef BIPEDAL_LOCOMOTION_CPPAD_HAS_JIT
+    const std::size_t outputSize = tape.Range();
+    const std::size_t numberOfEntries = pattern.nnz();
+
+    // record the function and the non-zero entries of the Jacobian in a new tape. The entries
+    // are computed with the same sparse sweeps used by the interpreter, so the generated code
+    // does not contain the operations needed by the structurally zero entries
+    ::CppAD::ADFun<::CppAD::AD<double>, double> adTape = tape.base2ad();
+    VectorXAD x = recordingPoint;
+    ::CppAD::Independent(x);
+    const VectorXAD y = adTape.Forward(0, x);
+
+    ::CppAD::sparse_rcv<SizeVector, VectorXAD> entries(pattern);
+    ::CppAD::sparse_jac_work adWork;
+    const std::string coloring = "cppad";
+    if (numberOfEntries > 0 && useForwardMode)
+    {
+        constexpr std::size_t groupMax = 1;
+        adTape.sparse_jac_for(groupMax, x, entries, pattern, coloring, adWork);
+    } else if (numberOfEntries > 0)
+    {
+        adTape.sparse_jac_rev(x, entries, pattern, coloring, adWork);
+    }
+
+    VectorXAD generatedOutput(outputSize + numberOfEntries);
+    generatedOutput.head(outputSize) = y;
+    for (std::size_t k = 0; k < numberOfEntries; k++)
+    {
+        generatedOutput(outputSize + k) = entries.val()[k];
+    }
+
+    ::CppAD::ADFun<double> generatedTape(x, generatedOutput);
+    generatedTape.optimize();
+    generatedTape.function_name_set(parameters.functionName);
+
+    std::error_code errorCode;
+    std::filesystem::create_directories(parameters.outputDirectory, errorCode);
+    const std::filesystem::path sourceFile
+        = parameters.outputDirectory / (parameters.functionName + ".c");
+#ifdef _WIN32
+    const std::filesystem::path libraryFile
+        = parameters.outputDirectory / (parameters.functionName + ".dll");
+#else
+    const std::filesystem::path libraryFile
+        = parameters.outputDirectory / (parameters.functionName + ".so");
+#endif
+
+    std::ofstream source(sourceFile);
+    if (!source.is_open())
+    {
+        log()->error("{} Unable to open the file {}.", logPrefix, sourceFile.string());
+        return false;
+    }
+    generatedTape.to_csrc(source, "double");
+    source.close();
+
+    ::CppAD::vector<std::string> sourceFiles(1);
+    sourceFiles[0] = sourceFile.string();
+    std::map<std::string, std::string> options;
+    if (!parameters.compileCommand.empty())
+    {
+        options["compile"] = parameters.compileCommand;
+    }
+
+    std::string errorMessage
+        = ::CppAD::create_dll_lib(libraryFile.string(), sourceFiles, options);
+    if (!errorMessage.empty())
+    {
+        log()->error("{} Unable to compile the generated code. Error: {}.",
+                     logPrefix,
+                     errorMessage);
+        return false;
+    }
+
+    library = std::make_unique<::CppAD::link_dll_lib>(libraryFile.string(), errorMessage);
+    if (!errorMessage.empty())
+    {
+        log()->error("{} Unable to load the library {}. Error: {}.",
+                     logPrefix,
+                     libraryFile.string(),
+                     errorMessage);
+        library.reset();
+        return false;
+    }
+
+    void* function = (*library)("cppad_jit_" + parameters.functionName, errorMessage);
+    if (!errorMessage.empty() || function == nullptr)
+    {
+        log()->error("{} Unable to find the generated function. Error: {}.",
+                     logPrefix,
+                     errorMessage);
+        library.reset();
+        return false;
+    }
+
+    generatedFunction = reinterpret_cast<GeneratedFunction>(function);
+    generatedOutput.resize(outputSize + numberOfEntries);
+
+    log()->debug("{} The function has been compiled in {}.", logPrefix, libraryFile.string());
+    return true;
+#else
+    log()->error("{} The code generation requires CppAD 2022 or newer.", logPrefix);
+    return false;
+#endif
+}
+
+void TapedFunction::Impl::copyJacobianEntries(const double* entries)
+{
+    double* values = jacobian.valuePtr();
+    for (std::size_t k = 0; k < valueIndices.size(); k++)
+    {
+        values[valueIndices[k]] = entries[k];
+    }
+}
+
+TapedFunction::TapedFunction()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+TapedFunction::~TapedFunction() = default;
+
+bool TapedFunction::initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[TapedFunction::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} Invalid parameter handler.", logPrefix);
+        return false;
+    }
+
+    auto& parameters = m_pimpl->parameters;
+    if (!ptr->getParameter("optimize", parameters.optimize))
+    {
+        log()->info("{} Unable to find the parameter 'optimize'. The default value will be used: "
+                    "{}.",
+                    logPrefix,
+                    parameters.optimize);
+    }
+
+    if (!ptr->getParameter("generate_code", parameters.generateCode))
+    {
+        log()->info("{} Unable to find the parameter 'generate_code'. The default value will be "
+                    "used: {}.",
+                    logPrefix,
+                    parameters.generateCode);
+    }
+
+    if (parameters.generateCode)
+    {
+        if (!ptr->getParameter("function_name", parameters.functionName))
+        {
+            log()->info("{} Unable to find the parameter 'function_name'. The default value will "
+                        "be used: {}.",
+                        logPrefix,
+                        parameters.functionName);
+        }
+
+        std::string outputDirectory;
+        if (ptr->getParameter("output_directory", outputDirectory))
+        {
+            parameters.outputDirectory = outputDirectory;
+        } else
+        {
+            parameters.outputDirectory = std::filesystem::temp_directory_path();
+            log()->info("{} Unable to find the parameter 'output_directory'. The default value "
+                        "will be used: {}.",
+                        logPrefix,
+                        parameters.outputDirectory.string());
+        }
+
+        ptr->getParameter("compile_command", parameters.compileCommand);
+
+#ifndef BIPEDAL_LOCOMOTION_CPPAD_HAS_JIT
+        log()->error("{} The code generation requires CppAD 2022 or newer.", logPrefix);
+        return false;
+#endif
+    }
+
+    m_pimpl->isInitialized = true;
+    m_pimpl->isFunctionSet = false;
+    return true;
+}
+
+bool TapedFunction::setFunction(const Function& function,
+                                Eigen::Index inputSize,
+                                Eigen::Ref<const Eigen::VectorXd> input)
+{
+    constexpr auto logPrefix = "[TapedFunction::setFunction]";
+
+    if (!m_pimpl->isInitialized)
+    {
+        log()->error("{} Please call initialize() before setting the function.", logPrefix);
+        return false;
+    }
+
+    if (inputSize <= 0)
+    {
+        log()->error("{} The size of the input must be positive.", logPrefix);
+        return false;
+    }
+
+    if (input.size() != 0 && input.size() != inputSize)
+    {
+        log()->error("{} The size of the recording point is {}. Expected {}.",
+                     logPrefix,
+                     input.size(),
+                     inputSize);
+        return false;
+    }
+
+    m_pimpl->isFunctionSet = false;
+    m_pimpl->generatedFunction = nullptr;
+
+    // record the function
+    VectorXAD x = VectorXAD::Zero(inputSize);
+    if (input.size() != 0)
+    {
+        x = input.cast<::CppAD::AD<double>>();
+    }
+    const VectorXAD recordingPoint = x;
+
+    ::CppAD::Independent(x);
+    const VectorXAD y = function(x);
+    if (y.size() == 0)
+    {
+        ::CppAD::AD<double>::abort_recording();
+        log()->error("{} The output of the function is empty.", logPrefix);
+        return false;
+    }
+
+    m_pimpl->tape.Dependent(x, y);
+    if (m_pimpl->parameters.optimize)
+    {
+        m_pimpl->tape.optimize();
+    }
+
+    // compute the sparsity pattern of the Jacobian
+    const std::size_t n = inputSize;
+    const std::size_t m = y.size();
+    ::CppAD::sparse_rc<Impl::SizeVector> identity(n, n, n);
+    for (std::size_t k = 0; k < n; k++)
+    {
+        identity.set(k, k, k);
+    }
+
+    constexpr bool transpose = false;
+    constexpr bool dependency = false;
+    constexpr bool internalBool = true;
+    m_pimpl->tape.for_jac_sparsity(identity,
+                                   transpose,
+                                   dependency,
+                                   internalBool,
+                                   m_pimpl->pattern);
+
+    m_pimpl->jacobianEntries
+        = ::CppAD::sparse_rcv<Impl::SizeVector, Impl::ValueVector>(m_pimpl->pattern);
+    m_pimpl->work.clear();
+    m_pimpl->useForwardMode = n <= m;
+
+    // allocate the Jacobian with its final sparsity pattern
+    const std::size_t numberOfEntries = m_pimpl->pattern.nnz();
+    std::vector<Eigen::Triplet<double>> triplets;
+    triplets.reserve(numberOfEntries);
+    for (std::size_t k = 0; k < numberOfEntries; k++)
+    {
+        triplets.emplace_back(m_pimpl->pattern.row()[k], m_pimpl->pattern.col()[k], 0.0);
+    }
+
+    m_pimpl->jacobian.resize(m, n);
+    m_pimpl->jacobian.setFromTriplets(triplets.begin(), triplets.end());
+    m_pimpl->jacobian.makeCompressed();
+
+    m_pimpl->valueIndices.resize(numberOfEntries);
+    for (std::size_t k = 0; k < numberOfEntries; k++)
+    {
+        m_pimpl->valueIndices[k] = &m_pimpl->jacobian.coeffRef(m_pimpl->pattern.row()[k],
+                                                               m_pimpl->pattern.col()[k])
+                                   - m_pimpl->jacobian.valuePtr();
+    }
+
+    m_pimpl->input.resize(n);
+    m_pimpl->forwardOutput.resize(m);
+    m_pimpl->output.resize(m);
+
+    // the vector returned by the interpreter at each evaluation is allocated through
+    // CppAD::thread_alloc. The memory is held by CppAD so that it is reused by the next call
+    ::CppAD::thread_alloc::hold_memory(true);
+
+    if (m_pimpl->parameters.generateCode && !m_pimpl->generateCode(recordingPoint))
+    {
+        log()->error("{} Unable to generate the code of the function.", logPrefix);
+        return false;
+    }
+
+    log()->debug("{} Function recorded. Input size: {}, output size: {}, non-zero entries of "
+                 "the Jacobian: {}.",
+                 logPrefix,
+                 n,
+                 m,
+                 numberOfEntries);
+
+    m_pimpl->isFunctionSet = true;
+    return true;
+}
+
+bool TapedFunction::evaluate(Eigen::Ref<const Eigen::VectorXd> input)
+{
+    constexpr auto logPrefix = "[TapedFunction::evaluate]";
+
+    if (!m_pimpl->isFunctionSet)
+    {
+        log()->error("{} Please call setFunction() before evaluating the function.", logPrefix);
+        return false;
+    }
+
+    if (input.size() != static_cast<Eigen::Index>(m_pimpl->input.size()))
+    {
+        log()->error("{} The size of the input is {}. Expected {}.",
+                     logPrefix,
+                     input.size(),
+                     m_pimpl->input.size());
+        return false;
+    }
+
+    if (m_pimpl->generatedFunction != nullptr)
+    {
+        std::size_t compareChange = 0;
+        if (m_pimpl->generatedFunction(input.size(),
+                                       input.data(),
+                                       m_pimpl->generatedOutput.size(),
+                                       m_pimpl->generatedOutput.data(),
+                                       &compareChange)
+            != 0)
+        {
+            log()->error("{} Unable to evaluate the generated function.", logPrefix);
+            return false;
+        }
+
+        const Eigen::Index outputSize = m_pimpl->output.size();
+        m_pimpl->output = m_pimpl->generatedOutput.head(outputSize);
+        m_pimpl->copyJacobianEntries(m_pimpl->generatedOutput.data() + outputSize);
+        return true;
+    }
+
+    for (Eigen::Index i = 0; i < input.size(); i++)
+    {
+        m_pimpl->input[i] = input[i];
+    }
+
+    // the result is moved in the buffer, whose previous memory is returned to CppAD
+    m_pimpl->forwardOutput = m_pimpl->tape.Forward(0, m_pimpl->input);
+    for (Eigen::Index i = 0; i < m_pimpl->output.size(); i++)
+    {
+        m_pimpl->output[i] = m_pimpl->forwardOutput[i];
+    }
+
+    if (m_pimpl->pattern.nnz() == 0)
+    {
+        return true;
+    }
+
+    const std::string coloring = "cppad";
+    if (m_pimpl->useForwardMode)
+    {
+        constexpr std::size_t groupMax = 1;
+        m_pimpl->tape.sparse_jac_for(groupMax,
+                                     m_pimpl->input,
+                                     m_pimpl->jacobianEntries,
+                                     m_pimpl->pattern,
+                                     coloring,
+                                     m_pimpl->work);
+    } else
+    {
+        m_pimpl->tape.sparse_jac_rev(m_pimpl->input,
+                                     m_pimpl->jacobianEntries,
+                                     m_pimpl->pattern,
+                                     coloring,
+                                     m_pimpl->work);
+    }
+
+    m_pimpl->copyJacobianEntries(m_pimpl->jacobianEntries.val().data());
+    return true;
+}
+
+Eigen::Ref<const Eigen::VectorXd> TapedFunction::getOutput() const
+{
+    return m_pimpl->output;
+}
+
+const Eigen::SparseMatrix<double>& TapedFunction::getJacobian() const
+{
+    return m_pimpl->jacobian;
+}
+
+Eigen::Index TapedFunction::getInputSize() const
+{
+    return m_pimpl->input.size();
+}
+
+Eigen::Index TapedFunction::getOutputSize() const
+{
+    return m_pimpl->output.size();
+}
+
+bool TapedFunction::isCodeGenerated() const
+{
+    return m_pimpl->generatedFunction != nullptr;
+}
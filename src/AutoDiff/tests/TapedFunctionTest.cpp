@@ -0,0 +1,107 @@
+/**
+ * @file TapedFunctionTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cmath>
+#include <filesystem>
+#include <memory>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/AutoDiff/TapedFunction.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion::AutoDiff::CppAD;
+using namespace BipedalLocomotion::ParametersHandler;
+
+namespace
+{
+VectorXAD function(const VectorXAD& x)
+{
+    VectorXAD y(3);
+    y(0) = x(0) * x(1);
+    y(1) = CppAD::sin(x(2));
+    y(2) = 2.0 * x(3) + x(0);
+    return y;
+}
+
+Eigen::MatrixXd analyticJacobian(const Eigen::Ref<const Eigen::VectorXd>& x)
+{
+    Eigen::MatrixXd jacobian = Eigen::MatrixXd::Zero(3, 4);
+    jacobian(0, 0) = x(1);
+    jacobian(0, 1) = x(0);
+    jacobian(1, 2) = std::cos(x(2));
+    jacobian(2, 0) = 1.0;
+    jacobian(2, 3) = 2.0;
+    return jacobian;
+}
+} // namespace
+
+TEST_CASE("Taped function")
+{
+    auto handler = std::make_shared<StdImplementation>();
+
+    TapedFunction taped;
+    REQUIRE(taped.initialize(handler));
+    REQUIRE(taped.setFunction(function, 4));
+    REQUIRE_FALSE(taped.isCodeGenerated());
+    REQUIRE(taped.getInputSize() == 4);
+    REQUIRE(taped.getOutputSize() == 3);
+
+    // only the structurally non-zero entries are stored
+    REQUIRE(taped.getJacobian().nonZeros() == 5);
+
+    constexpr double tolerance = 1e-10;
+    for (int i = 0; i < 10; i++)
+    {
+        const Eigen::VectorXd x = Eigen::VectorXd::Random(4);
+        REQUIRE(taped.evaluate(x));
+
+        Eigen::Vector3d expectedOutput;
+        expectedOutput << x(0) * x(1), std::sin(x(2)), 2.0 * x(3) + x(0);
+        REQUIRE(taped.getOutput().isApprox(expectedOutput, tolerance));
+        REQUIRE(Eigen::MatrixXd(taped.getJacobian()).isApprox(analyticJacobian(x), tolerance));
+    }
+
+    REQUIRE_FALSE(taped.evaluate(Eigen::VectorXd::Zero(3)));
+}
+
+// the just in time compilation is available only if CppAD found a C compiler
+#ifdef CPPAD_C_COMPILER_CMD
+TEST_CASE("Taped function code generation")
+{
+    auto interpretedHandler = std::make_shared<StdImplementation>();
+    auto generatedHandler = std::make_shared<StdImplementation>();
+    generatedHandler->setParameter("generate_code", true);
+    generatedHandler->setParameter("function_name", "blf_taped_function_test");
+    generatedHandler->setParameter("output_directory",
+                                   std::filesystem::temp_directory_path().string());
+
+    TapedFunction interpreted;
+    REQUIRE(interpreted.initialize(interpretedHandler));
+    REQUIRE(interpreted.setFunction(function, 4));
+
+    TapedFunction generated;
+    REQUIRE(generated.initialize(generatedHandler));
+    REQUIRE(generated.setFunction(function, 4));
+    REQUIRE(generated.isCodeGenerated());
+
+    // the generated code contains only the structurally non-zero entries
+    REQUIRE(generated.getJacobian().nonZeros() == interpreted.getJacobian().nonZeros());
+
+    constexpr double tolerance = 1e-10;
+    for (int i = 0; i < 10; i++)
+    {
+        const Eigen::VectorXd x = Eigen::VectorXd::Random(4);
+        REQUIRE(interpreted.evaluate(x));
+        REQUIRE(generated.evaluate(x));
+
+        REQUIRE(generated.getOutput().isApprox(interpreted.getOutput(), tolerance));
+        REQUIRE(Eigen::MatrixXd(generated.getJacobian())
+                    .isApprox(Eigen::MatrixXd(interpreted.getJacobian()), tolerance));
+    }
+}
+#endif // CPPAD_C_COMPILER_CMD
@@ -0,0 +1,203 @@
+/**
+ * @file SmallVector.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_GENERIC_CONTAINER_SMALL_VECTOR_H
+#define BIPEDAL_LOCOMOTION_GENERIC_CONTAINER_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace GenericContainer
+{
+
+/**
+ * SmallVector is a contiguous and resizable container storing up to N elements inline, i.e. without
+ * allocating memory. When the size exceeds N, the elements are moved to a std::vector. Once on the
+ * heap, the elements stay there even if the container shrinks, so that resizing back and forth
+ * does not allocate again. SmallVector provides the data(), size() and resize() methods, hence it
+ * can be used with GenericContainer::Vector and GenericContainer::Vector::Ref.
+ * @code{.cpp}
+ * GenericContainer::SmallVector<double, 6> wrench;
+ * handler->getParameter("wrench", wrench); // no allocation if the parameter has at most 6 elements
+ * @endcode
+ * @tparam T type of the elements. It must be default constructible.
+ * @tparam N number of elements stored inline.
+ */
+template <typename T, std::size_t N> class SmallVector
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /**
+     * Constructor.
+     */
+    SmallVector() = default;
+
+    /**
+     * Constructor.
+     * @param size number of elements.
+     * @param value value used to initialize the elements.
+     */
+    explicit SmallVector(size_type size, const T& value = T())
+    {
+        resize(size);
+        std::fill(begin(), end(), value);
+    }
+
+    /**
+     * Constructor.
+     * @param list elements of the container.
+     */
+    SmallVector(std::initializer_list<T> list)
+    {
+        resize(list.size());
+        std::copy(list.begin(), list.end(), begin());
+    }
+
+    /**
+     * Get the pointer to the first element.
+     * @return a pointer to the first element.
+     */
+    T* data()
+    {
+        return m_isInline ? m_inlineStorage.data() : m_heapStorage.data();
+    }
+
+    /**
+     * Get the pointer to the first element.
+     * @return a const pointer to the first element.
+     */
+    const T* data() const
+    {
+        return m_isInline ? m_inlineStorage.data() : m_heapStorage.data();
+    }
+
+    /**
+     * Get the number of elements.
+     * @return the size of the container.
+     */
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    /**
+     * Check if the container is empty.
+     * @return true if the container does not contain any element.
+     */
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /**
+     * Check if the elements are stored inline.
+     * @return true if the elements are stored inline, false if they are stored in the heap.
+     */
+    bool isInline() const
+    {
+        return m_isInline;
+    }
+
+    /**
+     * Resize the container. The new elements are value initialized.
+     * @param newSize the new size.
+     * @note Memory is allocated only if newSize is greater than N and than the size of the
+     * elements already stored in the heap.
+     */
+    void resize(size_type newSize)
+    {
+        if (m_isInline && newSize <= N)
+        {
+            std::fill(m_inlineStorage.begin() + std::min(m_size, newSize),
+                      m_inlineStorage.begin() + newSize,
+                      T());
+        } else if (m_isInline)
+        {
+            m_heapStorage.assign(std::make_move_iterator(m_inlineStorage.begin()),
+                                 std::make_move_iterator(m_inlineStorage.begin() + m_size));
+            m_heapStorage.resize(newSize);
+            m_isInline = false;
+        } else
+        {
+            m_heapStorage.resize(newSize);
+        }
+
+        m_size = newSize;
+    }
+
+    /**
+     * Remove all the elements. The memory already allocated is not released.
+     */
+    void clear()
+    {
+        resize(0);
+    }
+
+    /**
+     * Access an element.
+     * @param index index of the element.
+     * @return a reference to the element.
+     */
+    T& operator[](size_type index)
+    {
+        return data()[index];
+    }
+
+    /**
+     * Access an element.
+     * @param index index of the element.
+     * @return a const reference to the element.
+     */
+    const T& operator[](size_type index) const
+    {
+        return data()[index];
+    }
+
+    iterator begin()
+    {
+        return data();
+    }
+
+    iterator end()
+    {
+        return data() + m_size;
+    }
+
+    const_iterator begin() const
+    {
+        return data();
+    }
+
+    const_iterator end() const
+    {
+        return data() + m_size;
+    }
+
+private:
+    std::array<T, N> m_inlineStorage{}; /**< Storage used if the size is at most N. */
+    std::vector<T> m_heapStorage; /**< Storage used if the size exceeded N. */
+    size_type m_size{0}; /**< Number of elements. */
+    bool m_isInline{true}; /**< True if the elements are stored in m_inlineStorage. */
+};
+
+} // namespace GenericContainer
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_GENERIC_CONTAINER_SMALL_VECTOR_H
@@ -44,6 +44,9 @@ using Vector_ptr = std::shared_ptr<Vector<T>>;
  * initialized from an existing container, such as an iDynTree::Vector, std::vector, array, yarp::sig::Vector and similar.
  * Even if it does not own the memory, it is possible to resize it. This is done through an user specified lambda, which
  * calls the corresponding "resize" method on the original object from which Vector has been initialized.
+ * When the type of the original object is known at compile time (e.g. when using make_vector or Ref), the lambda is
+ * replaced by a plain function pointer. In this case, creating a Vector does not allocate memory and resizing it does
+ * not pass through std::function.
  *
  * @warning The original object from which Vector has been initialized should not be deallocated before Vector.
  * This would invalidate the pointer inside it.
@@ -83,6 +86,12 @@ public:
      */
     using resize_function_type = std::function<iDynTree::Span<T>(index_type)>;
 
+    /**
+     * Alias for the type of function used to resize the original vector when its type is known at compile time.
+     * It takes as input a pointer to the original vector and the new size.
+     */
+    using resize_callback_type = iDynTree::Span<T> (*)(void*, index_type);
+
     /**
      * Alias to determine the output type of toEigen()
      */
@@ -99,6 +108,14 @@ protected:
      * @brief User specified lambda to resize the existing container.
      */
     resize_function_type m_resizeLambda;
+    /**
+     * @brief Pointer to the existing container. It is passed to m_resizeCallback.
+     */
+    void* m_container{nullptr};
+    /**
+     * @brief Function resizing the existing container. If set, it is used in place of m_resizeLambda.
+     */
+    resize_callback_type m_resizeCallback{nullptr};
 
     /**
      * The default constructor is private. In fact, once the Vector is built, it is assumed to point to an existing container.
@@ -128,7 +145,22 @@ public:
     Vector(iDynTree::Span<T> span)
     {
         m_span = span;
-        m_resizeLambda = [span](index_type size){unused(size); return span;};
+    }
+
+    /**
+     * @brief Constructor
+     * @param span Span of the existing container
+     * @param container Pointer to the existing container
+     * @param resizeCallback Function resizing the container pointed by container and returning its new span
+     *
+     * Differently from resize_function_type, the callback is a plain function pointer. Hence, the
+     * constructor does not allocate memory. See DefaultContainerResizer.
+     */
+    Vector(iDynTree::Span<T> span, void* container, resize_callback_type resizeCallback)
+    {
+        m_span = span;
+        m_container = container;
+        m_resizeCallback = resizeCallback;
     }
 
     /**
@@ -152,7 +184,9 @@ public:
     Vector(Vector<T>&& other)
     {
         m_span = other.m_span;
-        m_resizeLambda = other.m_resizeLambda;
+        m_resizeLambda = std::move(other.m_resizeLambda);
+        m_container = other.m_container;
+        m_resizeCallback = other.m_resizeCallback;
     }
 
     /**
@@ -267,7 +301,15 @@ public:
      */
     bool resizeVector(index_type newSize)
     {
-        m_span = m_resizeLambda(newSize);
+        if (m_resizeCallback != nullptr)
+        {
+            m_span = m_resizeCallback(m_container, newSize);
+        }
+        else if (m_resizeLambda)
+        {
+            m_span = m_resizeLambda(newSize);
+        }
+
         return m_span.size() == newSize;
     }
 
@@ -681,6 +723,35 @@ typename Vector<typename container_data<Class>::type>::resize_function_type Defa
     }
 }
 
+/**
+ * @brief Utility function used as <code>resize_callback_type<\code> for the input class.
+ * @param container Pointer to an object of type Class.
+ * @param newSize The new size.
+ * @returns The span of the resized object.
+ *
+ * Differently from DefaultVectorResizer, no lambda is created, hence it does not allocate memory.
+ */
+template <typename Class>
+iDynTree::Span<typename container_data<Class>::type>
+DefaultContainerResizer(void* container, typename Vector<typename container_data<Class>::type>::index_type newSize)
+{
+    static_assert (is_resizable<Class>::value, "Class type is not resizable.");
+    static_assert (is_span_constructible<Class>::value || (is_data_available<Class>::value && is_size_available<Class>::value),
+                  "Cannot create a span given the provided class.");
+
+    Class& input = *static_cast<Class*>(container);
+    input.resize(newSize);
+
+    if constexpr (is_span_constructible<Class>::value)
+    {
+        return iDynTree::make_span(input);
+    }
+    else
+    {
+        return iDynTree::make_span(input.data(), input.size());
+    }
+}
+
 /**
  * @brief Utility function to create a GenericContainer::Vector from a reference to another vector.
  * @param input The refence to an existing vector.
@@ -716,7 +787,7 @@ make_vector(Class& input, VectorResizeMode mode = VectorResizeMode::Fixed)
     {
         if (mode == VectorResizeMode::Resizable)
         {
-            return Vector(span, DefaultVectorResizer(input));
+            return Vector(span, static_cast<void*>(&input), &DefaultContainerResizer<Class>);
         }
         else
         {
@@ -919,6 +990,8 @@ public:
     {
         m_span = other.m_span;
         m_resizeLambda = other.m_resizeLambda;
+        m_container = other.m_container;
+        m_resizeCallback = other.m_resizeCallback;
     }
 
     /**
@@ -929,6 +1002,8 @@ public:
     {
         m_span = other.m_span;
         m_resizeLambda = other.m_resizeLambda;
+        m_container = other.m_container;
+        m_resizeCallback = other.m_resizeCallback;
     }
 
     /**
@@ -939,6 +1014,8 @@ public:
     {
         m_span = other.m_span;
         m_resizeLambda = other.m_resizeLambda;
+        m_container = other.m_container;
+        m_resizeCallback = other.m_resizeCallback;
     }
 
     /**
@@ -953,6 +1030,8 @@ public:
     {
         m_span = other.m_span;
         m_resizeLambda = other.m_resizeLambda;
+        m_container = other.m_container;
+        m_resizeCallback = other.m_resizeCallback;
     }
 
     /**
@@ -981,14 +1060,9 @@ public:
 
         if constexpr (BipedalLocomotion::is_resizable<Vector>::value)
         {
-            m_resizeLambda = DefaultVectorResizer(input);
+            m_container = static_cast<void*>(&input);
+            m_resizeCallback = &DefaultContainerResizer<Vector>;
         }
-        else
-        {
-            iDynTree::Span<T> copiedSpan = m_span;
-            m_resizeLambda = [copiedSpan](index_type size){unused(size); return copiedSpan;};
-        }
-
     }
 
     /**
@@ -1012,10 +1086,6 @@ public:
         {
             m_span = iDynTree::make_span(input.data(), input.size());
         }
-
-        iDynTree::Span<T> copiedSpan = m_span;
-        m_resizeLambda = [copiedSpan](index_type size){unused(size); return copiedSpan;};
-
     }
 
     /**
@@ -16,6 +16,7 @@
 #include <string>
 #include <Eigen/Core>
 
+#include <BipedalLocomotion/GenericContainer/SmallVector.h>
 #include <BipedalLocomotion/GenericContainer/Vector.h>
 
 using namespace BipedalLocomotion;
@@ -709,4 +710,56 @@ TEST_CASE("GenericContainer::Vector")
         }
     }
 
+    SECTION("Resize through Ref")
+    {
+        std::vector<double> vec;
+        GenericContainer::Vector<double>::Ref ref(vec);
+        REQUIRE(ref.resizeVector(4));
+        REQUIRE(vec.size() == 4);
+
+        // the copy of a Ref resizes the original container
+        GenericContainer::Vector<double>::Ref copiedRef(ref);
+        REQUIRE(copiedRef.resizeVector(7));
+        REQUIRE(vec.size() == 7);
+        REQUIRE(copiedRef.data() == vec.data());
+
+        const std::vector<double>& cvec = vec;
+        GenericContainer::Vector<const double>::Ref constRef(cvec);
+        REQUIRE_FALSE(constRef.resizeVector(2));
+        REQUIRE(vec.size() == 7);
+    }
+
+    SECTION("Small vector")
+    {
+        GenericContainer::SmallVector<double, 3> vec{1.0, 2.0};
+        REQUIRE(GenericContainer::is_vector_constructible<GenericContainer::SmallVector<double, 3>>::value);
+        REQUIRE(vec.isInline());
+
+        GenericContainer::Vector<double>::Ref ref(vec);
+        REQUIRE(ref.size() == 2);
+        REQUIRE(ref.data() == vec.data());
+
+        std::vector<double> input{3.0, 4.0, 5.0};
+        ref = input;
+        REQUIRE(vec.isInline());
+        REQUIRE(vec.size() == 3);
+        REQUIRE(vec[2] == 5.0);
+
+        // the elements are moved to the heap when the size exceeds the inline capacity
+        input.push_back(6.0);
+        ref = input;
+        REQUIRE_FALSE(vec.isInline());
+        REQUIRE(vec.size() == 4);
+        REQUIRE(ref.data() == vec.data());
+        for (std::size_t i = 0; i < input.size(); ++i)
+        {
+            REQUIRE(vec[i] == input[i]);
+        }
+
+        GenericContainer::Vector container = GenericContainer::make_vector(vec, GenericContainer::VectorResizeMode::Resizable);
+        REQUIRE(container.resizeVector(1));
+        REQUIRE(vec.size() == 1);
+        REQUIRE(vec[0] == 3.0);
+    }
+
 }
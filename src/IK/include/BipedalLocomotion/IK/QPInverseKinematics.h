@@ -301,6 +301,13 @@ public:
      * @return a vector containing the solution of the optimization problem
      */
     Eigen::Ref<const Eigen::VectorXd> getRawSolution() const override;
+
+    /**
+     * Get the time spent updating the tasks, assembling the QP problem and solving it in the last
+     * call of advance.
+     * @return the timings of the last advance.
+     */
+    System::LinearTaskSolverTimings getTimings() const override;
 };
 } // namespace IK
 } // namespace BipedalLocomotion
@@ -5,6 +5,7 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <chrono>
 #include <cstddef>
 #include <memory>
 
@@ -53,6 +54,8 @@ struct QPInverseKinematics::Impl
     Eigen::VectorXd lowerBound;
     Eigen::VectorXd upperBound;
 
+    System::LinearTaskSolverTimings timings; /**< Timings of the last advance. */
+
     bool isFirstIteration{true};
     bool isValid{false};
     bool isInitialized{false};
@@ -425,6 +428,8 @@ bool QPInverseKinematics::advance()
         return false;
     }
 
+    const auto tasksUpdateStart = std::chrono::steady_clock::now();
+
     // update of all the tasks
     for (auto& [name, task] : m_pimpl->tasks)
     {
@@ -438,6 +443,8 @@ bool QPInverseKinematics::advance()
         assert(task.task->isValid() && "One of the task is not valid.");
     }
 
+    const auto problemAssemblyStart = std::chrono::steady_clock::now();
+
     // Compute the gradient and the hessian
     m_pimpl->hessian.setZero();
     m_pimpl->gradient.setZero();
@@ -490,6 +497,8 @@ bool QPInverseKinematics::advance()
         index += constraint.get().task->size();
     }
 
+    const auto problemSolutionStart = std::chrono::steady_clock::now();
+
     // update the solver
     if (!m_pimpl->isFirstIteration)
     {
@@ -527,6 +536,11 @@ bool QPInverseKinematics::advance()
         log()->debug("{} The solver found an inaccurate feasible solution.", logPrefix);
     }
 
+    const auto problemSolutionEnd = std::chrono::steady_clock::now();
+    m_pimpl->timings.tasksUpdate = problemAssemblyStart - tasksUpdateStart;
+    m_pimpl->timings.problemAssembly = problemSolutionStart - problemAssemblyStart;
+    m_pimpl->timings.problemSolution = problemSolutionEnd - problemSolutionStart;
+
     // retrieve the solution
     constexpr std::size_t spatialVelocitySize = 6;
     const std::size_t joints = m_pimpl->robotVelocityVariable.size - spatialVelocitySize;
@@ -624,6 +638,11 @@ Eigen::Ref<const Eigen::VectorXd> QPInverseKinematics::getRawSolution() const
     return m_pimpl->solver.getSolution();
 }
 
+System::LinearTaskSolverTimings QPInverseKinematics::getTimings() const
+{
+    return m_pimpl->timings;
+}
+
 IntegrationBasedIKProblem
 QPInverseKinematics::build(std::weak_ptr<const ParametersHandler::IParametersHandler> handler,
                            std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
@@ -11,6 +11,7 @@
 #include <Eigen/Dense>
 
 #include <memory>
+#include <vector>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 
@@ -27,6 +28,12 @@ namespace Math
  * @note This class implements the algorithm presented in the paper: Solving the algebraic
  * Riccati equation with the matrix sign function
  * https://www.sciencedirect.com/science/article/pii/0024379587902229
+ * @note When the matrices change slightly between two calls (e.g. when the LQR gains are
+ * recomputed online), the previous solution can be refined with the Newton-Kleinman iterations
+ * presented in: D. Kleinman, On an iterative technique for Riccati equation computations, IEEE
+ * Transactions on Automatic Control, 1968. Each iteration solves a Lyapunov equation with the
+ * Bartels-Stewart algorithm and it usually converges in a few iterations. If the initial guess does
+ * not stabilize the system, the solver falls back to the matrix sign function.
  */
 class CARE
 {
@@ -38,6 +45,17 @@ class CARE
 
 public:
 
+    /**
+     * Matrices defining a continuous algebraic Riccati equation. See CARE::setMatrices.
+     */
+    struct Matrices
+    {
+        Eigen::MatrixXd A; /**< n x n square matrix. */
+        Eigen::MatrixXd B; /**< n x m matrix. */
+        Eigen::MatrixXd Q; /**< n x n symmetric-square matrix. */
+        Eigen::MatrixXd R; /**< m x m square positive definite matrix. */
+    };
+
     /**
      * Initialize the continuous algebraic riccati equation solver.
      * @param handler pointer to the parameter handler.
@@ -47,6 +65,7 @@ public:
      * |    `tolerance`   |  `double` |               Tolerance of the solution (default value `1e-9`)               |     No    |
      * |   `is_verbose`   | `boolean` | If `true` the algorithm will print some information (default value `false`)  |     No    |
      * | `max_iterations` |   `int`   |   Max number of the interation used by the algorithm (default value `100`)   |     No    |
+     * |   `warm_start`   | `boolean` |  If `true` solve() starts from the previous solution (default value `false`)  |     No    |
      * @return true in case of success/false otherwise.
      */
     bool initialize(std::weak_ptr<ParametersHandler::IParametersHandler> handler);
@@ -68,9 +87,38 @@ public:
      * Run the algorithm to compute the unique stabilizing solution of the continuous algebriac
      * Riccati equation.
      * @return True in case of success and false otherwise.
+     * @note If `warm_start` is enabled and a solution has been already computed, the previous
+     * solution is used as initial guess of the Newton-Kleinman iterations.
      */
     bool solve();
 
+    /**
+     * Compute the unique stabilizing solution of the continuous algebriac Riccati equation using
+     * the Newton-Kleinman iterations.
+     * @param initialGuess n x n symmetric matrix used as initial guess. The gain
+     * \f$R^{-1} B^\top S\f$ computed with the initial guess should stabilize the system.
+     * Otherwise, the solution is computed with the matrix sign function.
+     * @return True in case of success and false otherwise.
+     */
+    bool solve(Eigen::Ref<const Eigen::MatrixXd> initialGuess);
+
+    /**
+     * Solve a set of continuous algebraic Riccati equations in parallel. This can be used to
+     * precompute the gains of a controller on a grid of operating points (gain scheduling).
+     * @param problems vector containing the matrices of each equation.
+     * @param solutions vector containing the solution of each equation.
+     * @param numberOfThreads number of threads. If zero, the number of concurrent threads
+     * supported by the hardware is used.
+     * @return True if all the equations have been solved and false otherwise.
+     * @note The problems are split in contiguous chunks, one for each thread. Each solution is used
+     * to warm start the next problem of the same chunk. Hence, it is convenient to sort the
+     * problems so that consecutive problems are close to each other. The parameters of the solver
+     * are the ones set with initialize().
+     */
+    bool solveBatch(const std::vector<Matrices>& problems,
+                    std::vector<Eigen::MatrixXd>& solutions,
+                    std::size_t numberOfThreads = 0) const;
+
     /**
      * Get the solution.
      * @return the solution
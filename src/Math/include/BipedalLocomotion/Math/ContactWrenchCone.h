@@ -11,6 +11,7 @@
 #include <memory>
 
 #include <Eigen/Dense>
+#include <Eigen/SparseCore>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 
@@ -52,6 +53,10 @@ namespace Math
  * \f]
  * where \f$I\f$ and \f$B\f$ are the inertial and the frame attached to the contact surface
  * respectively.
+ * @note The matrices are computed only once for each set of parameters (friction coefficient,
+ * number of slices and foot limits), and they are shared among all the cones having the same
+ * parameters. Use computeRotatedA to get the constraint in mixed representation without
+ * allocating memory.
  * @note If you want to specify only the constraints related to the contact force please take a look
  * at LinearizedFrictionCone class.
  * @warning ContactWrenchCone class does not consider the unilaterally constraint of the normal
@@ -59,8 +64,25 @@ namespace Math
  */
 class ContactWrenchCone
 {
-    Eigen::MatrixXd m_A;
-    Eigen::VectorXd m_b;
+public:
+    /**
+     * Constraints \f$ A w \le b \f$ describing the cone.
+     */
+    struct Constraints
+    {
+        Eigen::MatrixXd A;
+        Eigen::VectorXd b;
+
+        /** Columns of A associated to the force, stored as a sparse matrix. */
+        Eigen::SparseMatrix<double, Eigen::RowMajor> linearA;
+
+        /** Columns of A associated to the torque, stored as a sparse matrix. */
+        Eigen::SparseMatrix<double, Eigen::RowMajor> angularA;
+    };
+
+private:
+    /** Constraints of the cone. They are shared by all the cones having the same parameters. */
+    std::shared_ptr<const Constraints> m_constraints;
 
     bool m_isIntialized{false}; /**< True if the class has been correctly initialize */
 
@@ -91,6 +113,19 @@ public:
      * @return the matrix B..
      */
     Eigen::Ref<const Eigen::VectorXd> getB() const;
+
+    /**
+     * Compute the matrix A associated to a wrench expressed in mixed representation, i.e.
+     * \f$ A \text{blkdiag}({}^I R _ B ^\top, {}^I R _ B ^\top) \f$. The product exploits the
+     * sparsity of A, e.g. the rows related to the friction cone do not depend on the torque.
+     * @param rotation rotation matrix \f${}^I R _ B\f$ between the inertial frame \f$I\f$ and the
+     * frame \f$B\f$ attached to the contact surface.
+     * @param A matrix where the result is stored. It can be a block of a larger matrix, e.g. of
+     * the constraint matrix of a solver. Its size must be equal to the one of getA().
+     * @return true in case of success/false otherwise.
+     */
+    bool computeRotatedA(Eigen::Ref<const Eigen::Matrix3d> rotation,
+                         Eigen::Ref<Eigen::MatrixXd> A) const;
 };
 
 } // namespace Math
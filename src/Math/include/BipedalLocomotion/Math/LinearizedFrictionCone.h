@@ -29,11 +29,24 @@ namespace Math
  * the tangential force to the contact surface and \f$ \mu \f$ is the friction parameter.
  * The LinearizedFrictionCone aims to compute the polyhedral approximation of \f$ | f ^t | \le \mu f^c \cdot n \f$
  * by spitting the base of the cone into slices.
+ * @note The matrices are computed only once for each pair of friction coefficient and number of
+ * slices, and they are shared among all the cones having the same parameters.
  */
 class LinearizedFrictionCone
 {
-    Eigen::MatrixXd m_A;
-    Eigen::VectorXd m_b;
+public:
+    /**
+     * Constraints \f$ A f \le b \f$ describing the cone.
+     */
+    struct Constraints
+    {
+        Eigen::MatrixXd A;
+        Eigen::VectorXd b;
+    };
+
+private:
+    /** Constraints of the cone. They are shared by all the cones having the same parameters. */
+    std::shared_ptr<const Constraints> m_constraints;
 
     bool m_isIntialized{false}; /**< True if the class has been correctly initialize */
 
@@ -62,6 +75,18 @@ public:
      * @return the matrix B..
      */
     Eigen::Ref<const Eigen::VectorXd> getB() const;
+
+    /**
+     * Compute the matrix A associated to a force expressed in a frame rotated with respect to the
+     * frame attached to the contact surface, i.e. \f$ A {}^I R _ B ^\top \f$.
+     * @param rotation rotation matrix \f${}^I R _ B\f$ between the frame \f$I\f$ used to express
+     * the force and the frame \f$B\f$ attached to the contact surface.
+     * @param A matrix where the result is stored. It can be a block of a larger matrix, e.g. of
+     * the constraint matrix of a solver. Its size must be equal to the one of getA().
+     * @return true in case of success/false otherwise.
+     */
+    bool computeRotatedA(Eigen::Ref<const Eigen::Matrix3d> rotation,
+                         Eigen::Ref<Eigen::MatrixXd> A) const;
 };
 
 } // namespace Math
@@ -5,8 +5,14 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <complex>
 #include <iostream>
 #include <sstream>
+#include <thread>
+
+#include <Eigen/Eigenvalues>
 
 #include <BipedalLocomotion/Math/CARE.h>
 
@@ -17,12 +23,16 @@ struct CARE::Impl
     double tolerance{1e-9};
     bool isVerbose{false};
     int maxIterations{100};
+    bool warmStart{false};
 
     Eigen::MatrixXd A;
     Eigen::MatrixXd B;
     Eigen::MatrixXd Q;
     Eigen::MatrixXd R;
 
+    Eigen::LLT<Eigen::MatrixXd> RCholesky; /**< Cholesky decomposition of R. */
+    Eigen::MatrixXd BRInverseBt; /**< B inv(R) B'. */
+
     Eigen::MatrixXd lhs;
     Eigen::MatrixXd rhs;
     Eigen::MatrixXd Z;
@@ -31,11 +41,32 @@ struct CARE::Impl
 
     Eigen::MatrixXd identity;
     Eigen::MatrixXd solution;
+    bool isSolutionValid{false};
+
+    // quantities used by the Newton-Kleinman iterations
+    Eigen::MatrixXd closedLoopA;
+    Eigen::MatrixXd lyapunovConstant;
+    Eigen::MatrixXd solutionOld;
+    Eigen::ComplexSchur<Eigen::MatrixXd> schur;
+    Eigen::MatrixXcd lowerT;
+    Eigen::MatrixXcd F;
+    Eigen::MatrixXcd Y;
+
+    bool solveMatrixSign();
+    bool solveNewtonKleinman(Eigen::Ref<const Eigen::MatrixXd> initialGuess);
+    bool solveLyapunov();
 
     void resizeInteralMatrices()
     {
         const std::size_t n = B.rows();
 
+        closedLoopA.resize(n, n);
+        lyapunovConstant.resize(n, n);
+        solutionOld.resize(n, n);
+        lowerT.resize(n, n);
+        F.resize(n, n);
+        Y.resize(n, n);
+
         // resize the Hamiltonian matrix
         Z.resize(2 * n, 2 * n);
         ZOld.resize(2 * n, 2 * n);
@@ -66,6 +97,7 @@ bool CARE::initialize(std::weak_ptr<ParametersHandler::IParametersHandler> handl
     ptr->getParameter("tolerance", m_pimpl->tolerance);
     ptr->getParameter("is_verbose", m_pimpl->isVerbose);
     ptr->getParameter("max_iterations", m_pimpl->maxIterations);
+    ptr->getParameter("warm_start", m_pimpl->warmStart);
 
     return true;
 }
@@ -114,22 +146,21 @@ bool CARE::setMatrices(Eigen::Ref<const Eigen::MatrixXd> A,
     m_pimpl->Q = Q;
     m_pimpl->R = R;
 
+    // the decomposition of R is computed once and reused by all the calls of solve
+    m_pimpl->RCholesky.compute(m_pimpl->R);
+    if (m_pimpl->RCholesky.info() == Eigen::Success)
+    {
+        m_pimpl->BRInverseBt = m_pimpl->B * m_pimpl->RCholesky.solve(m_pimpl->B.transpose());
+    }
+
     m_pimpl->resizeInteralMatrices();
 
     return true;
 }
 
-bool CARE::solve()
+bool CARE::Impl::solveMatrixSign()
 {
-    const std::size_t n = m_pimpl->A.rows();
-
-    // compute cholesky decomposition
-    Eigen::LLT<Eigen::MatrixXd> R_cholesky(m_pimpl->R);
-    if (R_cholesky.info() != Eigen::Success)
-    {
-        std::cerr << "[CARE::solve] The matrix R must be positive definite." << std::endl;
-        return false;
-    }
+    const std::size_t n = A.rows();
 
     // Z represents the Hamiltonian matrix.
     //       _                _
@@ -137,58 +168,258 @@ bool CARE::solve()
     // Z  = |                  |
     //      |_Q       -  A'   _|
 
-    m_pimpl->Z.block(0, 0, n, n) = m_pimpl->A;
-    m_pimpl->Z.block(0, n, n, n) = m_pimpl->B * R_cholesky.solve(m_pimpl->B.transpose());
-    m_pimpl->Z.block(n, 0, n, n) = m_pimpl->Q;
-    m_pimpl->Z.block(n, n, n, n) = -m_pimpl->A.transpose();
+    Z.block(0, 0, n, n) = A;
+    Z.block(0, n, n, n) = BRInverseBt;
+    Z.block(n, 0, n, n) = Q;
+    Z.block(n, n, n, n) = -A.transpose();
 
-    double relativeNorm = m_pimpl->tolerance;
+    double relativeNorm = tolerance;
     std::size_t iteration = 0;
-    const double p = static_cast<double>(m_pimpl->Z.rows());
+    const double p = static_cast<double>(Z.rows());
 
     // run the algorithm
-    for (; iteration < m_pimpl->maxIterations && relativeNorm >= m_pimpl->tolerance; iteration++)
+    for (; iteration < maxIterations && relativeNorm >= tolerance; iteration++)
     {
-        m_pimpl->ZOld = m_pimpl->Z;
+        ZOld = Z;
 
         // R. Byers. Solving the algebraic Riccati equation with the matrix sign
         // function. Linear Algebra Appl., 85:267–279, 1987
         // Added determinant scaling to improve convergence (converges in rough half
         // the iterations with this)
-        const double ck = std::pow(std::abs(m_pimpl->Z.determinant()), -1.0 / p);
-        m_pimpl->Z *= ck;
-        m_pimpl->ZInverse = m_pimpl->Z.inverse();
-        m_pimpl->Z = m_pimpl->Z - 0.5 * (m_pimpl->Z - m_pimpl->ZInverse);
-        relativeNorm = (m_pimpl->Z - m_pimpl->ZOld).norm();
+        const double ck = std::pow(std::abs(Z.determinant()), -1.0 / p);
+        Z *= ck;
+        ZInverse = Z.inverse();
+        Z = Z - 0.5 * (Z - ZInverse);
+        relativeNorm = (Z - ZOld).norm();
+    }
+
+    Eigen::Ref<const Eigen::MatrixXd> W11 = Z.block(0, 0, n, n);
+    Eigen::Ref<const Eigen::MatrixXd> W12 = Z.block(0, n, n, n);
+    Eigen::Ref<const Eigen::MatrixXd> W21 = Z.block(n, 0, n, n);
+    Eigen::Ref<const Eigen::MatrixXd> W22 = Z.block(n, n, n, n);
+
+    lhs.topRows(n) = W12;
+    lhs.bottomRows(n) = W22 + identity;
+    rhs.topRows(n) = W11 + identity;
+    rhs.bottomRows(n) = W21;
+
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(lhs, Eigen::ComputeThinU | Eigen::ComputeThinV);
+    solution = svd.solve(rhs);
+
+    if (isVerbose)
+    {
+        std::stringstream info;
+        if (relativeNorm < tolerance)
+            info << "Solution found.";
+        else
+            info << "Solution not found.";
+        info << std::endl;
+        info << "Number of iteration: " << iteration << ". Relative error: " << relativeNorm << ".";
+
+        std::cout << "[CARE::Impl::solveMatrixSign] " << info.str() << std::endl;
+    }
+
+    return relativeNorm < tolerance;
+}
+
+bool CARE::Impl::solveLyapunov()
+{
+    // The Lyapunov equation closedLoopA' X + X closedLoopA + lyapunovConstant = 0 is solved with the
+    // Bartels-Stewart algorithm. Given the Schur decomposition closedLoopA = U T U^*, the equation
+    // becomes T^* Y + Y T = -F, with Y = U^* X U and F = U^* lyapunovConstant U. Since T is upper
+    // triangular, Y is computed column by column solving lower triangular systems.
+    const Eigen::Index n = closedLoopA.rows();
+
+    schur.compute(closedLoopA);
+    if (schur.info() != Eigen::Success)
+    {
+        return false;
+    }
+
+    const Eigen::MatrixXcd& T = schur.matrixT();
+    const Eigen::MatrixXcd& U = schur.matrixU();
+
+    // the closed loop system must be asymptotically stable, otherwise the equation may not have a
+    // unique solution and the iterations do not converge
+    for (Eigen::Index i = 0; i < n; i++)
+    {
+        if (T(i, i).real() >= 0)
+        {
+            return false;
+        }
     }
 
-    Eigen::Ref<const Eigen::MatrixXd> W11 = m_pimpl->Z.block(0, 0, n, n);
-    Eigen::Ref<const Eigen::MatrixXd> W12 = m_pimpl->Z.block(0, n, n, n);
-    Eigen::Ref<const Eigen::MatrixXd> W21 = m_pimpl->Z.block(n, 0, n, n);
-    Eigen::Ref<const Eigen::MatrixXd> W22 = m_pimpl->Z.block(n, n, n, n);
+    Y = lyapunovConstant.cast<std::complex<double>>();
+    F.noalias() = U.adjoint() * Y;
+    Y.noalias() = F * U;
+    F = Y;
+
+    lowerT = T.adjoint();
+    for (Eigen::Index j = 0; j < n; j++)
+    {
+        Y.col(j) = -F.col(j);
+        if (j > 0)
+        {
+            Y.col(j).noalias() -= Y.leftCols(j) * T.col(j).head(j);
+        }
+
+        lowerT.diagonal().array() += T(j, j);
+        lowerT.triangularView<Eigen::Lower>().solveInPlace(Y.col(j));
+        lowerT.diagonal().array() -= T(j, j);
+    }
+
+    F.noalias() = U * Y;
+    Y.noalias() = F * U.adjoint();
+    solution = Y.real();
+
+    // remove the numerical asymmetry
+    solution = 0.5 * (solution + solution.transpose()).eval();
+
+    return true;
+}
 
-    m_pimpl->lhs.topRows(n) = W12;
-    m_pimpl->lhs.bottomRows(n) = W22 + m_pimpl->identity;
-    m_pimpl->rhs.topRows(n) = W11 + m_pimpl->identity;
-    m_pimpl->rhs.bottomRows(n) = W21;
+bool CARE::Impl::solveNewtonKleinman(Eigen::Ref<const Eigen::MatrixXd> initialGuess)
+{
+    solution = initialGuess;
+    double relativeNorm = tolerance;
+    int iteration = 0;
 
-    Eigen::JacobiSVD<Eigen::MatrixXd> svd(m_pimpl->lhs, Eigen::ComputeThinU | Eigen::ComputeThinV);
-    m_pimpl->solution = svd.solve(m_pimpl->rhs);
+    for (; iteration < maxIterations && relativeNorm >= tolerance; iteration++)
+    {
+        // Given the gain K = inv(R) B' S, each iteration solves the Lyapunov equation
+        // (A - B K)' S + S (A - B K) + Q + K' R K = 0
+        solutionOld = solution;
+        closedLoopA = A;
+        closedLoopA.noalias() -= BRInverseBt * solutionOld;
+        lyapunovConstant = Q;
+        lyapunovConstant.noalias() += solutionOld * BRInverseBt * solutionOld;
+
+        if (!solveLyapunov())
+        {
+            if (isVerbose)
+            {
+                std::cout << "[CARE::Impl::solveNewtonKleinman] The initial guess does not "
+                             "stabilize the system."
+                          << std::endl;
+            }
+            return false;
+        }
+
+        relativeNorm = (solution - solutionOld).norm();
+    }
 
-    if (m_pimpl->isVerbose)
+    if (isVerbose)
     {
         std::stringstream info;
-        if (relativeNorm < m_pimpl->tolerance)
+        if (relativeNorm < tolerance)
             info << "Solution found.";
         else
             info << "Solution not found.";
         info << std::endl;
         info << "Number of iteration: " << iteration << ". Relative error: " << relativeNorm << ".";
 
-        std::cout << "[CARE::solve] " << info.str() << std::endl;
+        std::cout << "[CARE::Impl::solveNewtonKleinman] " << info.str() << std::endl;
+    }
+
+    return relativeNorm < tolerance;
+}
+
+bool CARE::solve()
+{
+    const Eigen::Index n = m_pimpl->A.rows();
+    if (m_pimpl->warmStart && m_pimpl->isSolutionValid && m_pimpl->solution.rows() == n
+        && m_pimpl->solution.cols() == n)
+    {
+        return this->solve(m_pimpl->solution);
+    }
+
+    if (m_pimpl->RCholesky.info() != Eigen::Success)
+    {
+        std::cerr << "[CARE::solve] The matrix R must be positive definite." << std::endl;
+        return false;
+    }
+
+    m_pimpl->isSolutionValid = m_pimpl->solveMatrixSign();
+    return m_pimpl->isSolutionValid;
+}
+
+bool CARE::solve(Eigen::Ref<const Eigen::MatrixXd> initialGuess)
+{
+    constexpr std::string_view errorPrefix = "[CARE::solve] ";
+
+    const Eigen::Index n = m_pimpl->A.rows();
+    if (initialGuess.rows() != n || initialGuess.cols() != n)
+    {
+        std::cerr << errorPrefix << "The initial guess must be a square matrix. Expected size: "
+                  << n << " x " << n << ". Passed size: " << initialGuess.rows() << " x "
+                  << initialGuess.cols() << "." << std::endl;
+        return false;
+    }
+
+    if (m_pimpl->RCholesky.info() != Eigen::Success)
+    {
+        std::cerr << errorPrefix << "The matrix R must be positive definite." << std::endl;
+        return false;
+    }
+
+    m_pimpl->isSolutionValid = m_pimpl->solveNewtonKleinman(initialGuess)
+                               || m_pimpl->solveMatrixSign();
+    return m_pimpl->isSolutionValid;
+}
+
+bool CARE::solveBatch(const std::vector<Matrices>& problems,
+                      std::vector<Eigen::MatrixXd>& solutions,
+                      std::size_t numberOfThreads) const
+{
+    solutions.resize(problems.size());
+    if (problems.empty())
+    {
+        return true;
+    }
+
+    if (numberOfThreads == 0)
+    {
+        numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numberOfThreads = std::min(numberOfThreads, problems.size());
+
+    std::atomic<bool> ok{true};
+    auto solveChunk = [&](std::size_t begin, std::size_t end) {
+        CARE care;
+        care.m_pimpl->tolerance = m_pimpl->tolerance;
+        care.m_pimpl->isVerbose = m_pimpl->isVerbose;
+        care.m_pimpl->maxIterations = m_pimpl->maxIterations;
+        care.m_pimpl->warmStart = true;
+
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const Matrices& problem = problems[i];
+            if (!care.setMatrices(problem.A, problem.B, problem.Q, problem.R) || !care.solve())
+            {
+                std::cerr << "[CARE::solveBatch] Unable to solve the problem number " << i << "."
+                          << std::endl;
+                ok = false;
+                continue;
+            }
+            solutions[i] = care.getSolution();
+        }
+    };
+
+    // the main thread solves the first chunk
+    const std::size_t chunkSize = (problems.size() + numberOfThreads - 1) / numberOfThreads;
+    std::vector<std::thread> threads;
+    for (std::size_t begin = chunkSize; begin < problems.size(); begin += chunkSize)
+    {
+        threads.emplace_back(solveChunk, begin, std::min(begin + chunkSize, problems.size()));
+    }
+    solveChunk(0, std::min(chunkSize, problems.size()));
+
+    for (auto& thread : threads)
+    {
+        thread.join();
     }
 
-    return relativeNorm < m_pimpl->tolerance;
+    return ok;
 }
 
 Eigen::Ref<const Eigen::MatrixXd> CARE::getSolution() const
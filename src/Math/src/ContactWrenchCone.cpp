@@ -5,8 +5,12 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <array>
 #include <cmath>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <tuple>
 
 #include <manif/manif.h>
 
@@ -17,40 +21,17 @@
 
 using namespace BipedalLocomotion::Math;
 
-bool ContactWrenchCone::initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+namespace
+{
+std::shared_ptr<const ContactWrenchCone::Constraints>
+computeConstraints(const LinearizedFrictionCone& forceCone,
+                   double staticFrictionCoefficient,
+                   const std::vector<double>& limitsX,
+                   const std::vector<double>& limitsY)
 {
-    constexpr auto errorPrefix = "[ContactWrenchCone::initialize]";
     constexpr int wrenchSize = Wrench<double>::SizeAtCompileTime;
 
-    LinearizedFrictionCone forceCone;
-
-    auto ptr = handler.lock();
-    if (ptr == nullptr)
-    {
-        log()->error("{} Invalid parameter handler.", errorPrefix);
-        return false;
-    }
-
-    double staticFrictionCoefficient = -1;
-    bool ok =  ptr->getParameter("static_friction_coefficient", staticFrictionCoefficient);
-    ok = ok && staticFrictionCoefficient > 0;
-
-    std::vector<double> limitsX, limitsY;
-    ok = ok && ptr->getParameter("foot_limits_x", limitsX);
-    ok = ok && ptr->getParameter("foot_limits_y", limitsY);
-    ok = ok && (limitsX.size() == limitsY.size()) && (limitsX.size() == 2);
-
-    if (!ok)
-    {
-        log()->error("{} Unable to retrieve all the parameters.", errorPrefix);
-        return false;
-    }
-
-    if(!forceCone.initialize(handler))
-    {
-        log()->error("{} Unable to initialize the force friction cone.", errorPrefix);
-        return false;
-    }
+    auto constraints = std::make_shared<ContactWrenchCone::Constraints>();
 
     Eigen::Vector3d center;
     center << std::accumulate(limitsX.begin(), limitsX.end(), 0.0) / limitsX.size(),
@@ -63,13 +44,13 @@ bool ContactWrenchCone::initialize(std::weak_ptr<const ParametersHandler::IParam
     constexpr std::size_t copConstraints = 2;
     constexpr std::size_t yawTorqueConstraints = 8;
     constexpr std::size_t torqueConstraints = 2 * copConstraints + yawTorqueConstraints;
-    m_A.resize(forceCone.getB().size() + torqueConstraints, wrenchSize);
-    m_A.setZero();
-    m_A.topLeftCorner(forceCone.getA().rows(), forceCone.getA().cols()) = forceCone.getA();
+    constraints->A.resize(forceCone.getB().size() + torqueConstraints, wrenchSize);
+    constraints->A.setZero();
+    constraints->A.topLeftCorner(forceCone.getA().rows(), forceCone.getA().cols()) = forceCone.getA();
 
     // take the lower part of the matrix A
     // this should simplify
-    Eigen::Ref<Eigen::MatrixXd> ACoP = m_A.middleRows(forceCone.getB().size(), 2 * copConstraints);
+    Eigen::Ref<Eigen::MatrixXd> ACoP = constraints->A.middleRows(forceCone.getB().size(), 2 * copConstraints);
     ACoP(0, 2) = limitsY[0];
     ACoP(1, 2) = -limitsY[1];
     ACoP(0, 3) = -1;
@@ -122,11 +103,95 @@ bool ContactWrenchCone::initialize(std::weak_ptr<const ParametersHandler::IParam
         = Eigen::Matrix<double, wrenchSize, wrenchSize>::Identity();
     adjointTransform.bottomLeftCorner<3, 3>() = manif::skew(-center);
 
-    m_A.bottomRows(yawTorqueConstraints).noalias() = AYawTorque * adjointTransform;
+    constraints->A.bottomRows(yawTorqueConstraints).noalias() = AYawTorque * adjointTransform;
+
+    constraints->b.resize(constraints->A.rows());
+    constraints->b.head(forceCone.getB().size()) = forceCone.getB();
+    constraints->b.tail(torqueConstraints).setZero();
+
+    // store the sparse representation used to rotate the constraints
+    constexpr double sparsityTolerance = 0.0;
+    constraints->linearA = constraints->A.leftCols<3>().sparseView(1.0, sparsityTolerance);
+    constraints->angularA = constraints->A.rightCols<3>().sparseView(1.0, sparsityTolerance);
+    constraints->linearA.makeCompressed();
+    constraints->angularA.makeCompressed();
+
+    return constraints;
+}
+
+std::shared_ptr<const ContactWrenchCone::Constraints>
+getConstraints(int numberOfSlices,
+               double staticFrictionCoefficient,
+               const std::vector<double>& limitsX,
+               const std::vector<double>& limitsY,
+               std::weak_ptr<const BipedalLocomotion::ParametersHandler::IParametersHandler> handler)
+{
+    // the constraints are shared by all the cones having the same parameters. The cache does not
+    // own them, so they are deallocated when the last cone is destroyed.
+    using Key = std::tuple<int, double, std::array<double, 2>, std::array<double, 2>>;
+    static std::mutex mutex;
+    static std::map<Key, std::weak_ptr<const ContactWrenchCone::Constraints>> cache;
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    auto& cachedConstraints = cache[Key{numberOfSlices,
+                                        staticFrictionCoefficient,
+                                        {limitsX[0], limitsX[1]},
+                                        {limitsY[0], limitsY[1]}}];
+    auto constraints = cachedConstraints.lock();
+    if (constraints != nullptr)
+    {
+        return constraints;
+    }
+
+    LinearizedFrictionCone forceCone;
+    if (!forceCone.initialize(handler))
+    {
+        return nullptr;
+    }
+
+    constraints = computeConstraints(forceCone, staticFrictionCoefficient, limitsX, limitsY);
+    cachedConstraints = constraints;
+    return constraints;
+}
+} // namespace
+
+bool ContactWrenchCone::initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto errorPrefix = "[ContactWrenchCone::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} Invalid parameter handler.", errorPrefix);
+        return false;
+    }
 
-    m_b.resize(m_A.rows());
-    m_b.head(forceCone.getB().size()) = forceCone.getB();
-    m_b.tail(torqueConstraints).setZero();
+    int numberOfSlices = -1;
+    bool ok = ptr->getParameter("number_of_slices", numberOfSlices);
+    ok = ok && numberOfSlices > 0;
+
+    double staticFrictionCoefficient = -1;
+    ok = ok && ptr->getParameter("static_friction_coefficient", staticFrictionCoefficient);
+    ok = ok && staticFrictionCoefficient > 0;
+
+    std::vector<double> limitsX, limitsY;
+    ok = ok && ptr->getParameter("foot_limits_x", limitsX);
+    ok = ok && ptr->getParameter("foot_limits_y", limitsY);
+    ok = ok && (limitsX.size() == limitsY.size()) && (limitsX.size() == 2);
+
+    if (!ok)
+    {
+        log()->error("{} Unable to retrieve all the parameters.", errorPrefix);
+        return false;
+    }
+
+    m_constraints
+        = getConstraints(numberOfSlices, staticFrictionCoefficient, limitsX, limitsY, handler);
+    if (m_constraints == nullptr)
+    {
+        log()->error("{} Unable to initialize the force friction cone.", errorPrefix);
+        return false;
+    }
 
     m_isIntialized = true;
 
@@ -141,9 +206,12 @@ Eigen::Ref<const Eigen::MatrixXd> ContactWrenchCone::getA() const
     {
         log()->warn(error);
         assert(m_isIntialized && error);
+
+        static const Eigen::MatrixXd empty;
+        return empty;
     }
 
-    return m_A;
+    return m_constraints->A;
 }
 
 Eigen::Ref<const Eigen::VectorXd> ContactWrenchCone::getB() const
@@ -153,7 +221,37 @@ Eigen::Ref<const Eigen::VectorXd> ContactWrenchCone::getB() const
     {
         log()->warn(error);
         assert(m_isIntialized && error);
+
+        static const Eigen::VectorXd empty;
+        return empty;
+    }
+
+    return m_constraints->b;
+}
+
+bool ContactWrenchCone::computeRotatedA(Eigen::Ref<const Eigen::Matrix3d> rotation,
+                                        Eigen::Ref<Eigen::MatrixXd> A) const
+{
+    constexpr auto errorPrefix = "[ContactWrenchCone::computeRotatedA]";
+
+    if (!m_isIntialized)
+    {
+        log()->error("{} Please initialize the class before.", errorPrefix);
+        return false;
     }
 
-    return m_b;
+    if (A.rows() != m_constraints->A.rows() || A.cols() != m_constraints->A.cols())
+    {
+        log()->error("{} The size of the matrix A is {} x {}. Expected {} x {}.",
+                     errorPrefix,
+                     A.rows(),
+                     A.cols(),
+                     m_constraints->A.rows(),
+                     m_constraints->A.cols());
+        return false;
+    }
+
+    A.leftCols<3>().noalias() = m_constraints->linearA * rotation.transpose();
+    A.rightCols<3>().noalias() = m_constraints->angularA * rotation.transpose();
+    return true;
 }
@@ -6,44 +6,28 @@
  */
 
 #include <cmath>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #include <BipedalLocomotion/Math/LinearizedFrictionCone.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 using namespace BipedalLocomotion::Math;
 
-bool LinearizedFrictionCone::initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+namespace
+{
+std::shared_ptr<const LinearizedFrictionCone::Constraints>
+computeConstraints(int numberOfSlices, double staticFrictionCoefficient)
 {
-    constexpr auto errorPrefix = "[LinearizedFrictionCone::initialize]";
-
-    auto ptr = handler.lock();
-    if (ptr == nullptr)
-    {
-        log()->error("{} Invalid parameter handler.", errorPrefix);
-        return false;
-    }
-
-    bool ok = true;
-    int numberOfSlices = -1;
-    ok = ok && ptr->getParameter("number_of_slices", numberOfSlices);
-    ok = ok && numberOfSlices > 0;
-
-    double staticFrictionCoefficient = -1;
-    ok = ok && ptr->getParameter("static_friction_coefficient", staticFrictionCoefficient);
-    ok = ok && staticFrictionCoefficient > 0;
-
-    if (!ok)
-    {
-        log()->error("{} Unable to retrieve all the parameters.", errorPrefix);
-        return false;
-    }
-
     // split the friction cone into slices
     const double segmentAngle = M_PI / (2 * numberOfSlices);
     const int numberOfEquations = 4 * numberOfSlices;
 
-    m_A.resize(numberOfEquations, 3);
-    m_b = Eigen::VectorXd::Zero(numberOfEquations);
+    auto constraints = std::make_shared<LinearizedFrictionCone::Constraints>();
+    constraints->A.resize(numberOfEquations, 3);
+    constraints->b = Eigen::VectorXd::Zero(numberOfEquations);
 
     // evaluate friction cone constraint
     std::vector<double> angles;
@@ -75,10 +59,64 @@ bool LinearizedFrictionCone::initialize(std::weak_ptr<const ParametersHandler::I
             inequalityFactor = -1;
 
         //  A(i,:) = inequalityFactor.* [-angularCoefficients, 1, (-offsets*staticFrictionCoefficient)];
-        m_A.row(i) << -inequalityFactor * angularCoefficients, inequalityFactor,
+        constraints->A.row(i) << -inequalityFactor * angularCoefficients, inequalityFactor,
             -inequalityFactor * offset * staticFrictionCoefficient;
     }
 
+    return constraints;
+}
+
+std::shared_ptr<const LinearizedFrictionCone::Constraints>
+getConstraints(int numberOfSlices, double staticFrictionCoefficient)
+{
+    // the constraints are shared by all the cones having the same parameters. The cache does not
+    // own them, so they are deallocated when the last cone is destroyed.
+    static std::mutex mutex;
+    static std::map<std::pair<int, double>,
+                    std::weak_ptr<const LinearizedFrictionCone::Constraints>>
+        cache;
+
+    const std::lock_guard<std::mutex> lock(mutex);
+    auto& cachedConstraints = cache[{numberOfSlices, staticFrictionCoefficient}];
+    auto constraints = cachedConstraints.lock();
+    if (constraints == nullptr)
+    {
+        constraints = computeConstraints(numberOfSlices, staticFrictionCoefficient);
+        cachedConstraints = constraints;
+    }
+
+    return constraints;
+}
+} // namespace
+
+bool LinearizedFrictionCone::initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto errorPrefix = "[LinearizedFrictionCone::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} Invalid parameter handler.", errorPrefix);
+        return false;
+    }
+
+    bool ok = true;
+    int numberOfSlices = -1;
+    ok = ok && ptr->getParameter("number_of_slices", numberOfSlices);
+    ok = ok && numberOfSlices > 0;
+
+    double staticFrictionCoefficient = -1;
+    ok = ok && ptr->getParameter("static_friction_coefficient", staticFrictionCoefficient);
+    ok = ok && staticFrictionCoefficient > 0;
+
+    if (!ok)
+    {
+        log()->error("{} Unable to retrieve all the parameters.", errorPrefix);
+        return false;
+    }
+
+    m_constraints = getConstraints(numberOfSlices, staticFrictionCoefficient);
+
     m_isIntialized = true;
 
     return true;
@@ -92,9 +130,12 @@ Eigen::Ref<const Eigen::MatrixXd> LinearizedFrictionCone::getA() const
     {
         log()->warn(error);
         assert(m_isIntialized && error);
+
+        static const Eigen::MatrixXd empty;
+        return empty;
     }
 
-    return m_A;
+    return m_constraints->A;
 }
 
 Eigen::Ref<const Eigen::VectorXd> LinearizedFrictionCone::getB() const
@@ -104,7 +145,36 @@ Eigen::Ref<const Eigen::VectorXd> LinearizedFrictionCone::getB() const
     {
         log()->warn(error);
         assert(m_isIntialized && error);
+
+        static const Eigen::VectorXd empty;
+        return empty;
     }
 
-    return m_b;
+    return m_constraints->b;
+}
+
+bool LinearizedFrictionCone::computeRotatedA(Eigen::Ref<const Eigen::Matrix3d> rotation,
+                                             Eigen::Ref<Eigen::MatrixXd> A) const
+{
+    constexpr auto errorPrefix = "[LinearizedFrictionCone::computeRotatedA]";
+
+    if (!m_isIntialized)
+    {
+        log()->error("{} Please initialize the class before.", errorPrefix);
+        return false;
+    }
+
+    if (A.rows() != m_constraints->A.rows() || A.cols() != m_constraints->A.cols())
+    {
+        log()->error("{} The size of the matrix A is {} x {}. Expected {} x {}.",
+                     errorPrefix,
+                     A.rows(),
+                     A.cols(),
+                     m_constraints->A.rows(),
+                     m_constraints->A.cols());
+        return false;
+    }
+
+    A.noalias() = m_constraints->A * rotation.transpose();
+    return true;
 }
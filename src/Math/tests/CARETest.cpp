@@ -5,10 +5,14 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <memory>
+#include <vector>
+
 // Catch2
 #include <catch2/catch_test_macros.hpp>
 
 #include <BipedalLocomotion/Math/CARE.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
 
 using namespace BipedalLocomotion::Math;
 using Matrix1d = Eigen::Matrix<double, 1, 1>;
@@ -48,3 +52,77 @@ TEST_CASE("Algebraic Riccati Equation")
     constexpr double tolerance = 1e-5;
     REQUIRE(matlabSolution.isApprox(solution, tolerance));
 }
+
+TEST_CASE("Algebraic Riccati Equation - Warm start")
+{
+    Eigen::Matrix4d A;
+    A << 0, 1, 0, 0,
+         2, 0, 0, 0,
+         0, 0, 0, 1,
+         0, 0, 3, 0;
+
+    Eigen::Matrix<double, 4, 2> B;
+    B << 0, 0,
+         1, 0,
+         0, 0,
+         0, 1;
+
+    const Eigen::Matrix4d Q = Eigen::Matrix4d::Identity();
+    const Eigen::Matrix2d R = Eigen::Matrix2d::Identity();
+
+    auto residual = [&B, &Q, &R](const Eigen::Matrix4d& A, const Eigen::MatrixXd& S) {
+        return (S * A + A.transpose() * S - S * B * R.inverse() * B.transpose() * S + Q).norm();
+    };
+
+    auto handler = std::make_shared<BipedalLocomotion::ParametersHandler::StdImplementation>();
+    handler->setParameter("warm_start", true);
+
+    CARE care;
+    REQUIRE(care.initialize(handler));
+    REQUIRE(care.setMatrices(A, B, Q, R));
+    REQUIRE(care.solve());
+
+    constexpr double tolerance = 1e-6;
+    REQUIRE(residual(A, care.getSolution()) < tolerance);
+
+    SECTION("Small variation")
+    {
+        // the previous solution still stabilizes the system
+        Eigen::Matrix4d newA = A;
+        newA(1, 0) = 2.1;
+        REQUIRE(care.setMatrices(newA, B, Q, R));
+        REQUIRE(care.solve());
+        REQUIRE(residual(newA, care.getSolution()) < tolerance);
+
+        CARE coldCare;
+        REQUIRE(coldCare.setMatrices(newA, B, Q, R));
+        REQUIRE(coldCare.solve());
+        REQUIRE(coldCare.getSolution().isApprox(care.getSolution(), tolerance));
+    }
+
+    SECTION("Non stabilizing initial guess")
+    {
+        // A is not Hurwitz, hence the zero matrix is not a stabilizing guess
+        REQUIRE(care.solve(Eigen::Matrix4d::Zero()));
+        REQUIRE(residual(A, care.getSolution()) < tolerance);
+    }
+
+    SECTION("Batch")
+    {
+        std::vector<CARE::Matrices> problems;
+        for (int i = 0; i < 20; i++)
+        {
+            Eigen::Matrix4d newA = A;
+            newA(1, 0) = 1.0 + 0.1 * i;
+            problems.push_back({newA, B, Q, R});
+        }
+
+        std::vector<Eigen::MatrixXd> solutions;
+        REQUIRE(care.solveBatch(problems, solutions, 4));
+        REQUIRE(solutions.size() == problems.size());
+        for (std::size_t i = 0; i < problems.size(); i++)
+        {
+            REQUIRE(residual(problems[i].A, solutions[i]) < tolerance);
+        }
+    }
+}
@@ -39,6 +39,19 @@ TEST_CASE("Linearized Friction Cone")
 
     constexpr double tolerance = 1e-4;
     REQUIRE(matlabSolution.isApprox(cone.getA(), tolerance));
+
+    SECTION("Rotated matrix")
+    {
+        const Eigen::Matrix3d rotation
+            = Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized()).toRotationMatrix();
+
+        Eigen::MatrixXd rotatedA(8, 3);
+        REQUIRE(cone.computeRotatedA(rotation, rotatedA));
+        REQUIRE(rotatedA.isApprox(cone.getA() * rotation.transpose()));
+
+        Eigen::MatrixXd wrongSize(7, 3);
+        REQUIRE_FALSE(cone.computeRotatedA(rotation, wrongSize));
+    }
 }
 
 
@@ -55,6 +68,37 @@ TEST_CASE("Contact wrench Cone")
     ContactWrenchCone cone;
     REQUIRE(cone.initialize(params));
 
+    SECTION("Shared matrices")
+    {
+        // the cones having the same parameters share the same matrices
+        ContactWrenchCone otherCone;
+        REQUIRE(otherCone.initialize(params));
+        REQUIRE(otherCone.getA().data() == cone.getA().data());
+
+        auto otherParams = params->clone();
+        otherParams->setParameter("static_friction_coefficient", 0.4);
+        ContactWrenchCone differentCone;
+        REQUIRE(differentCone.initialize(otherParams));
+        REQUIRE(differentCone.getA().data() != cone.getA().data());
+    }
+
+    SECTION("Rotated matrix")
+    {
+        const Eigen::Matrix3d rotation
+            = Eigen::AngleAxisd(0.3, Eigen::Vector3d(1, 2, 3).normalized()).toRotationMatrix();
+
+        Eigen::Matrix<double, 6, 6> adjoint = Eigen::Matrix<double, 6, 6>::Zero();
+        adjoint.topLeftCorner<3, 3>() = rotation.transpose();
+        adjoint.bottomRightCorner<3, 3>() = rotation.transpose();
+
+        // the rotated matrix can be written in a block of a larger matrix
+        Eigen::MatrixXd constraints = Eigen::MatrixXd::Zero(20, 10);
+        REQUIRE(cone.computeRotatedA(rotation, constraints.middleCols(2, 6)));
+        REQUIRE(constraints.middleCols(2, 6).isApprox(cone.getA() * adjoint));
+        REQUIRE(constraints.leftCols(2).isZero());
+        REQUIRE(constraints.rightCols(2).isZero());
+    }
+
     SECTION("Check matrix and vector")
     {
         // test the solution
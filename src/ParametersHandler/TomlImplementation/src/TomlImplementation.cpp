@@ -233,6 +233,22 @@ bool TomlImplementation::setGroup(const std::string& name, IParametersHandler::s
     return true;
 }
 
+std::vector<std::string> TomlImplementation::getKeys() const
+{
+    std::vector<std::string> keys;
+    keys.reserve(m_container.size() + m_lists.size());
+    for (const auto& [key, value] : m_container)
+    {
+        keys.emplace_back(key.str());
+    }
+    for (const auto& [key, group] : m_lists)
+    {
+        keys.push_back(key);
+    }
+
+    return keys;
+}
+
 std::string TomlImplementation::toString() const
 {
     std::ostringstream stream;
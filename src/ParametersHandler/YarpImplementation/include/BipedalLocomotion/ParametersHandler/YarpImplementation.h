@@ -13,6 +13,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 // YARP
 #include <yarp/os/Bottle.h>
@@ -276,6 +277,12 @@ public:
      */
     bool setGroup(const std::string& name, shared_ptr newGroup) final;
 
+    /**
+     * Get the names of the parameters and of the groups stored in the handler.
+     * @return a vector containing the names.
+     */
+    std::vector<std::string> getKeys() const final;
+
     /**
      * Return a standard text representation of the content of the object.
      * @return a string containing the standard text representation of the content of the object.
@@ -419,6 +419,26 @@ bool YarpImplementation::setGroup(const std::string& name, IParametersHandler::s
     return true;
 }
 
+std::vector<std::string> YarpImplementation::getKeys() const
+{
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < m_container.size(); i++)
+    {
+        // each parameter is stored as a list where the first element is the name
+        const yarp::os::Bottle* parameter = m_container.get(i).asList();
+        if ((parameter) && (parameter->size() > 1))
+        {
+            keys.push_back(parameter->get(0).toString());
+        }
+    }
+    for (const auto& [key, group] : m_lists)
+    {
+        keys.push_back(key);
+    }
+
+    return keys;
+}
+
 std::string YarpImplementation::toString() const
 {
     std::string output = m_container.toString();
@@ -0,0 +1,357 @@
+/**
+ * @file CompiledImplementation.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_PARAMETERS_HANDLER_COMPILED_IMPLEMENTATION_H
+#define BIPEDAL_LOCOMOTION_PARAMETERS_HANDLER_COMPILED_IMPLEMENTATION_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <BipedalLocomotion/GenericContainer/Vector.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+
+namespace BipedalLocomotion
+{
+namespace ParametersHandler
+{
+
+/**
+ * CompiledImplementation is a read-mostly snapshot of a tree of parameters handlers. The
+ * CompiledImplementation::compile method visits the handler and all its groups once and stores
+ * the parameters in a flat table. The values are stored in contiguous arrays, already converted to
+ * their type, and the names are retrieved with a perfect hash. Hence, differently from the other
+ * implementations, getting a parameter neither traverses a container nor converts its type.
+ *
+ * The table can be saved in a binary file with CompiledImplementation::saveToFile and loaded with
+ * CompiledImplementation::setFromFile. This allows the application to skip the parsing of large
+ * configuration files at startup.
+ * @code{.cpp}
+ * auto handler = std::make_shared<CompiledImplementation>();
+ * if (!handler->setFromFile("config.cache"))
+ * {
+ *     auto toml = std::make_shared<TomlImplementation>();
+ *     toml->setFromFile("config.toml");
+ *     handler->compile(toml);
+ *     handler->saveToFile("config.cache");
+ * }
+ * solver.initialize(handler);
+ * @endcode
+ * @note The snapshot has a fixed structure. setParameter can only change the value of an existing
+ * parameter having the same type and, for vectors, the same size. setGroup always fails.
+ * @note The binary file is not portable across machines having a different endianness. The file
+ * does not store any information about the source of the parameters, so it is up to the user to
+ * regenerate it when the configuration files change.
+ * @note A parameter stored as a double can also be retrieved as std::chrono::nanoseconds. In this
+ * case the value is considered expressed in seconds. This is consistent with TomlImplementation.
+ */
+class CompiledImplementation : public IParametersHandler
+{
+public:
+    /**
+     * Table containing the parameters of all the groups. It is shared between the handler and its
+     * groups.
+     */
+    struct Table;
+
+    /**
+     * Constructor.
+     */
+    CompiledImplementation();
+
+    /**
+     * Destructor.
+     */
+    ~CompiledImplementation();
+
+    /**
+     * Compile the content of a handler and of all its groups.
+     * @param handler pointer to the handler. The handler must implement
+     * IParametersHandler::getKeys.
+     * @return true in case of success, false otherwise.
+     * @note Each parameter is converted to the first type in the following list that is accepted
+     * by the handler: int, bool, double, std::chrono::nanoseconds, std::string and the vectors of
+     * the same types in the same order. If none of them is accepted the name is considered as a
+     * group.
+     */
+    bool compile(IParametersHandler::weak_ptr handler);
+
+    /**
+     * Load the table from a binary file generated by saveToFile.
+     * @param filename name of the file.
+     * @return true in case of success, false otherwise.
+     */
+    bool setFromFile(const std::string& filename);
+
+    /**
+     * Save the table in a binary file.
+     * @param filename name of the file.
+     * @return true in case of success, false otherwise.
+     * @note Only the root handler can be saved.
+     */
+    bool saveToFile(const std::string& filename) const;
+
+    /**
+     * Compare the content of the handler with another one.
+     * @param other the handler to compare with.
+     * @return the names of the parameters and of the groups that are contained only in one of the
+     * two handlers, and the names of the parameters that have a different type or value. The names
+     * of the parameters contained in a group are prefixed by the name of the group followed by
+     * '/', e.g. `GROUP/parameter`.
+     */
+    std::vector<std::string> getChangedKeys(const CompiledImplementation& other) const;
+
+    /**
+     * Get a parameter [int]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName, int& parameter) const final;
+
+    /**
+     * Get a parameter [double]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName, double& parameter) const final;
+
+    /**
+     * Get a parameter [std::string]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName, std::string& parameter) const final;
+
+    /**
+     * Get a parameter [bool]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName, bool& parameter) const final;
+
+    /**
+     * Get a parameter [std::chrono::nanoseconds]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName,
+                      std::chrono::nanoseconds& parameter) const final;
+
+    /**
+     * Get a parameter [std::vector<bool>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName, std::vector<bool>& parameter) const final;
+
+    /**
+     * Get a parameter [GenericContainer::Vector<int>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName,
+                      GenericContainer::Vector<int>::Ref parameter) const final;
+
+    /**
+     * Get a parameter [GenericContainer::Vector<double>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName,
+                      GenericContainer::Vector<double>::Ref parameter) const final;
+
+    /**
+     * Get a parameter [GenericContainer::Vector<std::string>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName,
+                      GenericContainer::Vector<std::string>::Ref parameter) const final;
+
+    /**
+     * Get a parameter [GenericContainer::Vector<std::chrono::nanoseconds>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @return true/false in case of success/failure
+     */
+    bool getParameter(const std::string& parameterName,
+                      GenericContainer::Vector<std::chrono::nanoseconds>::Ref parameter) const final;
+
+    /**
+     * Set a parameter [int]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName, const int& parameter) final;
+
+    /**
+     * Set a parameter [double]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName, const double& parameter) final;
+
+    /**
+     * Set a parameter [std::string]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName, const std::string& parameter) final;
+
+    /**
+     * Set a parameter [const char*]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName, const char* parameter) final;
+
+    /**
+     * Set a parameter [bool]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName, const bool& parameter) final;
+
+    /**
+     * Set a parameter [std::chrono::nanoseconds]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName, //
+                      const std::chrono::nanoseconds& parameter) final;
+
+    /**
+     * Set a parameter [std::vector<bool>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName, const std::vector<bool>& parameter) final;
+
+    /**
+     * Set a parameter [GenericContainer::Vector<int>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName,
+                      const GenericContainer::Vector<const int>::Ref parameter) final;
+
+    /**
+     * Set a parameter [GenericContainer::Vector<double>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName,
+                      const GenericContainer::Vector<const double>::Ref parameter) final;
+
+    /**
+     * Set a parameter [GenericContainer::Vector<std::string>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(const std::string& parameterName,
+                      const GenericContainer::Vector<const std::string>::Ref parameter) final;
+
+    /**
+     * Set a parameter [GenericContainer::Vector<std::chrono::nanoseconds>]
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     */
+    void setParameter(
+        const std::string& parameterName,
+        const GenericContainer::Vector<const std::chrono::nanoseconds>::Ref parameter) final;
+
+    /**
+     * Get a Group from the handler.
+     * @param name name of the group
+     * @return A pointer to IParametersHandler, if the group is not found the weak pointer cannot
+     * be locked
+     */
+    weak_ptr getGroup(const std::string& name) const final;
+
+    /**
+     * Set a new group on the handler.
+     * @param name name of the group
+     * @param newGroup shared pointer to the new group
+     * @return false since the structure of the snapshot cannot be changed.
+     */
+    bool setGroup(const std::string& name, shared_ptr newGroup) final;
+
+    /**
+     * Get the names of the parameters and of the groups stored in the handler.
+     * @return a vector containing the names.
+     */
+    std::vector<std::string> getKeys() const final;
+
+    /**
+     * Return a standard text representation of the content of the object.
+     * @return a string containing the standard text representation of the content of the object.
+     */
+    std::string toString() const final;
+
+    /**
+     * Check if the handler contains parameters
+     * @return true if the handler does not contain any parameters, false otherwise
+     */
+    bool isEmpty() const final;
+
+    /**
+     * Clears the handler from all the parameters
+     */
+    void clear() final;
+
+    /**
+     * Clone the content of the content.
+     * @return a IParametersHandler::shared_ptr clone of the current handler.
+     */
+    shared_ptr clone() const final;
+
+private:
+    /**
+     * Private implementation of getParameter
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @tparam T type of the parameter
+     * @return true/false in case of success/failure
+     */
+    template <typename T>
+    bool getParameterPrivate(const std::string& parameterName, T& parameter) const;
+
+    /**
+     * Private implementation of setParameter
+     * @param parameterName name of the parameter
+     * @param parameter parameter
+     * @tparam T type of the parameter
+     */
+    template <typename T>
+    void setParameterPrivate(const std::string& parameterName, const T& parameter);
+
+    /**
+     * Create the handlers associated to the groups contained in the table.
+     */
+    void createGroups();
+
+    std::shared_ptr<Table> m_table; /**< Table shared by the handler and its groups. */
+    std::uint32_t m_group{0}; /**< Index of the group represented by the handler. */
+
+    /** Handlers of the groups directly contained in the handler. */
+    std::vector<std::shared_ptr<CompiledImplementation>> m_groups;
+};
+
+} // namespace ParametersHandler
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_PARAMETERS_HANDLER_COMPILED_IMPLEMENTATION_H
@@ -228,6 +228,17 @@ public:
      */
     virtual bool setGroup(const std::string& name, shared_ptr newGroup) = 0;
 
+    /**
+     * Get the names of the parameters and of the groups stored in the handler.
+     * @return a vector containing the names. The order of the names is not specified.
+     * @note The default implementation returns an empty vector. The method is required to compile
+     * the handler with CompiledImplementation::compile.
+     */
+    virtual std::vector<std::string> getKeys() const
+    {
+        return {};
+    }
+
     /**
      * Return a standard text representation of the content of the object.
      * @return a string containing the standard text representation of the content of the object.
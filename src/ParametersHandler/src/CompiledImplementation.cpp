@@ -0,0 +1,1118 @@
+/**
+ * @file CompiledImplementation.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include <BipedalLocomotion/GenericContainer/TemplateHelpers.h>
+#include <BipedalLocomotion/GenericContainer/Vector.h>
+#include <BipedalLocomotion/ParametersHandler/CompiledImplementation.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion;
+
+namespace
+{
+
+/**
+ * Type of an entry of the table.
+ */
+enum class Type : std::uint32_t
+{
+    Int,
+    Double,
+    String,
+    Bool,
+    Duration,
+    VectorInt,
+    VectorDouble,
+    VectorString,
+    VectorBool,
+    VectorDuration,
+    Group,
+};
+
+/**
+ * Range of elements stored in one of the arrays of the table.
+ */
+struct Span
+{
+    std::uint32_t offset{0};
+    std::uint32_t size{0};
+};
+
+/**
+ * Entry of the table. Int, Bool and Duration values are stored in Table::integers, Double values
+ * in Table::doubles and String values in Table::strings. For a Group, value.offset contains the
+ * index of the group.
+ */
+struct Entry
+{
+    std::uint32_t group{0}; /**< Index of the group containing the entry. */
+    Span name; /**< Name of the entry stored in Table::text. */
+    Type type{Type::Int}; /**< Type of the entry. */
+    Span value; /**< Elements of the entry. */
+};
+
+constexpr std::uint32_t invalidSlot = std::numeric_limits<std::uint32_t>::max();
+constexpr std::uint32_t fileMagic = 0x50464c42; // "BLFP"
+constexpr std::uint32_t fileVersion = 1;
+
+/**
+ * Traits associating a C++ type to the types of the table.
+ */
+template <typename T> struct EntryType;
+
+template <> struct EntryType<int>
+{
+    static constexpr Type scalar = Type::Int;
+    static constexpr Type vector = Type::VectorInt;
+};
+
+template <> struct EntryType<double>
+{
+    static constexpr Type scalar = Type::Double;
+    static constexpr Type vector = Type::VectorDouble;
+};
+
+template <> struct EntryType<std::string>
+{
+    static constexpr Type scalar = Type::String;
+    static constexpr Type vector = Type::VectorString;
+};
+
+template <> struct EntryType<bool>
+{
+    static constexpr Type scalar = Type::Bool;
+    static constexpr Type vector = Type::VectorBool;
+};
+
+template <> struct EntryType<std::chrono::nanoseconds>
+{
+    static constexpr Type scalar = Type::Duration;
+    static constexpr Type vector = Type::VectorDuration;
+};
+
+std::uint64_t mix(std::uint64_t x)
+{
+    // splitmix64 finalizer
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+std::uint64_t baseHash(std::uint32_t group, std::string_view name)
+{
+    // FNV-1a
+    std::uint64_t hash = 0xcbf29ce484222325ULL ^ (static_cast<std::uint64_t>(group) << 32);
+    for (const char c : name)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+std::uint64_t seededHash(std::uint64_t base, std::uint32_t seed)
+{
+    return mix(base + seed * 0x9e3779b97f4a7c15ULL);
+}
+
+} // namespace
+
+struct CompiledImplementation::Table
+{
+    std::vector<Entry> entries; /**< Entries of all the groups. */
+    std::vector<std::uint32_t> displacements; /**< Seed of each bucket of the perfect hash. */
+    std::vector<std::uint32_t> slots; /**< Index of the entry associated to each slot. */
+    std::vector<std::int64_t> integers; /**< Int, Bool and Duration elements. */
+    std::vector<double> doubles; /**< Double elements. */
+    std::vector<Span> strings; /**< String elements stored in text. */
+    std::string text; /**< Names of the entries and content of the strings. */
+    std::uint32_t numberOfGroups{1}; /**< Number of groups. The group 0 is the root. */
+
+    std::string_view view(const Span& span) const
+    {
+        return std::string_view(text).substr(span.offset, span.size);
+    }
+
+    Span addText(std::string_view content)
+    {
+        Span span{static_cast<std::uint32_t>(text.size()),
+                  static_cast<std::uint32_t>(content.size())};
+        text.append(content);
+        return span;
+    }
+
+    const Entry* find(std::uint32_t group, std::string_view name) const
+    {
+        if (displacements.empty())
+        {
+            return nullptr;
+        }
+
+        const std::uint64_t base = baseHash(group, name);
+        const std::uint32_t seed = displacements[seededHash(base, 0) % displacements.size()];
+        const std::uint32_t slot = slots[seededHash(base, seed) % slots.size()];
+        if (slot == invalidSlot)
+        {
+            return nullptr;
+        }
+
+        const Entry& entry = entries[slot];
+        if (entry.group != group || view(entry.name) != name)
+        {
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    /**
+     * Build the perfect hash with the hash and displace algorithm. The entries are split in
+     * buckets, then, starting from the largest bucket, a seed mapping all the entries of the
+     * bucket in free slots is searched.
+     */
+    void buildHash()
+    {
+        displacements.clear();
+        slots.clear();
+        if (entries.empty())
+        {
+            return;
+        }
+
+        std::vector<std::uint64_t> bases(entries.size());
+        for (std::size_t i = 0; i < entries.size(); i++)
+        {
+            bases[i] = baseHash(entries[i].group, view(entries[i].name));
+        }
+
+        std::size_t numberOfSlots = entries.size() + entries.size() / 4 + 1;
+        const std::size_t numberOfBuckets = entries.size() / 2 + 1;
+        constexpr std::uint32_t maxSeed = 1 << 16;
+
+        std::vector<std::vector<std::uint32_t>> buckets(numberOfBuckets);
+        for (std::size_t i = 0; i < entries.size(); i++)
+        {
+            buckets[seededHash(bases[i], 0) % numberOfBuckets].push_back(i);
+        }
+
+        std::vector<std::uint32_t> order(numberOfBuckets);
+        for (std::size_t i = 0; i < numberOfBuckets; i++)
+        {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&buckets](auto lhs, auto rhs) {
+            return buckets[lhs].size() > buckets[rhs].size();
+        });
+
+        std::vector<std::size_t> candidates;
+        bool isHashBuilt = false;
+        while (!isHashBuilt)
+        {
+            displacements.assign(numberOfBuckets, 0);
+            slots.assign(numberOfSlots, invalidSlot);
+            isHashBuilt = true;
+
+            for (const auto bucketIndex : order)
+            {
+                const auto& bucket = buckets[bucketIndex];
+                if (bucket.empty())
+                {
+                    break;
+                }
+
+                bool isSeedFound = false;
+                for (std::uint32_t seed = 1; seed < maxSeed && !isSeedFound; seed++)
+                {
+                    candidates.clear();
+                    isSeedFound = true;
+                    for (const auto entryIndex : bucket)
+                    {
+                        const std::size_t slot = seededHash(bases[entryIndex], seed) % numberOfSlots;
+                        if (slots[slot] != invalidSlot
+                            || std::find(candidates.begin(), candidates.end(), slot)
+                                   != candidates.end())
+                        {
+                            isSeedFound = false;
+                            break;
+                        }
+                        candidates.push_back(slot);
+                    }
+
+                    if (isSeedFound)
+                    {
+                        displacements[bucketIndex] = seed;
+                        for (std::size_t i = 0; i < bucket.size(); i++)
+                        {
+                            slots[candidates[i]] = bucket[i];
+                        }
+                    }
+                }
+
+                if (!isSeedFound)
+                {
+                    // very unlikely. Try again with more free slots.
+                    numberOfSlots *= 2;
+                    isHashBuilt = false;
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * Check that all the indices stored in the table are consistent.
+     */
+    bool isValid() const
+    {
+        const auto isSpanValid = [](const Span& span, std::size_t size) {
+            return static_cast<std::size_t>(span.offset) + span.size <= size;
+        };
+
+        for (const auto& entry : entries)
+        {
+            if (entry.group >= numberOfGroups || !isSpanValid(entry.name, text.size()))
+            {
+                return false;
+            }
+
+            bool isValueValid = false;
+            switch (entry.type)
+            {
+            case Type::Int:
+            case Type::Bool:
+            case Type::Duration:
+            case Type::VectorInt:
+            case Type::VectorBool:
+            case Type::VectorDuration:
+                isValueValid = isSpanValid(entry.value, integers.size());
+                break;
+            case Type::Double:
+            case Type::VectorDouble:
+                isValueValid = isSpanValid(entry.value, doubles.size());
+                break;
+            case Type::String:
+            case Type::VectorString:
+                isValueValid = isSpanValid(entry.value, strings.size());
+                break;
+            case Type::Group:
+                // the groups are numbered while they are compiled, hence a group has a larger
+                // index than the group containing it. A group pointing to itself or to one of its
+                // ancestors would be created recursively forever.
+                isValueValid = entry.value.offset < numberOfGroups //
+                               && entry.value.offset > entry.group;
+                break;
+            }
+
+            if (!isValueValid)
+            {
+                return false;
+            }
+        }
+
+        for (const auto& span : strings)
+        {
+            if (!isSpanValid(span, text.size()))
+            {
+                return false;
+            }
+        }
+
+        for (const auto& slot : slots)
+        {
+            if (slot != invalidSlot && slot >= entries.size())
+            {
+                return false;
+            }
+        }
+
+        return entries.empty() || (!displacements.empty() && !slots.empty());
+    }
+};
+
+namespace
+{
+
+using Table = CompiledImplementation::Table;
+
+void storeElement(Table& table, const int& element)
+{
+    table.integers.push_back(element);
+}
+
+void storeElement(Table& table, const bool& element)
+{
+    table.integers.push_back(element ? 1 : 0);
+}
+
+void storeElement(Table& table, const std::chrono::nanoseconds& element)
+{
+    table.integers.push_back(element.count());
+}
+
+void storeElement(Table& table, const double& element)
+{
+    table.doubles.push_back(element);
+}
+
+void storeElement(Table& table, const std::string& element)
+{
+    table.strings.push_back(table.addText(element));
+}
+
+template <typename T> std::uint32_t poolSize(const Table& table)
+{
+    if constexpr (std::is_same_v<T, double>)
+    {
+        return table.doubles.size();
+    } else if constexpr (std::is_same_v<T, std::string>)
+    {
+        return table.strings.size();
+    } else
+    {
+        return table.integers.size();
+    }
+}
+
+/**
+ * Try to get a parameter with a given type and store it in the table.
+ */
+template <typename T>
+bool tryStore(const IParametersHandler& handler, const std::string& key, Entry& entry, Table& table)
+{
+    T parameter{};
+    if (!handler.getParameter(key, parameter))
+    {
+        return false;
+    }
+
+    if constexpr (is_resizable<T>::value && !is_string<T>::value)
+    {
+        using elementType = typename T::value_type;
+        entry.type = EntryType<elementType>::vector;
+        entry.value.offset = poolSize<elementType>(table);
+        entry.value.size = parameter.size();
+        for (std::size_t i = 0; i < parameter.size(); i++)
+        {
+            storeElement(table, static_cast<elementType>(parameter[i]));
+        }
+    } else
+    {
+        entry.type = EntryType<T>::scalar;
+        entry.value.offset = poolSize<T>(table);
+        entry.value.size = 1;
+        storeElement(table, parameter);
+    }
+
+    return true;
+}
+
+bool addGroup(const IParametersHandler& handler, std::uint32_t group, Table& table)
+{
+    constexpr auto logPrefix = "[CompiledImplementation::compile]";
+
+    const std::vector<std::string> keys = handler.getKeys();
+    if (keys.empty() && !handler.isEmpty())
+    {
+        log()->error("{} The handler does not implement IParametersHandler::getKeys.", logPrefix);
+        return false;
+    }
+
+    std::unordered_set<std::string> addedKeys;
+    for (const auto& key : keys)
+    {
+        if (!addedKeys.insert(key).second)
+        {
+            continue;
+        }
+
+        Entry entry;
+        entry.group = group;
+        entry.name = table.addText(key);
+
+        // The types are probed from the most specific one since some implementations convert
+        // the parameters when they are retrieved. E.g., YARP returns an integer when a bool is
+        // requested and both YARP and TOML return a duration when a double (or a string
+        // formatted as HH:MM:SS.xxxxxx) is requested. For this reason int is probed before bool,
+        // and double and std::chrono::nanoseconds are probed before std::string.
+        const bool isParameter
+            = tryStore<int>(handler, key, entry, table)
+              || tryStore<bool>(handler, key, entry, table)
+              || tryStore<double>(handler, key, entry, table)
+              || tryStore<std::chrono::nanoseconds>(handler, key, entry, table)
+              || tryStore<std::string>(handler, key, entry, table)
+              || tryStore<std::vector<int>>(handler, key, entry, table)
+              || tryStore<std::vector<bool>>(handler, key, entry, table)
+              || tryStore<std::vector<double>>(handler, key, entry, table)
+              || tryStore<std::vector<std::chrono::nanoseconds>>(handler, key, entry, table)
+              || tryStore<std::vector<std::string>>(handler, key, entry, table);
+        if (isParameter)
+        {
+            table.entries.push_back(entry);
+            continue;
+        }
+
+        auto child = handler.getGroup(key).lock();
+        if (child == nullptr)
+        {
+            log()->warn("{} Unable to retrieve the type of the parameter named '{}'. The "
+                        "parameter will be ignored.",
+                        logPrefix,
+                        key);
+            continue;
+        }
+
+        entry.type = Type::Group;
+        entry.value.offset = table.numberOfGroups++;
+        entry.value.size = 0;
+        table.entries.push_back(entry);
+
+        if (!addGroup(*child, entry.value.offset, table))
+        {
+            log()->error("{} Unable to compile the group named '{}'.", logPrefix, key);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename T> void writeVector(std::ofstream& stream, const std::vector<T>& vector)
+{
+    const std::uint64_t size = vector.size();
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    stream.write(reinterpret_cast<const char*>(vector.data()), sizeof(T) * vector.size());
+}
+
+template <typename T> bool readVector(std::ifstream& stream, std::vector<T>& vector)
+{
+    std::uint64_t size{0};
+    if (!stream.read(reinterpret_cast<char*>(&size), sizeof(size))
+        || size > std::numeric_limits<std::uint32_t>::max())
+    {
+        return false;
+    }
+    vector.resize(size);
+    return static_cast<bool>(
+        stream.read(reinterpret_cast<char*>(vector.data()), sizeof(T) * vector.size()));
+}
+
+bool isValueEqual(const Table& lhsTable, const Entry& lhs, const Table& rhsTable, const Entry& rhs)
+{
+    if (lhs.type != rhs.type || lhs.value.size != rhs.value.size)
+    {
+        return false;
+    }
+
+    switch (lhs.type)
+    {
+    case Type::Double:
+    case Type::VectorDouble:
+        return std::equal(lhsTable.doubles.begin() + lhs.value.offset,
+                          lhsTable.doubles.begin() + lhs.value.offset + lhs.value.size,
+                          rhsTable.doubles.begin() + rhs.value.offset);
+    case Type::String:
+    case Type::VectorString:
+        for (std::uint32_t i = 0; i < lhs.value.size; i++)
+        {
+            if (lhsTable.view(lhsTable.strings[lhs.value.offset + i])
+                != rhsTable.view(rhsTable.strings[rhs.value.offset + i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    case Type::Group:
+        return true;
+    default:
+        return std::equal(lhsTable.integers.begin() + lhs.value.offset,
+                          lhsTable.integers.begin() + lhs.value.offset + lhs.value.size,
+                          rhsTable.integers.begin() + rhs.value.offset);
+    }
+}
+
+void collectChangedKeys(const Table& lhsTable,
+                        std::uint32_t lhsGroup,
+                        const Table& rhsTable,
+                        std::uint32_t rhsGroup,
+                        const std::string& prefix,
+                        std::vector<std::string>& changedKeys)
+{
+    for (const auto& entry : lhsTable.entries)
+    {
+        if (entry.group != lhsGroup)
+        {
+            continue;
+        }
+
+        const std::string_view name = lhsTable.view(entry.name);
+        const Entry* other = rhsTable.find(rhsGroup, name);
+        if (other != nullptr && entry.type == Type::Group && other->type == Type::Group)
+        {
+            collectChangedKeys(lhsTable,
+                               entry.value.offset,
+                               rhsTable,
+                               other->value.offset,
+                               prefix + std::string(name) + "/",
+                               changedKeys);
+        } else if (other == nullptr || !isValueEqual(lhsTable, entry, rhsTable, *other))
+        {
+            changedKeys.push_back(prefix + std::string(name));
+        }
+    }
+
+    // entries contained only in the other table
+    for (const auto& entry : rhsTable.entries)
+    {
+        if (entry.group == rhsGroup && lhsTable.find(lhsGroup, rhsTable.view(entry.name)) == nullptr)
+        {
+            changedKeys.push_back(prefix + std::string(rhsTable.view(entry.name)));
+        }
+    }
+}
+
+} // namespace
+
+CompiledImplementation::CompiledImplementation()
+    : m_table(std::make_shared<Table>())
+{
+}
+
+CompiledImplementation::~CompiledImplementation() = default;
+
+bool CompiledImplementation::compile(IParametersHandler::weak_ptr handler)
+{
+    constexpr auto logPrefix = "[CompiledImplementation::compile]";
+
+    auto handlerPtr = handler.lock();
+    if (handlerPtr == nullptr)
+    {
+        log()->error("{} The handler is not valid.", logPrefix);
+        return false;
+    }
+
+    auto table = std::make_shared<Table>();
+    if (!addGroup(*handlerPtr, 0, *table))
+    {
+        log()->error("{} Unable to compile the handler.", logPrefix);
+        return false;
+    }
+    table->buildHash();
+
+    m_table = std::move(table);
+    m_group = 0;
+    this->createGroups();
+
+    return true;
+}
+
+bool CompiledImplementation::setFromFile(const std::string& filename)
+{
+    constexpr auto logPrefix = "[CompiledImplementation::setFromFile]";
+
+    std::ifstream stream(filename, std::ios::binary);
+    if (!stream.is_open())
+    {
+        log()->debug("{} Unable to open the file named '{}'.", logPrefix, filename);
+        return false;
+    }
+
+    std::uint32_t magic{0};
+    std::uint32_t version{0};
+    auto table = std::make_shared<Table>();
+    stream.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    stream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    stream.read(reinterpret_cast<char*>(&table->numberOfGroups), sizeof(table->numberOfGroups));
+    if (!stream || magic != fileMagic || version != fileVersion)
+    {
+        log()->error("{} The file named '{}' is not a compiled parameters file or it has been "
+                     "generated by a different version of the library.",
+                     logPrefix,
+                     filename);
+        return false;
+    }
+
+    std::vector<char> text;
+    const bool ok = readVector(stream, table->entries) //
+                    && readVector(stream, table->displacements)
+                    && readVector(stream, table->slots) //
+                    && readVector(stream, table->integers)
+                    && readVector(stream, table->doubles) //
+                    && readVector(stream, table->strings) //
+                    && readVector(stream, text);
+    table->text.assign(text.begin(), text.end());
+
+    if (!ok || !table->isValid())
+    {
+        log()->error("{} The file named '{}' is corrupted.", logPrefix, filename);
+        return false;
+    }
+
+    m_table = std::move(table);
+    m_group = 0;
+    this->createGroups();
+
+    return true;
+}
+
+bool CompiledImplementation::saveToFile(const std::string& filename) const
+{
+    constexpr auto logPrefix = "[CompiledImplementation::saveToFile]";
+
+    if (m_group != 0)
+    {
+        log()->error("{} Only the root handler can be saved.", logPrefix);
+        return false;
+    }
+
+    std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open())
+    {
+        log()->error("{} Unable to open the file named '{}'.", logPrefix, filename);
+        return false;
+    }
+
+    stream.write(reinterpret_cast<const char*>(&fileMagic), sizeof(fileMagic));
+    stream.write(reinterpret_cast<const char*>(&fileVersion), sizeof(fileVersion));
+    stream.write(reinterpret_cast<const char*>(&m_table->numberOfGroups),
+                 sizeof(m_table->numberOfGroups));
+    writeVector(stream, m_table->entries);
+    writeVector(stream, m_table->displacements);
+    writeVector(stream, m_table->slots);
+    writeVector(stream, m_table->integers);
+    writeVector(stream, m_table->doubles);
+    writeVector(stream, m_table->strings);
+    writeVector(stream, std::vector<char>(m_table->text.begin(), m_table->text.end()));
+
+    if (!stream)
+    {
+        log()->error("{} Unable to write the file named '{}'.", logPrefix, filename);
+        return false;
+    }
+
+    return true;
+}
+
+std::vector<std::string>
+CompiledImplementation::getChangedKeys(const CompiledImplementation& other) const
+{
+    std::vector<std::string> changedKeys;
+    collectChangedKeys(*m_table, m_group, *other.m_table, other.m_group, "", changedKeys);
+    return changedKeys;
+}
+
+void CompiledImplementation::createGroups()
+{
+    m_groups.clear();
+    for (const auto& entry : m_table->entries)
+    {
+        if (entry.group == m_group && entry.type == Type::Group)
+        {
+            auto group = std::make_shared<CompiledImplementation>();
+            group->m_table = m_table;
+            group->m_group = entry.value.offset;
+            group->createGroups();
+            m_groups.push_back(std::move(group));
+        }
+    }
+}
+
+template <typename T>
+bool CompiledImplementation::getParameterPrivate(const std::string& parameterName,
+                                                 T& parameter) const
+{
+    constexpr auto logPrefix = "[CompiledImplementation::getParameterPrivate]";
+
+    const Entry* entry = m_table->find(m_group, parameterName);
+    if (entry == nullptr)
+    {
+        log()->debug("{} Parameter named '{}' not found.", logPrefix, parameterName);
+        return false;
+    }
+
+    const auto getElement = [this, entry](std::size_t index, auto& element) {
+        using elementType = std::decay_t<decltype(element)>;
+        const std::size_t position = entry->value.offset + index;
+        if constexpr (std::is_same_v<elementType, double>)
+        {
+            element = m_table->doubles[position];
+        } else if constexpr (std::is_same_v<elementType, std::string>)
+        {
+            element = m_table->view(m_table->strings[position]);
+        } else if constexpr (std::is_same_v<elementType, std::chrono::nanoseconds>)
+        {
+            if (entry->type == Type::Double || entry->type == Type::VectorDouble)
+            {
+                element = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::duration<double>(m_table->doubles[position]));
+            } else
+            {
+                element = std::chrono::nanoseconds(m_table->integers[position]);
+            }
+        } else if constexpr (std::is_same_v<elementType, bool>)
+        {
+            element = m_table->integers[position] != 0;
+        } else
+        {
+            element = static_cast<elementType>(m_table->integers[position]);
+        }
+    };
+
+    if constexpr (std::is_scalar<T>::value || is_string<T>::value
+                  || std::is_same<T, std::chrono::nanoseconds>::value)
+    {
+        const bool isTypeValid = entry->type == EntryType<T>::scalar
+                                 || (std::is_same_v<T, std::chrono::nanoseconds>
+                                     && entry->type == Type::Double)
+                                 || (std::is_same_v<T, bool> && entry->type == Type::Int);
+        if (!isTypeValid)
+        {
+            log()->debug("{} The type of the parameter named '{}' is different from the one "
+                         "expected.",
+                         logPrefix,
+                         parameterName);
+            return false;
+        }
+
+        getElement(0, parameter);
+    } else
+    {
+        using elementType = typename T::value_type;
+        const bool isTypeValid = entry->type == EntryType<elementType>::vector
+                                 || (std::is_same_v<elementType, std::chrono::nanoseconds>
+                                     && entry->type == Type::VectorDouble)
+                                 || (std::is_same_v<elementType, bool>
+                                     && entry->type == Type::VectorInt);
+        if (!isTypeValid)
+        {
+            log()->debug("{} The type of the parameter named '{}' is different from the one "
+                         "expected.",
+                         logPrefix,
+                         parameterName);
+            return false;
+        }
+
+        if (entry->value.size != parameter.size())
+        {
+            // If the vector can be resize, let resize it. Otherwise it is a fix-size vector and
+            // the dimensions has to be the same of list
+            if constexpr (GenericContainer::is_vector<T>::value)
+            {
+                if (!parameter.resizeVector(entry->value.size))
+                {
+                    log()->debug("{} Unable to resize {} List size: {}. Vector size: {}.",
+                                 logPrefix,
+                                 type_name<T>(),
+                                 entry->value.size,
+                                 parameter.size());
+                    return false;
+                }
+            } else
+            {
+                parameter.resize(entry->value.size);
+            }
+        }
+
+        for (std::size_t index = 0; index < entry->value.size; index++)
+        {
+            elementType element{};
+            getElement(index, element);
+            parameter[index] = element;
+        }
+    }
+
+    return true;
+}
+
+template <typename T>
+void CompiledImplementation::setParameterPrivate(const std::string& parameterName,
+                                                 const T& parameter)
+{
+    constexpr auto logPrefix = "[CompiledImplementation::setParameterPrivate]";
+
+    // the entry is modified in place since the structure of the table cannot change
+    Entry* entry = const_cast<Entry*>(m_table->find(m_group, parameterName));
+    if (entry == nullptr)
+    {
+        log()->error("{} Parameter named '{}' not found. New parameters cannot be added to a "
+                     "compiled handler.",
+                     logPrefix,
+                     parameterName);
+        return;
+    }
+
+    const auto setElement = [this, entry](std::size_t index, const auto& element) {
+        using elementType = std::decay_t<decltype(element)>;
+        const std::size_t position = entry->value.offset + index;
+        if constexpr (std::is_same_v<elementType, double>)
+        {
+            m_table->doubles[position] = element;
+        } else if constexpr (std::is_same_v<elementType, std::string>)
+        {
+            // the slot is reused if the new string fits, so that the text does not grow at
+            // every set
+            Span& span = m_table->strings[position];
+            if (element.size() <= span.size)
+            {
+                m_table->text.replace(span.offset, element.size(), element);
+                span.size = static_cast<std::uint32_t>(element.size());
+            } else
+            {
+                span = m_table->addText(element);
+            }
+        } else if constexpr (std::is_same_v<elementType, std::chrono::nanoseconds>)
+        {
+            m_table->integers[position] = element.count();
+        } else
+        {
+            m_table->integers[position] = element;
+        }
+    };
+
+    if constexpr (std::is_scalar<T>::value || is_string<T>::value
+                  || std::is_same<T, std::chrono::nanoseconds>::value)
+    {
+        if (entry->type != EntryType<T>::scalar)
+        {
+            log()->error("{} The type of the parameter named '{}' is different from the one "
+                         "stored in the compiled handler.",
+                         logPrefix,
+                         parameterName);
+            return;
+        }
+
+        setElement(0, parameter);
+    } else
+    {
+        using elementType = std::remove_cv_t<typename T::value_type>;
+        if (entry->type != EntryType<elementType>::vector
+            || entry->value.size != parameter.size())
+        {
+            log()->error("{} The type or the size of the parameter named '{}' is different from "
+                         "the one stored in the compiled handler.",
+                         logPrefix,
+                         parameterName);
+            return;
+        }
+
+        for (std::size_t index = 0; index < entry->value.size; index++)
+        {
+            setElement(index, static_cast<elementType>(parameter[index]));
+        }
+    }
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName, int& parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName,
+                                          double& parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName,
+                                          std::string& parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName, bool& parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName,
+                                          std::chrono::nanoseconds& parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName,
+                                          std::vector<bool>& parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName,
+                                          GenericContainer::Vector<int>::Ref parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(const std::string& parameterName,
+                                          GenericContainer::Vector<double>::Ref parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(
+    const std::string& parameterName, GenericContainer::Vector<std::string>::Ref parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+bool CompiledImplementation::getParameter(
+    const std::string& parameterName,
+    GenericContainer::Vector<std::chrono::nanoseconds>::Ref parameter) const
+{
+    return getParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName, const int& parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName,
+                                          const double& parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName,
+                                          const std::string& parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName, const char* parameter)
+{
+    setParameterPrivate(parameterName, std::string(parameter));
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName, const bool& parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName,
+                                          const std::chrono::nanoseconds& parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName,
+                                          const std::vector<bool>& parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(const std::string& parameterName,
+                                          const GenericContainer::Vector<const int>::Ref parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(
+    const std::string& parameterName, const GenericContainer::Vector<const double>::Ref parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(
+    const std::string& parameterName,
+    const GenericContainer::Vector<const std::string>::Ref parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+void CompiledImplementation::setParameter(
+    const std::string& parameterName,
+    const GenericContainer::Vector<const std::chrono::nanoseconds>::Ref parameter)
+{
+    setParameterPrivate(parameterName, parameter);
+}
+
+IParametersHandler::weak_ptr CompiledImplementation::getGroup(const std::string& name) const
+{
+    const Entry* entry = m_table->find(m_group, name);
+    if (entry != nullptr && entry->type == Type::Group)
+    {
+        for (const auto& group : m_groups)
+        {
+            if (group->m_group == entry->value.offset)
+            {
+                return group;
+            }
+        }
+    }
+
+    return std::make_shared<CompiledImplementation>();
+}
+
+bool CompiledImplementation::setGroup(const std::string& name, shared_ptr newGroup)
+{
+    log()->debug("[CompiledImplementation::setGroup] Unable to add the group named '{}'. The "
+                 "structure of a compiled handler cannot be changed.",
+                 name);
+    return false;
+}
+
+std::vector<std::string> CompiledImplementation::getKeys() const
+{
+    std::vector<std::string> keys;
+    for (const auto& entry : m_table->entries)
+    {
+        if (entry.group == m_group)
+        {
+            keys.emplace_back(m_table->view(entry.name));
+        }
+    }
+
+    return keys;
+}
+
+std::string CompiledImplementation::toString() const
+{
+    std::string key;
+    for (const auto& parameter : this->getKeys())
+        key += parameter + " ";
+
+    return key;
+}
+
+bool CompiledImplementation::isEmpty() const
+{
+    return std::none_of(m_table->entries.cbegin(),
+                        m_table->entries.cend(),
+                        [this](const Entry& entry) { return entry.group == m_group; });
+}
+
+void CompiledImplementation::clear()
+{
+    // the table is shared with the other groups, so it is replaced instead of being cleared
+    m_table = std::make_shared<Table>();
+    m_group = 0;
+    m_groups.clear();
+}
+
+IParametersHandler::shared_ptr CompiledImplementation::clone() const
+{
+    auto handler = std::make_shared<CompiledImplementation>();
+
+    // copy the content of the table.
+    handler->m_table = std::make_shared<Table>(*m_table);
+    handler->m_group = m_group;
+    handler->createGroups();
+
+    return handler;
+}
@@ -7,6 +7,7 @@
 
 #include <chrono>
 #include <string>
+#include <vector>
 
 #include <BipedalLocomotion/GenericContainer/Vector.h>
 #include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
@@ -177,6 +178,18 @@ void StdImplementation::set(const std::unordered_map<std::string, std::any>& obj
     m_map = object;
 }
 
+std::vector<std::string> StdImplementation::getKeys() const
+{
+    std::vector<std::string> keys;
+    keys.reserve(m_map.size());
+    for (const auto& [key, value] : m_map)
+    {
+        keys.push_back(key);
+    }
+
+    return keys;
+}
+
 std::string StdImplementation::toString() const
 {
     std::string key;
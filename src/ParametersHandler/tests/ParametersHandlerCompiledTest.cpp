@@ -0,0 +1,253 @@
+/**
+ * @file ParametersHandlerCompiledTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+// std
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/ParametersHandler/CompiledImplementation.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace std::chrono_literals;
+
+void checkContent(IParametersHandler::shared_ptr handler)
+{
+    int answer;
+    REQUIRE(handler->getParameter("answer_to_the_ultimate_question_of_life", answer));
+    REQUIRE(answer == 42);
+
+    double pi;
+    REQUIRE(handler->getParameter("pi", pi));
+    REQUIRE(pi == 3.14);
+
+    std::string john;
+    REQUIRE(handler->getParameter("John", john));
+    REQUIRE(john == "Smith");
+
+    bool flag;
+    REQUIRE(handler->getParameter("flag", flag));
+    REQUIRE(flag);
+
+    std::chrono::nanoseconds time;
+    REQUIRE(handler->getParameter("sampling_time", time));
+    REQUIRE(time == 10ms);
+
+    std::vector<int> fibonacci;
+    REQUIRE(handler->getParameter("Fibonacci Numbers", fibonacci));
+    REQUIRE(fibonacci == std::vector<int>{1, 1, 2, 3, 5, 8, 13, 21});
+
+    // the type is checked
+    REQUIRE_FALSE(handler->getParameter("pi", answer));
+    REQUIRE_FALSE(handler->getParameter("John", fibonacci));
+    REQUIRE_FALSE(handler->getParameter("Luke", john));
+
+    auto group = handler->getGroup("CARTOONS").lock();
+    REQUIRE(group);
+    std::vector<std::string> nephews;
+    REQUIRE(group->getParameter("Donald's nephews", nephews));
+    REQUIRE(nephews == std::vector<std::string>{"Huey", "Dewey", "Louie"});
+
+    // the parameters of the parent are not visible from the group
+    REQUIRE_FALSE(group->getParameter("pi", pi));
+
+    auto nestedGroup = group->getGroup("MOVIES").lock();
+    REQUIRE(nestedGroup);
+    std::vector<double> gains;
+    REQUIRE(nestedGroup->getParameter("gains", gains));
+    REQUIRE(gains == std::vector<double>{1.0, 2.5, -3.0});
+
+    std::vector<std::chrono::nanoseconds> times;
+    REQUIRE(nestedGroup->getParameter("times", times));
+    REQUIRE(times == std::vector<std::chrono::nanoseconds>{1s, 2ms});
+
+    std::vector<bool> flags;
+    REQUIRE(nestedGroup->getParameter("flags", flags));
+    REQUIRE(flags == std::vector<bool>{true, false, true});
+
+    REQUIRE_FALSE(handler->getGroup("NOT_EXISTING").lock());
+}
+
+TEST_CASE("Compiled parameters handler")
+{
+    auto originalHandler = std::make_shared<StdImplementation>();
+    originalHandler->setParameter("answer_to_the_ultimate_question_of_life", 42);
+    originalHandler->setParameter("pi", 3.14);
+    originalHandler->setParameter("John", "Smith");
+    originalHandler->setParameter("flag", true);
+    originalHandler->setParameter("sampling_time", std::chrono::nanoseconds(10ms));
+    originalHandler->setParameter("Fibonacci Numbers", std::vector<int>{1, 1, 2, 3, 5, 8, 13, 21});
+
+    auto cartoons = std::make_shared<StdImplementation>();
+    cartoons->setParameter("Donald's nephews", std::vector<std::string>{"Huey", "Dewey", "Louie"});
+    auto movies = std::make_shared<StdImplementation>();
+    movies->setParameter("gains", std::vector<double>{1.0, 2.5, -3.0});
+    movies->setParameter("times", std::vector<std::chrono::nanoseconds>{1s, 2ms});
+    movies->setParameter("flags", std::vector<bool>{true, false, true});
+    REQUIRE(cartoons->setGroup("MOVIES", movies));
+    REQUIRE(originalHandler->setGroup("CARTOONS", cartoons));
+
+    auto handler = std::make_shared<CompiledImplementation>();
+    REQUIRE(handler->isEmpty());
+    REQUIRE(handler->compile(originalHandler));
+    REQUIRE_FALSE(handler->isEmpty());
+    REQUIRE(handler->getKeys().size() == originalHandler->getKeys().size());
+
+    SECTION("Get parameters")
+    {
+        checkContent(handler);
+    }
+
+    SECTION("Set parameters")
+    {
+        handler->setParameter("pi", 3.1415);
+        handler->setParameter("John", "Doe");
+        double pi;
+        std::string john;
+        REQUIRE(handler->getParameter("pi", pi));
+        REQUIRE(pi == 3.1415);
+        REQUIRE(handler->getParameter("John", john));
+        REQUIRE(john == "Doe");
+
+        // a shorter string reuses the storage of the previous one
+        handler->setParameter("John", "Smith");
+        handler->setParameter("John", "Doe");
+        REQUIRE(handler->getParameter("John", john));
+        REQUIRE(john == "Doe");
+        handler->setParameter("John", "Smithson");
+        REQUIRE(handler->getParameter("John", john));
+        REQUIRE(john == "Smithson");
+
+        // the structure of the handler cannot be changed
+        handler->setParameter("pi", 3);
+        handler->setParameter("e", 2.71);
+        REQUIRE(handler->getParameter("pi", pi));
+        REQUIRE(pi == 3.1415);
+        REQUIRE_FALSE(handler->getParameter("e", pi));
+        REQUIRE_FALSE(handler->setGroup("NEW_GROUP", std::make_shared<StdImplementation>()));
+    }
+
+    SECTION("Clone")
+    {
+        auto newHandler = handler->clone();
+        handler->clear();
+        REQUIRE(handler->isEmpty());
+        checkContent(newHandler);
+    }
+
+    SECTION("Binary file")
+    {
+        const std::string filename = "ParametersHandlerCompiledTest.bin";
+        REQUIRE(handler->saveToFile(filename));
+
+        auto loadedHandler = std::make_shared<CompiledImplementation>();
+        REQUIRE(loadedHandler->setFromFile(filename));
+        checkContent(loadedHandler);
+
+        std::remove(filename.c_str());
+        REQUIRE_FALSE(loadedHandler->setFromFile(filename));
+    }
+
+    SECTION("Binary file with a cycle")
+    {
+        const std::string filename = "ParametersHandlerCompiledTestCycle.bin";
+        REQUIRE(handler->saveToFile(filename));
+
+        std::vector<char> content;
+        {
+            std::ifstream stream(filename, std::ios::binary);
+            content.assign(std::istreambuf_iterator<char>(stream),
+                           std::istreambuf_iterator<char>());
+        }
+
+        // the entries are stored after the magic number, the version, the number of groups and
+        // the size of the vector. Each entry contains group, name (offset and size), type and
+        // value (offset and size).
+        constexpr std::size_t entriesBegin = 3 * sizeof(std::uint32_t) + sizeof(std::uint64_t);
+        constexpr std::size_t entrySize = 6 * sizeof(std::uint32_t);
+        constexpr std::uint32_t groupType = 10;
+        std::uint64_t numberOfEntries{0};
+        std::memcpy(&numberOfEntries,
+                    content.data() + 3 * sizeof(std::uint32_t),
+                    sizeof(numberOfEntries));
+
+        // MOVIES is the only group contained in another group
+        std::size_t moviesOffset{0};
+        for (std::size_t i = 0; i < numberOfEntries; i++)
+        {
+            std::uint32_t fields[6];
+            std::memcpy(fields, content.data() + entriesBegin + i * entrySize, entrySize);
+            if (fields[3] == groupType && fields[0] != 0)
+            {
+                moviesOffset = entriesBegin + i * entrySize;
+            }
+        }
+        REQUIRE(moviesOffset != 0);
+
+        // CARTOONS contains itself and then the root group
+        std::uint32_t parent{0};
+        std::memcpy(&parent, content.data() + moviesOffset, sizeof(parent));
+        for (const std::uint32_t group : {parent, std::uint32_t{0}})
+        {
+            std::memcpy(content.data() + moviesOffset + 4 * sizeof(std::uint32_t),
+                        &group,
+                        sizeof(group));
+            {
+                std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+                stream.write(content.data(), content.size());
+            }
+
+            auto loadedHandler = std::make_shared<CompiledImplementation>();
+            REQUIRE_FALSE(loadedHandler->setFromFile(filename));
+        }
+
+        std::remove(filename.c_str());
+    }
+
+    SECTION("Changed keys")
+    {
+        auto modifiedHandler = std::make_shared<CompiledImplementation>();
+        REQUIRE(modifiedHandler->compile(originalHandler));
+        REQUIRE(handler->getChangedKeys(*modifiedHandler).empty());
+
+        modifiedHandler->setParameter("pi", 3.1415);
+        modifiedHandler->getGroup("CARTOONS").lock()->getGroup("MOVIES").lock()->setParameter(
+            "gains",
+            std::vector<double>{1.0, 2.5, -4.0});
+        REQUIRE(handler->getChangedKeys(*modifiedHandler)
+                == std::vector<std::string>{"pi", "CARTOONS/MOVIES/gains"});
+
+        originalHandler->setParameter("e", 2.71);
+        REQUIRE(modifiedHandler->compile(originalHandler));
+        REQUIRE(handler->getChangedKeys(*modifiedHandler) == std::vector<std::string>{"e"});
+    }
+
+    SECTION("Many parameters")
+    {
+        auto largeHandler = std::make_shared<StdImplementation>();
+        for (int i = 0; i < 1000; i++)
+        {
+            largeHandler->setParameter("parameter_" + std::to_string(i), i);
+        }
+        REQUIRE(handler->compile(largeHandler));
+        for (int i = 0; i < 1000; i++)
+        {
+            int value;
+            REQUIRE(handler->getParameter("parameter_" + std::to_string(i), value));
+            REQUIRE(value == i);
+        }
+    }
+}
@@ -13,6 +13,7 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include <BipedalLocomotion/GenericContainer/Vector.h>
+#include <BipedalLocomotion/ParametersHandler/CompiledImplementation.h>
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/ParametersHandler/TomlImplementation.h>
 
@@ -179,4 +180,50 @@ TEST_CASE("Get parameters")
         parameterHandler->clear();
         REQUIRE(parameterHandler->isEmpty());
     }
+
+    SECTION("Compile")
+    {
+        IParametersHandler::shared_ptr setGroup = std::make_shared<TomlImplementation>();
+        setGroup->setParameter("Donald's nephews", donaldsNephews);
+        REQUIRE(parameterHandler->setGroup("CARTOONS", setGroup));
+
+        auto compiledHandler = std::make_shared<CompiledImplementation>();
+        REQUIRE(compiledHandler->compile(parameterHandler));
+
+        int integer;
+        REQUIRE(compiledHandler->getParameter("answer_to_the_ultimate_question_of_life", integer));
+        REQUIRE(integer == 42);
+
+        double pi;
+        REQUIRE(compiledHandler->getParameter("pi", pi));
+        REQUIRE(pi == 3.14);
+
+        std::string john;
+        REQUIRE(compiledHandler->getParameter("John", john));
+        REQUIRE(john == "Smith");
+
+        bool flag;
+        REQUIRE(compiledHandler->getParameter("flag", flag));
+        REQUIRE(flag);
+        REQUIRE_FALSE(compiledHandler->getParameter("flag", integer));
+
+        std::chrono::nanoseconds time, expectedTime;
+        REQUIRE(parameterHandler->getParameter("time", expectedTime));
+        REQUIRE(compiledHandler->getParameter("time", time));
+        REQUIRE(time == expectedTime);
+
+        std::vector<int> fibonacci;
+        REQUIRE(compiledHandler->getParameter("Fibonacci Numbers", fibonacci));
+        REQUIRE(fibonacci == fibonacciNumbers);
+
+        std::vector<bool> retrievedFlags;
+        REQUIRE(compiledHandler->getParameter("flags", retrievedFlags));
+        REQUIRE(retrievedFlags == flags);
+
+        auto cartoonsGroup = compiledHandler->getGroup("CARTOONS").lock();
+        REQUIRE(cartoonsGroup);
+        std::vector<std::string> nephews;
+        REQUIRE(cartoonsGroup->getParameter("Donald's nephews", nephews));
+        REQUIRE(nephews == donaldsNephews);
+    }
 }
@@ -20,6 +20,7 @@
 #include <yarp/os/Bottle.h>
 
 #include <BipedalLocomotion/GenericContainer/Vector.h>
+#include <BipedalLocomotion/ParametersHandler/CompiledImplementation.h>
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/ParametersHandler/YarpImplementation.h>
 
@@ -348,6 +349,54 @@ TEST_CASE("Get parameters")
         }
     }
 
+    SECTION("Compile")
+    {
+        IParametersHandler::shared_ptr setGroup = std::make_shared<YarpImplementation>();
+        setGroup->setParameter("Donald's nephews", donaldsNephews);
+        REQUIRE(parameterHandler->setGroup("CARTOONS", setGroup));
+
+        auto compiledHandler = std::make_shared<CompiledImplementation>();
+        REQUIRE(compiledHandler->compile(parameterHandler));
+
+        // YARP returns an integer also when a bool is requested, the integer must not be
+        // compiled as a bool
+        int integer;
+        REQUIRE(compiledHandler->getParameter("answer_to_the_ultimate_question_of_life", integer));
+        REQUIRE(integer == 42);
+
+        double pi;
+        REQUIRE(compiledHandler->getParameter("pi", pi));
+        REQUIRE(pi == 3.14);
+
+        std::string john;
+        REQUIRE(compiledHandler->getParameter("John", john));
+        REQUIRE(john == "Smith");
+
+        bool element;
+        REQUIRE(compiledHandler->getParameter("flag", element));
+        REQUIRE(element == flag);
+
+        std::chrono::nanoseconds retrievedTime;
+        REQUIRE(compiledHandler->getParameter("time", retrievedTime));
+        REQUIRE(retrievedTime == time);
+        REQUIRE(compiledHandler->getParameter("time_as_double", retrievedTime));
+        REQUIRE(retrievedTime == std::chrono::duration<double>(timeAsDouble));
+
+        std::vector<int> fibonacci;
+        REQUIRE(compiledHandler->getParameter("Fibonacci Numbers", fibonacci));
+        REQUIRE(fibonacci == fibonacciNumbers);
+
+        std::vector<bool> retrievedFlags;
+        REQUIRE(compiledHandler->getParameter("flags", retrievedFlags));
+        REQUIRE(retrievedFlags == flags);
+
+        auto cartoonsGroup = compiledHandler->getGroup("CARTOONS").lock();
+        REQUIRE(cartoonsGroup);
+        std::vector<std::string> nephews;
+        REQUIRE(cartoonsGroup->getParameter("Donald's nephews", nephews));
+        REQUIRE(nephews == donaldsNephews);
+    }
+
     SECTION("Clone")
     {
         IParametersHandler::shared_ptr setGroup = std::make_shared<YarpImplementation>();
@@ -32,6 +32,9 @@ namespace Capture {
 *  |       `stream_ir`       |     `boolean`     |      flag to enable streaming IR images       |     No    |     false     |
 *  |       `stream_pcl`      |     `boolean`     |      flag to enable streaming pointcloud      |     No    |     false     |
 *  | `align_frames_to_color` |     `boolean`     |    flag to align other images to BGR images   |     No    |     false     |
+*
+* The optional group `POINT_CLOUD_COMPRESSION` contains the parameters of the
+* Compression::PointCloudEncoder used by getCompressedPointCloud().
 */
 
 class RealSense : public BipedalLocomotion::RobotInterface::ICameraBridge,
@@ -81,6 +84,11 @@ public:
                   pcl::PointCloud<pcl::PointXYZRGB>::Ptr coloredPointCloud,
                   std::optional<std::reference_wrapper<double>> receiveTimeInSeconds = {}) final;
 
+    bool getCompressedPointCloud(
+        const std::string& pclDevName,
+        BipedalLocomotion::RobotInterface::CompressedPointCloud& compressedPointCloud,
+        std::optional<std::reference_wrapper<double>> receiveTimeInSeconds = {}) final;
+
     /**
      * Get the stored metadata.
      * @return a const reference to the metadata
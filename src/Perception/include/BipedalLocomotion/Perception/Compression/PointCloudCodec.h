@@ -0,0 +1,120 @@
+/**
+ * @file PointCloudCodec.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_PERCEPTION_COMPRESSION_POINT_CLOUD_CODEC_H
+#define BIPEDAL_LOCOMOTION_PERCEPTION_COMPRESSION_POINT_CLOUD_CODEC_H
+
+#include <functional>
+#include <memory>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/RobotInterface/IPointCloudBridge.h>
+
+namespace BipedalLocomotion
+{
+namespace Perception
+{
+namespace Compression
+{
+
+/**
+ * PointCloudEncoder decimates a point cloud on a voxel grid and encodes the result in a
+ * RobotInterface::CompressedPointCloud. All the points belonging to the same voxel are replaced
+ * by their centroid (the color is averaged as well). The centroids are then quantized with a
+ * 16-bit integer per axis, sorted and delta compressed.
+ * The internal buffers, including the open addressing hash table used to find the voxels, are
+ * reused. Hence once the size of the input cloud is stable, encoding into the same
+ * CompressedPointCloud does not allocate memory.
+ *
+ * The following parameters are used to initialize the class
+ *
+ * | Parameter Name |   Type   |                               Description                                     | Mandatory | Default Value |
+ * |:--------------:|:--------:|:-----------------------------------------------------------------------------:|:---------:|:-------------:|
+ * |  `voxel_size`  | `double` | Edge of the voxel used for decimation in meters. If 0 the cloud is not decimated. |    No     |     0.01      |
+ * |  `resolution`  | `double` | Quantization step in meters. If 0 it is computed from the extent of each cloud. |    No     |      0.0      |
+ */
+class PointCloudEncoder
+{
+public:
+    /**
+     * Constructor.
+     */
+    PointCloudEncoder();
+
+    /**
+     * Destructor.
+     */
+    ~PointCloudEncoder();
+
+    /**
+     * Initialize the encoder.
+     * @param handler pointer to the parameter handler.
+     * @return true in case of success, false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
+
+    /**
+     * Encode a point cloud.
+     * @param cloud the input point cloud. Points having non finite coordinates are discarded.
+     * @param compressed the compressed point cloud.
+     * @return true in case of success, false otherwise.
+     */
+    bool encode(const pcl::PointCloud<pcl::PointXYZRGB>& cloud,
+                RobotInterface::CompressedPointCloud& compressed);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+/**
+ * PointCloudDecoder decodes a RobotInterface::CompressedPointCloud. Setting the input is
+ * inexpensive, the data is decoded only when the points are requested by the user.
+ * @warning The decoder stores a reference to the compressed point cloud passed to
+ * PointCloudDecoder::setInput, the user must guarantee that the object outlives the decoder.
+ */
+class PointCloudDecoder
+{
+public:
+    /**
+     * Set the compressed point cloud.
+     * @param compressed the compressed point cloud.
+     * @return true in case of success, false otherwise.
+     */
+    bool setInput(const RobotInterface::CompressedPointCloud& compressed);
+
+    /**
+     * Get the number of points contained in the compressed point cloud.
+     * @return the number of points.
+     */
+    std::size_t size() const;
+
+    /**
+     * Decode all the points and call the visitor on each of them. No memory is allocated.
+     * @param visitor function called for each decoded point.
+     * @return true in case of success, false otherwise.
+     */
+    bool forEachPoint(const std::function<void(const pcl::PointXYZRGB&)>& visitor) const;
+
+    /**
+     * Decode all the points in a pcl point cloud.
+     * @param cloud the decoded point cloud.
+     * @return true in case of success, false otherwise.
+     */
+    bool decode(pcl::PointCloud<pcl::PointXYZRGB>& cloud) const;
+
+private:
+    const RobotInterface::CompressedPointCloud* m_input{nullptr};
+};
+
+} // namespace Compression
+} // namespace Perception
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_PERCEPTION_COMPRESSION_POINT_CLOUD_CODEC_H
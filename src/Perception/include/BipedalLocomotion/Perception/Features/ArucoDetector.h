@@ -14,6 +14,7 @@
 #include <Eigen/Dense>
 #include <opencv2/core.hpp>
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 
@@ -59,6 +60,28 @@ struct ArucoDetectorOutput
     double timeNow{-1.0};
 };
 
+/**
+ * Statistics of the last call of ArucoDetector::advance
+ */
+struct ArucoDetectorStatistics
+{
+    bool isFullFrameSearch{true}; /**< True if the markers have been searched in the whole image */
+    std::size_t numberOfRegionsOfInterest{0}; /**< Number of regions of interest searched */
+    std::chrono::nanoseconds predictionDuration{0}; /**< Time spent to predict the regions */
+    std::chrono::nanoseconds detectionDuration{0}; /**< Time spent to detect the markers */
+    std::chrono::nanoseconds poseEstimationDuration{0}; /**< Time spent to estimate the poses */
+};
+
+/**
+ * ArucoDetector detects the Aruco markers in an image and estimates their pose in the camera frame.
+ *
+ * If the tracking is enabled, the markers detected in the previous frame are not searched in the
+ * whole image. Their pose is predicted assuming a constant linear velocity and the corners are
+ * projected in the image. The markers are then searched only in the regions of interest around
+ * the projected corners. The whole image is searched again
+ * - every `full_frame_search_period` frames, to detect the markers entering the field of view;
+ * - when a tracked marker is not found in its region of interest.
+ */
 class ArucoDetector : public System::Source<ArucoDetectorOutput>
 {
 public:
@@ -78,6 +101,15 @@ public:
      * - "marker_length" marker length in m
      * - "camera_matrix" 9d vector representing the camera calbration matrix in row major order
      * - "distortion_coefficients" 5d vector containing camera distortion coefficients
+     * The following parameters are optional:
+     * - "enable_tracking" if true the markers are searched in the regions of interest predicted
+     * from the previous detections (default false)
+     * - "full_frame_search_period" number of frames between two searches in the whole image when
+     * the tracking is enabled (default 30)
+     * - "roi_margin" margin added to each side of the regions of interest, as a fraction of the
+     * size of the projected marker (default 0.5)
+     * - "profiling_period" if positive, the average duration of the stages of the detector is
+     * printed every "profiling_period" frames (default 0)
      * @param[in] handlerWeak weak pointer to a ParametersHandler::IParametersHandler interface
      * @tparameter Derived particular implementation of the IParameterHandler
      * @return True in case of success, false otherwise.
@@ -131,6 +163,12 @@ public:
      */
     bool isOutputValid() const final;
 
+    /**
+     * Get the statistics of the last call of advance.
+     * @return a struct containing the duration of each stage of the detector.
+     */
+    const ArucoDetectorStatistics& getStatistics() const;
+
 private:
     class Impl;
     std::unique_ptr<Impl> m_pimpl;
@@ -7,16 +7,23 @@
 #define BIPEDAL_LOCOMOTION_PERCEPTION_PCL_PROCESSOR_H
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/Perception/Features/VoxelHashGrid.h>
+#include <BipedalLocomotion/System/WorkerPool.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
-#include <pcl/filters/voxel_grid.h>
-#include <pcl/filters/statistical_outlier_removal.h>
-#include <pcl/kdtree/kdtree.h>
-#include <pcl/segmentation/extract_clusters.h>
+#include <pcl/PointIndices.h>
+#include <pcl/common/centroid.h>
 #include <pcl/common/transforms.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace BipedalLocomotion {
 
 namespace Perception {
@@ -33,6 +40,8 @@ struct PCLProcessorParameters
     double spatialClusterTolerance{0.02}; /**< spatial distance in meters to consider the Euclidean clustering of points (L2 euclidean norm) */
     int minNrPointsInCluster{10}; /**< minimum number of points required to detect a cluster */
     int maxNrPointsInCluster{1000};  /**< maximum number of points allowed in a detected cluster */
+
+    int numberOfThreads{0}; /**< number of threads used to process the point clouds. If zero all the hardware threads are used */
 };
 
 /**
@@ -42,6 +51,11 @@ struct PCLProcessorParameters
  * - Remove outliers
  * - Extract spatial clusters of point cloud
  * - Transform a point cloud
+ *
+ * The downsampling, the outlier removal and the cluster extraction are computed in parallel by a
+ * pool of threads created in initialize. They are based on a VoxelHashGrid that is kept between
+ * the calls, as all the other buffers. Hence, once the clouds reached their maximum size, these
+ * operations do not allocate memory. The output clouds can be the same as the input ones.
  */
 template <class PointType>
 class PointCloudProcessor
@@ -50,10 +64,27 @@ public:
     PointCloudProcessor();
     ~PointCloudProcessor() = default;
 
+    /**
+     * Initialize the processor.
+     * @param handler pointer to the parameter handler.
+     * @note The following parameters are optional
+     * |               Parameter Name              |    Type    |                                 Description                                  | Default Value |
+     * |:-----------------------------------------:|:----------:|:----------------------------------------------------------------------------:|:-------------:|
+     * |          `downsample_voxel_size`          | `double[3]`|                  Size of the voxels used for the downsampling.                |(0.05, 0.05, 0.05)|
+     * |     `nr_points_for_outlier_estimation`    |   `int`    |          Number of neighbors used for the statistical outlier removal.       |     100       |
+     * | `std_dev_multiplier_for_outlier_estimation`|  `double`  |        Multiplier of the standard deviation of the mean distances.           |     1.0       |
+     * |        `spatial_cluster_tolerance`        |  `double`  |           Distance between two points belonging to the same cluster.         |     0.02      |
+     * |        `min_points_for_clustering`        |   `int`    |                    Minimum number of points in a cluster.                    |      10       |
+     * |        `max_points_for_clustering`        |   `int`    |                    Maximum number of points in a cluster.                    |     1000      |
+     * |            `number_of_threads`            |   `int`    |     Number of threads. If zero, all the hardware threads are used.           |       0       |
+     * @return true in case of success, false otherwise.
+     */
     bool initialize(std::weak_ptr<BipedalLocomotion::ParametersHandler::IParametersHandler> handler);
 
     /**
-     * Downsample the point cloud using voxel grid filter
+     * Downsample the point cloud using voxel grid filter. The points contained in the same voxel
+     * are replaced by their centroid. The voxels are the same of `pcl::VoxelGrid`, while the order
+     * of the output points may differ.
      * See https://pcl.readthedocs.io/projects/tutorials/en/latest/voxel_grid.html#voxelgrid
      */
     bool downsample(const typename pcl::PointCloud<PointType>::Ptr inCloud,
@@ -62,6 +93,9 @@ public:
     /**
      * Remove outliers from point cloud based on nearest neighbors
      * See https://pcl.readthedocs.io/projects/tutorials/en/latest/statistical_outlier.html#statistical-outlier-removal
+     * @note The nearest neighbors are searched in a voxel grid having the size of the voxels
+     * proportional to `downsample_voxel_size`. Hence, the search is faster if the cloud has been
+     * downsampled.
      */
     bool removeOutliers(const typename pcl::PointCloud<PointType>::Ptr inCloud,
                         typename pcl::PointCloud<PointType>::Ptr outCloud);
@@ -69,6 +103,9 @@ public:
     /**
      * Extract Euclidean clustering based point cloud clusters
      * See https://pcl.readthedocs.io/projects/tutorials/en/latest/cluster_extraction.html#cluster-extraction
+     * The clusters are sorted by decreasing size and the indices of each cluster are sorted.
+     * @note The memory of the elements already contained in clusterIndices is reused. The same
+     * holds for the clouds in cloudClusters that are not shared with other objects.
      */
     bool extractClusters(const typename pcl::PointCloud<PointType>::Ptr inCloud,
                          std::vector<pcl::PointIndices>& clusterIndices,
@@ -93,14 +130,50 @@ public:
 
 private:
     bool checkInitialization();
-    void updateInternalParameters();
+
+    /**
+     * Copy the header of the input cloud and resize the output one.
+     * @return the cloud where the output has to be written, i.e. an internal buffer if the input
+     * and the output are the same cloud.
+     */
+    pcl::PointCloud<PointType>& prepareOutput(const pcl::PointCloud<PointType>& inCloud,
+                                              pcl::PointCloud<PointType>& outCloud,
+                                              std::size_t size);
+
+    /**
+     * Set the output cloud once it has been filled.
+     */
+    void finalizeOutput(pcl::PointCloud<PointType>& buffer, pcl::PointCloud<PointType>& outCloud);
+
+    /**
+     * Get the root of the cluster containing a point.
+     */
+    int findRoot(int index);
+
+    /**
+     * Merge the clusters containing two points. The root of a cluster is its point with the
+     * smallest index.
+     */
+    void mergeClusters(int first, int second);
 
     bool m_initialized{false};
-    pcl::VoxelGrid<PointType> m_voxelGridFilter;
-    pcl::StatisticalOutlierRemoval<PointType> m_outlierRemover;
-    typename pcl::search::KdTree<PointType>::Ptr m_kdTree;
-    pcl::EuclideanClusterExtraction<PointType> m_clusterExtractor;
     PCLProcessorParameters m_params;
+
+    std::unique_ptr<System::WorkerPool> m_pool; /**< Threads used to process the clouds. */
+    VoxelHashGrid<PointType> m_grid; /**< Spatial index reused by all the operations. */
+    pcl::PointCloud<PointType> m_buffer; /**< Output used when the output is also the input. */
+
+    std::vector<float> m_meanDistances; /**< Mean distance of each point from its neighbors. */
+    std::vector<std::vector<std::pair<float, int>>> m_neighbors; /**< Neighbors for each thread. */
+    std::vector<double> m_partialSum; /**< Sum of the mean distances for each thread. */
+    std::vector<double> m_partialSquaredSum; /**< Sum of the squared mean distances for each thread. */
+    std::vector<std::size_t> m_partialCount; /**< Number of points for each thread. */
+
+    std::unique_ptr<std::atomic<int>[]> m_parent; /**< Union-find forest of the clusters. */
+    std::size_t m_parentCapacity{0}; /**< Size of m_parent. */
+    std::vector<int> m_clusterOfPoint; /**< Root of the cluster of each point or its cluster index. */
+    std::vector<int> m_clusterSize; /**< Number of points of the cluster having a given root. */
+    std::vector<int> m_clusterRoots; /**< Roots of the valid clusters, sorted by size. */
 };
 
 template <class PointType>
@@ -154,26 +227,40 @@ bool PointCloudProcessor<PointType>::initialize(std::weak_ptr<BipedalLocomotion:
                     "Using default name \"1000\".", logPrefix);
     }
 
-    m_kdTree = pcl::make_shared< pcl::search::KdTree<PointType> >();
-    updateInternalParameters();
-    m_initialized = true;
-    return true;
-}
+    if (!ptr->getParameter("number_of_threads", m_params.numberOfThreads))
+    {
+        log()->warn("{} Parameter \"number_of_threads\" not available in the configuration."
+                    "Using default name \"0\", i.e. all the hardware threads.", logPrefix);
+    }
 
+    if (m_params.numberOfThreads < 0)
+    {
+        log()->error("{} The number of threads must be non negative.", logPrefix);
+        return false;
+    }
 
-template <class PointType>
-void PointCloudProcessor<PointType>::updateInternalParameters()
-{
-    m_voxelGridFilter.setLeafSize(m_params.voxelSizeDownsampling[0],
-                                  m_params.voxelSizeDownsampling[1],
-                                  m_params.voxelSizeDownsampling[2]);
+    if (m_params.spatialClusterTolerance <= 0
+        || *std::min_element(m_params.voxelSizeDownsampling.begin(),
+                             m_params.voxelSizeDownsampling.end()) <= 0)
+    {
+        log()->error("{} The voxel size and the cluster tolerance must be positive.", logPrefix);
+        return false;
+    }
+
+    m_pool = std::make_unique<System::WorkerPool>(m_params.numberOfThreads);
 
-    m_outlierRemover.setMeanK(m_params.nrPointsForOutlierEstimation);
-    m_outlierRemover.setStddevMulThresh(m_params.multiplierForOutlierStdDev);
+    const std::size_t numberOfThreads = m_pool->size();
+    m_neighbors.resize(numberOfThreads);
+    for (auto& neighbors : m_neighbors)
+    {
+        neighbors.reserve(std::max(m_params.nrPointsForOutlierEstimation, 0));
+    }
+    m_partialSum.resize(numberOfThreads);
+    m_partialSquaredSum.resize(numberOfThreads);
+    m_partialCount.resize(numberOfThreads);
 
-    m_clusterExtractor.setClusterTolerance(m_params.spatialClusterTolerance);
-    m_clusterExtractor.setMinClusterSize(m_params.minNrPointsInCluster);
-    m_clusterExtractor.setMaxClusterSize(m_params.maxNrPointsInCluster);
+    m_initialized = true;
+    return true;
 }
 
 template <class PointType>
@@ -189,6 +276,43 @@ bool PointCloudProcessor<PointType>::checkInitialization()
     return true;
 }
 
+template <class PointType>
+pcl::PointCloud<PointType>&
+PointCloudProcessor<PointType>::prepareOutput(const pcl::PointCloud<PointType>& inCloud,
+                                              pcl::PointCloud<PointType>& outCloud,
+                                              std::size_t size)
+{
+    // the input is read while the output is written, hence they cannot be the same cloud
+    pcl::PointCloud<PointType>& output = (&inCloud == &outCloud) ? m_buffer : outCloud;
+    output.header = inCloud.header;
+    output.sensor_origin_ = inCloud.sensor_origin_;
+    output.sensor_orientation_ = inCloud.sensor_orientation_;
+    output.points.resize(size);
+    output.width = static_cast<std::uint32_t>(size);
+    output.height = 1;
+    output.is_dense = true;
+    return output;
+}
+
+template <class PointType>
+void PointCloudProcessor<PointType>::finalizeOutput(pcl::PointCloud<PointType>& buffer,
+                                                    pcl::PointCloud<PointType>& outCloud)
+{
+    if (&buffer == &outCloud)
+    {
+        return;
+    }
+
+    // swapping the points keeps the memory of both the clouds
+    outCloud.points.swap(buffer.points);
+    outCloud.header = buffer.header;
+    outCloud.sensor_origin_ = buffer.sensor_origin_;
+    outCloud.sensor_orientation_ = buffer.sensor_orientation_;
+    outCloud.width = buffer.width;
+    outCloud.height = buffer.height;
+    outCloud.is_dense = buffer.is_dense;
+}
+
 template <class PointType>
 bool PointCloudProcessor<PointType>::downsample(const typename pcl::PointCloud<PointType>::Ptr inCloud,
                                                 typename pcl::PointCloud<PointType>::Ptr outCloud)
@@ -198,45 +322,46 @@ bool PointCloudProcessor<PointType>::downsample(const typename pcl::PointCloud<P
         return false;
     }
 
-    if (inCloud == nullptr)
+    if (inCloud == nullptr || outCloud == nullptr)
     {
         log()->error("[PointCloudProcessor::downsample] Invalid pointer");
         return false;
     }
 
-    if ((inCloud->size() / m_params.voxelSizeDownsampling[0]) >= std::numeric_limits<int>::max())
+    if (inCloud->size() <= m_params.nrPointsForOutlierEstimation)
     {
-        log()->warn("[PointCloudProcessor::downsample] "
-                    " Input point cloud size too large for given voxel size x"
-                    " This might cause overflow. Returning without any action.");
+        log()->error("[PointCloudProcessor::downsample] "
+                     "Input point cloud size less than minimium required points for downsampling.");
         return false;
     }
 
-    if ((inCloud->size() / m_params.voxelSizeDownsampling[1]) >= std::numeric_limits<int>::max())
+    const Eigen::Vector3f voxelSize
+        = Eigen::Map<const Eigen::Vector3d>(m_params.voxelSizeDownsampling.data()).cast<float>();
+    if (!m_grid.build(*inCloud, voxelSize, *m_pool))
     {
-        log()->warn("[PointCloudProcessor::downsample] "
-                    " Input point cloud size too large for given voxel size y"
-                    " This might cause overflow. Returning without any action.");
+        log()->error("[PointCloudProcessor::downsample] Unable to build the voxel grid.");
         return false;
     }
 
-    if ((inCloud->size() / m_params.voxelSizeDownsampling[2]) >= std::numeric_limits<int>::max())
-    {
-        log()->warn("[PointCloudProcessor::downsample] "
-                    " Input point cloud size too large for given voxel size z"
-                    " This might cause overflow. Returning without any action.");
-        return false;
-    }
+    auto& output = this->prepareOutput(*inCloud, *outCloud, m_grid.getNumberOfVoxels());
 
-    if (inCloud->size() <= m_params.nrPointsForOutlierEstimation)
-    {
-        log()->error("[PointCloudProcessor::downsample] "
-                     "Input point cloud size less than minimium required points for downsampling.");
-        return false;
-    }
+    auto computeCentroids = [&](std::size_t thread) {
+        const auto [begin, end]
+            = System::WorkerPool::getChunk(m_grid.getNumberOfVoxels(), m_pool->size(), thread);
+        for (std::size_t voxel = begin; voxel < end; voxel++)
+        {
+            // all the fields of the points are averaged
+            pcl::CentroidPoint<PointType> centroid;
+            for (const int index : m_grid.getVoxel(voxel))
+            {
+                centroid.add((*inCloud)[index]);
+            }
+            centroid.get(output[voxel]);
+        }
+    };
+    m_pool->run(computeCentroids);
 
-    m_voxelGridFilter.setInputCloud(inCloud);
-    m_voxelGridFilter.filter(*outCloud);
+    this->finalizeOutput(output, *outCloud);
     return true;
 }
 
@@ -249,7 +374,7 @@ bool PointCloudProcessor<PointType>::removeOutliers(const typename pcl::PointClo
         return false;
     }
 
-    if (inCloud == nullptr)
+    if (inCloud == nullptr || outCloud == nullptr)
     {
         log()->error("[PointCloudProcessor::removeOutliers] Invalid pointer");
         return false;
@@ -262,11 +387,159 @@ bool PointCloudProcessor<PointType>::removeOutliers(const typename pcl::PointClo
         return false;
     }
 
-    m_outlierRemover.setInputCloud(inCloud);
-    m_outlierRemover.filter(*outCloud);
+    // assuming the points are on a surface with a spacing equal to the downsampling voxel size, a
+    // voxel contains about k / pi points. So the neighbors are usually found in the first shells
+    const std::size_t k = static_cast<std::size_t>(std::max(m_params.nrPointsForOutlierEstimation, 1));
+    const float voxelSize = static_cast<float>(*std::max_element(m_params.voxelSizeDownsampling.begin(),
+                                                                 m_params.voxelSizeDownsampling.end())
+                                               * std::max(1.0, std::sqrt(k / M_PI)));
+    if (!m_grid.build(*inCloud, Eigen::Vector3f::Constant(voxelSize), *m_pool))
+    {
+        log()->error("[PointCloudProcessor::removeOutliers] Unable to build the voxel grid.");
+        return false;
+    }
+
+    const std::size_t numberOfPoints = inCloud->size();
+    const std::size_t numberOfThreads = m_pool->size();
+    m_meanDistances.resize(numberOfPoints);
+
+    // the mean distance is NaN for the points to be removed in any case
+    auto computeMeanDistances = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        auto& neighbors = m_neighbors[thread];
+        double sum = 0;
+        double squaredSum = 0;
+        std::size_t count = 0;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            if (!m_grid.isPointValid(i))
+            {
+                m_meanDistances[i] = std::numeric_limits<float>::quiet_NaN();
+                continue;
+            }
+
+            if (m_grid.nearestKSearch((*inCloud)[i], k, static_cast<int>(i), neighbors) == 0)
+            {
+                m_meanDistances[i] = 0;
+                continue;
+            }
+
+            double distance = 0;
+            for (const auto& neighbor : neighbors)
+            {
+                distance += std::sqrt(neighbor.first);
+            }
+            distance /= neighbors.size();
+
+            m_meanDistances[i] = static_cast<float>(distance);
+            sum += distance;
+            squaredSum += distance * distance;
+            count++;
+        }
+        m_partialSum[thread] = sum;
+        m_partialSquaredSum[thread] = squaredSum;
+        m_partialCount[thread] = count;
+    };
+    m_pool->run(computeMeanDistances);
+
+    double sum = 0;
+    double squaredSum = 0;
+    std::size_t count = 0;
+    for (std::size_t thread = 0; thread < numberOfThreads; thread++)
+    {
+        sum += m_partialSum[thread];
+        squaredSum += m_partialSquaredSum[thread];
+        count += m_partialCount[thread];
+    }
+
+    const double mean = count == 0 ? 0.0 : sum / count;
+    const double variance = count < 2 ? 0.0 : (squaredSum - sum * sum / count) / (count - 1);
+    const float threshold
+        = static_cast<float>(mean + m_params.multiplierForOutlierStdDev * std::sqrt(std::max(variance, 0.0)));
+
+    // count the inliers of each chunk and compute where they have to be copied
+    auto countInliers = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        m_partialCount[thread] = std::count_if(m_meanDistances.begin() + begin,
+                                               m_meanDistances.begin() + end,
+                                               [threshold](float distance) {
+                                                   return distance <= threshold;
+                                               });
+    };
+    m_pool->run(countInliers);
+
+    std::size_t numberOfInliers = 0;
+    for (std::size_t thread = 0; thread < numberOfThreads; thread++)
+    {
+        const std::size_t inliers = m_partialCount[thread];
+        m_partialCount[thread] = numberOfInliers;
+        numberOfInliers += inliers;
+    }
+
+    auto& output = this->prepareOutput(*inCloud, *outCloud, numberOfInliers);
+
+    auto copyInliers = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        std::size_t cursor = m_partialCount[thread];
+        for (std::size_t i = begin; i < end; i++)
+        {
+            if (m_meanDistances[i] <= threshold)
+            {
+                output[cursor++] = (*inCloud)[i];
+            }
+        }
+    };
+    m_pool->run(copyInliers);
+
+    this->finalizeOutput(output, *outCloud);
     return true;
 }
 
+template <class PointType>
+int PointCloudProcessor<PointType>::findRoot(int index)
+{
+    int parent = m_parent[index].load();
+    while (parent != index)
+    {
+        // path halving. It is safe since the parents can only decrease
+        int grandParent = m_parent[parent].load();
+        if (grandParent != parent)
+        {
+            m_parent[index].compare_exchange_weak(parent, grandParent);
+        }
+        index = grandParent;
+        parent = m_parent[index].load();
+    }
+    return index;
+}
+
+template <class PointType>
+void PointCloudProcessor<PointType>::mergeClusters(int first, int second)
+{
+    while (true)
+    {
+        first = this->findRoot(first);
+        second = this->findRoot(second);
+        if (first == second)
+        {
+            return;
+        }
+
+        // the root with the largest index is attached to the other one. If it is no longer a root
+        // another thread modified it and the roots are searched again
+        if (first < second)
+        {
+            std::swap(first, second);
+        }
+
+        int expected = first;
+        if (m_parent[first].compare_exchange_strong(expected, second))
+        {
+            return;
+        }
+    }
+}
+
 template <class PointType>
 bool PointCloudProcessor<PointType>::extractClusters(const typename pcl::PointCloud<PointType>::Ptr inCloud,
                                                      std::vector<pcl::PointIndices>& clusterIndices,
@@ -290,26 +563,145 @@ bool PointCloudProcessor<PointType>::extractClusters(const typename pcl::PointCl
         return false;
     }
 
-    cloudClusters.clear();
-    clusterIndices.clear();
-    m_kdTree->setInputCloud(inCloud);
-    m_clusterExtractor.setSearchMethod(m_kdTree);
-    m_clusterExtractor.setInputCloud(inCloud);
-    m_clusterExtractor.extract(clusterIndices);
+    // with this voxel size the neighbors of a point are in the 27 voxels around it
+    const float tolerance = static_cast<float>(m_params.spatialClusterTolerance);
+    if (!m_grid.build(*inCloud, Eigen::Vector3f::Constant(tolerance), *m_pool))
+    {
+        log()->error("[PointCloudProcessor::extractClusters] Unable to build the voxel grid.");
+        return false;
+    }
 
-    for (auto it = clusterIndices.begin(); it != clusterIndices.end(); ++it)
+    const std::size_t numberOfPoints = inCloud->size();
+    const std::size_t numberOfThreads = m_pool->size();
+    if (m_parentCapacity < numberOfPoints)
     {
-        auto clusteredCloud =  pcl::make_shared<pcl::PointCloud<PointType>>();
-        for (auto pit = it->indices.begin(); pit != it->indices.end(); ++pit)
+        m_parent = std::make_unique<std::atomic<int>[]>(numberOfPoints);
+        m_parentCapacity = numberOfPoints;
+    }
+    m_clusterOfPoint.resize(numberOfPoints);
+    m_clusterSize.resize(numberOfPoints);
+
+    auto resetClusters = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        for (std::size_t i = begin; i < end; i++)
         {
-            clusteredCloud->push_back ((*inCloud)[*pit]);
+            m_parent[i].store(static_cast<int>(i));
+            m_clusterSize[i] = 0;
         }
-        clusteredCloud->width = clusteredCloud->size();
-        clusteredCloud->height = 1;
-        clusteredCloud->is_dense = false;
+    };
+    m_pool->run(resetClusters);
 
-        cloudClusters.emplace_back(clusteredCloud);
+    // grow the clusters in parallel. Each pair of neighbors is merged once
+    auto growClusters = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        for (std::size_t i = begin; i < end; i++)
+        {
+            if (!m_grid.isPointValid(i))
+            {
+                continue;
+            }
+
+            const int index = static_cast<int>(i);
+            m_grid.radiusSearch((*inCloud)[i], tolerance, [&](int neighbor, float) {
+                if (neighbor > index)
+                {
+                    this->mergeClusters(index, neighbor);
+                }
+            });
+        }
+    };
+    m_pool->run(growClusters);
+
+    auto findRoots = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        for (std::size_t i = begin; i < end; i++)
+        {
+            m_clusterOfPoint[i] = m_grid.isPointValid(i) ? this->findRoot(static_cast<int>(i)) : -1;
+        }
+    };
+    m_pool->run(findRoots);
+
+    // select the clusters with a valid size and sort them as pcl::EuclideanClusterExtraction
+    for (std::size_t i = 0; i < numberOfPoints; i++)
+    {
+        if (m_clusterOfPoint[i] >= 0)
+        {
+            m_clusterSize[m_clusterOfPoint[i]]++;
+        }
+    }
+
+    m_clusterRoots.clear();
+    for (std::size_t i = 0; i < numberOfPoints; i++)
+    {
+        if (m_clusterOfPoint[i] != static_cast<int>(i))
+        {
+            continue;
+        }
+
+        if (m_clusterSize[i] >= m_params.minNrPointsInCluster
+            && m_clusterSize[i] <= m_params.maxNrPointsInCluster)
+        {
+            m_clusterRoots.push_back(static_cast<int>(i));
+        } else
+        {
+            m_clusterSize[i] = -1;
+        }
     }
+    std::sort(m_clusterRoots.begin(), m_clusterRoots.end(), [this](int a, int b) {
+        return m_clusterSize[a] != m_clusterSize[b] ? m_clusterSize[a] > m_clusterSize[b] : a < b;
+    });
+
+    const std::size_t numberOfClusters = m_clusterRoots.size();
+    clusterIndices.resize(numberOfClusters);
+    cloudClusters.resize(numberOfClusters);
+    for (std::size_t cluster = 0; cluster < numberOfClusters; cluster++)
+    {
+        const int root = m_clusterRoots[cluster];
+        clusterIndices[cluster].header = inCloud->header;
+        clusterIndices[cluster].indices.resize(m_clusterSize[root]);
+
+        // a cloud can be reused only if the user does not own it anymore
+        if (cloudClusters[cluster] == nullptr || cloudClusters[cluster].use_count() > 1)
+        {
+            cloudClusters[cluster] = pcl::make_shared<pcl::PointCloud<PointType>>();
+        }
+
+        // from now on the size of the root is replaced by the index of the cluster
+        m_clusterSize[root] = static_cast<int>(cluster);
+    }
+
+    // the indices are filled sequentially so that they are sorted
+    m_clusterRoots.assign(numberOfClusters, 0);
+    for (std::size_t i = 0; i < numberOfPoints; i++)
+    {
+        if (m_clusterOfPoint[i] < 0 || m_clusterSize[m_clusterOfPoint[i]] < 0)
+        {
+            continue;
+        }
+
+        const int cluster = m_clusterSize[m_clusterOfPoint[i]];
+        clusterIndices[cluster].indices[m_clusterRoots[cluster]++] = static_cast<int>(i);
+    }
+
+    auto copyClusters = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfClusters, numberOfThreads, thread);
+        for (std::size_t cluster = begin; cluster < end; cluster++)
+        {
+            const auto& indices = clusterIndices[cluster].indices;
+            auto& clusteredCloud = *cloudClusters[cluster];
+            clusteredCloud.header = inCloud->header;
+            clusteredCloud.points.resize(indices.size());
+            for (std::size_t j = 0; j < indices.size(); j++)
+            {
+                clusteredCloud[j] = (*inCloud)[indices[j]];
+            }
+            clusteredCloud.width = static_cast<std::uint32_t>(indices.size());
+            clusteredCloud.height = 1;
+            clusteredCloud.is_dense = false;
+        }
+    };
+    m_pool->run(copyClusters);
+
     return true;
 }
 
@@ -0,0 +1,599 @@
+/**
+ * @file VoxelHashGrid.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_PERCEPTION_VOXEL_HASH_GRID_H
+#define BIPEDAL_LOCOMOTION_PERCEPTION_VOXEL_HASH_GRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Dense>
+
+#include <pcl/point_cloud.h>
+
+#include <BipedalLocomotion/System/WorkerPool.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace Perception
+{
+namespace Features
+{
+
+/**
+ * VoxelHashGrid groups the points of a cloud in the voxels of a regular grid and allows to search
+ * the neighbors of a point. Only the non-empty voxels are stored, in an open addressing hash table,
+ * hence the memory does not depend on the extent of the cloud. The voxel containing the point
+ * \f$p\f$ has integer coordinates \f$\lfloor p_i / s_i \rfloor\f$, where \f$s\f$ is the voxel size,
+ * i.e. the grid is the same used by `pcl::VoxelGrid`.
+ *
+ * The grid is built in parallel: the keys of the voxels are computed by chunks of points, then each
+ * thread inserts in its own hash table the voxels whose hash is assigned to it, so that no
+ * synchronization is required. The buffers are kept between two calls of VoxelHashGrid::build, so
+ * that building the grid for clouds having at most the same number of points does not allocate
+ * memory.
+ * @note The coordinates of the voxels must be in the range \f$[-2^{20}, 2^{20})\f$. The points
+ * outside this range and the points having a non finite coordinate are discarded.
+ * @note The queries are const and can be called concurrently by different threads.
+ */
+template <class PointType> class VoxelHashGrid
+{
+public:
+    /**
+     * Range of the indices of the points contained in a voxel. The indices are sorted.
+     */
+    struct Voxel
+    {
+        const int* first{nullptr}; /**< Pointer to the first index. */
+        const int* last{nullptr}; /**< Pointer to one past the last index. */
+
+        const int* begin() const
+        {
+            return first;
+        }
+
+        const int* end() const
+        {
+            return last;
+        }
+
+        std::size_t size() const
+        {
+            return static_cast<std::size_t>(last - first);
+        }
+    };
+
+    /**
+     * Build the grid.
+     * @param cloud the point cloud. It must outlive the grid, or at least the queries.
+     * @param voxelSize size of the voxels along x, y and z in meters.
+     * @param pool the threads used to build the grid.
+     * @return true in case of success, false otherwise.
+     */
+    bool build(const pcl::PointCloud<PointType>& cloud,
+               const Eigen::Ref<const Eigen::Vector3f>& voxelSize,
+               System::WorkerPool& pool);
+
+    /**
+     * Get the number of non-empty voxels.
+     * @return the number of voxels.
+     */
+    std::size_t getNumberOfVoxels() const
+    {
+        return m_numberOfVoxels;
+    }
+
+    /**
+     * Get the indices of the points contained in a voxel.
+     * @param index index of the voxel in the range [0, getNumberOfVoxels()).
+     * @return the indices of the points.
+     */
+    Voxel getVoxel(std::size_t index) const
+    {
+        return Voxel{m_sortedPoints.data() + m_voxelBegin[index],
+                     m_sortedPoints.data() + m_voxelEnd[index]};
+    }
+
+    /**
+     * Get the number of points contained in the grid, i.e. the number of points of the cloud
+     * excluding the discarded ones.
+     * @return the number of points.
+     */
+    std::size_t getNumberOfValidPoints() const
+    {
+        return m_ownerOffset.empty() ? 0 : m_ownerOffset[m_numberOfOwners];
+    }
+
+    /**
+     * Check if a point of the cloud is contained in the grid.
+     * @param index index of the point in the cloud.
+     * @return false if the point has been discarded, true otherwise.
+     */
+    bool isPointValid(std::size_t index) const
+    {
+        return m_keys[index] != invalidKey;
+    }
+
+    /**
+     * Find the voxel with given coordinates.
+     * @param coordinates integer coordinates of the voxel.
+     * @return the index of the voxel or -1 if the voxel is empty.
+     */
+    std::ptrdiff_t findVoxel(const Eigen::Vector3i& coordinates) const;
+
+    /**
+     * Call `visitor(index, squaredDistance)` for all the points of the grid having a distance
+     * from a given point less than or equal to a radius.
+     * @param point the query point.
+     * @param radius the radius in meters.
+     * @param visitor the function called for each neighbor. The query point is visited as well if
+     * it belongs to the cloud.
+     */
+    template <class Visitor>
+    void radiusSearch(const PointType& point, float radius, Visitor&& visitor) const;
+
+    /**
+     * Search the k nearest neighbors of a point.
+     * @param point the query point.
+     * @param k the number of neighbors.
+     * @param excludedIndex index of a point that is not considered, usually the query point itself.
+     * @param neighbors the squared distances and the indices of the neighbors. They are not sorted.
+     * Memory is not allocated if its capacity is at least k.
+     * @return the number of neighbors found. It is less than k only if the grid contains less than
+     * k points.
+     */
+    std::size_t nearestKSearch(const PointType& point,
+                               std::size_t k,
+                               int excludedIndex,
+                               std::vector<std::pair<float, int>>& neighbors) const;
+
+private:
+    using Key = std::uint64_t;
+    static constexpr Key invalidKey = std::numeric_limits<Key>::max();
+    static constexpr int coordinateOffset = 1 << 20;
+
+    /**
+     * Compute the integer coordinates of the voxel containing a point.
+     * @return false if the point is not finite or out of the range of the grid.
+     */
+    bool computeCoordinates(const PointType& point, Eigen::Vector3i& coordinates) const
+    {
+        const float x = std::floor(point.x * m_inverseVoxelSize[0]);
+        const float y = std::floor(point.y * m_inverseVoxelSize[1]);
+        const float z = std::floor(point.z * m_inverseVoxelSize[2]);
+
+        // this check discards NaN as well
+        constexpr float limit = static_cast<float>(coordinateOffset);
+        if (!(x >= -limit && x < limit && y >= -limit && y < limit && z >= -limit && z < limit))
+        {
+            return false;
+        }
+
+        coordinates = {static_cast<int>(x), static_cast<int>(y), static_cast<int>(z)};
+        return true;
+    }
+
+    static Key computeKey(const Eigen::Vector3i& coordinates)
+    {
+        return (static_cast<Key>(coordinates[0] + coordinateOffset) << 42)
+               | (static_cast<Key>(coordinates[1] + coordinateOffset) << 21)
+               | static_cast<Key>(coordinates[2] + coordinateOffset);
+    }
+
+    static Key computeHash(Key key)
+    {
+        // finalizer of splitmix64
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+        return key ^ (key >> 31);
+    }
+
+    /**
+     * Get the thread owning a voxel. The upper bits of the hash are used, the lower ones select the
+     * slot in the hash table.
+     */
+    std::size_t computeOwner(Key hash) const
+    {
+        return static_cast<std::size_t>(((hash >> 32) * m_numberOfOwners) >> 32);
+    }
+
+    static float squaredDistance(const PointType& a, const PointType& b)
+    {
+        const float dx = a.x - b.x;
+        const float dy = a.y - b.y;
+        const float dz = a.z - b.z;
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    const pcl::PointCloud<PointType>* m_cloud{nullptr}; /**< Cloud used to build the grid. */
+    Eigen::Vector3f m_voxelSize{Eigen::Vector3f::Ones()}; /**< Size of the voxels. */
+    Eigen::Vector3f m_inverseVoxelSize{Eigen::Vector3f::Ones()}; /**< Inverse of the size. */
+    Eigen::Vector3i m_minCoordinates{Eigen::Vector3i::Zero()}; /**< Bounds of the voxels. */
+    Eigen::Vector3i m_maxCoordinates{-Eigen::Vector3i::Ones()}; /**< Bounds of the voxels. */
+    std::size_t m_numberOfOwners{0}; /**< Number of threads used to build the grid. */
+    std::size_t m_numberOfVoxels{0}; /**< Number of non-empty voxels. */
+
+    std::vector<Key> m_keys; /**< Key of the voxel containing each point. */
+    std::vector<int> m_order; /**< Indices of the points grouped by owner. */
+    std::vector<int> m_localVoxel; /**< Voxel of each point of m_order, local to the owner. */
+    std::vector<int> m_localCount; /**< Number of points in the voxels local to the owners. */
+    std::vector<int> m_sortedPoints; /**< Indices of the points grouped by voxel. */
+    std::vector<int> m_voxelBegin; /**< First element of m_sortedPoints of each voxel. */
+    std::vector<int> m_voxelEnd; /**< One past the last element of m_sortedPoints of each voxel. */
+
+    std::vector<std::size_t> m_chunkCursor; /**< Points per chunk and owner. */
+    std::vector<std::size_t> m_ownerOffset; /**< First element of m_order of each owner. */
+    std::vector<std::size_t> m_tableOffset; /**< First slot of the hash table of each owner. */
+    std::vector<std::size_t> m_voxelBase; /**< Index of the first voxel of each owner. */
+    std::vector<Eigen::Vector3i> m_chunkMinCoordinates; /**< Bounds of the voxels per chunk. */
+    std::vector<Eigen::Vector3i> m_chunkMaxCoordinates; /**< Bounds of the voxels per chunk. */
+
+    std::vector<Key> m_tableKeys; /**< Keys of the hash tables. */
+    std::vector<int> m_tableValues; /**< Voxels of the hash tables, local to the owner. */
+};
+
+template <class PointType>
+bool VoxelHashGrid<PointType>::build(const pcl::PointCloud<PointType>& cloud,
+                                     const Eigen::Ref<const Eigen::Vector3f>& voxelSize,
+                                     System::WorkerPool& pool)
+{
+    constexpr auto logPrefix = "[VoxelHashGrid::build]";
+
+    const std::size_t numberOfPoints = cloud.size();
+    if (numberOfPoints > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+    {
+        log()->error("{} The point cloud contains too many points.", logPrefix);
+        return false;
+    }
+
+    if (!(voxelSize.minCoeff() > 0))
+    {
+        log()->error("{} The size of the voxels must be positive.", logPrefix);
+        return false;
+    }
+
+    m_cloud = &cloud;
+    m_voxelSize = voxelSize;
+    m_inverseVoxelSize = voxelSize.cwiseInverse();
+
+    // the last bucket contains the discarded points
+    const std::size_t numberOfThreads = pool.size();
+    const std::size_t numberOfBuckets = numberOfThreads + 1;
+    m_numberOfOwners = numberOfThreads;
+
+    m_keys.resize(numberOfPoints);
+    m_order.resize(numberOfPoints);
+    m_localVoxel.resize(numberOfPoints);
+    m_localCount.resize(numberOfPoints);
+    m_sortedPoints.resize(numberOfPoints);
+    m_voxelBegin.resize(numberOfPoints);
+    m_voxelEnd.resize(numberOfPoints);
+    m_chunkCursor.resize(numberOfThreads * numberOfBuckets);
+    m_ownerOffset.resize(numberOfBuckets + 1);
+    m_tableOffset.resize(numberOfThreads + 1);
+    m_voxelBase.resize(numberOfThreads + 1);
+    m_chunkMinCoordinates.resize(numberOfThreads);
+    m_chunkMaxCoordinates.resize(numberOfThreads);
+
+    // compute the keys and count the points assigned to each owner
+    auto computeKeys = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        std::size_t* count = m_chunkCursor.data() + thread * numberOfBuckets;
+        std::fill(count, count + numberOfBuckets, 0);
+
+        Eigen::Vector3i minCoordinates = Eigen::Vector3i::Constant(coordinateOffset);
+        Eigen::Vector3i maxCoordinates = Eigen::Vector3i::Constant(-coordinateOffset - 1);
+        Eigen::Vector3i coordinates;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            if (!this->computeCoordinates(cloud[i], coordinates))
+            {
+                m_keys[i] = invalidKey;
+                count[numberOfThreads]++;
+                continue;
+            }
+
+            m_keys[i] = computeKey(coordinates);
+            count[this->computeOwner(computeHash(m_keys[i]))]++;
+            minCoordinates = minCoordinates.cwiseMin(coordinates);
+            maxCoordinates = maxCoordinates.cwiseMax(coordinates);
+        }
+        m_chunkMinCoordinates[thread] = minCoordinates;
+        m_chunkMaxCoordinates[thread] = maxCoordinates;
+    };
+    pool.run(computeKeys);
+
+    // group the points by owner. The points of each owner are sorted by chunk, hence by index
+    std::size_t offset = 0;
+    for (std::size_t owner = 0; owner < numberOfBuckets; owner++)
+    {
+        m_ownerOffset[owner] = offset;
+        for (std::size_t chunk = 0; chunk < numberOfThreads; chunk++)
+        {
+            std::size_t& cursor = m_chunkCursor[chunk * numberOfBuckets + owner];
+            const std::size_t count = cursor;
+            cursor = offset;
+            offset += count;
+        }
+    }
+    m_ownerOffset[numberOfBuckets] = offset;
+
+    // each owner has a hash table with a load factor smaller than 0.5
+    std::size_t tableSize = 0;
+    for (std::size_t owner = 0; owner < numberOfThreads; owner++)
+    {
+        m_tableOffset[owner] = tableSize;
+        const std::size_t numberOfOwnedPoints = m_ownerOffset[owner + 1] - m_ownerOffset[owner];
+        std::size_t capacity = numberOfOwnedPoints == 0 ? 0 : 2;
+        while (capacity < 2 * numberOfOwnedPoints)
+        {
+            capacity *= 2;
+        }
+        tableSize += capacity;
+    }
+    m_tableOffset[numberOfThreads] = tableSize;
+    m_tableKeys.resize(tableSize);
+    m_tableValues.resize(tableSize);
+
+    m_minCoordinates = m_chunkMinCoordinates.front();
+    m_maxCoordinates = m_chunkMaxCoordinates.front();
+    for (std::size_t chunk = 1; chunk < numberOfThreads; chunk++)
+    {
+        m_minCoordinates = m_minCoordinates.cwiseMin(m_chunkMinCoordinates[chunk]);
+        m_maxCoordinates = m_maxCoordinates.cwiseMax(m_chunkMaxCoordinates[chunk]);
+    }
+
+    auto scatter = [&](std::size_t thread) {
+        const auto [begin, end] = System::WorkerPool::getChunk(numberOfPoints, numberOfThreads, thread);
+        std::size_t* cursor = m_chunkCursor.data() + thread * numberOfBuckets;
+        for (std::size_t i = begin; i < end; i++)
+        {
+            const std::size_t owner = m_keys[i] == invalidKey
+                                          ? numberOfThreads
+                                          : this->computeOwner(computeHash(m_keys[i]));
+            m_order[cursor[owner]++] = static_cast<int>(i);
+        }
+    };
+    pool.run(scatter);
+
+    // each thread inserts the voxels it owns in its hash table
+    auto insert = [&](std::size_t owner) {
+        const std::size_t first = m_ownerOffset[owner];
+        const std::size_t last = m_ownerOffset[owner + 1];
+        Key* keys = m_tableKeys.data() + m_tableOffset[owner];
+        int* values = m_tableValues.data() + m_tableOffset[owner];
+        const std::size_t capacity = m_tableOffset[owner + 1] - m_tableOffset[owner];
+        const std::size_t mask = capacity - 1;
+        std::fill(keys, keys + capacity, invalidKey);
+
+        int numberOfVoxels = 0;
+        for (std::size_t position = first; position < last; position++)
+        {
+            const Key key = m_keys[m_order[position]];
+            std::size_t slot = computeHash(key) & mask;
+            while (keys[slot] != invalidKey && keys[slot] != key)
+            {
+                slot = (slot + 1) & mask;
+            }
+
+            if (keys[slot] == invalidKey)
+            {
+                keys[slot] = key;
+                values[slot] = numberOfVoxels;
+                m_localCount[first + numberOfVoxels] = 0;
+                numberOfVoxels++;
+            }
+
+            m_localVoxel[position] = values[slot];
+            m_localCount[first + values[slot]]++;
+        }
+
+        // the number of voxels is temporarily stored in the base of the next owner
+        m_voxelBase[owner + 1] = numberOfVoxels;
+    };
+    pool.run(insert);
+
+    m_voxelBase[0] = 0;
+    for (std::size_t owner = 0; owner < numberOfThreads; owner++)
+    {
+        m_voxelBase[owner + 1] += m_voxelBase[owner];
+    }
+    m_numberOfVoxels = m_voxelBase[numberOfThreads];
+
+    // sort the points by voxel
+    auto fill = [&](std::size_t owner) {
+        const std::size_t first = m_ownerOffset[owner];
+        const std::size_t last = m_ownerOffset[owner + 1];
+        const std::size_t base = m_voxelBase[owner];
+        const std::size_t numberOfVoxels = m_voxelBase[owner + 1] - base;
+
+        int cursor = static_cast<int>(first);
+        for (std::size_t voxel = 0; voxel < numberOfVoxels; voxel++)
+        {
+            m_voxelBegin[base + voxel] = cursor;
+            m_voxelEnd[base + voxel] = cursor;
+            cursor += m_localCount[first + voxel];
+        }
+
+        for (std::size_t position = first; position < last; position++)
+        {
+            m_sortedPoints[m_voxelEnd[base + m_localVoxel[position]]++] = m_order[position];
+        }
+    };
+    pool.run(fill);
+
+    return true;
+}
+
+template <class PointType>
+std::ptrdiff_t VoxelHashGrid<PointType>::findVoxel(const Eigen::Vector3i& coordinates) const
+{
+    if ((coordinates.array() < m_minCoordinates.array()).any()
+        || (coordinates.array() > m_maxCoordinates.array()).any())
+    {
+        return -1;
+    }
+
+    const Key key = computeKey(coordinates);
+    const Key hash = computeHash(key);
+    const std::size_t owner = this->computeOwner(hash);
+    const std::size_t capacity = m_tableOffset[owner + 1] - m_tableOffset[owner];
+    if (capacity == 0)
+    {
+        return -1;
+    }
+
+    const Key* keys = m_tableKeys.data() + m_tableOffset[owner];
+    const std::size_t mask = capacity - 1;
+    std::size_t slot = hash & mask;
+    while (keys[slot] != invalidKey)
+    {
+        if (keys[slot] == key)
+        {
+            return static_cast<std::ptrdiff_t>(m_voxelBase[owner])
+                   + m_tableValues[m_tableOffset[owner] + slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return -1;
+}
+
+template <class PointType>
+template <class Visitor>
+void VoxelHashGrid<PointType>::radiusSearch(const PointType& point,
+                                            float radius,
+                                            Visitor&& visitor) const
+{
+    Eigen::Vector3i center;
+    if (m_numberOfVoxels == 0 || !this->computeCoordinates(point, center))
+    {
+        return;
+    }
+
+    // the division is exact if the radius is equal to the voxel size
+    Eigen::Vector3i range;
+    for (int i = 0; i < 3; i++)
+    {
+        range[i] = static_cast<int>(std::ceil(radius / m_voxelSize[i]));
+    }
+    const Eigen::Vector3i first = (center - range).cwiseMax(m_minCoordinates);
+    const Eigen::Vector3i last = (center + range).cwiseMin(m_maxCoordinates);
+    const float squaredRadius = radius * radius;
+
+    Eigen::Vector3i coordinates;
+    for (coordinates[0] = first[0]; coordinates[0] <= last[0]; coordinates[0]++)
+    {
+        for (coordinates[1] = first[1]; coordinates[1] <= last[1]; coordinates[1]++)
+        {
+            for (coordinates[2] = first[2]; coordinates[2] <= last[2]; coordinates[2]++)
+            {
+                const std::ptrdiff_t voxel = this->findVoxel(coordinates);
+                if (voxel < 0)
+                {
+                    continue;
+                }
+
+                for (const int index : this->getVoxel(voxel))
+                {
+                    const float distance = squaredDistance(point, (*m_cloud)[index]);
+                    if (distance <= squaredRadius)
+                    {
+                        visitor(index, distance);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <class PointType>
+std::size_t
+VoxelHashGrid<PointType>::nearestKSearch(const PointType& point,
+                                         std::size_t k,
+                                         int excludedIndex,
+                                         std::vector<std::pair<float, int>>& neighbors) const
+{
+    neighbors.clear();
+    Eigen::Vector3i center;
+    if (k == 0 || m_numberOfVoxels == 0 || !this->computeCoordinates(point, center))
+    {
+        return 0;
+    }
+
+    // max heap of the k closest points
+    auto visitVoxel = [&](const Eigen::Vector3i& coordinates) {
+        const std::ptrdiff_t voxel = this->findVoxel(coordinates);
+        if (voxel < 0)
+        {
+            return;
+        }
+
+        for (const int index : this->getVoxel(voxel))
+        {
+            if (index == excludedIndex)
+            {
+                continue;
+            }
+
+            const float distance = squaredDistance(point, (*m_cloud)[index]);
+            if (neighbors.size() < k)
+            {
+                neighbors.emplace_back(distance, index);
+                std::push_heap(neighbors.begin(), neighbors.end());
+            } else if (distance < neighbors.front().first)
+            {
+                std::pop_heap(neighbors.begin(), neighbors.end());
+                neighbors.back() = {distance, index};
+                std::push_heap(neighbors.begin(), neighbors.end());
+            }
+        }
+    };
+
+    // visit the shells of voxels around the query point. The points outside the shell s are at
+    // least s voxels far from the query point
+    const int maxShell = std::max((center - m_minCoordinates).maxCoeff(),
+                                  (m_maxCoordinates - center).maxCoeff());
+    const float minVoxelSize = m_voxelSize.minCoeff();
+    Eigen::Vector3i coordinates;
+    for (int shell = 0; shell <= maxShell; shell++)
+    {
+        for (int dx = -shell; dx <= shell; dx++)
+        {
+            for (int dy = -shell; dy <= shell; dy++)
+            {
+                // inside the shell only the two faces orthogonal to z are visited
+                const bool isOnSide = std::abs(dx) == shell || std::abs(dy) == shell;
+                const int step = isOnSide ? 1 : 2 * shell;
+                for (int dz = -shell; dz <= shell; dz += step)
+                {
+                    coordinates = center + Eigen::Vector3i(dx, dy, dz);
+                    visitVoxel(coordinates);
+                }
+            }
+        }
+
+        const float bound = shell * minVoxelSize;
+        if (neighbors.size() == k && neighbors.front().first <= bound * bound)
+        {
+            break;
+        }
+    }
+
+    return neighbors.size();
+}
+
+} // namespace Features
+} // namespace Perception
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_PERCEPTION_VOXEL_HASH_GRID_H
@@ -8,8 +8,12 @@
 #include <BipedalLocomotion/Conversions/CommonConversions.h>
 #include <BipedalLocomotion/GenericContainer/Vector.h>
 #include <BipedalLocomotion/Perception/Features/ArucoDetector.h>
+#include <BipedalLocomotion/System/TimeProfiler.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
+#include <algorithm>
+#include <chrono>
+
 using namespace BipedalLocomotion::ParametersHandler;
 using namespace BipedalLocomotion::GenericContainer;
 using namespace BipedalLocomotion::Perception;
@@ -22,11 +26,69 @@ using namespace BipedalLocomotion::Conversions;
 class ArucoDetector::Impl
 {
 public:
+    /**
+     * Marker detected in the previous frame
+     */
+    struct TrackedMarker
+    {
+        int id{-1}; /**< marker id */
+        cv::Vec3d rotVec; /**< rotation vector of the marker in the camera frame */
+        cv::Vec3d transVec; /**< translation vector of the marker in the camera frame */
+        cv::Vec3d linearVelocity{0, 0, 0}; /**< linear velocity of the marker in the camera frame */
+        double time{-1.0}; /**< time of the detection */
+    };
+
     /**
      * clear all internal buffers
      */
     void resetBuffers();
 
+    /**
+     * Detect the markers in the whole image
+     */
+    void detectInFullFrame();
+
+    /**
+     * Predict the regions of interest of the tracked markers
+     * @return false if the prediction of a marker is not in the image, true otherwise
+     */
+    bool predictRegionsOfInterest();
+
+    /**
+     * Detect the markers in the regions of interest
+     * @return true if all the tracked markers have been detected, false otherwise
+     */
+    bool detectInRegionsOfInterest();
+
+    /**
+     * Estimate the pose of the detected markers and fill the output
+     */
+    void estimatePoses();
+
+    /**
+     * Update the tracked markers with the current detections
+     */
+    void updateTrackedMarkers();
+
+    // tracking parameters
+    bool enableTracking{false}; /**< if true the markers are searched in the regions of interest */
+    int fullFrameSearchPeriod{30}; /**< frames between two searches in the whole image */
+    double roiMargin{0.5}; /**< margin of the regions of interest */
+    int profilingPeriod{0}; /**< period used to print the profiling information */
+
+    std::vector<TrackedMarker> trackedMarkers; /**< markers detected in the previous frame */
+    std::vector<TrackedMarker> newTrackedMarkers; /**< buffer used to update the tracked markers */
+    std::vector<cv::Rect> regionsOfInterest; /**< regions of interest of the current frame */
+    std::vector<cv::Point3f> markerObjectPoints; /**< corners of the marker in the marker frame */
+    std::vector<cv::Point2f> projectedCorners; /**< projected corners of a tracked marker */
+    std::vector<int> roiDetectedMarkerIds; /**< ids of the markers detected in a region */
+    std::vector<std::vector<cv::Point2f>> roiDetectedMarkerCorners; /**< corners of the markers
+                                                                       detected in a region */
+    int framesSinceFullFrameSearch{0}; /**< frames elapsed from the last full frame search */
+
+    ArucoDetectorStatistics statistics; /**< statistics of the last advance */
+    System::TimeProfiler profiler; /**< profiler used to print the duration of the stages */
+
     // parameters
     cv::Ptr<cv::aruco::Dictionary> dictionary; /**< container with detected markers data */
     double markerLength; /**< marker length*/
@@ -163,6 +225,54 @@ bool ArucoDetector::initialize(std::weak_ptr<const IParametersHandler> handler)
     m_pimpl->distCoeff = cv::Mat(5, 1, CV_64F);
     cv::eigen2cv(distCoeffVec, m_pimpl->distCoeff);
 
+    if (!handle->getParameter("enable_tracking", m_pimpl->enableTracking))
+    {
+        log()->info("{} The parameter \" enable_tracking \" is not found. The tracking is disabled.",
+                    printPrefix);
+        m_pimpl->enableTracking = false;
+    }
+
+    if (!handle->getParameter("full_frame_search_period", m_pimpl->fullFrameSearchPeriod))
+    {
+        m_pimpl->fullFrameSearchPeriod = 30;
+    }
+
+    if (!handle->getParameter("roi_margin", m_pimpl->roiMargin))
+    {
+        m_pimpl->roiMargin = 0.5;
+    }
+
+    if (!handle->getParameter("profiling_period", m_pimpl->profilingPeriod))
+    {
+        m_pimpl->profilingPeriod = 0;
+    }
+
+    if (m_pimpl->fullFrameSearchPeriod < 1 || m_pimpl->roiMargin < 0)
+    {
+        log()->error("{} The parameter \" full_frame_search_period \" must be positive and the "
+                     "parameter \" roi_margin \" must be non negative.",
+                     printPrefix);
+        return false;
+    }
+
+    // corners of the marker in the same order returned by cv::aruco::detectMarkers
+    const float halfLength = static_cast<float>(m_pimpl->markerLength / 2.0);
+    m_pimpl->markerObjectPoints = {{-halfLength, halfLength, 0},
+                                   {halfLength, halfLength, 0},
+                                   {halfLength, -halfLength, 0},
+                                   {-halfLength, -halfLength, 0}};
+    m_pimpl->trackedMarkers.clear();
+    m_pimpl->framesSinceFullFrameSearch = 0;
+
+    if (m_pimpl->profilingPeriod > 0)
+    {
+        m_pimpl->profiler = System::TimeProfiler();
+        m_pimpl->profiler.setPeriod(m_pimpl->profilingPeriod);
+        m_pimpl->profiler.addTimer("Prediction");
+        m_pimpl->profiler.addTimer("Detection");
+        m_pimpl->profiler.addTimer("Pose estimation");
+    }
+
     m_pimpl->initialized = true;
     return true;
 }
@@ -200,42 +310,249 @@ bool ArucoDetector::advance()
         return false;
     }
 
+    using clock = std::chrono::steady_clock;
+    const bool isProfilingEnabled = m_pimpl->profilingPeriod > 0;
+    auto& statistics = m_pimpl->statistics;
+
     m_pimpl->resetBuffers();
-    std::vector<std::vector<cv::Point2f>> detectedmarkerCorners;
-    cv::aruco::detectMarkers(m_pimpl->currentImg,
-                             m_pimpl->dictionary,
-                             m_pimpl->currentDetectedMarkerCorners,
-                             m_pimpl->currentDetectedMarkerIds);
-
-    if (m_pimpl->currentDetectedMarkerIds.size() > 0)
-    {
-        cv::aruco::estimatePoseSingleMarkers(m_pimpl->currentDetectedMarkerCorners,
-                                             m_pimpl->markerLength,
-                                             m_pimpl->cameraMatrix,
-                                             m_pimpl->distCoeff,
-                                             m_pimpl->currentDetectedMarkersRotVecs,
-                                             m_pimpl->currentDetectedMarkersTransVecs);
-
-        for (std::size_t idx = 0; idx < m_pimpl->currentDetectedMarkerIds.size(); idx++)
+    statistics.isFullFrameSearch
+        = !m_pimpl->enableTracking || m_pimpl->trackedMarkers.empty()
+          || m_pimpl->framesSinceFullFrameSearch + 1 >= m_pimpl->fullFrameSearchPeriod;
+    statistics.numberOfRegionsOfInterest = 0;
+    statistics.predictionDuration = std::chrono::nanoseconds::zero();
+    statistics.detectionDuration = std::chrono::nanoseconds::zero();
+
+    if (isProfilingEnabled)
+    {
+        m_pimpl->profiler.setInitTime("Prediction");
+    }
+    auto initTime = clock::now();
+    if (!statistics.isFullFrameSearch)
+    {
+        statistics.isFullFrameSearch = !m_pimpl->predictRegionsOfInterest();
+        statistics.numberOfRegionsOfInterest = m_pimpl->regionsOfInterest.size();
+    }
+    statistics.predictionDuration = clock::now() - initTime;
+    if (isProfilingEnabled)
+    {
+        m_pimpl->profiler.setEndTime("Prediction");
+        m_pimpl->profiler.setInitTime("Detection");
+    }
+
+    initTime = clock::now();
+    if (!statistics.isFullFrameSearch && !m_pimpl->detectInRegionsOfInterest())
+    {
+        // a tracked marker has been lost, it may be somewhere else in the image
+        log()->debug("{} A tracked marker has not been found in its region of interest. "
+                     "Searching the markers in the whole image.",
+                     printPrefix);
+        statistics.isFullFrameSearch = true;
+    }
+
+    if (statistics.isFullFrameSearch)
+    {
+        m_pimpl->detectInFullFrame();
+        m_pimpl->framesSinceFullFrameSearch = 0;
+    } else
+    {
+        m_pimpl->framesSinceFullFrameSearch++;
+    }
+    statistics.detectionDuration = clock::now() - initTime;
+    if (isProfilingEnabled)
+    {
+        m_pimpl->profiler.setEndTime("Detection");
+        m_pimpl->profiler.setInitTime("Pose estimation");
+    }
+
+    initTime = clock::now();
+    m_pimpl->estimatePoses();
+    m_pimpl->updateTrackedMarkers();
+    statistics.poseEstimationDuration = clock::now() - initTime;
+    if (isProfilingEnabled)
+    {
+        m_pimpl->profiler.setEndTime("Pose estimation");
+        m_pimpl->profiler.profiling();
+    }
+
+    return true;
+}
+
+void ArucoDetector::Impl::detectInFullFrame()
+{
+    currentDetectedMarkerCorners.clear();
+    currentDetectedMarkerIds.clear();
+    cv::aruco::detectMarkers(currentImg,
+                             dictionary,
+                             currentDetectedMarkerCorners,
+                             currentDetectedMarkerIds);
+}
+
+bool ArucoDetector::Impl::predictRegionsOfInterest()
+{
+    regionsOfInterest.clear();
+    const cv::Rect image(0, 0, currentImg.cols, currentImg.rows);
+
+    for (const auto& marker : trackedMarkers)
+    {
+        // constant linear velocity model. The rotation is assumed constant
+        const double dt = std::max(currentTime - marker.time, 0.0);
+        const cv::Vec3d transVec = marker.transVec + marker.linearVelocity * dt;
+        if (transVec(2) <= 0)
+        {
+            return false;
+        }
+
+        cv::projectPoints(markerObjectPoints,
+                          marker.rotVec,
+                          transVec,
+                          cameraMatrix,
+                          distCoeff,
+                          projectedCorners);
+
+        cv::Rect roi = cv::boundingRect(projectedCorners);
+        const int margin = static_cast<int>(roiMargin * std::max(roi.width, roi.height)) + 1;
+        roi.x -= margin;
+        roi.y -= margin;
+        roi.width += 2 * margin;
+        roi.height += 2 * margin;
+        roi &= image;
+        if (roi.empty())
+        {
+            return false;
+        }
+
+        regionsOfInterest.push_back(roi);
+    }
+
+    // merge the overlapping regions so that each marker is searched only once
+    bool merged = true;
+    while (merged)
+    {
+        merged = false;
+        for (std::size_t i = 0; i < regionsOfInterest.size() && !merged; i++)
+        {
+            for (std::size_t j = i + 1; j < regionsOfInterest.size() && !merged; j++)
+            {
+                if ((regionsOfInterest[i] & regionsOfInterest[j]).empty())
+                {
+                    continue;
+                }
+                regionsOfInterest[i] |= regionsOfInterest[j];
+                regionsOfInterest.erase(regionsOfInterest.begin() + j);
+                merged = true;
+            }
+        }
+    }
+
+    return true;
+}
+
+bool ArucoDetector::Impl::detectInRegionsOfInterest()
+{
+    for (const auto& roi : regionsOfInterest)
+    {
+        // the region shares the memory with the image
+        cv::aruco::detectMarkers(currentImg(roi),
+                                 dictionary,
+                                 roiDetectedMarkerCorners,
+                                 roiDetectedMarkerIds);
+
+        for (std::size_t idx = 0; idx < roiDetectedMarkerIds.size(); idx++)
+        {
+            if (std::find(currentDetectedMarkerIds.begin(),
+                          currentDetectedMarkerIds.end(),
+                          roiDetectedMarkerIds[idx])
+                != currentDetectedMarkerIds.end())
+            {
+                continue;
+            }
+
+            for (auto& corner : roiDetectedMarkerCorners[idx])
+            {
+                corner.x += roi.x;
+                corner.y += roi.y;
+            }
+            currentDetectedMarkerIds.push_back(roiDetectedMarkerIds[idx]);
+            currentDetectedMarkerCorners.push_back(roiDetectedMarkerCorners[idx]);
+        }
+    }
+
+    for (const auto& marker : trackedMarkers)
+    {
+        if (std::find(currentDetectedMarkerIds.begin(), currentDetectedMarkerIds.end(), marker.id)
+            == currentDetectedMarkerIds.end())
         {
-            cv::Rodrigues(m_pimpl->currentDetectedMarkersRotVecs[idx], m_pimpl->R);
-            cv::cv2eigen(m_pimpl->R, m_pimpl->Reig);
-            m_pimpl->teig << m_pimpl->currentDetectedMarkersTransVecs[idx](0),
-                m_pimpl->currentDetectedMarkersTransVecs[idx](1),
-                m_pimpl->currentDetectedMarkersTransVecs[idx](2);
-
-            m_pimpl->poseEig = toEigenPose(m_pimpl->Reig, m_pimpl->teig);
-            ArucoMarkerData markerData{m_pimpl->currentDetectedMarkerIds[idx],
-                                       m_pimpl->currentDetectedMarkerCorners[idx],
-                                       m_pimpl->poseEig};
-            m_pimpl->out.markers[m_pimpl->currentDetectedMarkerIds[idx]] = markerData;
+            return false;
         }
-        m_pimpl->out.timeNow = m_pimpl->currentTime;
     }
 
     return true;
 }
 
+void ArucoDetector::Impl::estimatePoses()
+{
+    if (currentDetectedMarkerIds.empty())
+    {
+        return;
+    }
+
+    cv::aruco::estimatePoseSingleMarkers(currentDetectedMarkerCorners,
+                                         markerLength,
+                                         cameraMatrix,
+                                         distCoeff,
+                                         currentDetectedMarkersRotVecs,
+                                         currentDetectedMarkersTransVecs);
+
+    for (std::size_t idx = 0; idx < currentDetectedMarkerIds.size(); idx++)
+    {
+        cv::Rodrigues(currentDetectedMarkersRotVecs[idx], R);
+        cv::cv2eigen(R, Reig);
+        teig << currentDetectedMarkersTransVecs[idx](0),
+            currentDetectedMarkersTransVecs[idx](1),
+            currentDetectedMarkersTransVecs[idx](2);
+
+        poseEig = toEigenPose(Reig, teig);
+        ArucoMarkerData markerData{currentDetectedMarkerIds[idx],
+                                   currentDetectedMarkerCorners[idx],
+                                   poseEig};
+        out.markers[currentDetectedMarkerIds[idx]] = markerData;
+    }
+    out.timeNow = currentTime;
+}
+
+void ArucoDetector::Impl::updateTrackedMarkers()
+{
+    newTrackedMarkers.clear();
+    if (!enableTracking)
+    {
+        return;
+    }
+
+    for (std::size_t idx = 0; idx < currentDetectedMarkerIds.size(); idx++)
+    {
+        TrackedMarker marker;
+        marker.id = currentDetectedMarkerIds[idx];
+        marker.rotVec = currentDetectedMarkersRotVecs[idx];
+        marker.transVec = currentDetectedMarkersTransVecs[idx];
+        marker.time = currentTime;
+
+        auto previous = std::find_if(trackedMarkers.begin(),
+                                     trackedMarkers.end(),
+                                     [&marker](const TrackedMarker& tracked) {
+                                         return tracked.id == marker.id;
+                                     });
+        if (previous != trackedMarkers.end() && marker.time > previous->time)
+        {
+            marker.linearVelocity
+                = (marker.transVec - previous->transVec) / (marker.time - previous->time);
+        }
+
+        newTrackedMarkers.push_back(marker);
+    }
+
+    std::swap(trackedMarkers, newTrackedMarkers);
+}
+
 const ArucoDetectorOutput& ArucoDetector::getOutput() const
 {
     return m_pimpl->out;
@@ -251,6 +568,11 @@ bool ArucoDetector::isOutputValid() const
     return true;
 }
 
+const ArucoDetectorStatistics& ArucoDetector::getStatistics() const
+{
+    return m_pimpl->statistics;
+}
+
 bool ArucoDetector::getDetectedMarkerData(const int& id, ArucoMarkerData& markerData)
 {
     if (m_pimpl->out.markers.find(id) == m_pimpl->out.markers.end())
@@ -0,0 +1,403 @@
+/**
+ * @file PointCloudCodec.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <BipedalLocomotion/Perception/Compression/PointCloudCodec.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::Perception::Compression;
+using namespace BipedalLocomotion::RobotInterface;
+using namespace BipedalLocomotion;
+
+namespace
+{
+
+constexpr std::uint64_t maxQuantizedValue = std::numeric_limits<std::uint16_t>::max();
+constexpr std::uint64_t voxelIndexBits = 21;
+constexpr std::uint64_t maxVoxelIndex = (std::uint64_t(1) << voxelIndexBits) - 1;
+
+std::uint64_t packKey(std::uint64_t x, std::uint64_t y, std::uint64_t z, std::uint64_t bits)
+{
+    return (x << (2 * bits)) | (y << bits) | z;
+}
+
+// the keys of the voxels use 63 bits, hence this value is never a valid key
+constexpr std::uint64_t emptyKey = std::numeric_limits<std::uint64_t>::max();
+
+std::uint64_t computeHash(std::uint64_t key)
+{
+    // finalizer of splitmix64
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return key ^ (key >> 31);
+}
+
+void appendVarint(std::uint64_t value, std::vector<std::uint8_t>& buffer)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<std::uint8_t>(value));
+}
+
+bool readVarint(const std::vector<std::uint8_t>& buffer, std::size_t& index, std::uint64_t& value)
+{
+    value = 0;
+    unsigned int shift = 0;
+    while (index < buffer.size() && shift < 64)
+    {
+        const std::uint8_t byte = buffer[index++];
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+        shift += 7;
+    }
+    return false;
+}
+
+} // namespace
+
+struct PointCloudEncoder::Impl
+{
+    struct Voxel
+    {
+        double x{0};
+        double y{0};
+        double z{0};
+        std::uint32_t r{0};
+        std::uint32_t g{0};
+        std::uint32_t b{0};
+        std::uint32_t count{0};
+    };
+
+    double voxelSize{0.01};
+    double resolution{0.0};
+
+    // buffers reused among the calls
+    std::vector<std::uint64_t> tableKeys; /**< Keys of the open addressing hash table. */
+    std::vector<std::size_t> tableValues; /**< Index of the voxel associated to each key. */
+    std::vector<Voxel> voxels;
+    std::vector<std::pair<std::uint64_t, std::size_t>> sortedPoints;
+
+    /**
+     * Clear the hash table and make it large enough to store a voxel for each point. The memory
+     * is allocated only if the cloud is larger than the previous ones.
+     */
+    void resetTable(std::size_t numberOfPoints)
+    {
+        // the load factor is smaller than 0.5
+        std::size_t capacity = 2;
+        while (capacity < 2 * numberOfPoints)
+        {
+            capacity *= 2;
+        }
+        tableKeys.assign(capacity, emptyKey);
+        tableValues.resize(capacity);
+    }
+
+    /**
+     * Find the slot of the hash table associated to a key, or the empty slot where the key has to
+     * be inserted.
+     */
+    std::size_t findSlot(std::uint64_t key) const
+    {
+        const std::size_t mask = tableKeys.size() - 1;
+        std::size_t slot = computeHash(key) & mask;
+        while (tableKeys[slot] != emptyKey && tableKeys[slot] != key)
+        {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void addPoint(const pcl::PointXYZRGB& point)
+    {
+        voxels.emplace_back();
+        auto& voxel = voxels.back();
+        voxel.x = point.x;
+        voxel.y = point.y;
+        voxel.z = point.z;
+        voxel.r = point.r;
+        voxel.g = point.g;
+        voxel.b = point.b;
+        voxel.count = 1;
+    }
+};
+
+PointCloudEncoder::PointCloudEncoder()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+PointCloudEncoder::~PointCloudEncoder() = default;
+
+bool PointCloudEncoder::initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[PointCloudEncoder::initialize]";
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} The parameter handler is not valid.", logPrefix);
+        return false;
+    }
+
+    if (!ptr->getParameter("voxel_size", m_pimpl->voxelSize))
+    {
+        log()->info("{} Parameter 'voxel_size' not found. The default value {} will be used.",
+                    logPrefix,
+                    m_pimpl->voxelSize);
+    }
+
+    if (!ptr->getParameter("resolution", m_pimpl->resolution))
+    {
+        log()->info("{} Parameter 'resolution' not found. The resolution will be computed from "
+                    "the extent of each point cloud.",
+                    logPrefix);
+    }
+
+    if (m_pimpl->voxelSize < 0 || m_pimpl->resolution < 0)
+    {
+        log()->error("{} The voxel size and the resolution must be non negative.", logPrefix);
+        return false;
+    }
+
+    return true;
+}
+
+bool PointCloudEncoder::encode(const pcl::PointCloud<pcl::PointXYZRGB>& cloud,
+                               CompressedPointCloud& compressed)
+{
+    constexpr auto logPrefix = "[PointCloudEncoder::encode]";
+
+    compressed.coordinates.clear();
+    compressed.colors.clear();
+    compressed.numberOfPoints = 0;
+
+    // compute the bounding box of the valid points
+    std::array<float, 3> minPoint{std::numeric_limits<float>::max(),
+                                  std::numeric_limits<float>::max(),
+                                  std::numeric_limits<float>::max()};
+    std::array<float, 3> maxPoint{std::numeric_limits<float>::lowest(),
+                                  std::numeric_limits<float>::lowest(),
+                                  std::numeric_limits<float>::lowest()};
+    bool isEmpty = true;
+    for (const auto& point : cloud.points)
+    {
+        if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z))
+        {
+            continue;
+        }
+        isEmpty = false;
+        minPoint[0] = std::min(minPoint[0], point.x);
+        minPoint[1] = std::min(minPoint[1], point.y);
+        minPoint[2] = std::min(minPoint[2], point.z);
+        maxPoint[0] = std::max(maxPoint[0], point.x);
+        maxPoint[1] = std::max(maxPoint[1], point.y);
+        maxPoint[2] = std::max(maxPoint[2], point.z);
+    }
+
+    if (isEmpty)
+    {
+        compressed.origin = {0.0f, 0.0f, 0.0f};
+        compressed.resolution = static_cast<float>(m_pimpl->resolution);
+        return true;
+    }
+
+    // decimate the point cloud on the voxel grid
+    m_pimpl->voxels.clear();
+    if (m_pimpl->voxelSize > 0)
+    {
+        m_pimpl->resetTable(cloud.size());
+        for (const auto& point : cloud.points)
+        {
+            if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z))
+            {
+                continue;
+            }
+
+            const auto ix = static_cast<std::uint64_t>((point.x - minPoint[0]) / m_pimpl->voxelSize);
+            const auto iy = static_cast<std::uint64_t>((point.y - minPoint[1]) / m_pimpl->voxelSize);
+            const auto iz = static_cast<std::uint64_t>((point.z - minPoint[2]) / m_pimpl->voxelSize);
+            if (ix > maxVoxelIndex || iy > maxVoxelIndex || iz > maxVoxelIndex)
+            {
+                log()->error("{} The point cloud is too large for the voxel size {} m.",
+                             logPrefix,
+                             m_pimpl->voxelSize);
+                return false;
+            }
+
+            const std::uint64_t key = packKey(ix, iy, iz, voxelIndexBits);
+            const std::size_t slot = m_pimpl->findSlot(key);
+            if (m_pimpl->tableKeys[slot] == emptyKey)
+            {
+                m_pimpl->tableKeys[slot] = key;
+                m_pimpl->tableValues[slot] = m_pimpl->voxels.size();
+                m_pimpl->addPoint(point);
+                continue;
+            }
+
+            auto& voxel = m_pimpl->voxels[m_pimpl->tableValues[slot]];
+            voxel.x += point.x;
+            voxel.y += point.y;
+            voxel.z += point.z;
+            voxel.r += point.r;
+            voxel.g += point.g;
+            voxel.b += point.b;
+            voxel.count++;
+        }
+    } else
+    {
+        for (const auto& point : cloud.points)
+        {
+            if (std::isfinite(point.x) && std::isfinite(point.y) && std::isfinite(point.z))
+            {
+                m_pimpl->addPoint(point);
+            }
+        }
+    }
+
+    // compute the quantization step
+    const double extent = std::max({maxPoint[0] - minPoint[0],
+                                    maxPoint[1] - minPoint[1],
+                                    maxPoint[2] - minPoint[2]});
+    double resolution = m_pimpl->resolution;
+    if (resolution == 0)
+    {
+        resolution = extent > 0 ? extent / static_cast<double>(maxQuantizedValue) : 1e-3;
+    } else if (extent / resolution > static_cast<double>(maxQuantizedValue))
+    {
+        log()->error("{} The extent of the point cloud ({} m) cannot be represented with 16 bits "
+                     "and a resolution of {} m.",
+                     logPrefix,
+                     extent,
+                     resolution);
+        return false;
+    }
+
+    const auto quantize = [resolution](double value, float origin) -> std::uint64_t {
+        const auto q = std::lround((value - origin) / resolution);
+        return static_cast<std::uint64_t>(
+            std::clamp<long>(q, 0, static_cast<long>(maxQuantizedValue)));
+    };
+
+    // quantize and sort the points. Sorting the points guarantees that the difference between
+    // two consecutive keys is small
+    m_pimpl->sortedPoints.clear();
+    m_pimpl->sortedPoints.reserve(m_pimpl->voxels.size());
+    for (std::size_t i = 0; i < m_pimpl->voxels.size(); i++)
+    {
+        auto& voxel = m_pimpl->voxels[i];
+        const double count = voxel.count;
+        const auto key = packKey(quantize(voxel.x / count, minPoint[0]),
+                                 quantize(voxel.y / count, minPoint[1]),
+                                 quantize(voxel.z / count, minPoint[2]),
+                                 16);
+        m_pimpl->sortedPoints.emplace_back(key, i);
+    }
+    std::sort(m_pimpl->sortedPoints.begin(), m_pimpl->sortedPoints.end());
+
+    // delta encoding
+    compressed.origin = minPoint;
+    compressed.resolution = static_cast<float>(resolution);
+    compressed.numberOfPoints = m_pimpl->sortedPoints.size();
+    compressed.colors.reserve(3 * compressed.numberOfPoints);
+    std::uint64_t previousKey = 0;
+    for (const auto& [key, index] : m_pimpl->sortedPoints)
+    {
+        appendVarint(key - previousKey, compressed.coordinates);
+        previousKey = key;
+
+        const auto& voxel = m_pimpl->voxels[index];
+        compressed.colors.push_back(static_cast<std::uint8_t>(voxel.r / voxel.count));
+        compressed.colors.push_back(static_cast<std::uint8_t>(voxel.g / voxel.count));
+        compressed.colors.push_back(static_cast<std::uint8_t>(voxel.b / voxel.count));
+    }
+
+    return true;
+}
+
+bool PointCloudDecoder::setInput(const CompressedPointCloud& compressed)
+{
+    if (compressed.colors.size() != 3 * compressed.numberOfPoints)
+    {
+        log()->error("[PointCloudDecoder::setInput] The number of colors does not match the "
+                     "number of points.");
+        return false;
+    }
+
+    m_input = &compressed;
+    return true;
+}
+
+std::size_t PointCloudDecoder::size() const
+{
+    return m_input == nullptr ? 0 : m_input->numberOfPoints;
+}
+
+bool PointCloudDecoder::forEachPoint(
+    const std::function<void(const pcl::PointXYZRGB&)>& visitor) const
+{
+    constexpr auto logPrefix = "[PointCloudDecoder::forEachPoint]";
+
+    if (m_input == nullptr)
+    {
+        log()->error("{} Please call setInput() before decoding the point cloud.", logPrefix);
+        return false;
+    }
+
+    constexpr std::uint64_t mask = maxQuantizedValue;
+    const double resolution = m_input->resolution;
+
+    pcl::PointXYZRGB point;
+    std::uint64_t key = 0;
+    std::size_t index = 0;
+    for (std::size_t i = 0; i < m_input->numberOfPoints; i++)
+    {
+        std::uint64_t delta;
+        if (!readVarint(m_input->coordinates, index, delta))
+        {
+            log()->error("{} The compressed point cloud is corrupted.", logPrefix);
+            return false;
+        }
+        key += delta;
+
+        point.x = m_input->origin[0] + static_cast<float>(((key >> 32) & mask) * resolution);
+        point.y = m_input->origin[1] + static_cast<float>(((key >> 16) & mask) * resolution);
+        point.z = m_input->origin[2] + static_cast<float>((key & mask) * resolution);
+        point.r = m_input->colors[3 * i];
+        point.g = m_input->colors[3 * i + 1];
+        point.b = m_input->colors[3 * i + 2];
+        visitor(point);
+    }
+
+    return true;
+}
+
+bool PointCloudDecoder::decode(pcl::PointCloud<pcl::PointXYZRGB>& cloud) const
+{
+    cloud.clear();
+    cloud.reserve(this->size());
+    if (!this->forEachPoint([&cloud](const pcl::PointXYZRGB& point) { cloud.push_back(point); }))
+    {
+        log()->error("[PointCloudDecoder::decode] Unable to decode the point cloud.");
+        return false;
+    }
+
+    cloud.width = static_cast<std::uint32_t>(cloud.size());
+    cloud.height = 1;
+    cloud.is_dense = true;
+    return true;
+}
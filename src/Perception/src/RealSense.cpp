@@ -6,6 +6,7 @@
 #include <algorithm>
 
 #include <BipedalLocomotion/Perception/Capture/RealSense.h>
+#include <BipedalLocomotion/Perception/Compression/PointCloudCodec.h>
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 #include <librealsense2/rs.hpp>
@@ -58,6 +59,9 @@ struct RealSense::Impl
     rs2::colorizer color_map;
     bool doAlignToColor{false};
     std::unique_ptr<rs2::align> alignToColor;
+
+    BipedalLocomotion::Perception::Compression::PointCloudEncoder encoder;
+    pcl::PointCloud<pcl::PointXYZRGB>::Ptr uncompressedCloud;
 };
 
 RealSense::RealSense()
@@ -165,6 +169,15 @@ bool RealSense::initialize(
                     logPrefix);
     }
 
+    // the compression group is optional. If not present the default parameters are used
+    auto compressionHandler = ptr->getGroup("POINT_CLOUD_COMPRESSION").lock();
+    if (compressionHandler != nullptr && !m_pimpl->encoder.initialize(compressionHandler))
+    {
+        log()->error("{} Unable to initialize the point cloud encoder.", logPrefix);
+        return false;
+    }
+    m_pimpl->uncompressedCloud = pcl::make_shared<pcl::PointCloud<pcl::PointXYZRGB>>();
+
     if (!m_pimpl->startStream())
     {
         return false;
@@ -411,6 +424,26 @@ bool RealSense::getPointCloud(const std::string& pclDevName,
     return true;
 }
 
+bool RealSense::getCompressedPointCloud(
+    const std::string& pclDevName,
+    BipedalLocomotion::RobotInterface::CompressedPointCloud& compressedPointCloud,
+    std::optional<std::reference_wrapper<double>> receiveTimeInSeconds)
+{
+    if (!this->getPointCloud(pclDevName, m_pimpl->uncompressedCloud, receiveTimeInSeconds))
+    {
+        return false;
+    }
+
+    if (!m_pimpl->encoder.encode(*m_pimpl->uncompressedCloud, compressedPointCloud))
+    {
+        log()->error("[RealSenseCapture::getCompressedPointCloud] Unable to compress the point "
+                     "cloud.");
+        return false;
+    }
+
+    return true;
+}
+
 bool RealSense::Impl::startStream()
 {
     if (isPCLEnabled)
@@ -0,0 +1,128 @@
+/**
+ * @file PointCloudCodecTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <cmath>
+#include <limits>
+#include <memory>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/Perception/Compression/PointCloudCodec.h>
+
+using namespace BipedalLocomotion::Perception::Compression;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace BipedalLocomotion::RobotInterface;
+
+namespace
+{
+pcl::PointCloud<pcl::PointXYZRGB> createCloud()
+{
+    // a 1m x 1m plane sampled every 2.5 mm
+    constexpr int samples = 400;
+    pcl::PointCloud<pcl::PointXYZRGB> cloud;
+    for (int i = 0; i < samples; i++)
+    {
+        for (int j = 0; j < samples; j++)
+        {
+            pcl::PointXYZRGB point;
+            point.x = i * 0.0025f;
+            point.y = j * 0.0025f;
+            point.z = 1.0f + 0.1f * point.x;
+            point.r = static_cast<std::uint8_t>(i % 256);
+            point.g = static_cast<std::uint8_t>(j % 256);
+            point.b = 100;
+            cloud.push_back(point);
+        }
+    }
+
+    // add an invalid point that must be discarded
+    pcl::PointXYZRGB invalid;
+    invalid.x = std::numeric_limits<float>::quiet_NaN();
+    cloud.push_back(invalid);
+
+    cloud.width = static_cast<std::uint32_t>(cloud.size());
+    cloud.height = 1;
+    return cloud;
+}
+} // namespace
+
+TEST_CASE("Point cloud codec")
+{
+    const auto cloud = createCloud();
+
+    SECTION("Lossless geometry without decimation")
+    {
+        auto handler = std::make_shared<StdImplementation>();
+        handler->setParameter("voxel_size", 0.0);
+        handler->setParameter("resolution", 0.0005);
+
+        PointCloudEncoder encoder;
+        REQUIRE(encoder.initialize(handler));
+
+        CompressedPointCloud compressed;
+        REQUIRE(encoder.encode(cloud, compressed));
+        REQUIRE(compressed.numberOfPoints == cloud.size() - 1);
+
+        // the quantized coordinates must require less than the half of the raw ones
+        REQUIRE(compressed.coordinates.size() < compressed.numberOfPoints * 3 * sizeof(float) / 2);
+
+        PointCloudDecoder decoder;
+        REQUIRE(decoder.setInput(compressed));
+        REQUIRE(decoder.size() == compressed.numberOfPoints);
+
+        pcl::PointCloud<pcl::PointXYZRGB> decoded;
+        REQUIRE(decoder.decode(decoded));
+        REQUIRE(decoded.size() == compressed.numberOfPoints);
+
+        // the points are sorted, hence the point closest to the origin is the first one
+        REQUIRE(std::abs(decoded.points.front().x - cloud.points.front().x) < 0.0005);
+        REQUIRE(std::abs(decoded.points.front().y - cloud.points.front().y) < 0.0005);
+        REQUIRE(std::abs(decoded.points.front().z - cloud.points.front().z) < 0.0005);
+        REQUIRE(decoded.points.front().b == 100);
+    }
+
+    SECTION("Voxel decimation")
+    {
+        auto handler = std::make_shared<StdImplementation>();
+        handler->setParameter("voxel_size", 0.01);
+
+        PointCloudEncoder encoder;
+        REQUIRE(encoder.initialize(handler));
+
+        CompressedPointCloud compressed;
+        REQUIRE(encoder.encode(cloud, compressed));
+
+        // each voxel contains 4x4 points
+        REQUIRE(compressed.numberOfPoints <= cloud.size() / 10);
+
+        PointCloudDecoder decoder;
+        REQUIRE(decoder.setInput(compressed));
+
+        std::size_t numberOfPoints = 0;
+        REQUIRE(decoder.forEachPoint([&numberOfPoints](const pcl::PointXYZRGB& point) {
+            REQUIRE(point.x >= -1e-3);
+            REQUIRE(point.x <= 1.0);
+            REQUIRE(std::abs(point.z - 1.0f - 0.1f * point.x) < 1e-3);
+            numberOfPoints++;
+        }));
+        REQUIRE(numberOfPoints == compressed.numberOfPoints);
+    }
+
+    SECTION("Resolution too small")
+    {
+        auto handler = std::make_shared<StdImplementation>();
+        handler->setParameter("voxel_size", 0.0);
+        handler->setParameter("resolution", 1e-6);
+
+        PointCloudEncoder encoder;
+        REQUIRE(encoder.initialize(handler));
+
+        CompressedPointCloud compressed;
+        REQUIRE_FALSE(encoder.encode(cloud, compressed));
+    }
+}
@@ -51,3 +51,52 @@ TEST_CASE("Aruco Detector")
      */
 
 }
+
+TEST_CASE("Aruco Detector with tracking")
+{
+    std::shared_ptr<IParametersHandler> parameterHandler = std::make_shared<StdImplementation>();
+    parameterHandler->setParameter("marker_dictionary", "4X4_50");
+    parameterHandler->setParameter("marker_length", 0.806);
+    parameterHandler->setParameter("camera_matrix", std::vector<double>{922.309448242188,0,664.546813964844,0,922.194458007813,348.770141601563,0,0,1});
+    parameterHandler->setParameter("distortion_coefficients", std::vector<double>{0.0, 0.0, 0.0, 0.0, 0.0});
+    parameterHandler->setParameter("enable_tracking", true);
+    parameterHandler->setParameter("full_frame_search_period", 3);
+    parameterHandler->setParameter("profiling_period", 2);
+
+    ArucoDetector detector;
+    REQUIRE(detector.initialize(parameterHandler));
+
+    auto inputImg = cv::imread(getSampleImagePath());
+
+    // the first frame is searched entirely
+    REQUIRE(detector.setImage(inputImg, 0.1));
+    REQUIRE(detector.advance());
+    REQUIRE(detector.getStatistics().isFullFrameSearch);
+    ArucoMarkerData marker2;
+    REQUIRE(detector.getDetectedMarkerData(/*id=*/ 2, marker2));
+
+    // then the marker is searched in its region of interest
+    for (int i = 0; i < 2; i++)
+    {
+        REQUIRE(detector.setImage(inputImg, 0.2 + 0.1 * i));
+        REQUIRE(detector.advance());
+        REQUIRE_FALSE(detector.getStatistics().isFullFrameSearch);
+        REQUIRE(detector.getStatistics().numberOfRegionsOfInterest > 0);
+
+        ArucoMarkerData trackedMarker2;
+        REQUIRE(detector.getDetectedMarkerData(/*id=*/ 2, trackedMarker2));
+        REQUIRE(trackedMarker2.pose.isApprox(marker2.pose, 1e-6));
+    }
+
+    // periodic search in the whole image
+    REQUIRE(detector.setImage(inputImg, 0.4));
+    REQUIRE(detector.advance());
+    REQUIRE(detector.getStatistics().isFullFrameSearch);
+
+    // when the marker is lost the whole image is searched
+    cv::Mat blackImg = cv::Mat::zeros(inputImg.size(), inputImg.type());
+    REQUIRE(detector.setImage(blackImg, 0.5));
+    REQUIRE(detector.advance());
+    REQUIRE(detector.getStatistics().isFullFrameSearch);
+    REQUIRE(detector.getOutput().markers.empty());
+}
@@ -0,0 +1,115 @@
+/**
+ * @file PointCloudProcessorTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/Perception/Features/PointCloudProcessor.h>
+
+using namespace BipedalLocomotion::Perception::Features;
+using namespace BipedalLocomotion::ParametersHandler;
+
+using PointCloud = pcl::PointCloud<pcl::PointXYZRGB>;
+
+namespace
+{
+void addPatch(PointCloud& cloud, float x0, float y0, int size, float spacing)
+{
+    for (int i = 0; i < size; i++)
+    {
+        for (int j = 0; j < size; j++)
+        {
+            pcl::PointXYZRGB point;
+            point.x = x0 + i * spacing;
+            point.y = y0 + j * spacing;
+            point.z = 1.0f;
+            point.r = 100;
+            cloud.push_back(point);
+        }
+    }
+    cloud.width = cloud.size();
+    cloud.height = 1;
+}
+} // namespace
+
+TEST_CASE("Point cloud processor")
+{
+    // two patches of 20x20 points with a spacing of 1 cm and an isolated point
+    auto cloud = pcl::make_shared<PointCloud>();
+    addPatch(*cloud, 0.0025f, 0.0025f, 20, 0.01f);
+    addPatch(*cloud, 1.0025f, 0.0025f, 20, 0.01f);
+    pcl::PointXYZRGB isolatedPoint;
+    isolatedPoint.x = 0.5f;
+    isolatedPoint.y = 3.0f;
+    isolatedPoint.z = 1.0f;
+    cloud->push_back(isolatedPoint);
+    cloud->width = cloud->size();
+
+    for (const int numberOfThreads : {1, 4})
+    {
+        DYNAMIC_SECTION("Number of threads " << numberOfThreads)
+        {
+            auto handler = std::make_shared<StdImplementation>();
+            handler->setParameter("downsample_voxel_size", std::vector<double>{0.05, 0.05, 0.05});
+            handler->setParameter("nr_points_for_outlier_estimation", 10);
+            handler->setParameter("std_dev_multiplier_for_outlier_estimation", 1.0);
+            handler->setParameter("spatial_cluster_tolerance", 0.015);
+            handler->setParameter("min_points_for_clustering", 10);
+            handler->setParameter("max_points_for_clustering", 1000);
+            handler->setParameter("number_of_threads", numberOfThreads);
+
+            PointCloudProcessor<pcl::PointXYZRGB> processor;
+            REQUIRE(processor.initialize(handler));
+
+            // each patch covers 4x4 voxels
+            auto downsampled = pcl::make_shared<PointCloud>();
+            REQUIRE(processor.downsample(cloud, downsampled));
+            REQUIRE(downsampled->size() == 2 * 16 + 1);
+            for (const auto& point : downsampled->points)
+            {
+                REQUIRE(point.z == 1.0f);
+            }
+
+            // the isolated point is an outlier. The output can be the input
+            auto filtered = pcl::make_shared<PointCloud>(*cloud);
+            REQUIRE(processor.removeOutliers(filtered, filtered));
+            REQUIRE(filtered->size() < cloud->size());
+            for (const auto& point : filtered->points)
+            {
+                REQUIRE(point.y < 1.0f);
+            }
+
+            std::vector<pcl::PointIndices> clusterIndices;
+            std::vector<PointCloud::Ptr> clusters;
+            for (int i = 0; i < 2; i++)
+            {
+                // the second time the memory of the outputs is reused
+                REQUIRE(processor.extractClusters(cloud, clusterIndices, clusters));
+                REQUIRE(clusterIndices.size() == 2);
+                REQUIRE(clusters.size() == 2);
+                REQUIRE(clusterIndices[0].indices.size() == 400);
+                REQUIRE(clusterIndices[1].indices.size() == 400);
+                REQUIRE(clusterIndices[0].indices.front() == 0);
+                REQUIRE(clusterIndices[1].indices.front() == 400);
+                REQUIRE(clusters[1]->size() == 400);
+                REQUIRE(clusters[1]->points.front().x == (*cloud)[400].x);
+            }
+
+            // the clusters having too many points are discarded
+            handler->setParameter("max_points_for_clustering", 399);
+            REQUIRE(processor.initialize(handler));
+            REQUIRE(processor.extractClusters(cloud, clusterIndices, clusters));
+            REQUIRE(clusterIndices.empty());
+        }
+    }
+}
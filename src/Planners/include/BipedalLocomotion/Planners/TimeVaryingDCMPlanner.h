@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_PLANNERS_TIME_VARYING_DCM_PLANNER_H
 #define BIPEDAL_LOCOMOTION_PLANNERS_TIME_VARYING_DCM_PLANNER_H
 
+#include <chrono>
+#include <cstddef>
 #include <memory>
 
 #include <BipedalLocomotion/Planners/DCMPlanner.h>
@@ -17,6 +19,19 @@ namespace BipedalLocomotion
 namespace Planners
 {
 
+/**
+ * TimeVaryingDCMPlannerStatistics contains the statistics of the last call of
+ * TimeVaryingDCMPlanner::computeTrajectory
+ */
+struct TimeVaryingDCMPlannerStatistics
+{
+    std::size_t numberOfIterations{0}; /**< Number of iterations performed by ipopt. */
+    std::chrono::nanoseconds problemSetupDuration{0}; /**< Time spent to build the optimization
+                                                         problem. */
+    std::chrono::nanoseconds solverDuration{0}; /**< Time spent to solve the optimization
+                                                   problem. */
+};
+
 /**
  * DCMPlanner defines a trajectory generator for the variable height Divergent component of motion
  * (DCM).
@@ -48,6 +63,7 @@ public:
      * |           Parameter Name          |    Type    |                                                                   Description                                                                  | Mandatory |
      * |:---------------------------------:|:----------:|:----------------------------------------------------------------------------------------------------------------------------------------------:|:---------:|
      * |          `linear_solver`          |  `string`  | Linear solver used by ipopt, the default value is mumps. Please check [here](https://coin-or.github.io/Ipopt/#PREREQUISITES) for the available solvers |     No    |
+     * |         `ipopt_tolerance`         |  `double`  | Convergence tolerance of ipopt, the default value is \f$10^{-8}\f$. Please check [here](https://coin-or.github.io/Ipopt/OPTIONS.html#OPT_tol) |     No    |
      * |      `planner_sampling_time`      |  `double`  |                                                          Sampling time of the planner                                                          |    Yes    |
      * |      `number_of_foot_corners`     |    `int`   |                                      Number of the corner of the polygon used to describe the foot. E.g. 4                                     |    Yes    |
      * |         `foot_corner_<i>`         | `Vector3d` |             A 3d vector describing the position of the corner w.r.t. frame associated to the foot. `i = 0:number_of_foot_corners`.             |    Yes    |
@@ -118,6 +134,13 @@ public:
      */
      bool advance() final;
 
+    /**
+     * Get the statistics of the last call of computeTrajectory.
+     * @return a struct containing the number of iterations and the time spent to build and solve
+     * the optimization problem.
+     */
+    const TimeVaryingDCMPlannerStatistics& getStatistics() const;
+
 };
 } // namespace Planners
 } // namespace BipedalLocomotion
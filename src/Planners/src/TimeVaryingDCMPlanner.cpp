@@ -111,6 +111,8 @@ struct TimeVaryingDCMPlanner::Impl
     {
         unsigned long solverVerbosity{1}; /**< Verbosity of ipopt */
         std::string ipoptLinearSolver{"mumps"}; /**< Linear solved used by ipopt */
+        double ipoptTolerance{1e-8}; /**< Tolerance of ipopt
+                                        (https://coin-or.github.io/Ipopt/OPTIONS.html#OPT_tol) */
 
         std::chrono::nanoseconds plannerSamplingTime; /**< Sampling time of the planner in seconds
                                                        */
@@ -132,6 +134,8 @@ struct TimeVaryingDCMPlanner::Impl
     };
     OptimizationSettings optiSettings; /**< Settings */
 
+    TimeVaryingDCMPlannerStatistics statistics; /**< Statistics of the last solution */
+
     struct InitialValue
     {
         casadi::DM dcm; /**< initial guess for the DCM trajectory */
@@ -203,6 +207,7 @@ struct TimeVaryingDCMPlanner::Impl
             casadiOptions["print_time"] = false;
         }
         ipoptOptions["linear_solver"] = this->optiSettings.ipoptLinearSolver;
+        ipoptOptions["tol"] = this->optiSettings.ipoptTolerance;
         casadiOptions["expand"] = true;
 
         this->opti.solver("ipopt", casadiOptions, ipoptOptions);
@@ -658,6 +663,13 @@ bool TimeVaryingDCMPlanner::initialize(
                     m_pimpl->optiSettings.ipoptLinearSolver);
     }
 
+    if (!ptr->getParameter("ipopt_tolerance", m_pimpl->optiSettings.ipoptTolerance))
+    {
+        log()->info("{} ipopt_tolerance not found. The following parameter will be used {}.",
+                    logPrefix,
+                    m_pimpl->optiSettings.ipoptTolerance);
+    }
+
     bool ok = true;
     ok = ok && ptr->getParameter("omega_dot_weight", m_pimpl->optiSettings.omegaDotWeight);
     ok = ok && ptr->getParameter("dcm_tracking_weight", m_pimpl->optiSettings.dcmTrackingWeight);
@@ -738,6 +750,8 @@ bool TimeVaryingDCMPlanner::computeTrajectory()
 
     // clear the solver and the solution computed
     m_pimpl->clear();
+    m_pimpl->statistics = TimeVaryingDCMPlannerStatistics();
+    const auto problemSetupStart = std::chrono::steady_clock::now();
 
     const auto& initialTrajectoryTime = m_contactPhaseList.cbegin()->beginTime;
     const auto& endTrajectoryTime = m_contactPhaseList.lastPhase()->endTime;
@@ -753,10 +767,20 @@ bool TimeVaryingDCMPlanner::computeTrajectory()
         return false;
     }
 
+    const auto solverStart = std::chrono::steady_clock::now();
+    m_pimpl->statistics.problemSetupDuration = solverStart - problemSetupStart;
+
     // this is how casadi works
     try
     {
         m_pimpl->optiSolution.solution = std::make_unique<casadi::OptiSol>(m_pimpl->opti.solve());
+        m_pimpl->statistics.solverDuration = std::chrono::steady_clock::now() - solverStart;
+
+        const casadi::Dict solverStats = m_pimpl->optiSolution.solution->stats();
+        if (auto iterations = solverStats.find("iter_count"); iterations != solverStats.end())
+        {
+            m_pimpl->statistics.numberOfIterations = iterations->second.to_int();
+        }
     } catch (const std::exception& e)
     {
         log()->error("{} Unable to solve the optimization problem. The following exception has "
@@ -855,6 +879,12 @@ bool TimeVaryingDCMPlanner::isOutputValid() const
     return m_pimpl->isTrajectoryComputed;
 }
 
+const TimeVaryingDCMPlannerStatistics& TimeVaryingDCMPlanner::getStatistics() const
+{
+    assert(m_pimpl);
+    return m_pimpl->statistics;
+}
+
 bool TimeVaryingDCMPlanner::advance()
 {
     constexpr auto logPrefix = "[TimeVaryingDCMPlanner::advance]";
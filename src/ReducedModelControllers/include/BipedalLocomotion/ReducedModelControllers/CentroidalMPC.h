@@ -8,6 +8,8 @@
 #ifndef BIPEDAL_LOCOMOTION_REDUCE_MODEL_CONTROLLERS_CENTROIDAL_MPC_H
 #define BIPEDAL_LOCOMOTION_REDUCE_MODEL_CONTROLLERS_CENTROIDAL_MPC_H
 
+#include <chrono>
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <optional>
@@ -41,6 +43,17 @@ struct CentroidalMPCOutput
                                                                generated by the CentroidalMPC. */
 };
 
+/**
+ * CentroidalMPCStatistics contains the statistics of the last call of CentroidalMPC::advance
+ */
+struct CentroidalMPCStatistics
+{
+    std::size_t numberOfIterations{0}; /**< Number of iterations performed by the solver. It is
+                                          always zero if casadi is older than 3.6. */
+    std::chrono::nanoseconds solverDuration{0}; /**< Time spent to solve the optimization
+                                                   problem. */
+};
+
 /**
  * CentroidalMPC implements a Non-Linear Model Predictive Controller for humanoid robot locomotion
  * with online step adjustment capabilities. The proposed controller considers the Centroidal
@@ -193,6 +206,12 @@ public:
      */
     bool isOutputValid() const final;
 
+    /**
+     * Get the statistics of the last call of advance.
+     * @return a struct containing the number of iterations and the time spent by the solver.
+     */
+    const CentroidalMPCStatistics& getStatistics() const;
+
     /**
      * Perform one control cycle.
      * @return True if the advance is successfull.
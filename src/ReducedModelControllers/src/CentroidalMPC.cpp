@@ -79,9 +79,11 @@ struct CentroidalMPC::Impl
 {
     casadi::Opti opti; /**< CasADi opti stack */
     casadi::Function controller;
+    casadi::Function solver; /**< Solver called by the controller. Used to retrieve its stats */
     std::chrono::nanoseconds currentTime{std::chrono::nanoseconds::zero()};
 
     CentroidalMPCOutput output;
+    CentroidalMPCStatistics statistics;
     Contacts::ContactPhaseList contactPhaseList;
     Math::LinearizedFrictionCone frictionCone;
 
@@ -1115,6 +1117,22 @@ bool CentroidalMPC::initialize(std::weak_ptr<const ParametersHandler::IParameter
 
     m_pimpl->resizeControllerInputs();
     m_pimpl->controller = m_pimpl->createController();
+
+    // The controller is a function wrapping the solver created by opti, hence the solver has to
+    // be retrieved from the controller to access the stats of the last call.
+    // Function::find_function is available since casadi 3.6.
+#if CASADI_MAJOR_VERSION > 3 || (CASADI_MAJOR_VERSION == 3 && CASADI_MINOR_VERSION >= 6)
+    try
+    {
+        m_pimpl->solver = m_pimpl->controller.find_function("solver");
+    } catch (const std::exception& e)
+    {
+        log()->debug("{} Unable to retrieve the solver. The number of iterations will not be "
+                     "available. The following exception has been thrown {}.",
+                     errorPrefix,
+                     e.what());
+    }
+#endif
     m_pimpl->fsm = Impl::FSM::Initialized;
 
     return true;
@@ -1137,6 +1155,11 @@ bool CentroidalMPC::isOutputValid() const
     return m_pimpl->fsm == Impl::FSM::OutputValid;
 }
 
+const CentroidalMPCStatistics& CentroidalMPC::getStatistics() const
+{
+    return m_pimpl->statistics;
+}
+
 bool CentroidalMPC::advance()
 {
     constexpr auto errorPrefix = "[CentroidalMPC::advance]";
@@ -1156,9 +1179,22 @@ bool CentroidalMPC::advance()
 
     // compute the output
     std::vector<casadi::DM> controllerOutput;
+    m_pimpl->statistics = CentroidalMPCStatistics();
     try
     {
+        const auto solverStart = std::chrono::steady_clock::now();
         controllerOutput = m_pimpl->controller(m_pimpl->vectorizedOptiInputs);
+        m_pimpl->statistics.solverDuration = std::chrono::steady_clock::now() - solverStart;
+
+        // both ipopt and sqpmethod report the number of iterations of the last call
+        if (!m_pimpl->solver.is_null())
+        {
+            const casadi::Dict solverStats = m_pimpl->solver.stats();
+            if (auto iterations = solverStats.find("iter_count"); iterations != solverStats.end())
+            {
+                m_pimpl->statistics.numberOfIterations = iterations->second.to_int();
+            }
+        }
     } catch (const std::exception& e)
     {
         log()->error("{} Unable to solve the problem. The following exception has been thrown {}.",
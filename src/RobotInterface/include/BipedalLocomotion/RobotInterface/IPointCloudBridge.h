@@ -6,6 +6,8 @@
 #ifndef BIPEDAL_LOCOMOTION_ROBOT_INTERFACE_IPCL_BRIDGE_H
 #define BIPEDAL_LOCOMOTION_ROBOT_INTERFACE_IPCL_BRIDGE_H
 
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -14,6 +16,7 @@
 #include <vector>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
@@ -39,6 +42,23 @@ struct PCLBridgeMetaData
     PCLDeviceLists pclDevList;
 };
 
+/**
+ * Point cloud decimated on a voxel grid and encoded with quantized 16-bit coordinates.
+ * The quantized coordinates of each point are packed in a single integer key, the points are
+ * sorted by key and only the difference between two consecutive keys is stored as a variable
+ * length integer. The content of this struct can be decoded with
+ * BipedalLocomotion::Perception::Compression::PointCloudDecoder.
+ */
+struct CompressedPointCloud
+{
+    std::array<float, 3> origin{0.0f, 0.0f, 0.0f}; /**< Position of the quantization grid origin
+                                                      in meters. */
+    float resolution{0.0f}; /**< Quantization step in meters. */
+    std::size_t numberOfPoints{0}; /**< Number of encoded points. */
+    std::vector<std::uint8_t> coordinates; /**< Delta encoded quantized coordinates. */
+    std::vector<std::uint8_t> colors; /**< Packed RGB triplets, one for each encoded point. */
+};
+
 /**
  * Sensor bridge interface.
  */
@@ -77,6 +97,29 @@ public:
         return false;
     };
 
+    /**
+     * Get the point cloud decimated and compressed by the producer.
+     * @param[in] pclDev name of the point cloud device
+     * @param[out] compressedPointCloud compressed point cloud. The memory already allocated by
+     * the object is reused.
+     * @param[out] receiveTimeInSeconds time at which the point cloud has been received
+     * @return true/false in case of success/failure
+     * @note The point cloud can be lazily decoded by the consumer only when needed.
+     * @note The default implementation returns false since the compression is not supported by
+     * the bridge.
+     */
+    virtual bool
+    getCompressedPointCloud(const std::string& pclDev,
+                            CompressedPointCloud& compressedPointCloud,
+                            std::optional<std::reference_wrapper<double>> receiveTimeInSeconds = {})
+    {
+        log()->error("[IPointCloudBridge::getCompressedPointCloud] The compression of the point "
+                     "cloud is not supported by this bridge. Unable to get the compressed point "
+                     "cloud of the device {}.",
+                     pclDev);
+        return false;
+    };
+
     /**
      * Destructor
      */
@@ -9,9 +9,11 @@
 #define BIPEDAL_LOCOMOTION_SIMPLIFIED_MODEL_CONTROLLERS_COM_ZMP_CONTROLLER_H
 
 #include <memory>
+#include <string>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
 #include <BipedalLocomotion/System/Advanceable.h>
+#include <BipedalLocomotion/System/ParametersWatcher.h>
 
 #include <manif/SO2.h>
 
@@ -134,7 +136,40 @@ public:
                       Eigen::Ref<const Eigen::Vector2d> ZMPPosition,
                       const double angle);
 
+     /**
+      * Set the listener used to update the gains while the controller is running.
+      * @param listener pointer to a listener created by a System::ParametersWatcher.
+      * @param groupName name of the group containing the `com_gain` and `zmp_gain` parameters. If
+      * empty the parameters are searched in the root of the handler.
+      * @note The listener is checked at the beginning of advance(). A validator is set to the
+      * listener, so the snapshots not containing both the gains are rejected by the watcher and
+      * the previous gains are kept.
+      */
+     void setParametersListener(std::shared_ptr<System::ParametersListener> listener,
+                                const std::string& groupName = "");
+
  private:
+     /**
+      * Update the gains from the last snapshot received by the listener.
+      */
+     void updateGains();
+
+     /**
+      * Get the gains from a snapshot.
+      * @param snapshot the snapshot.
+      * @param groupName name of the group containing the gains.
+      * @param CoMGain gain of the CoM.
+      * @param ZMPGain gain of the ZMP.
+      * @return true if both the gains are available, false otherwise.
+      */
+     static bool getGains(const System::ParametersSnapshot& snapshot,
+                          const std::string& groupName,
+                          Eigen::Vector2d& CoMGain,
+                          Eigen::Vector2d& ZMPGain);
+
+     std::shared_ptr<System::ParametersListener> m_parametersListener;
+     std::string m_parametersGroupName;
+
      manif::SO2d m_I_R_B{manif::SO2d::Identity()};
      Eigen::Vector2d m_CoMGain{Eigen::Vector2d::Zero()};
      Eigen::Vector2d m_ZMPGain{Eigen::Vector2d::Zero()};
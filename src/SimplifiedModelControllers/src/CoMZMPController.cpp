@@ -10,6 +10,7 @@
 #include <BipedalLocomotion/TextLogging/Logger.h>
 
 #include <memory>
+#include <string>
 
 using namespace BipedalLocomotion::SimplifiedModelControllers;
 using namespace BipedalLocomotion;
@@ -61,6 +62,12 @@ bool CoMZMPController::advance()
         return false;
     }
 
+    // the gains are updated before checking the output since they change the output
+    if (m_parametersListener != nullptr && m_parametersListener->update())
+    {
+        this->updateGains();
+    }
+
     if (m_isOutputValid)
         return true;
 
@@ -117,3 +124,53 @@ void CoMZMPController::setFeedback(Eigen::Ref<const Eigen::Vector2d> CoMPosition
 {
     this->setFeedback(CoMPosition, ZMPPosition, manif::SO2d(angle));
 }
+
+void CoMZMPController::setParametersListener(std::shared_ptr<System::ParametersListener> listener,
+                                             const std::string& groupName)
+{
+    m_parametersListener = listener;
+    m_parametersGroupName = groupName;
+
+    if (m_parametersListener == nullptr)
+    {
+        return;
+    }
+
+    // the gains are checked by the thread of the watcher, so that advance() does not need to
+    // report invalid parameters
+    m_parametersListener->setValidator([groupName](const System::ParametersSnapshot& snapshot) {
+        Eigen::Vector2d CoMGain, ZMPGain;
+        return getGains(snapshot, groupName, CoMGain, ZMPGain);
+    });
+}
+
+bool CoMZMPController::getGains(const System::ParametersSnapshot& snapshot,
+                                const std::string& groupName,
+                                Eigen::Vector2d& CoMGain,
+                                Eigen::Vector2d& ZMPGain)
+{
+    auto handler = snapshot.parameters;
+    if (handler != nullptr && !groupName.empty())
+    {
+        handler = handler->getGroup(groupName).lock();
+    }
+
+    return handler != nullptr && handler->getParameter("com_gain", CoMGain)
+           && handler->getParameter("zmp_gain", ZMPGain);
+}
+
+void CoMZMPController::updateGains()
+{
+    // the snapshots without valid gains are rejected by the validator, hence the gains are
+    // always available except for the snapshot published before setting the listener. In that
+    // case the previous gains are kept
+    Eigen::Vector2d CoMGain, ZMPGain;
+    if (!getGains(m_parametersListener->getSnapshot(), m_parametersGroupName, CoMGain, ZMPGain))
+    {
+        return;
+    }
+
+    m_CoMGain = CoMGain;
+    m_ZMPGain = ZMPGain;
+    m_isOutputValid = false;
+}
@@ -6,6 +6,10 @@
  */
 
 #include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
 
 // Catch2
 #include <catch2/catch_test_macros.hpp>
@@ -64,3 +68,43 @@ TEST_CASE("Controller")
 
     expectedOutput.isApprox(controller.getOutput());
 }
+
+TEST_CASE("Controller with parameters listener")
+{
+    CoMZMPController::Input input;
+    input.desiredCoMVelocity.setZero();
+    input.desiredCoMPosition << 0.01, 0;
+    input.desiredZMPPosition << 0.01, 0;
+    input.CoMPosition << -0.02, 0.03;
+    input.ZMPPosition << 0.04, -0.01;
+    input.angle = 0;
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("zmp_gain", std::vector<double>{3, 4});
+    handler->setParameter("com_gain", std::vector<double>{1, 2});
+
+    BipedalLocomotion::System::ParametersWatcher watcher;
+    auto listener = watcher.createListener();
+
+    // the parameters are not stored in a file, so they are loaded only when reload is called
+    REQUIRE(watcher.start("not_existing_file.toml",
+                          std::chrono::seconds(1),
+                          [handler](const std::string&) { return handler->clone(); }));
+
+    CoMZMPController controller;
+    REQUIRE(controller.initialize(handler));
+    controller.setParametersListener(listener);
+
+    controller.setInput(input);
+    REQUIRE(controller.advance());
+    const Eigen::Vector2d output = controller.getOutput();
+
+    // the gains are updated without calling initialize
+    handler->setParameter("com_gain", std::vector<double>{2, 4});
+    handler->setParameter("zmp_gain", std::vector<double>{6, 8});
+    REQUIRE(watcher.reload());
+    REQUIRE(controller.advance());
+    REQUIRE(controller.getOutput().isApprox(2 * output));
+
+    watcher.stop();
+}
@@ -8,6 +8,7 @@
 #ifndef BIPEDAL_LOCOMOTION_SYSTEM_ILINEAR_TASK_SOLVER_H
 #define BIPEDAL_LOCOMOTION_SYSTEM_ILINEAR_TASK_SOLVER_H
 
+#include <chrono>
 #include <memory>
 #include <optional>
 #include <string>
@@ -31,6 +32,18 @@ namespace System
  */
 using WeightProviderPort = OutputPort<Eigen::VectorXd>;
 
+/**
+ * LinearTaskSolverTimings contains the time spent by ILinearTaskSolver::advance in each of its
+ * phases during the last call.
+ */
+struct LinearTaskSolverTimings
+{
+    std::chrono::nanoseconds tasksUpdate{0}; /**< Time spent updating the tasks. */
+    std::chrono::nanoseconds problemAssembly{0}; /**< Time spent building the cost and the
+                                                    constraints of the problem. */
+    std::chrono::nanoseconds problemSolution{0}; /**< Time spent by the solver. */
+};
+
 /**
  * ILinearTaskSolver describes the interface for solving problem related to LinearTask class. Please
  * check IntegrationBasedIK for further details.
@@ -140,6 +153,15 @@ public:
      */
     virtual Eigen::Ref<const Eigen::VectorXd> getRawSolution() const = 0;
 
+    /**
+     * Get the time spent in each phase of the last call of advance.
+     * @return the timings of the last advance. The default implementation returns zero durations.
+     */
+    virtual LinearTaskSolverTimings getTimings() const
+    {
+        return LinearTaskSolverTimings();
+    }
+
     /**
      * Destructor.
      */
@@ -0,0 +1,218 @@
+/**
+ * @file ParametersWatcher.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_PARAMETERS_WATCHER_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_PARAMETERS_WATCHER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <BipedalLocomotion/ParametersHandler/CompiledImplementation.h>
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/System/TripleBuffer.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * ParametersSnapshot contains a version of the parameters published by ParametersWatcher.
+ */
+struct ParametersSnapshot
+{
+    std::uint64_t version{0}; /**< Version of the parameters. It starts from 1. */
+
+    /** Parameters. The handler is compiled, hence getting a parameter does not allocate memory. */
+    std::shared_ptr<const ParametersHandler::IParametersHandler> parameters;
+
+    /** Names of the parameters changed with respect to the previous version published by the
+     * watcher. The names of the parameters contained in a group are prefixed by the name of the
+     * group followed by '/'. */
+    std::vector<std::string> changedKeys;
+
+    /**
+     * Check if a parameter has been changed with respect to the previous version.
+     * @param key name of the parameter, e.g. `GROUP/parameter`.
+     * @return true if the parameter has been changed, false otherwise.
+     */
+    bool hasChanged(const std::string& key) const;
+};
+
+/**
+ * ParametersListener receives the snapshots published by a ParametersWatcher. It is meant to be
+ * used by a single thread, usually the one running the control loop. Checking if new parameters
+ * are available costs a single atomic load, and receiving them neither blocks nor allocates or
+ * frees memory. The snapshots that are no longer used are released by the thread of the
+ * ParametersWatcher.
+ * @code{.cpp}
+ * bool Controller::advance()
+ * {
+ *     if (m_listener != nullptr && m_listener->update())
+ *     {
+ *         m_listener->getSnapshot().parameters->getParameter("gain", m_gain);
+ *     }
+ *     ...
+ * }
+ * @endcode
+ */
+class ParametersListener
+{
+public:
+    /**
+     * Function checking a snapshot before it is published to the listener. It returns true if the
+     * snapshot can be published.
+     */
+    using Validator = std::function<bool(const ParametersSnapshot& snapshot)>;
+
+    /**
+     * Set the function used to check the snapshots before publishing them to the listener. The
+     * function is called by the thread of the ParametersWatcher. A rejected snapshot is not
+     * published to the listener and the watcher prints a warning, so the thread using the
+     * listener neither receives invalid parameters nor needs to report the error.
+     * @param validator the function. If empty all the snapshots are published.
+     * @note The snapshot published before setting the validator is not checked.
+     */
+    void setValidator(Validator validator);
+
+    /**
+     * Check if a new snapshot has been published and, in that case, receive it.
+     * @return true if a new snapshot has been received, false otherwise.
+     */
+    bool update();
+
+    /**
+     * Get the last snapshot received by update.
+     * @return the snapshot. ParametersSnapshot::parameters is nullptr if no snapshot has been
+     * received yet.
+     */
+    const ParametersSnapshot& getSnapshot() const;
+
+private:
+    friend class ParametersWatcher;
+
+    /**
+     * Check a snapshot with the validator.
+     * @param snapshot the snapshot.
+     * @return true if the snapshot can be published, false otherwise.
+     */
+    bool isValid(const ParametersSnapshot& snapshot);
+
+    std::mutex m_validatorMutex; /**< Mutex protecting the validator. */
+    Validator m_validator; /**< Function checking the snapshots. */
+
+    /** Buffer shared with the watcher. */
+    TripleBuffer<std::shared_ptr<const ParametersSnapshot>> m_buffer;
+
+    /** Snapshot returned when no snapshot has been received yet. */
+    ParametersSnapshot m_emptySnapshot;
+};
+
+/**
+ * ParametersWatcher allows the user to change the parameters of a running application without
+ * restarting it or stopping the control loop. A background thread periodically checks the
+ * modification time of a configuration file. When the file changes, the thread loads it, compiles
+ * it in a ParametersHandler::CompiledImplementation and computes the parameters that have been
+ * changed. If any, a new ParametersSnapshot is published to all the ParametersListener objects
+ * created with ParametersWatcher::createListener.
+ * @code{.cpp}
+ * ParametersWatcher watcher;
+ * auto listener = watcher.createListener();
+ * controller.setParametersListener(listener);
+ * watcher.start("config.toml", std::chrono::seconds(1), [](const std::string& filename) {
+ *     auto handler = std::make_shared<ParametersHandler::TomlImplementation>();
+ *     return handler->setFromFile(filename) ? handler : nullptr;
+ * });
+ * @endcode
+ * @note The loader is a function since the library implementing the parameters handler (e.g.
+ * TOML or YARP) is chosen by the application.
+ */
+class ParametersWatcher
+{
+public:
+    /**
+     * Function loading the parameters from a file. It returns nullptr in case of failure.
+     */
+    using Loader = std::function<ParametersHandler::IParametersHandler::shared_ptr(
+        const std::string& filename)>;
+
+    /**
+     * Destructor. It stops the background thread.
+     */
+    ~ParametersWatcher();
+
+    /**
+     * Create a new listener.
+     * @return a pointer to the listener. If the watcher already published a snapshot, the listener
+     * receives it at the first call of ParametersListener::update.
+     */
+    std::shared_ptr<ParametersListener> createListener();
+
+    /**
+     * Load the parameters and start the background thread.
+     * @param filename name of the configuration file.
+     * @param period period used to check the modification time of the file.
+     * @param loader function used to load the file.
+     * @return true in case of success, false otherwise.
+     * @note The first version of the parameters is published before returning.
+     */
+    bool start(const std::string& filename, std::chrono::nanoseconds period, Loader loader);
+
+    /**
+     * Stop the background thread.
+     */
+    void stop();
+
+    /**
+     * Load the file again and publish a new snapshot if any parameter changed. This can be used,
+     * e.g., by an RPC command to reload the parameters immediately.
+     * @return true in case of success, false otherwise.
+     */
+    bool reload();
+
+    /**
+     * Get the version of the last published snapshot.
+     * @return the version. It is zero if no snapshot has been published.
+     */
+    std::uint64_t getVersion() const;
+
+private:
+    /**
+     * Check periodically the modification time of the file.
+     */
+    void run();
+
+    std::mutex m_mutex; /**< Mutex protecting the loader, the listeners and the last snapshot. */
+    std::condition_variable m_stopCondition; /**< Used to stop the thread without waiting. */
+    std::string m_filename; /**< Name of the configuration file. */
+    std::filesystem::file_time_type m_lastWriteTime; /**< Modification time of the file. */
+    Loader m_loader; /**< Function loading the configuration file. */
+    std::chrono::nanoseconds m_period{std::chrono::seconds(1)}; /**< Period of the thread. */
+
+    std::vector<std::shared_ptr<ParametersListener>> m_listeners; /**< Listeners. */
+
+    /** Last published parameters. */
+    std::shared_ptr<ParametersHandler::CompiledImplementation> m_parameters;
+    std::shared_ptr<const ParametersSnapshot> m_snapshot; /**< Last published snapshot. */
+    std::atomic<std::uint64_t> m_version{0}; /**< Version of the last published snapshot. */
+
+    std::thread m_thread; /**< Background thread. */
+    std::atomic<bool> m_isRunning{false}; /**< True if the background thread is running. */
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_PARAMETERS_WATCHER_H
@@ -0,0 +1,97 @@
+/**
+ * @file ReloadableWeightProvider.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_RELOADABLE_WEIGHT_PROVIDER_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_RELOADABLE_WEIGHT_PROVIDER_H
+
+#include <memory>
+#include <string>
+
+#include <Eigen/Dense>
+
+#include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/System/ParametersWatcher.h>
+#include <BipedalLocomotion/System/WeightProvider.h>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * ReloadableWeightProvider describes the provider for a weight that can be changed while the
+ * application is running by a ParametersWatcher. The weight is updated by advance() when a new
+ * snapshot is received by the listener. It can be used to change the weights of the tasks of a
+ * TSID or IK problem without building the problem again.
+ * @code{.cpp}
+ * auto weight = std::make_shared<ReloadableWeightProvider>();
+ * weight->initialize(taskGroup);
+ * weight->setParametersListener(watcher.createListener(), "COM_TASK");
+ * solver.setTaskWeight("com_task", weight);
+ *
+ * // control loop
+ * weight->advance();
+ * solver.advance();
+ * @endcode
+ * @note The size of the weight cannot be changed. The snapshots containing a weight with a
+ * different size are rejected by the watcher.
+ */
+class ReloadableWeightProvider : public WeightProvider
+{
+    Eigen::VectorXd m_weight; /**< Vector representing the diagonal matrix of a weight */
+    Eigen::VectorXd m_newWeight; /**< Buffer used to read the new weight. */
+    std::shared_ptr<ParametersListener> m_parametersListener; /**< Listener. */
+    std::string m_parametersGroupName; /**< Name of the group containing the weight. */
+
+public:
+    /**
+     * Initialize the weight provider.
+     * @param handler pointer to the parameter handler.
+     * @note The following parameters are required:
+     * |  Parameter Name  |        Type      |                          Description | Mandatory |
+     * |:----------------:|:----------------:|:-----------------------------------------------------------------:|:---------:|
+     * |    `weight`      | `vector<double>` |  Vector representing the diagonal matrix of the initial weight    |    Yes    |
+     * @return true in case of success/false otherwise.
+     */
+    bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler) override;
+
+    /**
+     * Set the listener used to update the weight.
+     * @param listener pointer to a listener created by a ParametersWatcher. It must not be shared
+     * with other objects.
+     * @param groupName name of the group containing the `weight` parameter. If empty the parameter
+     * is searched in the root of the handler.
+     * @return true in case of success, false otherwise.
+     * @warning The provider must be initialized before setting the listener.
+     */
+    bool setParametersListener(std::shared_ptr<ParametersListener> listener,
+                               const std::string& groupName = "");
+
+    /**
+     * Update the weight if a new snapshot has been received by the listener.
+     * @return true in case of success, false otherwise.
+     */
+    bool advance() final;
+
+    /**
+     * Get the weight associated to the provider
+     * @return A vector representing the diagonal matrix of the weight
+     */
+    const Eigen::VectorXd& getOutput() const final;
+
+    /**
+     * Determines the validity of the weight
+     * @return True if the weight is valid, false otherwise.
+     */
+    bool isOutputValid() const final;
+};
+
+BLF_REGISTER_WEIGHT_PROVIDER(ReloadableWeightProvider);
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_RELOADABLE_WEIGHT_PROVIDER_H
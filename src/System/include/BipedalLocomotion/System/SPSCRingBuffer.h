@@ -0,0 +1,219 @@
+/**
+ * @file SPSCRingBuffer.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_SPSC_RING_BUFFER_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_SPSC_RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * SPSCRingBuffer is a bounded, lock-free queue that can be shared between exactly one producer
+ * thread and one consumer thread. All the elements are allocated by SPSCRingBuffer::initialize,
+ * then the producer writes directly in a free slot and the consumer reads directly from the
+ * oldest written slot. Neither the producer nor the consumer ever block or allocate memory.
+ * @code{.cpp}
+ * SPSCRingBuffer<Eigen::VectorXd> buffer;
+ * buffer.initialize(100, Eigen::VectorXd::Zero(10));
+ *
+ * // producer thread
+ * if (Eigen::VectorXd* slot = buffer.beginWrite(); slot != nullptr)
+ * {
+ *     *slot = measurement; // no allocation since the slot has already the correct size
+ *     buffer.endWrite();
+ * }
+ *
+ * // consumer thread
+ * if (const Eigen::VectorXd* slot = buffer.beginRead(); slot != nullptr)
+ * {
+ *     process(*slot);
+ *     buffer.endRead();
+ * }
+ * @endcode
+ * @warning The class is not thread safe if more than one thread writes or more than one thread
+ * reads.
+ */
+template <class T> class SPSCRingBuffer
+{
+public:
+    /**
+     * Allocate the memory of the buffer.
+     * @param capacity maximum number of elements stored in the buffer.
+     * @param prototype element used to initialize all the slots of the buffer.
+     * @return true in case of success, false otherwise.
+     * @warning This function must be called before starting the producer and the consumer threads.
+     */
+    bool initialize(std::size_t capacity, const T& prototype = T());
+
+    /**
+     * Get the maximum number of elements that can be stored in the buffer.
+     * @return the capacity of the buffer.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * Get the number of elements stored in the buffer.
+     * @return the number of elements. Since the producer and the consumer may be running, the
+     * value may be outdated when the function returns.
+     */
+    std::size_t size() const;
+
+    /**
+     * Get a pointer to the free slot that will be written by the producer.
+     * @return a pointer to the slot or nullptr if the buffer is full.
+     * @note The element is made available to the consumer only when endWrite() is called.
+     */
+    T* beginWrite();
+
+    /**
+     * Publish the slot returned by beginWrite() to the consumer.
+     */
+    void endWrite();
+
+    /**
+     * Get a pointer to the oldest element written by the producer.
+     * @return a pointer to the element or nullptr if the buffer is empty.
+     * @note The slot is given back to the producer only when endRead() is called.
+     */
+    const T* beginRead();
+
+    /**
+     * Release the slot returned by beginRead().
+     */
+    void endRead();
+
+    /**
+     * Copy an element in the buffer.
+     * @param element the element to be copied.
+     * @return true if the element has been stored, false if the buffer is full.
+     */
+    bool push(const T& element);
+
+    /**
+     * Copy the oldest element of the buffer and remove it.
+     * @param element the copied element.
+     * @return true if an element has been copied, false if the buffer is empty.
+     */
+    bool pop(T& element);
+
+private:
+    std::size_t next(std::size_t index) const;
+
+    std::vector<T> m_slots; /**< The slots. One slot is always left empty to distinguish the full
+                               and the empty buffer. */
+
+    // head and tail are placed in different cache lines to avoid false sharing between the
+    // producer and the consumer
+    alignas(64) std::atomic<std::size_t> m_head{0}; /**< Next slot written by the producer. */
+    alignas(64) std::atomic<std::size_t> m_tail{0}; /**< Next slot read by the consumer. */
+};
+
+template <class T>
+bool SPSCRingBuffer<T>::initialize(std::size_t capacity, const T& prototype)
+{
+    if (capacity == 0)
+    {
+        return false;
+    }
+
+    m_slots.assign(capacity + 1, prototype);
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+    return true;
+}
+
+template <class T> std::size_t SPSCRingBuffer<T>::capacity() const
+{
+    return m_slots.empty() ? 0 : m_slots.size() - 1;
+}
+
+template <class T> std::size_t SPSCRingBuffer<T>::size() const
+{
+    const std::size_t head = m_head.load(std::memory_order_acquire);
+    const std::size_t tail = m_tail.load(std::memory_order_acquire);
+    return head >= tail ? head - tail : head + m_slots.size() - tail;
+}
+
+template <class T> std::size_t SPSCRingBuffer<T>::next(std::size_t index) const
+{
+    return index + 1 == m_slots.size() ? 0 : index + 1;
+}
+
+template <class T> T* SPSCRingBuffer<T>::beginWrite()
+{
+    if (m_slots.empty())
+    {
+        return nullptr;
+    }
+
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    if (next(head) == m_tail.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    return &m_slots[head];
+}
+
+template <class T> void SPSCRingBuffer<T>::endWrite()
+{
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    m_head.store(next(head), std::memory_order_release);
+}
+
+template <class T> const T* SPSCRingBuffer<T>::beginRead()
+{
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail == m_head.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    return &m_slots[tail];
+}
+
+template <class T> void SPSCRingBuffer<T>::endRead()
+{
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    m_tail.store(next(tail), std::memory_order_release);
+}
+
+template <class T> bool SPSCRingBuffer<T>::push(const T& element)
+{
+    T* slot = this->beginWrite();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+
+    *slot = element;
+    this->endWrite();
+    return true;
+}
+
+template <class T> bool SPSCRingBuffer<T>::pop(T& element)
+{
+    const T* slot = this->beginRead();
+    if (slot == nullptr)
+    {
+        return false;
+    }
+
+    element = *slot;
+    this->endRead();
+    return true;
+}
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_SPSC_RING_BUFFER_H
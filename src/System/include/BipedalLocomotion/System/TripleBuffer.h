@@ -0,0 +1,133 @@
+/**
+ * @file TripleBuffer.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_TRIPLE_BUFFER_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * TripleBuffer shares the latest value of a variable between exactly one producer thread and one
+ * consumer thread. Differently from SPSCRingBuffer, the producer never waits for the consumer: a
+ * value that has not been read yet is simply replaced by the newer one. The class stores three
+ * copies of the variable. The producer owns one of them, the consumer owns another one and the
+ * third one contains the latest published value. Publishing and reading swap the owned copy with
+ * the published one, so neither the producer nor the consumer ever block, copy or allocate
+ * memory.
+ * @code{.cpp}
+ * TripleBuffer<Eigen::VectorXd> buffer;
+ * buffer.initialize(Eigen::VectorXd::Zero(10));
+ *
+ * // producer thread
+ * buffer.getWriteBuffer() = measurement; // no allocation since the copy has the correct size
+ * buffer.publish();
+ *
+ * // consumer thread
+ * if (buffer.update())
+ * {
+ *     process(buffer.getReadBuffer());
+ * }
+ * @endcode
+ * @warning The class is not thread safe if more than one thread writes or more than one thread
+ * reads.
+ */
+template <class T> class TripleBuffer
+{
+public:
+    /**
+     * Initialize the three copies of the variable.
+     * @param prototype value used to initialize the copies.
+     * @warning This function must be called before starting the producer and the consumer threads.
+     */
+    void initialize(const T& prototype = T());
+
+    /**
+     * Get the copy owned by the producer.
+     * @return a reference to the copy. It is made available to the consumer by publish().
+     */
+    T& getWriteBuffer();
+
+    /**
+     * Publish the copy owned by the producer. The producer receives the copy published before,
+     * or the copy released by the consumer.
+     * @note Since the producer may receive an old copy, the content of getWriteBuffer() must be
+     * considered undefined after calling this function.
+     */
+    void publish();
+
+    /**
+     * Get the latest published copy.
+     * @return true if a new copy has been published since the last call, false otherwise. In the
+     * latter case getReadBuffer() is not changed.
+     */
+    bool update();
+
+    /**
+     * Get the copy owned by the consumer.
+     * @return a reference to the copy obtained by the last call of update().
+     */
+    const T& getReadBuffer() const;
+
+private:
+    static constexpr std::uint8_t indexMask = 0x3; /**< Bits containing the published copy. */
+    static constexpr std::uint8_t newDataBit = 0x4; /**< Set if the consumer has not seen the
+                                                       published copy. */
+
+    std::array<T, 3> m_buffers;
+    std::uint8_t m_writeIndex{0}; /**< Copy owned by the producer. */
+    std::uint8_t m_readIndex{1}; /**< Copy owned by the consumer. */
+    std::atomic<std::uint8_t> m_state{2}; /**< Published copy and newDataBit. */
+};
+
+template <class T> void TripleBuffer<T>::initialize(const T& prototype)
+{
+    m_buffers.fill(prototype);
+    m_writeIndex = 0;
+    m_readIndex = 1;
+    m_state.store(2, std::memory_order_relaxed);
+}
+
+template <class T> T& TripleBuffer<T>::getWriteBuffer()
+{
+    return m_buffers[m_writeIndex];
+}
+
+template <class T> void TripleBuffer<T>::publish()
+{
+    const std::uint8_t state = m_state.exchange(m_writeIndex | newDataBit,
+                                                std::memory_order_acq_rel);
+    m_writeIndex = state & indexMask;
+}
+
+template <class T> bool TripleBuffer<T>::update()
+{
+    if ((m_state.load(std::memory_order_relaxed) & newDataBit) == 0)
+    {
+        return false;
+    }
+
+    // only the consumer clears newDataBit, hence the exchanged state contains a new copy
+    const std::uint8_t state = m_state.exchange(m_readIndex, std::memory_order_acq_rel);
+    m_readIndex = state & indexMask;
+    return true;
+}
+
+template <class T> const T& TripleBuffer<T>::getReadBuffer() const
+{
+    return m_buffers[m_readIndex];
+}
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_TRIPLE_BUFFER_H
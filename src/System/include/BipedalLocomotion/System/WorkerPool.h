@@ -0,0 +1,115 @@
+/**
+ * @file WorkerPool.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_SYSTEM_WORKER_POOL_H
+#define BIPEDAL_LOCOMOTION_SYSTEM_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace BipedalLocomotion
+{
+namespace System
+{
+
+/**
+ * WorkerPool runs the same function on a fixed number of threads, e.g. to process the chunks of a
+ * large buffer in parallel. The threads are created in the constructor and wait on a condition
+ * variable between two calls of WorkerPool::run, hence running a function neither creates threads
+ * nor allocates memory. The calling thread takes part in the computation as the thread with index
+ * zero.
+ * @code{.cpp}
+ * WorkerPool pool(4);
+ * auto sum = [&](std::size_t threadIndex) {
+ *     const auto [begin, end] = WorkerPool::getChunk(data.size(), pool.size(), threadIndex);
+ *     partialSum[threadIndex] = std::accumulate(data.begin() + begin, data.begin() + end, 0.0);
+ * };
+ * pool.run(sum);
+ * @endcode
+ * @note WorkerPool::run must not be called concurrently by different threads.
+ */
+class WorkerPool
+{
+public:
+    /**
+     * Constructor.
+     * @param numberOfThreads number of threads, including the calling one. If zero, the number of
+     * concurrent threads supported by the hardware is used.
+     */
+    explicit WorkerPool(std::size_t numberOfThreads = 0);
+
+    /**
+     * Destructor. It joins all the threads.
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * Get the number of threads, including the calling one.
+     * @return the number of threads.
+     */
+    std::size_t size() const;
+
+    /**
+     * Call `function(threadIndex)` on all the threads and wait for them to return.
+     * @param function a callable object taking the index of the thread, in the range
+     * [0, size()), as input.
+     * @note The function is passed by reference and it is not copied, hence it does not need to be
+     * stored in a std::function.
+     */
+    template <typename Function> void run(Function& function)
+    {
+        this->run(
+            [](void* context, std::size_t threadIndex) {
+                (*static_cast<Function*>(context))(threadIndex);
+            },
+            static_cast<void*>(&function));
+    }
+
+    /**
+     * Split the range [0, size) in contiguous chunks of similar size.
+     * @param size size of the range.
+     * @param numberOfChunks number of chunks.
+     * @param chunkIndex index of the chunk.
+     * @return a pair containing the first element and one past the last element of the chunk.
+     */
+    static std::pair<std::size_t, std::size_t>
+    getChunk(std::size_t size, std::size_t numberOfChunks, std::size_t chunkIndex);
+
+private:
+    using Task = void (*)(void*, std::size_t);
+
+    /**
+     * Call the task on all the threads and wait for them to return.
+     */
+    void run(Task task, void* context);
+
+    /**
+     * Function executed by the worker threads.
+     */
+    void loop(std::size_t threadIndex);
+
+    std::mutex m_mutex; /**< Mutex protecting the following members. */
+    std::condition_variable m_startCondition; /**< Notified when a new task is available. */
+    std::condition_variable m_doneCondition; /**< Notified when all the workers returned. */
+    Task m_task{nullptr}; /**< Current task. */
+    void* m_context{nullptr}; /**< Context of the current task. */
+    std::size_t m_generation{0}; /**< Incremented every time a new task is started. */
+    std::size_t m_pendingWorkers{0}; /**< Number of workers running the current task. */
+    bool m_stop{false}; /**< True if the workers have to stop. */
+    std::vector<std::thread> m_workers; /**< Worker threads. */
+};
+
+} // namespace System
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_SYSTEM_WORKER_POOL_H
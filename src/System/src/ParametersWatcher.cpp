@@ -0,0 +1,254 @@
+/**
+ * @file ParametersWatcher.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <system_error>
+#include <utility>
+
+#include <BipedalLocomotion/System/ParametersWatcher.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion;
+
+bool ParametersSnapshot::hasChanged(const std::string& key) const
+{
+    return std::find(changedKeys.cbegin(), changedKeys.cend(), key) != changedKeys.cend();
+}
+
+void ParametersListener::setValidator(Validator validator)
+{
+    std::lock_guard<std::mutex> lock(m_validatorMutex);
+    m_validator = std::move(validator);
+}
+
+bool ParametersListener::isValid(const ParametersSnapshot& snapshot)
+{
+    std::lock_guard<std::mutex> lock(m_validatorMutex);
+    return !m_validator || m_validator(snapshot);
+}
+
+bool ParametersListener::update()
+{
+    return m_buffer.update();
+}
+
+const ParametersSnapshot& ParametersListener::getSnapshot() const
+{
+    const auto& snapshot = m_buffer.getReadBuffer();
+    if (snapshot == nullptr)
+    {
+        return m_emptySnapshot;
+    }
+    return *snapshot;
+}
+
+ParametersWatcher::~ParametersWatcher()
+{
+    this->stop();
+}
+
+std::shared_ptr<ParametersListener> ParametersWatcher::createListener()
+{
+    auto listener = std::make_shared<ParametersListener>();
+    listener->m_buffer.initialize(nullptr);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_snapshot != nullptr)
+    {
+        listener->m_buffer.getWriteBuffer() = m_snapshot;
+        listener->m_buffer.publish();
+    }
+    m_listeners.push_back(listener);
+
+    return listener;
+}
+
+bool ParametersWatcher::start(const std::string& filename,
+                              std::chrono::nanoseconds period,
+                              Loader loader)
+{
+    constexpr auto logPrefix = "[ParametersWatcher::start]";
+
+    if (m_isRunning)
+    {
+        log()->error("{} The watcher is already running.", logPrefix);
+        return false;
+    }
+
+    if (!loader)
+    {
+        log()->error("{} The loader is not valid.", logPrefix);
+        return false;
+    }
+
+    if (period <= std::chrono::nanoseconds::zero())
+    {
+        log()->error("{} The period must be positive.", logPrefix);
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_filename = filename;
+        m_period = period;
+        m_loader = std::move(loader);
+    }
+
+    if (!this->reload())
+    {
+        log()->error("{} Unable to load the parameters from the file named '{}'.",
+                     logPrefix,
+                     filename);
+        return false;
+    }
+
+    m_isRunning = true;
+    m_thread = std::thread([this] { this->run(); });
+
+    return true;
+}
+
+void ParametersWatcher::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isRunning = false;
+    }
+    m_stopCondition.notify_all();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+bool ParametersWatcher::reload()
+{
+    constexpr auto logPrefix = "[ParametersWatcher::reload]";
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_loader)
+    {
+        log()->error("{} The watcher has not been started.", logPrefix);
+        return false;
+    }
+
+    // the modification time is read before loading, so a change occurring while loading is not
+    // lost. It is stored also if the file cannot be loaded, so a broken file is not loaded again
+    // until it is modified
+    std::error_code error;
+    const auto lastWriteTime = std::filesystem::last_write_time(m_filename, error);
+    if (!error)
+    {
+        m_lastWriteTime = lastWriteTime;
+    }
+
+    auto handler = m_loader(m_filename);
+    if (handler == nullptr)
+    {
+        log()->error("{} Unable to load the file named '{}'.", logPrefix, m_filename);
+        return false;
+    }
+
+    auto parameters = std::make_shared<ParametersHandler::CompiledImplementation>();
+    if (!parameters->compile(handler))
+    {
+        log()->error("{} Unable to compile the parameters loaded from the file named '{}'.",
+                     logPrefix,
+                     m_filename);
+        return false;
+    }
+
+    auto snapshot = std::make_shared<ParametersSnapshot>();
+    if (m_parameters != nullptr)
+    {
+        snapshot->changedKeys = m_parameters->getChangedKeys(*parameters);
+        if (snapshot->changedKeys.empty())
+        {
+            return true;
+        }
+    } else
+    {
+        snapshot->changedKeys = parameters->getKeys();
+    }
+
+    snapshot->version = m_version + 1;
+    snapshot->parameters = parameters;
+    m_parameters = std::move(parameters);
+    m_snapshot = std::move(snapshot);
+
+    // the snapshots replaced in the buffers are released here and not in the thread of the
+    // listener
+    for (const auto& listener : m_listeners)
+    {
+        if (!listener->isValid(*m_snapshot))
+        {
+            log()->warn("{} The parameters loaded from the file named '{}' have been rejected by "
+                        "a listener. The listener keeps the previous version.",
+                        logPrefix,
+                        m_filename);
+            continue;
+        }
+
+        listener->m_buffer.getWriteBuffer() = m_snapshot;
+        listener->m_buffer.publish();
+    }
+    m_version = m_snapshot->version;
+
+    log()->info("{} New parameters loaded from the file named '{}'. Version: {}. Changed "
+                "parameters: {}.",
+                logPrefix,
+                m_filename,
+                m_snapshot->version,
+                m_snapshot->changedKeys.size());
+
+    return true;
+}
+
+std::uint64_t ParametersWatcher::getVersion() const
+{
+    return m_version;
+}
+
+void ParametersWatcher::run()
+{
+    constexpr auto logPrefix = "[ParametersWatcher::run]";
+
+    while (true)
+    {
+        std::filesystem::file_time_type previousWriteTime;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stopCondition.wait_for(lock, m_period, [this] { return !m_isRunning; });
+            if (!m_isRunning)
+            {
+                return;
+            }
+            previousWriteTime = m_lastWriteTime;
+        }
+
+        std::error_code error;
+        const auto lastWriteTime = std::filesystem::last_write_time(m_filename, error);
+        if (error)
+        {
+            log()->debug("{} Unable to get the modification time of the file named '{}': {}.",
+                         logPrefix,
+                         m_filename,
+                         error.message());
+            continue;
+        }
+
+        if (lastWriteTime != previousWriteTime && !this->reload())
+        {
+            log()->warn("{} Unable to reload the parameters. The previous version will be "
+                        "kept.",
+                        logPrefix);
+        }
+    }
+}
@@ -0,0 +1,113 @@
+/**
+ * @file ReloadableWeightProvider.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <memory>
+#include <string>
+
+#include <BipedalLocomotion/System/ReloadableWeightProvider.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion::ParametersHandler;
+
+namespace
+{
+std::shared_ptr<const IParametersHandler> getGroup(const ParametersSnapshot& snapshot,
+                                                   const std::string& groupName)
+{
+    if (snapshot.parameters == nullptr || groupName.empty())
+    {
+        return snapshot.parameters;
+    }
+    return snapshot.parameters->getGroup(groupName).lock();
+}
+} // namespace
+
+bool ReloadableWeightProvider::initialize(std::weak_ptr<const IParametersHandler> handler)
+{
+    constexpr auto logPrefix = "[ReloadableWeightProvider::initialize]";
+
+    auto ptr = handler.lock();
+    if (ptr == nullptr)
+    {
+        log()->error("{} Invalid parameter handler.", logPrefix);
+        return false;
+    }
+
+    if (!ptr->getParameter("weight", m_weight))
+    {
+        log()->error("{} Unable to get the parameter named 'weight'.", logPrefix);
+        return false;
+    }
+
+    return true;
+}
+
+bool ReloadableWeightProvider::setParametersListener(std::shared_ptr<ParametersListener> listener,
+                                                     const std::string& groupName)
+{
+    constexpr auto logPrefix = "[ReloadableWeightProvider::setParametersListener]";
+
+    if (!this->isOutputValid())
+    {
+        log()->error("{} The provider has not been initialized.", logPrefix);
+        return false;
+    }
+
+    if (listener == nullptr)
+    {
+        log()->error("{} Invalid listener.", logPrefix);
+        return false;
+    }
+
+    // the weight is checked by the thread of the watcher, hence advance() always receives a
+    // weight with the correct size
+    const Eigen::Index size = m_weight.size();
+    m_newWeight.resize(size);
+    listener->setValidator([groupName, size](const ParametersSnapshot& snapshot) {
+        auto handler = getGroup(snapshot, groupName);
+        Eigen::VectorXd weight;
+        return handler != nullptr && handler->getParameter("weight", weight)
+               && weight.size() == size;
+    });
+
+    m_parametersListener = listener;
+    m_parametersGroupName = groupName;
+
+    return true;
+}
+
+const Eigen::VectorXd& ReloadableWeightProvider::getOutput() const
+{
+    return m_weight;
+}
+
+bool ReloadableWeightProvider::advance()
+{
+    if (m_parametersListener == nullptr || !m_parametersListener->update())
+    {
+        return true;
+    }
+
+    // the snapshot published before setting the listener is not checked by the validator, in
+    // that case the previous weight is kept. The new weight is read in a buffer having the
+    // correct size, so no memory is allocated if the weight is valid
+    auto handler = getGroup(m_parametersListener->getSnapshot(), m_parametersGroupName);
+    if (handler == nullptr || !handler->getParameter("weight", m_newWeight)
+        || m_newWeight.size() != m_weight.size())
+    {
+        m_newWeight.resize(m_weight.size());
+        return true;
+    }
+
+    m_weight = m_newWeight;
+    return true;
+}
+
+bool ReloadableWeightProvider::isOutputValid() const
+{
+    return m_weight.size() != 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file WorkerPool.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+
+#include <BipedalLocomotion/System/WorkerPool.h>
+
+using namespace BipedalLocomotion::System;
+
+WorkerPool::WorkerPool(std::size_t numberOfThreads)
+{
+    if (numberOfThreads == 0)
+    {
+        numberOfThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_workers.reserve(numberOfThreads - 1);
+    for (std::size_t i = 1; i < numberOfThreads; i++)
+    {
+        m_workers.emplace_back([this, i] { this->loop(i); });
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_stop = true;
+    }
+    m_startCondition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+std::size_t WorkerPool::size() const
+{
+    return m_workers.size() + 1;
+}
+
+std::pair<std::size_t, std::size_t>
+WorkerPool::getChunk(std::size_t size, std::size_t numberOfChunks, std::size_t chunkIndex)
+{
+    const std::size_t chunkSize = size / numberOfChunks;
+    const std::size_t remainder = size % numberOfChunks;
+    const std::size_t begin = chunkIndex * chunkSize + std::min(chunkIndex, remainder);
+    return {begin, begin + chunkSize + (chunkIndex < remainder ? 1 : 0)};
+}
+
+void WorkerPool::run(Task task, void* context)
+{
+    if (m_workers.empty())
+    {
+        task(context, 0);
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_task = task;
+        m_context = context;
+        m_pendingWorkers = m_workers.size();
+        m_generation++;
+    }
+    m_startCondition.notify_all();
+
+    task(context, 0);
+
+    std::unique_lock lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_pendingWorkers == 0; });
+}
+
+void WorkerPool::loop(std::size_t threadIndex)
+{
+    std::size_t generation = 0;
+    while (true)
+    {
+        Task task{nullptr};
+        void* context{nullptr};
+        {
+            std::unique_lock lock(m_mutex);
+            m_startCondition.wait(lock,
+                                  [this, generation] { return m_stop || m_generation != generation; });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+            task = m_task;
+            context = m_context;
+        }
+
+        task(context, threadIndex);
+
+        bool isLast{false};
+        {
+            std::lock_guard lock(m_mutex);
+            isLast = (--m_pendingWorkers == 0);
+        }
+        if (isLast)
+        {
+            m_doneCondition.notify_one();
+        }
+    }
+}
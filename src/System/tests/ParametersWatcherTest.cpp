@@ -0,0 +1,188 @@
+/**
+ * @file ParametersWatcherTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/ParametersHandler/StdImplementation.h>
+#include <BipedalLocomotion/System/ParametersWatcher.h>
+#include <BipedalLocomotion/System/ReloadableWeightProvider.h>
+
+using namespace BipedalLocomotion::System;
+using namespace BipedalLocomotion::ParametersHandler;
+using namespace std::chrono_literals;
+
+namespace
+{
+void writeFile(const std::string& filename, double gain, int horizon)
+{
+    std::ofstream file(filename, std::ios::trunc);
+    file << gain << " " << horizon;
+}
+
+IParametersHandler::shared_ptr loadFile(const std::string& filename)
+{
+    std::ifstream file(filename);
+    double gain;
+    int horizon;
+    if (!(file >> gain >> horizon))
+    {
+        return nullptr;
+    }
+
+    auto handler = std::make_shared<StdImplementation>();
+    handler->setParameter("gain", gain);
+    handler->setParameter("horizon", horizon);
+    return handler;
+}
+} // namespace
+
+TEST_CASE("Parameters watcher")
+{
+    const std::string filename = "ParametersWatcherTest.txt";
+    writeFile(filename, 1.0, 10);
+
+    ParametersWatcher watcher;
+    auto listener = watcher.createListener();
+    REQUIRE_FALSE(listener->update());
+    REQUIRE(listener->getSnapshot().parameters == nullptr);
+
+    REQUIRE(watcher.start(filename, 10ms, loadFile));
+    REQUIRE(watcher.getVersion() == 1);
+    REQUIRE(listener->update());
+    REQUIRE_FALSE(listener->update());
+
+    double gain;
+    REQUIRE(listener->getSnapshot().parameters->getParameter("gain", gain));
+    REQUIRE(gain == 1.0);
+
+    SECTION("Reload")
+    {
+        // nothing changed, so nothing is published
+        REQUIRE(watcher.reload());
+        REQUIRE(watcher.getVersion() == 1);
+        REQUIRE_FALSE(listener->update());
+
+        writeFile(filename, 2.0, 10);
+        REQUIRE(watcher.reload());
+        REQUIRE(watcher.getVersion() == 2);
+        REQUIRE(listener->update());
+
+        const auto& snapshot = listener->getSnapshot();
+        REQUIRE(snapshot.version == 2);
+        REQUIRE(snapshot.hasChanged("gain"));
+        REQUIRE_FALSE(snapshot.hasChanged("horizon"));
+        REQUIRE(snapshot.parameters->getParameter("gain", gain));
+        REQUIRE(gain == 2.0);
+
+        // a listener created later receives the last snapshot
+        auto newListener = watcher.createListener();
+        REQUIRE(newListener->update());
+        REQUIRE(newListener->getSnapshot().version == 2);
+    }
+
+    SECTION("File modified")
+    {
+        writeFile(filename, 3.0, 20);
+
+        // make sure that the modification time changes
+        std::filesystem::last_write_time(filename,
+                                         std::filesystem::last_write_time(filename) + 1s);
+
+        const auto timeout = std::chrono::steady_clock::now() + 5s;
+        while (!listener->update() && std::chrono::steady_clock::now() < timeout)
+        {
+            std::this_thread::sleep_for(1ms);
+        }
+
+        const auto& snapshot = listener->getSnapshot();
+        REQUIRE(snapshot.version == 2);
+        REQUIRE(snapshot.hasChanged("gain"));
+        REQUIRE(snapshot.hasChanged("horizon"));
+        REQUIRE(snapshot.parameters->getParameter("gain", gain));
+        REQUIRE(gain == 3.0);
+    }
+
+    SECTION("Validator")
+    {
+        listener->setValidator([](const ParametersSnapshot& snapshot) {
+            int horizon;
+            return snapshot.parameters->getParameter("horizon", horizon) && horizon > 0;
+        });
+        auto otherListener = watcher.createListener();
+        REQUIRE(otherListener->update());
+
+        // the snapshot is rejected only by the listener having the validator
+        writeFile(filename, 2.0, -1);
+        REQUIRE(watcher.reload());
+        REQUIRE(watcher.getVersion() == 2);
+        REQUIRE_FALSE(listener->update());
+        REQUIRE(otherListener->update());
+
+        writeFile(filename, 2.0, 20);
+        REQUIRE(watcher.reload());
+        REQUIRE(listener->update());
+        REQUIRE(listener->getSnapshot().version == 3);
+    }
+
+    SECTION("Invalid file")
+    {
+        // the previous version is kept
+        writeFile(filename, 4.0, 10);
+        std::ofstream(filename, std::ios::trunc) << "invalid";
+        REQUIRE_FALSE(watcher.reload());
+        REQUIRE(watcher.getVersion() == 1);
+        REQUIRE_FALSE(listener->update());
+    }
+
+    watcher.stop();
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("Reloadable weight provider")
+{
+    auto handler = std::make_shared<StdImplementation>();
+    auto group = std::make_shared<StdImplementation>();
+    group->setParameter("weight", std::vector<double>{1.0, 2.0});
+    REQUIRE(handler->setGroup("TASK", group));
+
+    ParametersWatcher watcher;
+    auto listener = watcher.createListener();
+
+    // the parameters are not stored in a file, so they are loaded only when reload is called
+    REQUIRE(watcher.start("not_existing_file.toml", 1s, [handler](const std::string&) {
+        return handler->clone();
+    }));
+
+    ReloadableWeightProvider weight;
+    REQUIRE(weight.initialize(group));
+    REQUIRE(weight.setParametersListener(listener, "TASK"));
+    REQUIRE(weight.advance());
+    REQUIRE(weight.getOutput() == Eigen::Vector2d(1.0, 2.0));
+
+    group->setParameter("weight", std::vector<double>{3.0, 4.0});
+    REQUIRE(watcher.reload());
+    REQUIRE(weight.advance());
+    REQUIRE(weight.getOutput() == Eigen::Vector2d(3.0, 4.0));
+
+    // the size of the weight cannot be changed
+    group->setParameter("weight", std::vector<double>{5.0, 6.0, 7.0});
+    REQUIRE(watcher.reload());
+    REQUIRE_FALSE(listener->update());
+    REQUIRE(weight.advance());
+    REQUIRE(weight.getOutput() == Eigen::Vector2d(3.0, 4.0));
+
+    watcher.stop();
+}
@@ -0,0 +1,91 @@
+/**
+ * @file SPSCRingBufferTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <thread>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/SPSCRingBuffer.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("SPSC ring buffer")
+{
+    SPSCRingBuffer<std::vector<int>> buffer;
+    constexpr std::size_t capacity = 4;
+    REQUIRE(buffer.initialize(capacity, std::vector<int>(3, 0)));
+    REQUIRE(buffer.capacity() == capacity);
+    REQUIRE(buffer.size() == 0);
+    REQUIRE(buffer.beginRead() == nullptr);
+
+    SECTION("Full and empty buffer")
+    {
+        for (std::size_t i = 0; i < capacity; i++)
+        {
+            auto* slot = buffer.beginWrite();
+            REQUIRE(slot != nullptr);
+
+            // the slot is preallocated
+            REQUIRE(slot->size() == 3);
+            (*slot)[0] = static_cast<int>(i);
+            buffer.endWrite();
+        }
+        REQUIRE(buffer.size() == capacity);
+        REQUIRE(buffer.beginWrite() == nullptr);
+        REQUIRE_FALSE(buffer.push(std::vector<int>(3, 0)));
+
+        std::vector<int> element;
+        for (std::size_t i = 0; i < capacity; i++)
+        {
+            REQUIRE(buffer.pop(element));
+            REQUIRE(element[0] == static_cast<int>(i));
+        }
+        REQUIRE(buffer.size() == 0);
+        REQUIRE_FALSE(buffer.pop(element));
+    }
+
+    SECTION("Producer and consumer threads")
+    {
+        constexpr int numberOfElements = 100000;
+
+        std::thread producer([&buffer] {
+            for (int i = 0; i < numberOfElements;)
+            {
+                if (auto* slot = buffer.beginWrite(); slot != nullptr)
+                {
+                    (*slot)[0] = i;
+                    (*slot)[2] = -i;
+                    buffer.endWrite();
+                    i++;
+                } else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        int expected = 0;
+        bool isOrdered = true;
+        while (expected < numberOfElements)
+        {
+            if (const auto* slot = buffer.beginRead(); slot != nullptr)
+            {
+                isOrdered = isOrdered && (*slot)[0] == expected && (*slot)[2] == -expected;
+                buffer.endRead();
+                expected++;
+            } else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        producer.join();
+        REQUIRE(isOrdered);
+        REQUIRE(buffer.size() == 0);
+    }
+}
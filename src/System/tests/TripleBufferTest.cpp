@@ -0,0 +1,79 @@
+/**
+ * @file TripleBufferTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <thread>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/TripleBuffer.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("Triple buffer")
+{
+    TripleBuffer<std::vector<int>> buffer;
+    buffer.initialize(std::vector<int>(3, 0));
+    REQUIRE_FALSE(buffer.update());
+    REQUIRE(buffer.getReadBuffer().size() == 3);
+
+    SECTION("Latest value")
+    {
+        for (int i = 1; i <= 3; i++)
+        {
+            auto& value = buffer.getWriteBuffer();
+
+            // the copy is preallocated
+            REQUIRE(value.size() == 3);
+            value[0] = i;
+            buffer.publish();
+        }
+
+        // only the latest value is read
+        REQUIRE(buffer.update());
+        REQUIRE(buffer.getReadBuffer()[0] == 3);
+        REQUIRE_FALSE(buffer.update());
+        REQUIRE(buffer.getReadBuffer()[0] == 3);
+
+        buffer.getWriteBuffer()[0] = 4;
+        buffer.publish();
+        REQUIRE(buffer.update());
+        REQUIRE(buffer.getReadBuffer()[0] == 4);
+    }
+
+    SECTION("Producer and consumer")
+    {
+        constexpr int numberOfValues = 100000;
+
+        std::thread producer([&buffer] {
+            for (int i = 1; i <= numberOfValues; i++)
+            {
+                auto& value = buffer.getWriteBuffer();
+                value.assign(3, i);
+                buffer.publish();
+            }
+        });
+
+        int last = 0;
+        while (last < numberOfValues)
+        {
+            if (!buffer.update())
+            {
+                continue;
+            }
+
+            // the values are never torn and never go back in time
+            const auto& value = buffer.getReadBuffer();
+            REQUIRE(value[0] == value[1]);
+            REQUIRE(value[1] == value[2]);
+            REQUIRE(value[0] > last);
+            last = value[0];
+        }
+
+        producer.join();
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file WorkerPoolTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <numeric>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/System/WorkerPool.h>
+
+using namespace BipedalLocomotion::System;
+
+TEST_CASE("Worker pool")
+{
+    constexpr std::size_t numberOfThreads = 4;
+    WorkerPool pool(numberOfThreads);
+    REQUIRE(pool.size() == numberOfThreads);
+
+    SECTION("Chunks")
+    {
+        std::size_t expectedBegin = 0;
+        for (std::size_t i = 0; i < numberOfThreads; i++)
+        {
+            const auto [begin, end] = WorkerPool::getChunk(10, numberOfThreads, i);
+            REQUIRE(begin == expectedBegin);
+            REQUIRE(end - begin >= 2);
+            REQUIRE(end - begin <= 3);
+            expectedBegin = end;
+        }
+        REQUIRE(expectedBegin == 10);
+    }
+
+    SECTION("Parallel sum")
+    {
+        std::vector<int> data(1001);
+        std::iota(data.begin(), data.end(), 0);
+        std::vector<int> partialSum(pool.size(), 0);
+        std::vector<int> calls(pool.size(), 0);
+
+        auto sum = [&](std::size_t threadIndex) {
+            const auto [begin, end] = WorkerPool::getChunk(data.size(), pool.size(), threadIndex);
+            partialSum[threadIndex] = std::accumulate(data.begin() + begin, data.begin() + end, 0);
+            calls[threadIndex]++;
+        };
+
+        // the pool can be used several times
+        for (int i = 0; i < 100; i++)
+        {
+            pool.run(sum);
+            REQUIRE(std::accumulate(partialSum.begin(), partialSum.end(), 0) == 500500);
+        }
+
+        for (const auto& numberOfCalls : calls)
+        {
+            REQUIRE(numberOfCalls == 100);
+        }
+    }
+}
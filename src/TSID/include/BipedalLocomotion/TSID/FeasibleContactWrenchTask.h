@@ -48,8 +48,6 @@ class FeasibleContactWrenchTask : public TSIDLinearTask
     bool m_isInitialized{false}; /**< True if the task has been initialized. */
     bool m_isValid{false}; /**< True if the task is valid. */
 
-    Eigen::MatrixXd m_AinBodyCoordinate; /**< Matrix A written in body frame */
-
     std::shared_ptr<iDynTree::KinDynComputations> m_kinDyn; /**< Pointer to a KinDynComputations
                                                                object */
 public:
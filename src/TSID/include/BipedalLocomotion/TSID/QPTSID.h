@@ -189,6 +189,13 @@ public:
      */
     Eigen::Ref<const Eigen::VectorXd> getRawSolution() const override;
 
+    /**
+     * Get the time spent updating the tasks, assembling the QP problem and solving it in the last
+     * call of advance.
+     * @return the timings of the last advance.
+     */
+    System::LinearTaskSolverTimings getTimings() const override;
+
     // clang-format off
     /**
      * Build QPTSID problem
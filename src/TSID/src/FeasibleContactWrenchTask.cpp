@@ -77,13 +77,6 @@ bool FeasibleContactWrenchTask::setVariablesHandler(const System::VariablesHandl
     m_b.tail<2>()(0) = 0;
     m_b.tail<2>()(1) = std::numeric_limits<double>::max();
 
-    // the matrix A in body coordinate is fixed
-    m_AinBodyCoordinate.resize(normalForceFeasibilityConstraints + rowsOfConeMatrix,
-                               BipedalLocomotion::Math::Wrenchd::SizeAtCompileTime);
-    m_AinBodyCoordinate.topRows(rowsOfConeMatrix) = m_cone.getA();
-    m_AinBodyCoordinate.bottomRows<2>() << 0, 0, -1, 0, 0, 0,
-                                           0, 0,  1, 0, 0, 0;
-
     return true;
 }
 
@@ -177,10 +170,19 @@ bool FeasibleContactWrenchTask::update()
     m_contactWrench.frame_R_inertial
         = toEigen(m_kinDyn->getWorldTransform(m_contactWrench.frameIndex).getRotation().inverse());
 
-    toEigen(this->subA(m_contactWrench.variable)).leftCols<3>().noalias()
-        = m_AinBodyCoordinate.leftCols<3>() * m_contactWrench.frame_R_inertial;
-    toEigen(this->subA(m_contactWrench.variable)).rightCols<3>().noalias()
-        = m_AinBodyCoordinate.rightCols<3>() * m_contactWrench.frame_R_inertial;
+    // the cone is rotated directly in the task matrix
+    auto A = m_A.middleCols(m_contactWrench.variable.offset, m_contactWrench.variable.size);
+    const auto rowsOfConeMatrix = m_cone.getA().rows();
+    if (!m_cone.computeRotatedA(m_contactWrench.frame_R_inertial.transpose(),
+                                A.topRows(rowsOfConeMatrix)))
+    {
+        log()->error("{} Unable to rotate the contact wrench cone.", errorPrefix);
+        return false;
+    }
+
+    // 0 <= fz <= max_normal_force where fz is the normal force in local coordinate
+    A.bottomRows<2>().leftCols<3>().row(0) = -m_contactWrench.frame_R_inertial.row(2);
+    A.bottomRows<2>().leftCols<3>().row(1) = m_contactWrench.frame_R_inertial.row(2);
 
     m_isValid = true;
 
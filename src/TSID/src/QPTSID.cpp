@@ -5,6 +5,8 @@
  * distributed under the terms of the BSD-3-Clause license.
  */
 
+#include <chrono>
+
 #include <OsqpEigen/Constants.hpp>
 #include <OsqpEigen/OsqpEigen.h>
 
@@ -45,6 +47,8 @@ struct QPTSID::Impl
 
     bool isVerbose{false};
 
+    System::LinearTaskSolverTimings timings; /**< Timings of the last advance. */
+
     bool isFirstIteration{true};
     bool isValid{false};
     bool isInitialized{false};
@@ -521,6 +525,8 @@ bool QPTSID::advance()
         return false;
     }
 
+    const auto tasksUpdateStart = std::chrono::steady_clock::now();
+
     // update of all the tasks
     for (auto& [name, task] : m_pimpl->tasks)
     {
@@ -534,6 +540,8 @@ bool QPTSID::advance()
         assert(task.task->isValid() && "One of the task is not valid.");
     }
 
+    const auto problemAssemblyStart = std::chrono::steady_clock::now();
+
     // Compute the gradient and the hessian
     m_pimpl->hessian.setZero();
     m_pimpl->gradient.setZero();
@@ -586,6 +594,8 @@ bool QPTSID::advance()
         index += constraint.get().task->size();
     }
 
+    const auto problemSolutionStart = std::chrono::steady_clock::now();
+
     // update the solver
     if (!m_pimpl->isFirstIteration)
     {
@@ -623,6 +633,11 @@ bool QPTSID::advance()
         log()->debug("{} The solver found an inaccurate feasible solution.", logPrefix);
     }
 
+    const auto problemSolutionEnd = std::chrono::steady_clock::now();
+    m_pimpl->timings.tasksUpdate = problemAssemblyStart - tasksUpdateStart;
+    m_pimpl->timings.problemAssembly = problemSolutionStart - problemAssemblyStart;
+    m_pimpl->timings.problemSolution = problemSolutionEnd - problemSolutionStart;
+
     // retrieve the solution
     constexpr std::size_t spatialAccelerationSize = 6;
     const std::size_t joints = m_pimpl->robotAccelerationVariable.size - spatialAccelerationSize;
@@ -685,6 +700,11 @@ Eigen::Ref<const Eigen::VectorXd> QPTSID::getRawSolution() const
     return m_pimpl->solver.getSolution();
 }
 
+System::LinearTaskSolverTimings QPTSID::getTimings() const
+{
+    return m_pimpl->timings;
+}
+
 TaskSpaceInverseDynamicsProblem
 QPTSID::build(std::weak_ptr<const ParametersHandler::IParametersHandler> handler,
               std::shared_ptr<iDynTree::KinDynComputations> kinDyn)
@@ -0,0 +1,298 @@
+/**
+ * @file AsyncLogger.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_TEXT_LOGGING_ASYNC_LOGGER_H
+#define BIPEDAL_LOCOMOTION_TEXT_LOGGING_ASYNC_LOGGER_H
+
+#include <chrono>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <spdlog/sinks/sink.h>
+
+#include <BipedalLocomotion/TextLogging/DefaultLogger.h>
+#include <BipedalLocomotion/TextLogging/Logger.h>
+
+namespace BipedalLocomotion
+{
+namespace TextLogging
+{
+
+namespace sinks
+{
+
+/**
+ * AsyncSink is a spdlog sink that moves the messages to a background thread. The messages are
+ * stored in a bounded lock-free queue whose memory is allocated by the constructor, then the
+ * background thread forwards them to the wrapped sinks, i.e., the pattern formatting and the
+ * access to the console (or to the YARP and ROS ports) never happen in the thread that logs.
+ * Logging a message never blocks and never allocates memory: if the queue is full the message is
+ * dropped, and if it is longer than the maximum message size it is truncated. Both events are
+ * counted and periodically reported by the background thread.
+ * @note The sink can be shared by more than one thread.
+ */
+class AsyncSink final : public spdlog::sinks::sink
+{
+public:
+    /**
+     * Function formatting the arguments stored by AsyncSink::logDeferred.
+     */
+    using FormatFunction = void (*)(std::string_view format,
+                                    const void* arguments,
+                                    spdlog::memory_buf_t& buffer);
+
+    /**
+     * Constructor. It allocates the queue and starts the background thread.
+     * @param sinks sinks receiving the messages in the background thread.
+     * @param queueSize maximum number of messages waiting to be forwarded to the sinks.
+     * @param maxMessageSize maximum number of bytes stored for each message.
+     * @param period period of the background thread when the queue is empty.
+     */
+    AsyncSink(std::vector<spdlog::sink_ptr> sinks,
+              std::size_t queueSize,
+              std::size_t maxMessageSize,
+              std::chrono::nanoseconds period);
+
+    /**
+     * Destructor. All the queued messages are forwarded to the sinks before stopping the
+     * background thread.
+     */
+    ~AsyncSink() override;
+
+    /**
+     * Store a message in the queue.
+     * @param msg the message.
+     */
+    void log(const spdlog::details::log_msg& msg) final;
+
+    /**
+     * Request the background thread to flush the sinks.
+     */
+    void flush() final;
+
+    /**
+     * Set the pattern of all the wrapped sinks.
+     * @param pattern the pattern.
+     */
+    void set_pattern(const std::string& pattern) final;
+
+    /**
+     * Set the formatter of all the wrapped sinks.
+     * @param sinkFormatter the formatter.
+     */
+    void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) final;
+
+    /**
+     * Store a message whose formatting is delegated to the background thread. The arguments are
+     * copied in the queue, hence only trivially copyable types (e.g., numbers, enums and small
+     * structs) are accepted.
+     * @param level level of the message.
+     * @param loggerName name of the logger. It must outlive the sink.
+     * @param format format string of the message. It must outlive the sink, e.g., a string
+     * literal.
+     * @param args arguments of the message.
+     * @return true if the message has been stored, false if it has been dropped.
+     * @warning The arguments are copied by value. A view (e.g. `std::string_view`) must refer to
+     * data that is still valid when the message is formatted.
+     */
+    template <typename... Args>
+    bool logDeferred(spdlog::level::level_enum level,
+                     spdlog::string_view_t loggerName,
+                     std::string_view format,
+                     const Args&... args);
+
+    /**
+     * Get the number of messages dropped because the queue was full.
+     * @return the number of dropped messages.
+     */
+    std::size_t getDroppedMessages() const;
+
+    /**
+     * Get the number of messages truncated because they were longer than the maximum message
+     * size.
+     * @return the number of truncated messages.
+     */
+    std::size_t getTruncatedMessages() const;
+
+private:
+    struct Message;
+
+    /**
+     * Reserve a slot of the queue.
+     * @param argumentsSize number of bytes required to store the message.
+     * @param arguments pointer to the memory of the slot.
+     * @return a pointer to the slot or nullptr if the message is dropped.
+     */
+    Message* reserveMessage(std::size_t argumentsSize, void*& arguments);
+
+    /**
+     * Make a slot reserved by reserveMessage() available to the background thread.
+     */
+    void publishMessage(Message* message,
+                        spdlog::level::level_enum level,
+                        spdlog::string_view_t loggerName,
+                        std::string_view format,
+                        FormatFunction formatFunction,
+                        std::size_t size);
+
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+template <typename... Args>
+bool AsyncSink::logDeferred(spdlog::level::level_enum level,
+                            spdlog::string_view_t loggerName,
+                            std::string_view format,
+                            const Args&... args)
+{
+    using Arguments = std::tuple<Args...>;
+    static_assert((std::is_trivially_copyable_v<Args> && ...),
+                  "Only trivially copyable arguments can be formatted in the background thread.");
+    static_assert((!std::is_pointer_v<Args> && ...),
+                  "The memory pointed by a pointer may not be valid when the message is "
+                  "formatted.");
+    static_assert(alignof(Arguments) <= alignof(std::max_align_t));
+
+    void* arguments = nullptr;
+    Message* message = this->reserveMessage(sizeof(Arguments), arguments);
+    if (message == nullptr)
+    {
+        return false;
+    }
+
+    new (arguments) Arguments(args...);
+
+    auto formatFunction = [](std::string_view format,
+                             const void* arguments,
+                             spdlog::memory_buf_t& buffer) {
+        std::apply(
+            [&format, &buffer](const auto&... args) {
+                fmt::vformat_to(std::back_inserter(buffer),
+                                fmt::string_view(format.data(), format.size()),
+                                fmt::make_format_args(args...));
+            },
+            *static_cast<const Arguments*>(arguments));
+    };
+
+    this->publishMessage(message, level, loggerName, format, formatFunction, sizeof(Arguments));
+    return true;
+}
+
+} // namespace sinks
+
+/**
+ * AsyncLoggerFactory wraps another LoggerFactory and makes the logger asynchronous. The sinks of
+ * the logger created by the wrapped factory are moved in the background thread of a
+ * sinks::AsyncSink, hence logging from a real-time loop costs the formatting of the message in a
+ * stack buffer and a copy in a preallocated queue.
+ * \code{.cpp}
+ * #include <BipedalLocomotion/TextLogging/AsyncLogger.h>
+ * #include <BipedalLocomotion/TextLogging/LoggerBuilder.h>
+ * #include <BipedalLocomotion/TextLogging/YarpLogger.h>
+ *
+ * // Change the logger
+ * BipedalLocomotion::TextLogging::LoggerBuilder::setFactory(
+ *     std::make_shared<BipedalLocomotion::TextLogging::AsyncLoggerFactory>(
+ *         std::make_shared<BipedalLocomotion::TextLogging::YarpLoggerFactory>()));
+ *
+ * BipedalLocomotion::log()->info("My info");
+ *
+ * // the formatting of the message is moved to the background thread
+ * BipedalLocomotion::TextLogging::logDeferred(BipedalLocomotion::TextLogging::Verbosity::Warn,
+ *                                             "The error is {}.",
+ *                                             error);
+ * \endcode
+ */
+class AsyncLoggerFactory final : public LoggerFactory
+{
+public:
+    /**
+     * Construct a new AsyncLoggerFactory object
+     * @param factory the factory creating the logger whose sinks are used in the background
+     * thread.
+     * @param queueSize maximum number of messages waiting to be forwarded to the sinks.
+     * @param maxMessageSize maximum number of bytes stored for each message.
+     * @param period period of the background thread when there are no messages.
+     */
+    AsyncLoggerFactory(std::shared_ptr<LoggerFactory> factory
+                       = std::make_shared<DefaultLoggerFactory>(),
+                       std::size_t queueSize = 1024,
+                       std::size_t maxMessageSize = 256,
+                       std::chrono::nanoseconds period = std::chrono::milliseconds(10));
+
+    /**
+     * Create the asynchronous logger as a singleton
+     * @return the pointer to TextLogging::Logger
+     */
+    std::shared_ptr<Logger> const createLogger() final;
+
+    /**
+     * Get the sink used by the asynchronous logger.
+     * @return a pointer to the sink. It is nullptr if the logger has not been created yet.
+     */
+    std::shared_ptr<sinks::AsyncSink> getSink() const;
+
+private:
+    std::shared_ptr<LoggerFactory> m_factory; /** The wrapped factory */
+    std::size_t m_queueSize; /** Size of the queue */
+    std::size_t m_maxMessageSize; /** Maximum size of a message */
+    std::chrono::nanoseconds m_period; /** Period of the background thread */
+
+    std::once_flag m_loggerCreated;
+    std::shared_ptr<sinks::AsyncSink> m_sink;
+    std::shared_ptr<Logger> m_logger;
+};
+
+/**
+ * Log a message whose formatting is delegated to the background thread. If the logger returned
+ * by BipedalLocomotion::log() is not asynchronous the message is formatted and logged
+ * immediately.
+ * @param verbosity level of the message.
+ * @param format format string of the message. It must be a string literal.
+ * @param args arguments of the message. Only trivially copyable types are accepted.
+ * @note The message is not stored if the verbosity is lower than the level of the logger.
+ */
+template <std::size_t N, typename... Args>
+void logDeferred(const Verbosity verbosity, const char (&format)[N], const Args&... args)
+{
+    const auto level = static_cast<spdlog::level::level_enum>(
+        static_cast<std::underlying_type<Verbosity>::type>(verbosity));
+
+    const auto logger = BipedalLocomotion::log();
+    if (!logger->should_log(level))
+    {
+        return;
+    }
+
+    if (logger->sinks().size() == 1)
+    {
+        auto sink = dynamic_cast<sinks::AsyncSink*>(logger->sinks().front().get());
+        if (sink != nullptr)
+        {
+            sink->logDeferred(level, logger->name(), std::string_view(format, N - 1), args...);
+            return;
+        }
+    }
+
+    spdlog::memory_buf_t buffer;
+    fmt::vformat_to(std::back_inserter(buffer),
+                    fmt::string_view(format, N - 1),
+                    fmt::make_format_args(args...));
+    logger->log(level, spdlog::string_view_t(buffer.data(), buffer.size()));
+}
+
+} // namespace TextLogging
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_TEXT_LOGGING_ASYNC_LOGGER_H
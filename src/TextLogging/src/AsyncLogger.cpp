@@ -0,0 +1,375 @@
+/**
+ * @file AsyncLogger.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <thread>
+
+#include <spdlog/details/os.h>
+
+#include <BipedalLocomotion/TextLogging/AsyncLogger.h>
+
+using namespace BipedalLocomotion::TextLogging;
+
+struct sinks::AsyncSink::Message
+{
+    /** Position of the message in the queue. It is used to synchronize the threads. */
+    std::atomic<std::size_t> sequence{0};
+
+    spdlog::level::level_enum level{spdlog::level::info};
+    spdlog::log_clock::time_point time;
+    std::size_t threadId{0};
+    spdlog::string_view_t loggerName;
+
+    /** Format string and function of a deferred message. formatFunction is nullptr if the
+     * message has already been formatted. */
+    std::string_view format;
+    FormatFunction formatFunction{nullptr};
+
+    std::size_t size{0}; /**< Number of bytes used in the storage. */
+    std::vector<std::max_align_t> storage; /**< Formatted message or arguments to be formatted. */
+};
+
+struct sinks::AsyncSink::Impl
+{
+    std::vector<spdlog::sink_ptr> sinks;
+    std::size_t maxMessageSize{0};
+    std::chrono::nanoseconds period;
+
+    // bounded multiple producers single consumer queue (D. Vyukov). The capacity is a power of
+    // two, so the position of a message is obtained with a mask.
+    std::unique_ptr<Message[]> messages;
+    std::size_t mask{0};
+    alignas(64) std::atomic<std::size_t> enqueuePosition{0};
+    alignas(64) std::size_t dequeuePosition{0};
+
+    std::atomic<std::size_t> droppedMessages{0};
+    std::atomic<std::size_t> truncatedMessages{0};
+    std::atomic<bool> flushRequested{false};
+    std::atomic<bool> isRunning{false};
+    std::thread thread;
+
+    Message* reserve()
+    {
+        std::size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Message& message = messages[position & mask];
+            const std::size_t sequence = message.sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<std::ptrdiff_t>(sequence)
+                                    - static_cast<std::ptrdiff_t>(position);
+            if (difference == 0)
+            {
+                if (enqueuePosition.compare_exchange_weak(position,
+                                                          position + 1,
+                                                          std::memory_order_relaxed))
+                {
+                    return &message;
+                }
+            } else if (difference < 0)
+            {
+                // the queue is full
+                return nullptr;
+            } else
+            {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void forward(const Message& message, spdlog::memory_buf_t& buffer)
+    {
+        const char* data = reinterpret_cast<const char*>(message.storage.data());
+        spdlog::string_view_t payload(data, message.size);
+
+        if (message.formatFunction != nullptr)
+        {
+            buffer.clear();
+            try
+            {
+                message.formatFunction(message.format, data, buffer);
+            } catch (const std::exception& e)
+            {
+                buffer.clear();
+                fmt::format_to(std::back_inserter(buffer),
+                               "Unable to format the message '{}'. Error: {}",
+                               message.format,
+                               e.what());
+            }
+            payload = spdlog::string_view_t(buffer.data(), buffer.size());
+        }
+
+        spdlog::details::log_msg msg(message.time,
+                                     spdlog::source_loc{},
+                                     message.loggerName,
+                                     message.level,
+                                     payload);
+        msg.thread_id = message.threadId;
+        this->forward(msg);
+    }
+
+    void forward(const spdlog::details::log_msg& msg)
+    {
+        for (const auto& sink : sinks)
+        {
+            if (sink->should_log(msg.level))
+            {
+                sink->log(msg);
+            }
+        }
+    }
+
+    void run()
+    {
+        spdlog::memory_buf_t buffer;
+        std::size_t reportedDroppedMessages = 0;
+        std::size_t reportedTruncatedMessages = 0;
+        spdlog::string_view_t loggerName;
+
+        auto report = [&](std::size_t& reported,
+                          const std::atomic<std::size_t>& counter,
+                          const char* description) {
+            const std::size_t value = counter.load(std::memory_order_relaxed);
+            if (value == reported)
+            {
+                return;
+            }
+            buffer.clear();
+            fmt::format_to(std::back_inserter(buffer),
+                           "[AsyncSink] {} messages have been {} since the logger was created.",
+                           value,
+                           description);
+            this->forward(spdlog::details::log_msg(loggerName,
+                                                   spdlog::level::warn,
+                                                   spdlog::string_view_t(buffer.data(),
+                                                                         buffer.size())));
+            reported = value;
+        };
+
+        while (true)
+        {
+            Message& message = messages[dequeuePosition & mask];
+            if (message.sequence.load(std::memory_order_acquire) == dequeuePosition + 1)
+            {
+                loggerName = message.loggerName;
+                this->forward(message, buffer);
+
+                // the message is given back to the producers
+                message.sequence.store(dequeuePosition + mask + 1, std::memory_order_release);
+                dequeuePosition++;
+                continue;
+            }
+
+            // the queue is empty
+            report(reportedDroppedMessages, droppedMessages, "dropped because the queue was full");
+            report(reportedTruncatedMessages, truncatedMessages, "truncated");
+
+            if (flushRequested.exchange(false))
+            {
+                for (const auto& sink : sinks)
+                {
+                    sink->flush();
+                }
+            }
+
+            if (!isRunning.load(std::memory_order_acquire))
+            {
+                // check again the queue since a message may have been pushed before stopping
+                if (messages[dequeuePosition & mask].sequence.load(std::memory_order_acquire)
+                    != dequeuePosition + 1)
+                {
+                    break;
+                }
+                continue;
+            }
+
+            std::this_thread::sleep_for(period);
+        }
+
+        for (const auto& sink : sinks)
+        {
+            sink->flush();
+        }
+    }
+};
+
+sinks::AsyncSink::AsyncSink(std::vector<spdlog::sink_ptr> sinks,
+                            std::size_t queueSize,
+                            std::size_t maxMessageSize,
+                            std::chrono::nanoseconds period)
+    : m_pimpl(std::make_unique<Impl>())
+{
+    m_pimpl->sinks = std::move(sinks);
+    m_pimpl->maxMessageSize = std::max<std::size_t>(maxMessageSize, 1);
+    m_pimpl->period = period;
+
+    // the capacity of the queue is rounded to the next power of two
+    std::size_t capacity = 1;
+    while (capacity < queueSize)
+    {
+        capacity *= 2;
+    }
+    m_pimpl->mask = capacity - 1;
+    m_pimpl->messages = std::make_unique<Message[]>(capacity);
+
+    const std::size_t storageSize
+        = (m_pimpl->maxMessageSize + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+    for (std::size_t i = 0; i < capacity; i++)
+    {
+        m_pimpl->messages[i].sequence.store(i, std::memory_order_relaxed);
+        m_pimpl->messages[i].storage.resize(storageSize);
+    }
+
+    m_pimpl->isRunning = true;
+    m_pimpl->thread = std::thread([this] { m_pimpl->run(); });
+}
+
+sinks::AsyncSink::~AsyncSink()
+{
+    m_pimpl->isRunning.store(false, std::memory_order_release);
+    if (m_pimpl->thread.joinable())
+    {
+        m_pimpl->thread.join();
+    }
+}
+
+sinks::AsyncSink::Message* sinks::AsyncSink::reserveMessage(std::size_t argumentsSize,
+                                                             void*& arguments)
+{
+    if (argumentsSize > m_pimpl->maxMessageSize)
+    {
+        // the arguments cannot be truncated
+        m_pimpl->droppedMessages.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Message* message = m_pimpl->reserve();
+    if (message == nullptr)
+    {
+        m_pimpl->droppedMessages.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    arguments = message->storage.data();
+    return message;
+}
+
+void sinks::AsyncSink::publishMessage(Message* message,
+                                      spdlog::level::level_enum level,
+                                      spdlog::string_view_t loggerName,
+                                      std::string_view format,
+                                      FormatFunction formatFunction,
+                                      std::size_t size)
+{
+    message->level = level;
+    message->time = spdlog::log_clock::now();
+    message->threadId = spdlog::details::os::thread_id();
+    message->loggerName = loggerName;
+    message->format = format;
+    message->formatFunction = formatFunction;
+    message->size = size;
+
+    // the message is made available to the background thread
+    const std::size_t position = message->sequence.load(std::memory_order_relaxed);
+    message->sequence.store(position + 1, std::memory_order_release);
+}
+
+void sinks::AsyncSink::log(const spdlog::details::log_msg& msg)
+{
+    void* storage = nullptr;
+    Message* message = this->reserveMessage(0, storage);
+    if (message == nullptr)
+    {
+        return;
+    }
+
+    std::size_t size = msg.payload.size();
+    if (size > m_pimpl->maxMessageSize)
+    {
+        size = m_pimpl->maxMessageSize;
+        m_pimpl->truncatedMessages.fetch_add(1, std::memory_order_relaxed);
+    }
+    std::memcpy(storage, msg.payload.data(), size);
+
+    message->level = msg.level;
+    message->time = msg.time;
+    message->threadId = msg.thread_id;
+    message->loggerName = msg.logger_name;
+    message->formatFunction = nullptr;
+    message->size = size;
+
+    const std::size_t position = message->sequence.load(std::memory_order_relaxed);
+    message->sequence.store(position + 1, std::memory_order_release);
+}
+
+void sinks::AsyncSink::flush()
+{
+    m_pimpl->flushRequested = true;
+}
+
+void sinks::AsyncSink::set_pattern(const std::string& pattern)
+{
+    for (const auto& sink : m_pimpl->sinks)
+    {
+        sink->set_pattern(pattern);
+    }
+}
+
+void sinks::AsyncSink::set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter)
+{
+    for (const auto& sink : m_pimpl->sinks)
+    {
+        sink->set_formatter(sinkFormatter->clone());
+    }
+}
+
+std::size_t sinks::AsyncSink::getDroppedMessages() const
+{
+    return m_pimpl->droppedMessages.load(std::memory_order_relaxed);
+}
+
+std::size_t sinks::AsyncSink::getTruncatedMessages() const
+{
+    return m_pimpl->truncatedMessages.load(std::memory_order_relaxed);
+}
+
+AsyncLoggerFactory::AsyncLoggerFactory(std::shared_ptr<LoggerFactory> factory,
+                                       std::size_t queueSize,
+                                       std::size_t maxMessageSize,
+                                       std::chrono::nanoseconds period)
+    : m_factory(std::move(factory))
+    , m_queueSize(queueSize)
+    , m_maxMessageSize(maxMessageSize)
+    , m_period(period)
+{
+}
+
+std::shared_ptr<Logger> const AsyncLoggerFactory::createLogger()
+{
+    std::call_once(m_loggerCreated, [this] {
+        // the sinks of the wrapped logger are used by the background thread. The pattern has been
+        // already set by the wrapped factory.
+        auto logger = m_factory->createLogger();
+        m_sink = std::make_shared<sinks::AsyncSink>(logger->sinks(),
+                                                    m_queueSize,
+                                                    m_maxMessageSize,
+                                                    m_period);
+
+        // the logger is not registered in spdlog since the wrapped logger has the same name
+        m_logger = std::make_shared<Logger>(logger->name(), m_sink);
+        m_logger->set_level(logger->level());
+        m_logger->flush_on(logger->flush_level());
+    });
+
+    return m_logger;
+}
+
+std::shared_ptr<sinks::AsyncSink> AsyncLoggerFactory::getSink() const
+{
+    return m_sink;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file AsyncLoggerTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <spdlog/sinks/ostream_sink.h>
+
+#include <BipedalLocomotion/TextLogging/AsyncLogger.h>
+#include <BipedalLocomotion/TextLogging/LoggerBuilder.h>
+
+using namespace BipedalLocomotion::TextLogging;
+using namespace std::chrono_literals;
+
+namespace
+{
+std::vector<std::string> split(const std::string& text)
+{
+    std::vector<std::string> lines;
+    std::istringstream stream(text);
+    for (std::string line; std::getline(stream, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+} // namespace
+
+TEST_CASE("Async sink")
+{
+    std::ostringstream stream;
+    auto ostreamSink = std::make_shared<spdlog::sinks::ostream_sink_mt>(stream);
+    ostreamSink->set_pattern("%l %v");
+    const std::vector<spdlog::sink_ptr> wrappedSinks{ostreamSink};
+
+    SECTION("Messages")
+    {
+        {
+            auto sink = std::make_shared<sinks::AsyncSink>(wrappedSinks, 16, 64, 1ms);
+            Logger logger("test", sink);
+            logger.set_level(spdlog::level::info);
+
+            logger.info("message {}", 1);
+            logger.debug("this message is filtered by the logger");
+            REQUIRE(sink->logDeferred(spdlog::level::warn, "test", "deferred {} {:.1f}", 2, 3.0));
+            logger.error("a message longer than the maximum size of a message stored in the queue "
+                         "is truncated");
+
+            REQUIRE(sink->getTruncatedMessages() == 1);
+            REQUIRE(sink->getDroppedMessages() == 0);
+        }
+
+        // the queued messages are logged when the sink is destroyed. Then the truncated message
+        // is reported
+        const auto lines = split(stream.str());
+        REQUIRE(lines.size() >= 3);
+        REQUIRE(lines[0] == "info message 1");
+        REQUIRE(lines[1] == "warning deferred 2 3.0");
+        REQUIRE(lines[2].size() == std::string("error ").size() + 64);
+    }
+
+    SECTION("Full queue")
+    {
+        constexpr std::size_t numberOfMessages = 1000;
+        std::size_t droppedMessages = 0;
+        {
+            // the background thread is slow, so the queue is filled
+            auto sink = std::make_shared<sinks::AsyncSink>(wrappedSinks, 4, 64, 100ms);
+            Logger logger("test", sink);
+            for (std::size_t i = 0; i < numberOfMessages; i++)
+            {
+                logger.info("message {}", i);
+            }
+            droppedMessages = sink->getDroppedMessages();
+            REQUIRE(droppedMessages > 0);
+        }
+
+        // all the messages that have not been dropped are logged when the sink is destroyed
+        std::size_t loggedMessages = 0;
+        for (const auto& line : split(stream.str()))
+        {
+            if (line.rfind("info message", 0) == 0)
+            {
+                loggedMessages++;
+            }
+        }
+        REQUIRE(loggedMessages + droppedMessages == numberOfMessages);
+    }
+
+    SECTION("Multiple producers")
+    {
+        constexpr std::size_t numberOfThreads = 4;
+        constexpr std::size_t numberOfMessages = 100;
+        {
+            auto sink = std::make_shared<sinks::AsyncSink>(wrappedSinks,
+                                                           numberOfThreads * numberOfMessages,
+                                                           64,
+                                                           1ms);
+            Logger logger("test", sink);
+
+            std::vector<std::thread> threads;
+            for (std::size_t i = 0; i < numberOfThreads; i++)
+            {
+                threads.emplace_back([&logger, i] {
+                    for (std::size_t j = 0; j < numberOfMessages; j++)
+                    {
+                        logger.info("thread {} message {}", i, j);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+            REQUIRE(sink->getDroppedMessages() == 0);
+        }
+
+        REQUIRE(split(stream.str()).size() == numberOfThreads * numberOfMessages);
+    }
+}
+
+TEST_CASE("Async logger factory")
+{
+    auto factory = std::make_shared<AsyncLoggerFactory>();
+    REQUIRE(LoggerBuilder::setFactory(factory));
+
+    BipedalLocomotion::log()->info("Message logged by the background thread");
+    logDeferred(Verbosity::Info, "Message formatted by the background thread {}", 42);
+    REQUIRE(factory->getSink() != nullptr);
+    REQUIRE(factory->getSink()->getDroppedMessages() == 0);
+
+    REQUIRE(LoggerBuilder::setFactory(std::make_shared<DefaultLoggerFactory>()));
+}
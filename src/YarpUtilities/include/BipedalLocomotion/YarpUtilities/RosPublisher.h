@@ -29,6 +29,18 @@ namespace YarpUtilities
  *  - Wrenches publisher
  *  - Transform broadcaster
  * Although the class might be ROS independent, in order to run the code, ROS is required and usual YARP-ROS connections need to be made.
+ *
+ * The messages are preallocated and filled in place, so once the size of the joint list is known
+ * publishing does not allocate memory. If the parameter "asynchronous" is true, the publish
+ * functions only pass the values to a background thread running with the period
+ * "publishing_period", which fills the messages and serializes them. The values are passed through
+ * a System::TripleBuffer, hence the publish functions never lock a mutex. The background thread
+ * publishes only the latest value of each message, hence publishing from a control loop faster
+ * than the publishing period does not increase the network traffic.
+ * @note The transforms are always published synchronously.
+ * @note In asynchronous mode the joint names are taken from the parameter "joint_names", and the
+ * joint list passed to publishJointStates must contain the same joints in the same order.
+ * @warning The configure and the publish functions must be called by the same thread.
  */
 class RosPublisher
 {
@@ -52,6 +64,9 @@ public:
      * - "WrenchPublishers" is group with the following parameters,
      *      - "frame_names" a list containing the frames at which the published wrenches should be expressed
      *      - "topics" a list containing the topics over which the wrenches need to be published. Must be the same size and order as frame_names.
+     * - "joint_names" (optional) list of the joints. If provided the joint states message is preallocated. It is required if "asynchronous" is true.
+     * - "asynchronous" (optional) if true the messages are published by a background thread. Default false.
+     * - "publishing_period" (optional) period in seconds of the background thread. Default 0.01.
      * @param[in] handler Parameter handler
      * @note this method needs to be called after construction and before publishing
      */
@@ -0,0 +1,176 @@
+/**
+ * @file SharedMemoryVectorsCollection.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_YARP_UTILITIES_SHARED_MEMORY_VECTORS_COLLECTION_H
+#define BIPEDAL_LOCOMOTION_YARP_UTILITIES_SHARED_MEMORY_VECTORS_COLLECTION_H
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <iDynTree/Span.h>
+
+namespace BipedalLocomotion
+{
+
+namespace YarpUtilities
+{
+
+/**
+ * SharedMemoryVectorsCollection is a ring of packed records stored in a POSIX shared memory
+ * object. Each record contains all the vectors of a collection, laid out as described by
+ * VectorsCollectionLayout. A single process writes the records, while any number of processes
+ * on the same machine can read them without copying the data.
+ *
+ * The writer fills the next slot of the ring in place and then publishes it. Each reader keeps
+ * its own position in the ring, hence it receives the records in order. If a reader is slower
+ * than the writer, the records overwritten before being read are skipped and counted. Since the
+ * reader accesses the memory of the ring directly, the returned record may be overwritten by the
+ * writer while it is in use. SharedMemoryVectorsCollection::isLastReadValid can be used to check
+ * that this did not happen.
+ *
+ * When the writer is restarted, it creates a new object with the same name and a different
+ * generation, while the readers keep mapping the old one. The readers can detect it with
+ * SharedMemoryVectorsCollection::isStale and open the new object.
+ * @note The class is available only on POSIX systems.
+ */
+class SharedMemoryVectorsCollection
+{
+public:
+    /**
+     * Constructor.
+     */
+    SharedMemoryVectorsCollection();
+
+    /**
+     * Destructor. The shared memory object is removed if it has been created by this instance.
+     */
+    ~SharedMemoryVectorsCollection();
+
+    /**
+     * Create the shared memory object and initialize the ring.
+     * @param name name of the shared memory object. It can be computed with
+     * SharedMemoryVectorsCollection::getName.
+     * @param schemaVersion schema version of the layout of the records.
+     * @param recordSize number of doubles contained in each record.
+     * @param capacity number of records stored in the ring.
+     * @return true in case of success, false otherwise.
+     * @note An existing object with the same name, e.g. left by a writer that crashed, is
+     * removed and a new one is created. The object can be accessed only by the user running the
+     * writer.
+     */
+    bool create(const std::string& name,
+                std::int32_t schemaVersion,
+                std::size_t recordSize,
+                std::size_t capacity);
+
+    /**
+     * Open an existing shared memory object as reader.
+     * @param name name of the shared memory object.
+     * @return true in case of success, false otherwise.
+     * @note The reader starts from the oldest record available in the ring.
+     */
+    bool open(const std::string& name);
+
+    /**
+     * Unmap the shared memory object.
+     */
+    void close();
+
+    /**
+     * Check if the shared memory object is mapped.
+     * @return true if the object is mapped, false otherwise.
+     */
+    bool isOpen() const;
+
+    /**
+     * Get the schema version of the records.
+     * @return the schema version.
+     */
+    std::int32_t getSchemaVersion() const;
+
+    /**
+     * Get the generation of the shared memory object. It is a random number chosen by the writer
+     * when the object is created.
+     * @return the generation. It is zero if the object is not mapped.
+     */
+    std::uint64_t getGeneration() const;
+
+    /**
+     * Check if the mapped object has been removed or replaced by a new writer, e.g. because the
+     * writer has been restarted. In that case no new record will be written in the mapped object
+     * and the reader should be opened again.
+     * @return true if the object is stale, false otherwise.
+     * @note The function opens the object associated to the name, hence it should not be called
+     * at every read.
+     */
+    bool isStale() const;
+
+    /**
+     * Get the number of doubles contained in each record.
+     * @return the size of a record.
+     */
+    std::size_t getRecordSize() const;
+
+    /**
+     * Get the number of records stored in the ring.
+     * @return the capacity of the ring.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * Get the memory of the next record. The record initially contains the values of the last
+     * published record.
+     * @return a span pointing to the record. It is empty if the ring has not been created.
+     * @note Calling this function again before endWrite returns the same record.
+     */
+    iDynTree::Span<double> beginWrite();
+
+    /**
+     * Publish the record returned by beginWrite.
+     */
+    void endWrite();
+
+    /**
+     * Read the oldest record that has not been read yet.
+     * @param shouldWait if true the function waits until a record is available.
+     * @return a span pointing to the record in the shared memory. It is empty if no record is
+     * available.
+     * @note The span is valid until the writer publishes getCapacity() - 1 new records.
+     */
+    iDynTree::Span<const double> read(bool shouldWait = true);
+
+    /**
+     * Check if the record returned by the last call of read has not been overwritten by the
+     * writer in the meantime.
+     * @return true if the record is still valid, false otherwise.
+     */
+    bool isLastReadValid() const;
+
+    /**
+     * Get the number of records overwritten by the writer before being read.
+     * @return the number of lost records.
+     */
+    std::size_t getLostRecords() const;
+
+    /**
+     * Compute the name of the shared memory object associated to a port name.
+     * @param portName name of a YARP port.
+     * @return the name of the shared memory object.
+     */
+    static std::string getName(const std::string& portName);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> m_pimpl;
+};
+
+} // namespace YarpUtilities
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_YARP_UTILITIES_SHARED_MEMORY_VECTORS_COLLECTION_H
@@ -12,7 +12,10 @@
 #include <vector>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/YarpUtilities/PackedVectorsCollection.h>
+#include <BipedalLocomotion/YarpUtilities/SharedMemoryVectorsCollection.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollection.h>
+#include <BipedalLocomotion/YarpUtilities/VectorsCollectionLayout.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollectionMetadata.h>
 
 #include <iDynTree/Span.h>
@@ -26,6 +29,9 @@ namespace YarpUtilities
 /**
  * VectorsCollectionClient is a class that implements that allows to receive a VectorsCollection
  * from a VectorsCollectionServer.
+ * @note If the server writes the data in shared memory, the parameter `shared_memory` must be set
+ * to true. In this case the client must run on the same machine of the server, and the records
+ * can be accessed without any copy with readSharedData.
  */
 class VectorsCollectionClient
 {
@@ -49,6 +55,8 @@ public:
      * |        local       |  string  |                          Name of the local port.                                |
      * |        remote      |  string  |                          Name of the remote port.                               |
      * |       carrier      |  string  |                           Name of the carrier.                                  |
+     * |        packed      |   bool   | True if the server sends a PackedVectorsCollection (Optional, default false).   |
+     * |    shared_memory   |   bool   | True if the server writes the data in shared memory (Optional, default false).  |
      * @return true if the server has been initialized successfully, false otherwise.
      */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
@@ -69,6 +77,8 @@ public:
      * Get the metadata.
      * @param metadata metadata of the vectors collection.
      * @return true if the metadata has been retrieved successfully, false otherwise.
+     * @note If the client receives packed data, this function also computes the layout used to
+     * interpret the data. In shared memory mode this function also opens the shared memory.
      */
     bool getMetadata(BipedalLocomotion::YarpUtilities::VectorsCollectionMetadata& metadata);
 
@@ -77,9 +87,79 @@ public:
      * @param shouldWait if true the function will wait until the data is available.
      * @return a pointer to the VectorsCollection. The ownership of the pointer is controlled by the
      * yarp port.
+     * @note If the client receives packed data, the data is unpacked in a VectorsCollection owned
+     * by the client. Consider using readPackedData (or readSharedData in shared memory mode) to
+     * avoid the copy. getMetadata must be called before reading the data.
      */
     BipedalLocomotion::YarpUtilities::VectorsCollection* readData(bool shouldWait = true);
 
+    /**
+     * Read the packed data from the port.
+     * @param shouldWait if true the function will wait until the data is available.
+     * @return a pointer to the PackedVectorsCollection. The ownership of the pointer is controlled
+     * by the yarp port. A nullptr is returned if the data is not available or if it is not
+     * compatible with the layout computed from the metadata.
+     * @note The vectors can be accessed through the layout returned by getLayout. In shared memory
+     * mode the record is copied in a PackedVectorsCollection owned by the client. If the record
+     * is overwritten by the server while it is copied, the next one is read. A nullptr is returned
+     * if no consistent record is obtained after a few attempts.
+     */
+    const BipedalLocomotion::YarpUtilities::PackedVectorsCollection*
+    readPackedData(bool shouldWait = true);
+
+    /**
+     * Read the next record written by the server in shared memory.
+     * @param shouldWait if true the function will wait until the data is available.
+     * @return a span pointing directly to the record stored in shared memory. It is empty if the
+     * data is not available.
+     * @note The vectors can be accessed through the layout returned by getLayout. Since the data
+     * is not copied, the record may be overwritten by the server while it is used if the client is
+     * slower than the server. Call isSharedDataValid after using the data to check that this did
+     * not happen.
+     */
+    iDynTree::Span<const double> readSharedData(bool shouldWait = true);
+
+    /**
+     * Check if the record returned by the last call of readSharedData has not been overwritten.
+     * @return true if the record is valid, false otherwise.
+     */
+    bool isSharedDataValid() const;
+
+    /**
+     * Check if the shared memory read by the client has been replaced, e.g. because the server
+     * has been restarted. In that case getMetadata has to be called again.
+     * @return true if the shared memory is stale, false otherwise.
+     * @note The function opens the shared memory object, hence it should not be called at every
+     * read.
+     */
+    bool isSharedDataStale() const;
+
+    /**
+     * Get the number of records written in shared memory that have been overwritten before being
+     * read by the client.
+     * @return the number of lost records.
+     */
+    std::size_t getLostRecords() const;
+
+    /**
+     * Check if the client receives packed data.
+     * @return true if the data is packed, false otherwise.
+     */
+    bool isPacked() const;
+
+    /**
+     * Check if the client reads the data from shared memory.
+     * @return true if the data is read from shared memory, false otherwise.
+     */
+    bool isSharedMemory() const;
+
+    /**
+     * Get the layout of the packed data.
+     * @return a const reference to the layout.
+     * @note The layout is valid only after getMetadata has been called.
+     */
+    const VectorsCollectionLayout& getLayout() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> m_pimpl;
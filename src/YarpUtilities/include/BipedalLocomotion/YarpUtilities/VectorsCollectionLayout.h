@@ -0,0 +1,121 @@
+/**
+ * @file VectorsCollectionLayout.h
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#ifndef BIPEDAL_LOCOMOTION_YARP_UTILITIES_VECTORS_COLLECTION_LAYOUT_H
+#define BIPEDAL_LOCOMOTION_YARP_UTILITIES_VECTORS_COLLECTION_LAYOUT_H
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <BipedalLocomotion/YarpUtilities/PackedVectorsCollection.h>
+#include <BipedalLocomotion/YarpUtilities/VectorsCollectionMetadata.h>
+
+#include <iDynTree/Span.h>
+
+namespace BipedalLocomotion
+{
+
+namespace YarpUtilities
+{
+
+/**
+ * VectorsCollectionLayout describes how the vectors of a VectorsCollection are stored in a
+ * PackedVectorsCollection. The layout is computed only from the VectorsCollectionMetadata, hence
+ * the server and the client compute the same layout without exchanging any additional
+ * information. Each vector is identified by an integer handle that can be used to access the
+ * data without looking up the key.
+ */
+class VectorsCollectionLayout
+{
+public:
+    using Handle = std::size_t; /**< Handle associated to a vector. */
+
+    /**
+     * Description of a vector stored in the packed collection.
+     */
+    struct Entry
+    {
+        std::string key; /**< Key of the vector. */
+        std::size_t offset{0}; /**< Position of the first element in the packed data. */
+        std::size_t size{0}; /**< Number of elements. */
+    };
+
+    /**
+     * Compute the layout from the metadata.
+     * @param metadata metadata of the vectors collection.
+     * @return true in case of success, false otherwise.
+     */
+    bool initialize(const VectorsCollectionMetadata& metadata);
+
+    /**
+     * Get the handle associated to a key.
+     * @param key key of the vector.
+     * @param handle handle associated to the key.
+     * @return true if the key exists, false otherwise.
+     */
+    bool getHandle(const std::string& key, Handle& handle) const;
+
+    /**
+     * Get all the entries of the layout. The position of an entry in the vector is its handle.
+     * @return a const reference to the entries.
+     */
+    const std::vector<Entry>& getEntries() const;
+
+    /**
+     * Get the number of doubles required to store all the vectors.
+     * @return the size of the packed data.
+     */
+    std::size_t getPackedSize() const;
+
+    /**
+     * Get the schema version associated to the layout.
+     * @return the schema version.
+     */
+    std::int32_t getSchemaVersion() const;
+
+    /**
+     * Check if a packed collection can be interpreted with this layout.
+     * @param collection the packed collection.
+     * @return true if the collection is compatible with the layout, false otherwise.
+     */
+    bool isCompatible(const PackedVectorsCollection& collection) const;
+
+    /**
+     * Get the vector associated to an handle.
+     * @param collection the packed collection.
+     * @param handle handle of the vector.
+     * @return a span pointing to the data stored in the collection. An empty span is returned if
+     * the handle is not valid.
+     * @warning The collection is assumed to be compatible with the layout.
+     */
+    iDynTree::Span<const double> getVector(const PackedVectorsCollection& collection,
+                                           Handle handle) const;
+
+    /**
+     * Get the vector associated to an handle.
+     * @param data packed data, e.g., a record read from a SharedMemoryVectorsCollection.
+     * @param handle handle of the vector.
+     * @return a span pointing to the data. An empty span is returned if the handle is not valid.
+     * @warning The size of the data is assumed to be equal to getPackedSize().
+     */
+    iDynTree::Span<const double> getVector(iDynTree::Span<const double> data,
+                                           Handle handle) const;
+
+private:
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::string, Handle> m_handles;
+    std::size_t m_packedSize{0};
+    std::int32_t m_schemaVersion{0};
+};
+
+} // namespace YarpUtilities
+} // namespace BipedalLocomotion
+
+#endif // BIPEDAL_LOCOMOTION_YARP_UTILITIES_VECTORS_COLLECTION_LAYOUT_H
@@ -12,7 +12,9 @@
 #include <vector>
 
 #include <BipedalLocomotion/ParametersHandler/IParametersHandler.h>
+#include <BipedalLocomotion/YarpUtilities/SharedMemoryVectorsCollection.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollection.h>
+#include <BipedalLocomotion/YarpUtilities/VectorsCollectionLayout.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollectionMetadata.h>
 #include <BipedalLocomotion/YarpUtilities/VectorsCollectionMetadataService.h>
 
@@ -50,6 +52,24 @@ namespace YarpUtilities
  * server.sendData();
  * @endcode
  * `server.write()` will send the data to the client.
+ * @note If the parameter `packed` is set to true, the server sends a PackedVectorsCollection. All
+ * the vectors are stored in a contiguous buffer whose layout is computed from the metadata (see
+ * VectorsCollectionLayout), hence the keys are not sent with the data. In this case the size of
+ * each vector must match the size of its metadata. The data can be populated using the handle
+ * returned by getHandle to avoid looking up the key at each call.
+ * @code{.cpp}
+ * VectorsCollectionLayout::Handle handle;
+ * server.getHandle("key1", handle); // to be called after finalizeMetadata
+ *
+ * server.prepareData();
+ * server.populateData(handle, {1.0, 2.0, 3.0});
+ * server.sendData();
+ * @endcode
+ * @note If the parameter `shared_memory` is set to true, the data is not sent through a YARP port
+ * but it is written in a ring of packed records stored in shared memory (see
+ * SharedMemoryVectorsCollection), which can be read only by the clients running on the same
+ * machine. The records have the same layout of the packed data and populateData writes directly
+ * in the shared memory. The metadata are still provided through the YARP rpc port.
  */
 class VectorsCollectionServer : public VectorsCollectionMetadataService
 {
@@ -71,6 +91,9 @@ public:
      * |   Parameter Name   |   Type   |                                   Description                                   |
      * |:------------------:|:--------:|:-------------------------------------------------------------------------------:|
      * |        remote      |  string  |                          Name of the port that will be created.                 |
+     * |        packed      |   bool   |      If true the data is sent as a PackedVectorsCollection (Optional, default false). |
+     * |    shared_memory   |   bool   | If true the data is written in shared memory instead of a YARP port (Optional, default false). |
+     * | shared_memory_capacity | int  |      Number of records stored in the shared memory ring (Optional, default 16).  |
      * @return true if the server has been initialized successfully, false otherwise.
      */
     bool initialize(std::weak_ptr<const ParametersHandler::IParametersHandler> handler);
@@ -87,7 +110,7 @@ public:
      * Finalize the metadata.
      * @return true if the metadata has been finalized successfully, false otherwise.
      * @note this function should be called after the metadata has been populated. It opens the
-     * ports.
+     * ports. In shared memory mode it creates the ring of records.
      */
     bool finalizeMetadata();
 
@@ -101,6 +124,26 @@ public:
      */
     bool populateData(const std::string& key, const iDynTree::Span<const double>& data);
 
+    /**
+     * Set the data associated to an handle.
+     * @param handle handle of the data. It can be retrieved with getHandle.
+     * @param data data.
+     * @return true if the data has been set successfully, false otherwise.
+     * @note this function should be called after the metadata has been finalized and after the
+     * prepareData function has been called.
+     */
+    bool populateData(VectorsCollectionLayout::Handle handle,
+                      const iDynTree::Span<const double>& data);
+
+    /**
+     * Get the handle associated to a key.
+     * @param key key of the data.
+     * @param handle handle associated to the key.
+     * @return true if the handle has been retrieved successfully, false otherwise.
+     * @note this function should be called after the metadata has been finalized.
+     */
+    bool getHandle(const std::string& key, VectorsCollectionLayout::Handle& handle) const;
+
     /**
      * Get the metadata.
      * @return the metadata.
@@ -133,6 +176,8 @@ public:
      * to reuse it without reallocating memory, you may skip calling this function. Otherwise, use
      * VectorsCollection::clearData to free the memory allocated in the internal buffer.
      * @note Note that this function only clears the data and does not affect the metadata.
+     * @note If the server sends packed data this function does nothing, since the size of the
+     * buffer is fixed by the metadata.
      * @return true if the data has been cleared successfully, false otherwise.
      */
     bool clearData();
@@ -6,6 +6,7 @@
  */
 
 #include "BipedalLocomotion/YarpUtilities/RosPublisher.h"
+#include <BipedalLocomotion/System/TripleBuffer.h>
 
 #include <yarp/os/Time.h>
 #include <yarp/os/Node.h>
@@ -19,26 +20,84 @@
 #include <yarp/rosmsg/sensor_msgs/JointState.h>
 #include <yarp/rosmsg/geometry_msgs/WrenchStamped.h>
 
-#include <unordered_map>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 
 using namespace BipedalLocomotion::YarpUtilities;
 using namespace BipedalLocomotion;
 
-template <typename PublisherPtr, typename Msg>
+namespace
+{
+
+/**
+ * Joint state passed to the background thread in asynchronous mode. The joint names are not
+ * contained since they are set in the message when the publisher is configured.
+ */
+struct JointStateSample
+{
+    yarp::rosmsg::TickTime stamp;
+    std::vector<double> position;
+    std::vector<double> velocity;
+    std::vector<double> effort;
+};
+
+/**
+ * Wrench passed to the background thread in asynchronous mode.
+ */
+struct WrenchSample
+{
+    yarp::rosmsg::TickTime stamp;
+    std::array<double, 6> wrench{};
+};
+
+template <typename PublisherPtr, typename Msg, typename Sample>
 struct PublisherDetails
 {
     PublisherPtr ptr{nullptr}; /**< YARP object for a ROS  publisher */
     std::string topic{"/topic"}; /**< topic over which the message is published */
     Msg msg; /**< YARP object for a ROS message */
+    System::TripleBuffer<Sample> samples; /**< latest sample passed to the background thread in
+                                             asynchronous mode */
 };
 
 using JointStateMsg = yarp::rosmsg::sensor_msgs::JointState;
 using JointStatePublisherPtr = std::unique_ptr< yarp::os::Publisher<JointStateMsg> >;
 using WrenchStampedMsg = yarp::rosmsg::geometry_msgs::WrenchStamped;
 using WrenchStampedPublisherPtr = std::unique_ptr< yarp::os::Publisher<WrenchStampedMsg> >;
-using WrenchPublisherDetails = PublisherDetails<WrenchStampedPublisherPtr, WrenchStampedMsg>;
-using JointStatePublisherDetails = PublisherDetails<JointStatePublisherPtr, JointStateMsg>;
+using WrenchPublisherDetails
+    = PublisherDetails<WrenchStampedPublisherPtr, WrenchStampedMsg, WrenchSample>;
+using JointStatePublisherDetails
+    = PublisherDetails<JointStatePublisherPtr, JointStateMsg, JointStateSample>;
+
+/**
+ * Copy a sample in the message. The memory of the message is reused since its size does not
+ * change.
+ */
+void fillMessage(const JointStateSample& sample, JointStateMsg& msg)
+{
+    msg.header.stamp = sample.stamp;
+    msg.position = sample.position;
+    msg.velocity = sample.velocity;
+    msg.effort = sample.effort;
+}
+
+void fillMessage(const WrenchSample& sample, WrenchStampedMsg& msg)
+{
+    msg.header.stamp = sample.stamp;
+    msg.wrench.force.x = sample.wrench[0];
+    msg.wrench.force.y = sample.wrench[1];
+    msg.wrench.force.z = sample.wrench[2];
+
+    msg.wrench.torque.x = sample.wrench[3];
+    msg.wrench.torque.y = sample.wrench[4];
+    msg.wrench.torque.z = sample.wrench[5];
+}
+
+} // namespace
 
 class RosPublisher::Impl
 {
@@ -100,6 +159,26 @@ public:
 
     void resizeJointStateBuffer(const std::size_t& size);
 
+    /**
+     * Publish the latest sample of a message if a new one has been passed since the last call.
+     * @note configurationMutex must be locked by the caller.
+     */
+    template <typename PublisherDetails> void publishLatest(PublisherDetails& pub)
+    {
+        if (pub.ptr == nullptr || !pub.samples.update())
+        {
+            return;
+        }
+
+        fillMessage(pub.samples.getReadBuffer(), pub.msg);
+        pub.msg.header.seq++;
+        pub.ptr->write(pub.msg);
+    }
+
+    void startPublishingThread();
+    void stopPublishingThread();
+    void publishingLoop();
+
     std::string nodeName; /**< name of the ROS node */
     std::unique_ptr<yarp::os::Node> node; /**< YARP object for a ROS node */
 
@@ -112,6 +191,12 @@ public:
     bool publishTF{false}; /**< flag to enable publishing transforms to YARP transform server */
     bool initialized{false}; /**< flag to chekc if the publisher was initialized */
 
+    bool asynchronous{false}; /**< flag to enable the publishing in a background thread */
+    std::chrono::duration<double> publishingPeriod{0.01}; /**< period of the background thread */
+    std::mutex configurationMutex; /**< mutex protecting the publishers used by the background thread */
+    std::atomic<bool> isPublishingThreadRunning{false};
+    std::thread publishingThread;
+
     // placeholder variables
     yarp::sig::Matrix pose; /**< placeholder variable for publishing transform data*/
     std::vector<double> jointStateZero; /**< placeholder variable for zero joint state data*/
@@ -127,7 +212,45 @@ RosPublisher::RosPublisher(const std::string& nodeName) : m_pimpl(std::make_uniq
     std::cout <<  "[RosPublisher] Ensure roscore is running and yarpserver was run with --ros option." << std::endl;
 }
 
-RosPublisher::~RosPublisher() = default;
+RosPublisher::~RosPublisher()
+{
+    m_pimpl->stopPublishingThread();
+}
+
+void RosPublisher::Impl::startPublishingThread()
+{
+    isPublishingThreadRunning = true;
+    publishingThread = std::thread([this] { this->publishingLoop(); });
+}
+
+void RosPublisher::Impl::stopPublishingThread()
+{
+    isPublishingThreadRunning = false;
+    if (publishingThread.joinable())
+    {
+        publishingThread.join();
+    }
+}
+
+void RosPublisher::Impl::publishingLoop()
+{
+    auto nextPublishingTime = std::chrono::steady_clock::now();
+    while (isPublishingThreadRunning)
+    {
+        {
+            std::lock_guard<std::mutex> lock(configurationMutex);
+            publishLatest(jointStatePublisher);
+            for (auto& [frame, pub] : wrenchPublisherMap)
+            {
+                publishLatest(pub);
+            }
+        }
+
+        nextPublishingTime += std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            publishingPeriod);
+        std::this_thread::sleep_until(nextPublishingTime);
+    }
+}
 
 bool RosPublisher::initialize(std::weak_ptr<BipedalLocomotion::ParametersHandler::IParametersHandler> handler)
 {
@@ -141,6 +264,25 @@ bool RosPublisher::initialize(std::weak_ptr<BipedalLocomotion::ParametersHandler
         return false;
     }
 
+    m_pimpl->stopPublishingThread();
+
+    // the asynchronous publishing is optional
+    if (!handle->getParameter("asynchronous", m_pimpl->asynchronous))
+    {
+        m_pimpl->asynchronous = false;
+    }
+
+    double publishingPeriod{m_pimpl->publishingPeriod.count()};
+    if (handle->getParameter("publishing_period", publishingPeriod))
+    {
+        if (publishingPeriod <= 0)
+        {
+            std::cerr << printPrefix << "The parameter \"publishing_period\" must be strictly positive." << std::endl;
+            return false;
+        }
+        m_pimpl->publishingPeriod = std::chrono::duration<double>(publishingPeriod);
+    }
+
     // configure joint state publisher if it exists
     if (handle->getParameter("joint_states_topic", m_pimpl->jointStatePublisher.topic))
     {
@@ -149,6 +291,30 @@ bool RosPublisher::initialize(std::weak_ptr<BipedalLocomotion::ParametersHandler
             std::cerr << printPrefix << "Could not configure joint states publisher." << std::endl;
             return false;
         }
+
+        // preallocate the joint states message if the joints are known. In asynchronous mode
+        // the names are set only here, hence they are required.
+        std::vector<std::string> jointNames;
+        if (handle->getParameter("joint_names", jointNames))
+        {
+            auto& pub = m_pimpl->jointStatePublisher;
+            pub.msg.name = jointNames;
+            pub.msg.position.resize(jointNames.size(), 0.0);
+            pub.msg.velocity.resize(jointNames.size(), 0.0);
+            pub.msg.effort.resize(jointNames.size(), 0.0);
+
+            JointStateSample sample;
+            sample.position.resize(jointNames.size(), 0.0);
+            sample.velocity.resize(jointNames.size(), 0.0);
+            sample.effort.resize(jointNames.size(), 0.0);
+            pub.samples.initialize(sample);
+
+            m_pimpl->resizeJointStateBuffer(jointNames.size());
+        } else if (m_pimpl->asynchronous)
+        {
+            std::cerr << printPrefix << "The parameter \"joint_names\" is required to publish the joint states asynchronously." << std::endl;
+            return false;
+        }
     }
 
     // configure transform publisher
@@ -203,11 +369,17 @@ bool RosPublisher::initialize(std::weak_ptr<BipedalLocomotion::ParametersHandler
 
     m_pimpl->initialized = true;
 
+    if (m_pimpl->asynchronous)
+    {
+        m_pimpl->startPublishingThread();
+    }
+
     return true;
 }
 
 bool RosPublisher::configureJointStatePublisher(const std::string& topicName)
 {
+    std::lock_guard<std::mutex> lock(m_pimpl->configurationMutex);
     m_pimpl->configurePublisher(m_pimpl->jointStatePublisher.ptr);
 
     m_pimpl->jointStatePublisher.topic = topicName;
@@ -223,14 +395,17 @@ bool RosPublisher::configureWrenchPublisher(const std::string& frameName,
                                             const std::string& topicName)
 {
     std::string_view printPrefix = "[RosPublisher::configureWrenchPublisher] ";
+    std::lock_guard<std::mutex> lock(m_pimpl->configurationMutex);
     if (m_pimpl->wrenchPublisherMap.find(frameName) == m_pimpl->wrenchPublisherMap.end())
     {
         std::cerr << printPrefix << "Wrench publisher does not already exist. Adding a wrench publisher for " << frameName << "." << std::endl;
-        m_pimpl->wrenchPublisherMap[frameName] = WrenchPublisherDetails();
+        m_pimpl->wrenchPublisherMap[frameName];
     }
 
     m_pimpl->configurePublisher(m_pimpl->wrenchPublisherMap.at(frameName).ptr);
     m_pimpl->wrenchPublisherMap.at(frameName).topic = topicName;
+    m_pimpl->wrenchPublisherMap.at(frameName).msg.header.frame_id = frameName;
+    m_pimpl->wrenchPublisherMap.at(frameName).samples.initialize();
     if (!m_pimpl->openPublisher(m_pimpl->wrenchPublisherMap.at(frameName).ptr.get(), m_pimpl->wrenchPublisherMap.at(frameName).topic))
     {
         return false;
@@ -242,6 +417,7 @@ bool RosPublisher::configureWrenchPublisher(const std::string& frameName,
 bool RosPublisher::removeWrenchPublisher(const std::string& frameName)
 {
     std::string_view printPrefix = "[RosPublisher::removeWrenchPublisher] ";
+    std::lock_guard<std::mutex> lock(m_pimpl->configurationMutex);
     if (m_pimpl->wrenchPublisherMap.find(frameName) == m_pimpl->wrenchPublisherMap.end())
     {
         std::cerr << printPrefix << "Wrench publisher does not already exist." << std::endl;
@@ -377,22 +553,51 @@ bool RosPublisher::publishJointStates(const GenericContainer::Vector<const std::
         return false;
     }
 
-    pub.msg.header.seq++;
-    pub.msg.header.stamp = m_pimpl->getTimeStampFromYarp();
+    const std::size_t size = jointList.size();
+
+    // in asynchronous mode the names are set when the publisher is configured and only the values
+    // are passed to the background thread
+    if (m_pimpl->asynchronous)
+    {
+        if (size != pub.msg.name.size())
+        {
+            std::cerr << printPrefix << "The number of joints does not match the parameter \"joint_names\". Unable to publish joint states." << std::endl;
+            return false;
+        }
 
-    pub.msg.name.clear();
-    pub.msg.position.clear();
-    pub.msg.velocity.clear();
-    pub.msg.effort.clear();
+        auto& sample = pub.samples.getWriteBuffer();
+        sample.stamp = m_pimpl->getTimeStampFromYarp();
+        for (std::size_t idx = 0; idx < size; idx++)
+        {
+            sample.position[idx] = jointPositions(idx);
+            sample.velocity[idx] = jointVelocities(idx);
+            sample.effort[idx] = jointEfforts(idx);
+        }
+        pub.samples.publish();
+        return true;
+    }
+
+    auto& msg = pub.msg;
+    msg.header.stamp = m_pimpl->getTimeStampFromYarp();
 
-    for (std::size_t idx = 0; idx < jointList.size(); idx++)
+    // the message is filled in place, the memory is allocated only if the number of joints changes
+    if (msg.name.size() != size)
     {
-        pub.msg.name.emplace_back(jointList(idx));
-        pub.msg.position.emplace_back(jointPositions(idx));
-        pub.msg.velocity.emplace_back(jointVelocities(idx));
-        pub.msg.effort.emplace_back(jointEfforts(idx));
+        msg.name.resize(size);
+        msg.position.resize(size);
+        msg.velocity.resize(size);
+        msg.effort.resize(size);
     }
 
+    for (std::size_t idx = 0; idx < size; idx++)
+    {
+        msg.name[idx] = jointList(idx);
+        msg.position[idx] = jointPositions(idx);
+        msg.velocity[idx] = jointVelocities(idx);
+        msg.effort[idx] = jointEfforts(idx);
+    }
+
+    pub.msg.header.seq++;
     pub.ptr->write(pub.msg);
     return true;
 }
@@ -427,16 +632,21 @@ bool RosPublisher::publishWrench(const std::string& frame,
         return false;
     }
 
+    auto& sample = pub.samples.getWriteBuffer();
+    sample.stamp = m_pimpl->getTimeStampFromYarp();
+    for (std::size_t idx = 0; idx < sample.wrench.size(); idx++)
+    {
+        sample.wrench[idx] = wrench6d(idx);
+    }
+
+    if (m_pimpl->asynchronous)
+    {
+        pub.samples.publish();
+        return true;
+    }
+
+    fillMessage(sample, pub.msg);
     pub.msg.header.seq++;
-    pub.msg.header.frame_id = frame;
-    pub.msg.header.stamp = m_pimpl->getTimeStampFromYarp();
-    pub.msg.wrench.force.x = wrench6d(0);
-    pub.msg.wrench.force.y = wrench6d(1);
-    pub.msg.wrench.force.z = wrench6d(2);
-
-    pub.msg.wrench.torque.x = wrench6d(3);
-    pub.msg.wrench.torque.y = wrench6d(4);
-    pub.msg.wrench.torque.z = wrench6d(5);
     pub.ptr->write(pub.msg);
 
     return true;
@@ -467,6 +677,8 @@ yarp::rosmsg::TickTime RosPublisher::Impl::getTimeStampFromYarp()
 
 void RosPublisher::stop()
 {
+    m_pimpl->stopPublishingThread();
+
     if (!m_pimpl->wrenchPublisherMap.empty())
     {
         std::vector<std::string> frames;
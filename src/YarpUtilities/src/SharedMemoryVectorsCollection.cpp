@@ -0,0 +1,483 @@
+/**
+ * @file SharedMemoryVectorsCollection.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <BipedalLocomotion/TextLogging/Logger.h>
+#include <BipedalLocomotion/YarpUtilities/SharedMemoryVectorsCollection.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BLF_SHARED_MEMORY_AVAILABLE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace BipedalLocomotion::YarpUtilities;
+
+namespace
+{
+// the atomics are shared between different processes
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+constexpr char magic[8] = {'B', 'L', 'F', 'S', 'H', 'M', '0', '2'};
+constexpr std::size_t cacheLineSize = 64;
+
+struct Header
+{
+    char magic[8];
+    std::int32_t schemaVersion;
+    std::uint32_t reserved;
+    std::uint64_t recordSize;
+    std::uint64_t capacity;
+    std::uint64_t slotSize; /**< Distance in bytes between two consecutive slots. */
+    std::uint64_t generation; /**< Random number identifying the object. */
+    alignas(cacheLineSize) std::atomic<std::uint64_t> writeIndex; /**< Number of published
+                                                                     records. */
+};
+
+// Each slot starts with a sequence number followed by the record. While the record i is written
+// the sequence is 2 * i + 1, once it is published the sequence is 2 * i + 2.
+struct SlotHeader
+{
+    std::atomic<std::uint64_t> sequence;
+    std::uint64_t reserved;
+};
+
+constexpr std::size_t headerSize = (sizeof(Header) + cacheLineSize - 1) / cacheLineSize
+                                   * cacheLineSize;
+
+/**
+ * Read the generation of the object associated to a name.
+ * @return true in case of success, false if the object does not exist or it is not valid.
+ */
+bool readGeneration(const std::string& name, std::uint64_t& generation)
+{
+#ifdef BLF_SHARED_MEMORY_AVAILABLE
+    const int fileDescriptor = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fileDescriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+    void* memory = MAP_FAILED;
+    if (fstat(fileDescriptor, &status) == 0
+        && static_cast<std::size_t>(status.st_size) >= headerSize)
+    {
+        memory = mmap(nullptr, headerSize, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    }
+    ::close(fileDescriptor);
+    if (memory == MAP_FAILED)
+    {
+        return false;
+    }
+
+    const Header* header = static_cast<const Header*>(memory);
+    const bool isValid = std::memcmp(header->magic, magic, sizeof(magic)) == 0;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    generation = header->generation;
+    munmap(memory, headerSize);
+    return isValid;
+#else
+    return false;
+#endif
+}
+} // namespace
+
+struct SharedMemoryVectorsCollection::Impl
+{
+    std::string name;
+    bool isOwner{false};
+    void* memory{nullptr};
+    std::size_t memorySize{0};
+
+    Header* header{nullptr};
+
+    std::uint64_t generation{0}; /**< Generation of the mapped object. */
+
+    // writer
+    bool isWriting{false};
+
+    // reader
+    std::uint64_t readIndex{0};
+    const SlotHeader* lastReadSlot{nullptr};
+    std::uint64_t lastReadSequence{0};
+    std::size_t lostRecords{0};
+
+    SlotHeader* slot(std::uint64_t index) const
+    {
+        auto* first = static_cast<unsigned char*>(memory) + headerSize;
+        return reinterpret_cast<SlotHeader*>(first + (index % header->capacity) * header->slotSize);
+    }
+
+    double* record(SlotHeader* slot) const
+    {
+        return reinterpret_cast<double*>(slot + 1);
+    }
+
+    bool map(int fileDescriptor, std::size_t size, bool isWritable);
+};
+
+bool SharedMemoryVectorsCollection::Impl::map(int fileDescriptor,
+                                              std::size_t size,
+                                              bool isWritable)
+{
+#ifdef BLF_SHARED_MEMORY_AVAILABLE
+    const int protection = isWritable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* ptr = mmap(nullptr, size, protection, MAP_SHARED, fileDescriptor, 0);
+    if (ptr == MAP_FAILED)
+    {
+        return false;
+    }
+
+    memory = ptr;
+    memorySize = size;
+    header = static_cast<Header*>(memory);
+    return true;
+#else
+    return false;
+#endif
+}
+
+SharedMemoryVectorsCollection::SharedMemoryVectorsCollection()
+    : m_pimpl(std::make_unique<Impl>())
+{
+}
+
+SharedMemoryVectorsCollection::~SharedMemoryVectorsCollection()
+{
+    this->close();
+}
+
+bool SharedMemoryVectorsCollection::create(const std::string& name,
+                                           std::int32_t schemaVersion,
+                                           std::size_t recordSize,
+                                           std::size_t capacity)
+{
+    constexpr auto logPrefix = "[SharedMemoryVectorsCollection::create]";
+
+#ifdef BLF_SHARED_MEMORY_AVAILABLE
+    if (this->isOpen())
+    {
+        log()->error("{} The shared memory {} is already open.", logPrefix, m_pimpl->name);
+        return false;
+    }
+
+    if (capacity < 2)
+    {
+        log()->error("{} The capacity of the ring must be at least 2.", logPrefix);
+        return false;
+    }
+
+    const std::size_t slotSize
+        = (sizeof(SlotHeader) + recordSize * sizeof(double) + cacheLineSize - 1) / cacheLineSize
+          * cacheLineSize;
+    const std::size_t size = headerSize + capacity * slotSize;
+
+    // An object left by a process that crashed is removed instead of being reused, since the
+    // readers that still map it would see its content changing while it is initialized. The
+    // readers keep mapping the old object and they can detect that it has been replaced with
+    // isStale. Only the user running the writer can access the object.
+    shm_unlink(name.c_str());
+    const int fileDescriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fileDescriptor < 0)
+    {
+        log()->error("{} Unable to create the shared memory {}: {}.",
+                     logPrefix,
+                     name,
+                     std::strerror(errno));
+        return false;
+    }
+
+    const bool ok = ftruncate(fileDescriptor, static_cast<off_t>(size)) == 0
+                    && m_pimpl->map(fileDescriptor, size, true);
+    ::close(fileDescriptor);
+    if (!ok)
+    {
+        log()->error("{} Unable to map the shared memory {}: {}.",
+                     logPrefix,
+                     name,
+                     std::strerror(errno));
+        shm_unlink(name.c_str());
+        return false;
+    }
+
+    m_pimpl->name = name;
+    m_pimpl->isOwner = true;
+
+    // the new object is filled with zeros. The magic string is written last, so a reader does
+    // not use a partially initialized header
+    Header* header = m_pimpl->header;
+    header->schemaVersion = schemaVersion;
+    header->recordSize = recordSize;
+    header->capacity = capacity;
+    header->slotSize = slotSize;
+    std::random_device randomDevice;
+    header->generation = (static_cast<std::uint64_t>(randomDevice()) << 32) ^ randomDevice();
+    header->writeIndex.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, magic, sizeof(magic));
+
+    return true;
+#else
+    log()->error("{} The shared memory is not supported on this platform.", logPrefix);
+    return false;
+#endif
+}
+
+bool SharedMemoryVectorsCollection::open(const std::string& name)
+{
+    constexpr auto logPrefix = "[SharedMemoryVectorsCollection::open]";
+
+#ifdef BLF_SHARED_MEMORY_AVAILABLE
+    if (this->isOpen())
+    {
+        this->close();
+    }
+
+    const int fileDescriptor = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fileDescriptor < 0)
+    {
+        log()->error("{} Unable to open the shared memory {}: {}.",
+                     logPrefix,
+                     name,
+                     std::strerror(errno));
+        return false;
+    }
+
+    struct stat status;
+    const bool ok = fstat(fileDescriptor, &status) == 0
+                    && static_cast<std::size_t>(status.st_size) >= headerSize
+                    && m_pimpl->map(fileDescriptor, status.st_size, false);
+    ::close(fileDescriptor);
+    if (!ok)
+    {
+        log()->error("{} Unable to map the shared memory {}.", logPrefix, name);
+        return false;
+    }
+
+    m_pimpl->name = name;
+    m_pimpl->isOwner = false;
+
+    const Header* header = m_pimpl->header;
+    if (std::memcmp(header->magic, magic, sizeof(magic)) != 0 || header->capacity < 2
+        || headerSize + header->capacity * header->slotSize > m_pimpl->memorySize)
+    {
+        log()->error("{} The shared memory {} does not contain a valid ring.", logPrefix, name);
+        this->close();
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    // start from the oldest record that cannot be overwritten while it is read
+    const std::uint64_t writeIndex = header->writeIndex.load(std::memory_order_acquire);
+    m_pimpl->readIndex = writeIndex > header->capacity - 1 ? writeIndex - (header->capacity - 1)
+                                                           : 0;
+    m_pimpl->lastReadSlot = nullptr;
+    m_pimpl->lostRecords = 0;
+
+    return true;
+#else
+    log()->error("{} The shared memory is not supported on this platform.", logPrefix);
+    return false;
+#endif
+}
+
+void SharedMemoryVectorsCollection::close()
+{
+#ifdef BLF_SHARED_MEMORY_AVAILABLE
+    if (m_pimpl->memory != nullptr)
+    {
+        m_pimpl->generation = m_pimpl->header->generation;
+        munmap(m_pimpl->memory, m_pimpl->memorySize);
+    }
+
+    // the object is not removed if it has been replaced by another writer
+    std::uint64_t generation{0};
+    if (m_pimpl->isOwner && readGeneration(m_pimpl->name, generation)
+        && generation == m_pimpl->generation)
+    {
+        shm_unlink(m_pimpl->name.c_str());
+    }
+#endif
+
+    m_pimpl->memory = nullptr;
+    m_pimpl->memorySize = 0;
+    m_pimpl->header = nullptr;
+    m_pimpl->isOwner = false;
+    m_pimpl->isWriting = false;
+    m_pimpl->lastReadSlot = nullptr;
+}
+
+bool SharedMemoryVectorsCollection::isOpen() const
+{
+    return m_pimpl->memory != nullptr;
+}
+
+std::int32_t SharedMemoryVectorsCollection::getSchemaVersion() const
+{
+    return this->isOpen() ? m_pimpl->header->schemaVersion : 0;
+}
+
+std::uint64_t SharedMemoryVectorsCollection::getGeneration() const
+{
+    return this->isOpen() ? m_pimpl->header->generation : 0;
+}
+
+bool SharedMemoryVectorsCollection::isStale() const
+{
+    if (!this->isOpen())
+    {
+        return false;
+    }
+
+    std::uint64_t generation{0};
+    return !readGeneration(m_pimpl->name, generation)
+           || generation != m_pimpl->header->generation;
+}
+
+std::size_t SharedMemoryVectorsCollection::getRecordSize() const
+{
+    return this->isOpen() ? m_pimpl->header->recordSize : 0;
+}
+
+std::size_t SharedMemoryVectorsCollection::getCapacity() const
+{
+    return this->isOpen() ? m_pimpl->header->capacity : 0;
+}
+
+iDynTree::Span<double> SharedMemoryVectorsCollection::beginWrite()
+{
+    if (!this->isOpen() || !m_pimpl->isOwner)
+    {
+        return iDynTree::Span<double>();
+    }
+
+    Header* header = m_pimpl->header;
+    const std::uint64_t index = header->writeIndex.load(std::memory_order_relaxed);
+    SlotHeader* slot = m_pimpl->slot(index);
+    double* record = m_pimpl->record(slot);
+
+    if (!m_pimpl->isWriting)
+    {
+        // the readers see that the slot is being written before its content changes
+        slot->sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        // the values that are not populated are the same of the previous record
+        if (index > 0)
+        {
+            const double* previous = m_pimpl->record(m_pimpl->slot(index - 1));
+            std::copy_n(previous, header->recordSize, record);
+        }
+        m_pimpl->isWriting = true;
+    }
+
+    return iDynTree::Span<double>(record, header->recordSize);
+}
+
+void SharedMemoryVectorsCollection::endWrite()
+{
+    if (!m_pimpl->isWriting)
+    {
+        return;
+    }
+
+    Header* header = m_pimpl->header;
+    const std::uint64_t index = header->writeIndex.load(std::memory_order_relaxed);
+    m_pimpl->slot(index)->sequence.store(2 * index + 2, std::memory_order_release);
+    header->writeIndex.store(index + 1, std::memory_order_release);
+    m_pimpl->isWriting = false;
+}
+
+iDynTree::Span<const double> SharedMemoryVectorsCollection::read(bool shouldWait /*= true*/)
+{
+    if (!this->isOpen())
+    {
+        return iDynTree::Span<const double>();
+    }
+
+    const Header* header = m_pimpl->header;
+    std::size_t attempts = 0;
+    while (true)
+    {
+        const std::uint64_t writeIndex = header->writeIndex.load(std::memory_order_acquire);
+        if (m_pimpl->readIndex >= writeIndex)
+        {
+            if (!shouldWait)
+            {
+                return iDynTree::Span<const double>();
+            }
+
+            // the writer usually publishes soon, so the thread yields before sleeping
+            if (attempts++ < 100)
+            {
+                std::this_thread::yield();
+            } else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            continue;
+        }
+
+        // the slot of the record writeIndex may be under writing, hence at most capacity - 1
+        // records can be read
+        if (writeIndex - m_pimpl->readIndex > header->capacity - 1)
+        {
+            const std::uint64_t oldest = writeIndex - (header->capacity - 1);
+            m_pimpl->lostRecords += oldest - m_pimpl->readIndex;
+            m_pimpl->readIndex = oldest;
+        }
+
+        const SlotHeader* slot = m_pimpl->slot(m_pimpl->readIndex);
+        const std::uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence != 2 * m_pimpl->readIndex + 2)
+        {
+            // the writer overwrote the slot in the meantime
+            continue;
+        }
+
+        m_pimpl->lastReadSlot = slot;
+        m_pimpl->lastReadSequence = sequence;
+        m_pimpl->readIndex++;
+        return iDynTree::Span<const double>(m_pimpl->record(const_cast<SlotHeader*>(slot)),
+                                            header->recordSize);
+    }
+}
+
+bool SharedMemoryVectorsCollection::isLastReadValid() const
+{
+    if (m_pimpl->lastReadSlot == nullptr)
+    {
+        return false;
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return m_pimpl->lastReadSlot->sequence.load(std::memory_order_relaxed)
+           == m_pimpl->lastReadSequence;
+}
+
+std::size_t SharedMemoryVectorsCollection::getLostRecords() const
+{
+    return m_pimpl->lostRecords;
+}
+
+std::string SharedMemoryVectorsCollection::getName(const std::string& portName)
+{
+    // the name of a POSIX shared memory object starts with a slash and it does not contain any
+    // other slash
+    std::string name = "/blf" + portName;
+    std::replace(name.begin() + 1, name.end(), '/', '_');
+    return name;
+}
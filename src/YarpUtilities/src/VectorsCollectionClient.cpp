@@ -21,6 +21,9 @@ struct VectorsCollectionClient::Impl
 {
     yarp::os::BufferedPort<VectorsCollection> port; /**< Buffered port used to communicate with
                                                             the server. */
+    yarp::os::BufferedPort<PackedVectorsCollection> packedPort; /**< Buffered port used to
+                                                                   communicate with the server if
+                                                                   the data is packed. */
     yarp::os::Port rpcPort; /**< RPC port used to communicate with the server. */
     BipedalLocomotion::YarpUtilities::VectorsCollectionMetadataService rpcInterface;
 
@@ -31,8 +34,37 @@ struct VectorsCollectionClient::Impl
     std::string carrier; /**< Carrier used to connect the port. */
 
     bool isConnected{false}; /**< True if the client is connected. */
+
+    bool isPacked{false}; /**< True if the server sends packed data. */
+    bool isLayoutValid{false}; /**< True if the layout has been computed from the metadata. */
+    VectorsCollectionLayout layout; /**< Layout of the packed data. */
+    VectorsCollection unpackedCollection; /**< Collection used to unpack the data in readData. */
+
+    bool isSharedMemory{false}; /**< True if the server writes the data in shared memory. */
+    SharedMemoryVectorsCollection sharedMemory; /**< Ring of records stored in shared memory. */
+    PackedVectorsCollection packedCollection; /**< Copy of the shared record used by
+                                                 readPackedData. */
+    static constexpr std::size_t maxSharedReadAttempts{3}; /**< Maximum number of records read
+                                                              to get a consistent copy. */
+
+    /**
+     * Unpack the data in unpackedCollection.
+     */
+    VectorsCollection* unpack(iDynTree::Span<const double> data);
 };
 
+VectorsCollection* VectorsCollectionClient::Impl::unpack(iDynTree::Span<const double> data)
+{
+    // the keys are inserted only the first time, then the memory is reused
+    for (const auto& entry : layout.getEntries())
+    {
+        const auto first = data.begin() + entry.offset;
+        unpackedCollection.vectors[entry.key].assign(first, first + entry.size);
+    }
+
+    return &unpackedCollection;
+}
+
 VectorsCollectionClient::VectorsCollectionClient()
 {
     m_pimpl = std::make_unique<Impl>();
@@ -69,8 +101,25 @@ bool VectorsCollectionClient::initialize(
     m_pimpl->remotePortName = remotePort + "/measures:o";
     m_pimpl->remoteRpcPortName = remotePort + "/rpc:i";
 
+    if (!ptr->getParameter("packed", m_pimpl->isPacked))
+    {
+        log()->info("{} The parameter 'packed' is not found. The data is assumed not packed.",
+                    logPrefix);
+    }
+
+    if (!ptr->getParameter("shared_memory", m_pimpl->isSharedMemory))
+    {
+        log()->info("{} The parameter 'shared_memory' is not found. The data is assumed to be "
+                    "sent through a YARP port.",
+                    logPrefix);
+    }
+
+    // in shared memory mode the data port is not used
     m_pimpl->localPortName = localPort + "/measures:i";
-    if (!m_pimpl->port.open(m_pimpl->localPortName))
+    const bool portOpened = m_pimpl->isSharedMemory
+                            || (m_pimpl->isPacked ? m_pimpl->packedPort.open(m_pimpl->localPortName)
+                                                  : m_pimpl->port.open(m_pimpl->localPortName));
+    if (!portOpened)
     {
         log()->error("{} Unable to open the port named {}.", //
                      logPrefix,
@@ -104,8 +153,8 @@ bool VectorsCollectionClient::disconnect()
         return true;
     }
 
-    if (!yarp::os::Network::disconnect(m_pimpl->remotePortName,
-                                       m_pimpl->localPortName)
+    if ((!m_pimpl->isSharedMemory
+         && !yarp::os::Network::disconnect(m_pimpl->remotePortName, m_pimpl->localPortName))
         || !yarp::os::Network::disconnect(m_pimpl->localRpcPortName, //
                                           m_pimpl->remoteRpcPortName))
     {
@@ -121,9 +170,10 @@ bool VectorsCollectionClient::connect()
     constexpr auto rpcCarrier = "tcp";
     m_pimpl->isConnected = false;
 
-    if (!yarp::os::Network::connect(m_pimpl->remotePortName,
-                                    m_pimpl->localPortName,
-                                    m_pimpl->carrier)
+    if ((!m_pimpl->isSharedMemory
+         && !yarp::os::Network::connect(m_pimpl->remotePortName,
+                                        m_pimpl->localPortName,
+                                        m_pimpl->carrier))
         || !yarp::os::Network::connect(m_pimpl->localRpcPortName, //
                                        m_pimpl->remoteRpcPortName,
                                        rpcCarrier))
@@ -152,11 +202,184 @@ bool VectorsCollectionClient::getMetadata(
     }
 
     metadata = m_pimpl->rpcInterface.getMetadata();
+
+    if (m_pimpl->isPacked || m_pimpl->isSharedMemory)
+    {
+        m_pimpl->isLayoutValid = m_pimpl->layout.initialize(metadata);
+        if (!m_pimpl->isLayoutValid)
+        {
+            log()->error("[VectorsCollectionClient::getMetadata] Unable to compute the layout of "
+                         "the packed data.");
+            return false;
+        }
+    }
+
+    if (m_pimpl->isSharedMemory)
+    {
+        // the shared memory is created by the server when the metadata is finalized
+        const std::string name = SharedMemoryVectorsCollection::getName(m_pimpl->remotePortName);
+        if (!m_pimpl->sharedMemory.open(name))
+        {
+            m_pimpl->isLayoutValid = false;
+            log()->error("[VectorsCollectionClient::getMetadata] Unable to open the shared memory "
+                         "named {}.",
+                         name);
+            return false;
+        }
+
+        if (m_pimpl->sharedMemory.getSchemaVersion() != m_pimpl->layout.getSchemaVersion())
+        {
+            m_pimpl->isLayoutValid = false;
+            log()->error("[VectorsCollectionClient::getMetadata] The schema version of the shared "
+                         "memory ({}) does not match the one computed from the metadata ({}).",
+                         m_pimpl->sharedMemory.getSchemaVersion(),
+                         m_pimpl->layout.getSchemaVersion());
+            return false;
+        }
+
+        if (m_pimpl->sharedMemory.getRecordSize() != m_pimpl->layout.getPackedSize())
+        {
+            m_pimpl->isLayoutValid = false;
+            log()->error("[VectorsCollectionClient::getMetadata] The size of the records stored in "
+                         "the shared memory ({}) does not match the one computed from the "
+                         "metadata ({}).",
+                         m_pimpl->sharedMemory.getRecordSize(),
+                         m_pimpl->layout.getPackedSize());
+            return false;
+        }
+    }
+
     return true;
 }
 
 BipedalLocomotion::YarpUtilities::VectorsCollection*
 VectorsCollectionClient::readData(bool shouldWait /*= true */)
 {
-    return m_pimpl->port.read(shouldWait);
+    if (!m_pimpl->isPacked && !m_pimpl->isSharedMemory)
+    {
+        return m_pimpl->port.read(shouldWait);
+    }
+
+    // in shared memory mode readPackedData copies the record and checks that it is consistent
+    const PackedVectorsCollection* packedCollection = this->readPackedData(shouldWait);
+    if (packedCollection == nullptr)
+    {
+        return nullptr;
+    }
+
+    return m_pimpl->unpack(iDynTree::make_span(packedCollection->data));
+}
+
+const BipedalLocomotion::YarpUtilities::PackedVectorsCollection*
+VectorsCollectionClient::readPackedData(bool shouldWait /*= true */)
+{
+    constexpr auto logPrefix = "[VectorsCollectionClient::readPackedData]";
+
+    if (!m_pimpl->isPacked && !m_pimpl->isSharedMemory)
+    {
+        log()->error("{} The client has not been configured to receive packed data.", logPrefix);
+        return nullptr;
+    }
+
+    if (!m_pimpl->isLayoutValid)
+    {
+        log()->error("{} Please call getMetadata before reading the packed data.", logPrefix);
+        return nullptr;
+    }
+
+    if (m_pimpl->isSharedMemory)
+    {
+        // the writer may overwrite the record while it is copied, in that case the next record
+        // is read
+        for (std::size_t attempt = 0; attempt < Impl::maxSharedReadAttempts; attempt++)
+        {
+            const iDynTree::Span<const double> record = m_pimpl->sharedMemory.read(shouldWait);
+            if (record.empty())
+            {
+                return nullptr;
+            }
+
+            // the memory of the collection is allocated only the first time
+            m_pimpl->packedCollection.data.assign(record.begin(), record.end());
+            if (m_pimpl->sharedMemory.isLastReadValid())
+            {
+                m_pimpl->packedCollection.schemaVersion = m_pimpl->sharedMemory.getSchemaVersion();
+                return &m_pimpl->packedCollection;
+            }
+        }
+
+        log()->warn("{} Unable to read a consistent record from the shared memory after {} "
+                    "attempts. The client is probably too slow with respect to the server.",
+                    logPrefix,
+                    Impl::maxSharedReadAttempts);
+        return nullptr;
+    }
+
+    const PackedVectorsCollection* collection = m_pimpl->packedPort.read(shouldWait);
+    if (collection == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (!m_pimpl->layout.isCompatible(*collection))
+    {
+        log()->error("{} The schema version of the received data ({}) does not match the one "
+                     "computed from the metadata ({}).",
+                     logPrefix,
+                     collection->schemaVersion,
+                     m_pimpl->layout.getSchemaVersion());
+        return nullptr;
+    }
+
+    return collection;
+}
+
+iDynTree::Span<const double> VectorsCollectionClient::readSharedData(bool shouldWait /*= true */)
+{
+    constexpr auto logPrefix = "[VectorsCollectionClient::readSharedData]";
+
+    if (!m_pimpl->isSharedMemory)
+    {
+        log()->error("{} The client has not been configured to read the data from shared memory.",
+                     logPrefix);
+        return iDynTree::Span<const double>();
+    }
+
+    if (!m_pimpl->isLayoutValid)
+    {
+        log()->error("{} Please call getMetadata before reading the data.", logPrefix);
+        return iDynTree::Span<const double>();
+    }
+
+    return m_pimpl->sharedMemory.read(shouldWait);
+}
+
+bool VectorsCollectionClient::isSharedDataValid() const
+{
+    return m_pimpl->sharedMemory.isLastReadValid();
+}
+
+bool VectorsCollectionClient::isSharedDataStale() const
+{
+    return m_pimpl->sharedMemory.isStale();
+}
+
+std::size_t VectorsCollectionClient::getLostRecords() const
+{
+    return m_pimpl->sharedMemory.getLostRecords();
+}
+
+bool VectorsCollectionClient::isPacked() const
+{
+    return m_pimpl->isPacked;
+}
+
+bool VectorsCollectionClient::isSharedMemory() const
+{
+    return m_pimpl->isSharedMemory;
+}
+
+const VectorsCollectionLayout& VectorsCollectionClient::getLayout() const
+{
+    return m_pimpl->layout;
 }
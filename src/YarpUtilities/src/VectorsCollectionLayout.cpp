@@ -0,0 +1,113 @@
+/**
+ * @file VectorsCollectionLayout.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <BipedalLocomotion/YarpUtilities/VectorsCollectionLayout.h>
+
+using namespace BipedalLocomotion::YarpUtilities;
+
+namespace
+{
+// 32 bit FNV-1a hash. It is used to generate the schema version from the metadata
+constexpr std::uint32_t fnvOffsetBasis = 2166136261u;
+constexpr std::uint32_t fnvPrime = 16777619u;
+
+void hashCombine(const void* data, std::size_t size, std::uint32_t& hash)
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= fnvPrime;
+    }
+}
+} // namespace
+
+bool VectorsCollectionLayout::initialize(const VectorsCollectionMetadata& metadata)
+{
+    m_entries.clear();
+    m_handles.clear();
+    m_packedSize = 0;
+
+    std::uint32_t hash = fnvOffsetBasis;
+
+    // the metadata are stored in an ordered map, so the order of the entries is the same on the
+    // server and on the client
+    for (const auto& [key, elements] : metadata.vectors)
+    {
+        Entry entry;
+        entry.key = key;
+        entry.offset = m_packedSize;
+        entry.size = elements.size();
+
+        // the size is hashed as a fixed width integer to be platform independent
+        const std::uint64_t size = entry.size;
+        hashCombine(key.data(), key.size() + 1, hash);
+        hashCombine(&size, sizeof(size), hash);
+
+        m_handles.emplace(key, m_entries.size());
+        m_packedSize += entry.size;
+        m_entries.push_back(std::move(entry));
+    }
+
+    m_schemaVersion = static_cast<std::int32_t>(hash);
+    return true;
+}
+
+bool VectorsCollectionLayout::getHandle(const std::string& key, Handle& handle) const
+{
+    const auto it = m_handles.find(key);
+    if (it == m_handles.end())
+    {
+        return false;
+    }
+
+    handle = it->second;
+    return true;
+}
+
+const std::vector<VectorsCollectionLayout::Entry>& VectorsCollectionLayout::getEntries() const
+{
+    return m_entries;
+}
+
+std::size_t VectorsCollectionLayout::getPackedSize() const
+{
+    return m_packedSize;
+}
+
+std::int32_t VectorsCollectionLayout::getSchemaVersion() const
+{
+    return m_schemaVersion;
+}
+
+bool VectorsCollectionLayout::isCompatible(const PackedVectorsCollection& collection) const
+{
+    return collection.schemaVersion == m_schemaVersion && collection.data.size() == m_packedSize;
+}
+
+iDynTree::Span<const double>
+VectorsCollectionLayout::getVector(const PackedVectorsCollection& collection, Handle handle) const
+{
+    if (handle >= m_entries.size())
+    {
+        return iDynTree::Span<const double>();
+    }
+
+    const auto& entry = m_entries[handle];
+    return iDynTree::Span<const double>(collection.data.data() + entry.offset, entry.size);
+}
+
+iDynTree::Span<const double>
+VectorsCollectionLayout::getVector(iDynTree::Span<const double> data, Handle handle) const
+{
+    if (handle >= m_entries.size())
+    {
+        return iDynTree::Span<const double>();
+    }
+
+    const auto& entry = m_entries[handle];
+    return iDynTree::Span<const double>(data.data() + entry.offset, entry.size);
+}
@@ -11,6 +11,7 @@
 #include <yarp/os/BufferedPort.h>
 #include <yarp/os/Port.h>
 
+#include <algorithm>
 #include <functional>
 #include <optional>
 #include <unordered_set>
@@ -21,6 +22,9 @@ struct VectorsCollectionServer::Impl
 {
     yarp::os::BufferedPort<VectorsCollection> port; /**< Buffered port used to communicate with
                                                             the client. */
+    yarp::os::BufferedPort<PackedVectorsCollection> packedPort; /**< Buffered port used to
+                                                                   communicate with the client if
+                                                                   the data is packed. */
     yarp::os::Port rpcPort; /**< RPC port used to communicate with the client. */
 
     VectorsCollectionMetadata metadata; /**< Metadata of the vectors collection. */
@@ -29,6 +33,18 @@ struct VectorsCollectionServer::Impl
     std::unordered_set<std::string> setOfKeys; /**< Set of keys. */
     std::optional<std::reference_wrapper<VectorsCollection>> collection; /**< Reference to the
                                                                             collection. */
+    std::optional<std::reference_wrapper<PackedVectorsCollection>> packedCollection; /**< Reference
+                                                                                        to the
+                                                                                        packed
+                                                                                        collection. */
+    bool isPacked{false}; /**< True if the data is sent as a PackedVectorsCollection. */
+    VectorsCollectionLayout layout; /**< Layout of the data computed from the metadata. */
+
+    bool isSharedMemory{false}; /**< True if the data is written in shared memory. */
+    int sharedMemoryCapacity{16}; /**< Number of records stored in shared memory. */
+    std::string sharedMemoryName; /**< Name of the shared memory object. */
+    SharedMemoryVectorsCollection sharedMemory; /**< Ring of records stored in shared memory. */
+    iDynTree::Span<double> sharedRecord; /**< Record prepared by prepareData. */
 
     /**
      * Check if the collection is valid.
@@ -39,7 +55,12 @@ struct VectorsCollectionServer::Impl
 
 bool VectorsCollectionServer::Impl::isCollectionValid() const
 {
-    return collection.has_value();
+    if (isSharedMemory)
+    {
+        return !sharedRecord.empty();
+    }
+
+    return isPacked ? packedCollection.has_value() : collection.has_value();
 }
 
 VectorsCollectionServer::VectorsCollectionServer()
@@ -68,11 +89,40 @@ bool VectorsCollectionServer::initialize(
         return false;
     }
 
+    if (!ptr->getParameter("packed", m_pimpl->isPacked))
+    {
+        log()->info("{} The parameter 'packed' is not found. The data will not be packed.",
+                    logPrefix);
+    }
+
+    if (!ptr->getParameter("shared_memory", m_pimpl->isSharedMemory))
+    {
+        log()->info("{} The parameter 'shared_memory' is not found. The data will be sent through "
+                    "a YARP port.",
+                    logPrefix);
+    }
+
     const std::string portName = remote + "/measures:o";
-    if (!m_pimpl->port.open(portName))
+    if (m_pimpl->isSharedMemory)
     {
-        log()->error("{} Unable to open the port named {}.", logPrefix, portName);
-        return false;
+        // the ring is created once the layout is known, i.e., in finalizeMetadata
+        if (ptr->getParameter("shared_memory_capacity", m_pimpl->sharedMemoryCapacity)
+            && m_pimpl->sharedMemoryCapacity < 2)
+        {
+            log()->error("{} The parameter 'shared_memory_capacity' must be at least 2.",
+                         logPrefix);
+            return false;
+        }
+        m_pimpl->sharedMemoryName = SharedMemoryVectorsCollection::getName(portName);
+    } else
+    {
+        const bool portOpened = m_pimpl->isPacked ? m_pimpl->packedPort.open(portName)
+                                                  : m_pimpl->port.open(portName);
+        if (!portOpened)
+        {
+            log()->error("{} Unable to open the port named {}.", logPrefix, portName);
+            return false;
+        }
     }
 
     // open the rpc port
@@ -138,6 +188,26 @@ bool VectorsCollectionServer::finalizeMetadata()
         return false;
     }
 
+    // the layout is used to associate an handle to each key
+    if (!m_pimpl->layout.initialize(m_pimpl->metadata))
+    {
+        log()->error("[VectorsCollectionServer::finalizeMetadata] Unable to compute the layout of "
+                     "the data.");
+        return false;
+    }
+
+    if (m_pimpl->isSharedMemory
+        && !m_pimpl->sharedMemory.create(m_pimpl->sharedMemoryName,
+                                         m_pimpl->layout.getSchemaVersion(),
+                                         m_pimpl->layout.getPackedSize(),
+                                         m_pimpl->sharedMemoryCapacity))
+    {
+        log()->error("[VectorsCollectionServer::finalizeMetadata] Unable to create the shared "
+                     "memory named {}.",
+                     m_pimpl->sharedMemoryName);
+        return false;
+    }
+
     // set the metadata as finalized
     m_pimpl->isMetadataFinalized = true;
 
@@ -146,13 +216,51 @@ bool VectorsCollectionServer::finalizeMetadata()
 
 void VectorsCollectionServer::prepareData()
 {
-    m_pimpl->collection = m_pimpl->port.prepare();
+    if (m_pimpl->isSharedMemory)
+    {
+        // the record is filled directly in the shared memory
+        m_pimpl->sharedRecord = m_pimpl->sharedMemory.beginWrite();
+        return;
+    }
+
+    if (!m_pimpl->isPacked)
+    {
+        m_pimpl->collection = m_pimpl->port.prepare();
+        return;
+    }
+
+    // the buffer is resized only the first time, the previous content of the buffer is kept
+    PackedVectorsCollection& collection = m_pimpl->packedPort.prepare();
+    collection.schemaVersion = m_pimpl->layout.getSchemaVersion();
+    collection.data.resize(m_pimpl->layout.getPackedSize(), 0.0);
+    m_pimpl->packedCollection = collection;
+}
+
+bool VectorsCollectionServer::getHandle(const std::string& key,
+                                        VectorsCollectionLayout::Handle& handle) const
+{
+    constexpr auto logPrefix = "[VectorsCollectionServer::getHandle]";
+
+    // check if the metadata has been finalized
+    if (!m_pimpl->isMetadataFinalized)
+    {
+        log()->error("{} The metadata has not been finalized.", logPrefix);
+        return false;
+    }
+
+    if (!m_pimpl->layout.getHandle(key, handle))
+    {
+        log()->error("{} The key {} does not exist.", logPrefix, key);
+        return false;
+    }
+
+    return true;
 }
 
 bool VectorsCollectionServer::populateData(const std::string& key,
                                            const iDynTree::Span<const double>& data)
 {
-    constexpr auto logPrefix = "[VectorsCollectionServer::setData]";
+    constexpr auto logPrefix = "[VectorsCollectionServer::populateData]";
 
     // check if the metadata has been finalized
     if (!m_pimpl->isMetadataFinalized)
@@ -162,12 +270,35 @@ bool VectorsCollectionServer::populateData(const std::string& key,
     }
 
     // check if the key exists
-    if (m_pimpl->setOfKeys.find(key) == m_pimpl->setOfKeys.end())
+    VectorsCollectionLayout::Handle handle;
+    if (!m_pimpl->layout.getHandle(key, handle))
     {
         log()->error("{} The key {} does not exist.", logPrefix, key);
         return false;
     }
 
+    return this->populateData(handle, data);
+}
+
+bool VectorsCollectionServer::populateData(VectorsCollectionLayout::Handle handle,
+                                           const iDynTree::Span<const double>& data)
+{
+    constexpr auto logPrefix = "[VectorsCollectionServer::populateData]";
+
+    // check if the metadata has been finalized
+    if (!m_pimpl->isMetadataFinalized)
+    {
+        log()->error("{} The metadata has not been finalized.", logPrefix);
+        return false;
+    }
+
+    const auto& entries = m_pimpl->layout.getEntries();
+    if (handle >= entries.size())
+    {
+        log()->error("{} The handle {} is not valid.", logPrefix, handle);
+        return false;
+    }
+
     if (!m_pimpl->isCollectionValid())
     {
         log()->error("{} The data collection is not valid. Please call prepareData before "
@@ -176,13 +307,53 @@ bool VectorsCollectionServer::populateData(const std::string& key,
         return false;
     }
 
-    m_pimpl->collection.value().get().vectors[key].assign(data.begin(), data.end());
+    const auto& entry = entries[handle];
+    if (!m_pimpl->isPacked && !m_pimpl->isSharedMemory)
+    {
+        m_pimpl->collection.value().get().vectors[entry.key].assign(data.begin(), data.end());
+        return true;
+    }
+
+    if (static_cast<std::size_t>(data.size()) != entry.size)
+    {
+        log()->error("{} The size of the data associated to the key {} is {}, while the size of "
+                     "its metadata is {}.",
+                     logPrefix,
+                     entry.key,
+                     data.size(),
+                     entry.size);
+        return false;
+    }
+
+    if (m_pimpl->isSharedMemory)
+    {
+        std::copy(data.begin(), data.end(), m_pimpl->sharedRecord.begin() + entry.offset);
+        return true;
+    }
+
+    std::copy(data.begin(),
+              data.end(),
+              m_pimpl->packedCollection.value().get().data.begin() + entry.offset);
 
     return true;
 }
 
 void VectorsCollectionServer::sendData(bool forceStrict /*= false */)
 {
+    if (m_pimpl->isSharedMemory)
+    {
+        // the readers never block the writer, hence forceStrict is not used
+        m_pimpl->sharedMemory.endWrite();
+        m_pimpl->sharedRecord = iDynTree::Span<double>();
+        return;
+    }
+
+    if (m_pimpl->isPacked)
+    {
+        m_pimpl->packedPort.write(forceStrict);
+        return;
+    }
+
     m_pimpl->port.write(forceStrict);
 }
 
@@ -196,6 +367,12 @@ bool VectorsCollectionServer::clearData()
         return false;
     }
 
+    // the size of the packed data is fixed by the metadata
+    if (m_pimpl->isPacked || m_pimpl->isSharedMemory)
+    {
+        return true;
+    }
+
     m_pimpl->collection.value().get().vectors.clear();
     return true;
 }
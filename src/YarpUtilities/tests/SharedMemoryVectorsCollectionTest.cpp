@@ -0,0 +1,129 @@
+/**
+ * @file SharedMemoryVectorsCollectionTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/YarpUtilities/SharedMemoryVectorsCollection.h>
+
+using namespace BipedalLocomotion::YarpUtilities;
+
+TEST_CASE("Shared memory vectors collection")
+{
+    constexpr std::size_t recordSize = 5;
+    constexpr std::size_t capacity = 4;
+    constexpr std::int32_t schemaVersion = 42;
+
+    // a random suffix avoids conflicts with the tests running in parallel
+    const std::string suffix = std::to_string(std::random_device()());
+    const std::string name = SharedMemoryVectorsCollection::getName("/test/shared_memory/"
+                                                                    + suffix);
+    REQUIRE(name == "/blf_test_shared_memory_" + suffix);
+
+    SharedMemoryVectorsCollection writer;
+    REQUIRE(writer.create(name, schemaVersion, recordSize, capacity));
+
+    SharedMemoryVectorsCollection reader;
+    REQUIRE(reader.open(name));
+    REQUIRE(reader.getSchemaVersion() == schemaVersion);
+    REQUIRE(reader.getRecordSize() == recordSize);
+    REQUIRE(reader.getCapacity() == capacity);
+    REQUIRE(reader.read(false).empty());
+
+    auto write = [&](double value) {
+        auto record = writer.beginWrite();
+        REQUIRE(record.size() == recordSize);
+        record[0] = value;
+        writer.endWrite();
+    };
+
+    SECTION("Read in order")
+    {
+        // the first record is filled, the following ones keep the previous values
+        auto record = writer.beginWrite();
+        std::fill(record.begin(), record.end(), 1.0);
+        writer.endWrite();
+        write(2.0);
+
+        auto data = reader.read(false);
+        REQUIRE(data.size() == recordSize);
+        REQUIRE(data[0] == 1.0);
+        REQUIRE(reader.isLastReadValid());
+
+        data = reader.read(false);
+        REQUIRE(data[0] == 2.0);
+        REQUIRE(data[recordSize - 1] == 1.0);
+        REQUIRE(reader.read(false).empty());
+        REQUIRE(reader.getLostRecords() == 0);
+    }
+
+    SECTION("Slow reader")
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            write(i);
+        }
+
+        // only capacity - 1 records are available
+        for (int i = 10 - static_cast<int>(capacity - 1); i < 10; i++)
+        {
+            auto data = reader.read(false);
+            REQUIRE(data[0] == i);
+        }
+        REQUIRE(reader.getLostRecords() == 10 - (capacity - 1));
+
+        // the record is overwritten while it is used
+        write(10.0);
+        auto data = reader.read(false);
+        REQUIRE(data[0] == 10.0);
+        for (std::size_t i = 0; i < capacity; i++)
+        {
+            write(11.0 + i);
+        }
+        REQUIRE_FALSE(reader.isLastReadValid());
+    }
+
+    SECTION("Late reader")
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            write(i);
+        }
+
+        // a reader opened later starts from the oldest record available
+        SharedMemoryVectorsCollection lateReader;
+        REQUIRE(lateReader.open(name));
+        REQUIRE(lateReader.read(false)[0] == 10 - static_cast<int>(capacity - 1));
+    }
+
+    SECTION("Writer restarted")
+    {
+        write(1.0);
+        REQUIRE_FALSE(reader.isStale());
+
+        // the new writer replaces the object without changing the one mapped by the reader
+        SharedMemoryVectorsCollection newWriter;
+        REQUIRE(newWriter.create(name, schemaVersion, recordSize, capacity));
+        REQUIRE(newWriter.getGeneration() != writer.getGeneration());
+        REQUIRE(reader.isStale());
+        REQUIRE(reader.read(false)[0] == 1.0);
+
+        // the old writer does not remove the new object
+        writer.close();
+        REQUIRE(reader.open(name));
+        REQUIRE_FALSE(reader.isStale());
+        REQUIRE(reader.getGeneration() == newWriter.getGeneration());
+        REQUIRE(reader.read(false).empty());
+    }
+
+    writer.close();
+    SharedMemoryVectorsCollection closedReader;
+    REQUIRE_FALSE(closedReader.open(name));
+}
@@ -0,0 +1,113 @@
+/**
+ * @file VectorsCollectionLayoutTest.cpp
+ * @copyright 2024 Istituto Italiano di Tecnologia (IIT). This software may be modified and
+ * distributed under the terms of the BSD-3-Clause license.
+ */
+
+#include <numeric>
+#include <string>
+
+// Catch2
+#include <catch2/catch_test_macros.hpp>
+
+#include <BipedalLocomotion/YarpUtilities/VectorsCollectionLayout.h>
+
+using namespace BipedalLocomotion::YarpUtilities;
+
+TEST_CASE("Vectors collection layout")
+{
+    VectorsCollectionMetadata metadata;
+    metadata.vectors["joints"] = {"j0", "j1", "j2"};
+    metadata.vectors["base"] = {"x", "y"};
+    metadata.vectors["time"] = {"t"};
+
+    VectorsCollectionLayout layout;
+    REQUIRE(layout.initialize(metadata));
+    REQUIRE(layout.getPackedSize() == 6);
+
+    SECTION("Handles and offsets")
+    {
+        // the entries are sorted by key
+        const auto& entries = layout.getEntries();
+        REQUIRE(entries.size() == 3);
+
+        VectorsCollectionLayout::Handle handle;
+        REQUIRE(layout.getHandle("base", handle));
+        REQUIRE(handle == 0);
+        REQUIRE(entries[handle].key == "base");
+        REQUIRE(entries[handle].offset == 0);
+        REQUIRE(entries[handle].size == 2);
+
+        REQUIRE(layout.getHandle("joints", handle));
+        REQUIRE(handle == 1);
+        REQUIRE(entries[handle].offset == 2);
+        REQUIRE(entries[handle].size == 3);
+
+        REQUIRE(layout.getHandle("time", handle));
+        REQUIRE(handle == 2);
+        REQUIRE(entries[handle].offset == 5);
+        REQUIRE(entries[handle].size == 1);
+
+        REQUIRE_FALSE(layout.getHandle("unknown", handle));
+    }
+
+    SECTION("Access the data")
+    {
+        PackedVectorsCollection collection;
+        collection.schemaVersion = layout.getSchemaVersion();
+        collection.data.resize(layout.getPackedSize());
+        std::iota(collection.data.begin(), collection.data.end(), 0.0);
+        REQUIRE(layout.isCompatible(collection));
+
+        VectorsCollectionLayout::Handle handle;
+        REQUIRE(layout.getHandle("joints", handle));
+        const auto joints = layout.getVector(collection, handle);
+        REQUIRE(joints.size() == 3);
+        REQUIRE(joints[0] == 2.0);
+        REQUIRE(joints[2] == 4.0);
+
+        // the same layout is used to interpret a raw record
+        const iDynTree::Span<const double> record(collection.data.data(), collection.data.size());
+        REQUIRE(layout.getHandle("time", handle));
+        const auto time = layout.getVector(record, handle);
+        REQUIRE(time.size() == 1);
+        REQUIRE(time[0] == 5.0);
+
+        REQUIRE(layout.getVector(collection, 3).size() == 0);
+        REQUIRE(layout.getVector(record, 3).size() == 0);
+
+        collection.data.pop_back();
+        REQUIRE_FALSE(layout.isCompatible(collection));
+        collection.data.push_back(5.0);
+        collection.schemaVersion++;
+        REQUIRE_FALSE(layout.isCompatible(collection));
+    }
+
+    SECTION("Schema version")
+    {
+        // the schema depends only on the keys and on the sizes of the vectors
+        VectorsCollectionLayout sameLayout;
+        metadata.vectors["joints"] = {"hip", "knee", "ankle"};
+        REQUIRE(sameLayout.initialize(metadata));
+        REQUIRE(sameLayout.getSchemaVersion() == layout.getSchemaVersion());
+
+        VectorsCollectionLayout resizedLayout;
+        metadata.vectors["joints"].push_back("toe");
+        REQUIRE(resizedLayout.initialize(metadata));
+        REQUIRE(resizedLayout.getSchemaVersion() != layout.getSchemaVersion());
+        REQUIRE(resizedLayout.getPackedSize() == 7);
+
+        VectorsCollectionLayout renamedLayout;
+        metadata.vectors.erase("joints");
+        metadata.vectors["joint"] = {"j0", "j1", "j2"};
+        REQUIRE(renamedLayout.initialize(metadata));
+        REQUIRE(renamedLayout.getSchemaVersion() != layout.getSchemaVersion());
+
+        // the layout is computed again when it is initialized with new metadata
+        REQUIRE(layout.initialize(metadata));
+        REQUIRE(layout.getSchemaVersion() == renamedLayout.getSchemaVersion());
+        VectorsCollectionLayout::Handle handle;
+        REQUIRE_FALSE(layout.getHandle("joints", handle));
+        REQUIRE(layout.getHandle("joint", handle));
+    }
+}
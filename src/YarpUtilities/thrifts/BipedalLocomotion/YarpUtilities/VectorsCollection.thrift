@@ -5,6 +5,18 @@ struct VectorsCollection
     1: map<string, list<double>> vectors;
 }
 
+/**
+ * Packed representation of a VectorsCollection. The vectors are stored contiguously, sorted by
+ * key, and each vector has the size of the corresponding entry of the VectorsCollectionMetadata.
+ * The schemaVersion is computed from the metadata and allows the client to check that its layout
+ * matches the one of the server.
+ */
+struct PackedVectorsCollection
+{
+    1: i32 schemaVersion;
+    2: list<double> data;
+}
+
 struct VectorsCollectionMetadata
 {
     1: map<string, list<string>> vectors;